@@ -82,6 +82,7 @@ namespace SIMPL
   namespace TypeNames
   {
     const QString Bool("bool");
+    const QString BitMask("BitMask");
     const QString Float("float");
     const QString Double("double");
     const QString Int8("int8_t");
@@ -601,6 +602,7 @@ namespace SIMPL
     const QString TetVolumes("TetrahedralVolumes");
 
     const QString VoxelSizes("VoxelSizes");
+    const QString VoxelCentroids("VoxelCentroids");
     const QString VertexSizes("VertexSizes");
 
     const QString GBCD("GBCD");
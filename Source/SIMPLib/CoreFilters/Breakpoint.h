@@ -36,6 +36,7 @@
 #ifndef _breakpoint_h_
 #define _breakpoint_h_
 
+#include <QtCore/QMutex>
 #include <QtCore/QWaitCondition>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -41,6 +41,7 @@
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Math/DataArrayReductions.hpp"
 #include "SIMPLib/SIMPLibVersion.h"
 
 /**
@@ -100,19 +101,13 @@ public:
         {
           arrayOffset += inputIDataArrays[i - 1].lock()->getNumberOfComponents();
         }
-        for(size_t j = 0; j < numTuples; j++)
+        std::vector<DataType> arrayMins;
+        std::vector<DataType> arrayMaxs;
+        DataArrayReductions<DataType>::ComponentMinMax(inputArrays[i], numTuples, numDims, arrayMins, arrayMaxs);
+        for(int32_t k = 0; k < numDims; k++)
         {
-          for(int32_t k = 0; k < numDims; k++)
-          {
-            if(inputArrays[i][numDims * j + k] > maxVals[arrayOffset + k])
-            {
-              maxVals[arrayOffset + k] = inputArrays[i][numDims * j + k];
-            }
-            if(inputArrays[i][numDims * j + k] < minVals[arrayOffset + k])
-            {
-              minVals[arrayOffset + k] = inputArrays[i][numDims * j + k];
-            }
-          }
+          maxVals[arrayOffset + k] = arrayMaxs[k];
+          minVals[arrayOffset + k] = arrayMins[k];
         }
       }
 
@@ -35,11 +35,22 @@
 
 #include "ConditionalSetValue.h"
 
+#include <memory>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.hpp"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
+#include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
 // -----------------------------------------------------------------------------
@@ -48,6 +59,7 @@
 ConditionalSetValue::ConditionalSetValue()
 : m_SelectedArrayPath("", "", "")
 , m_ConditionalArrayPath("", "", "")
+, m_AdditionalArrayPaths(QVector<DataArrayPath>())
 , m_ReplaceValue(0.0)
 //, m_Array(nullptr)
 , m_ConditionalArray(nullptr)
@@ -68,12 +80,18 @@ void ConditionalSetValue::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("New Value", ReplaceValue, FilterParameter::Parameter, ConditionalSetValue));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Category::Any);
+    req.daTypes.push_back(SIMPL::TypeNames::BitMask);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Conditional Array", ConditionalArrayPath, FilterParameter::RequiredArray, ConditionalSetValue, req));
   }
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Category::Any);
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array", SelectedArrayPath, FilterParameter::RequiredArray, ConditionalSetValue, req));
   }
+  {
+    MultiDataArraySelectionFilterParameter::RequirementType req =
+        MultiDataArraySelectionFilterParameter::CreateCategoryRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Category::Any);
+    parameters.push_back(SIMPL_NEW_MDA_SELECTION_FP("Additional Attribute Arrays", AdditionalArrayPaths, FilterParameter::RequiredArray, ConditionalSetValue, req));
+  }
   setFilterParameters(parameters);
 }
 
@@ -85,6 +103,7 @@ void ConditionalSetValue::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setConditionalArrayPath(reader->readDataArrayPath("ConditionalArrayPath", getConditionalArrayPath()));
   setSelectedArrayPath(reader->readDataArrayPath("SelectedArrayPath", getSelectedArrayPath()));
+  setAdditionalArrayPaths(reader->readDataArrayPathVector("AdditionalArrayPaths", getAdditionalArrayPaths()));
   setReplaceValue(reader->readValue("ReplaceValue", getReplaceValue()));
   reader->closeFilterGroup();
 }
@@ -120,28 +139,192 @@ template <typename T> void checkValuesFloatDouble(AbstractFilter* filter, double
   }
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
+namespace
+{
+// Number of tuples processed per block. A block of the mask stays in cache while
+// every selected array consumes it, so the mask is only streamed from memory once.
+const size_t k_BlockSize = 4096;
+
+/**
+ * @brief The ReplaceTarget class is the type erased view of one array that the
+ * conditional mask is applied to.
+ */
+class ReplaceTarget
+{
+public:
+  virtual ~ReplaceTarget() = default;
+
+  virtual void replace(size_t start, size_t end, const bool* mask) const = 0;
+  virtual void replace(size_t start, size_t end, const BitMaskArray::Word* words) const = 0;
+};
 
-template <typename T> void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, BoolArrayType::Pointer condDataPtr, double replaceValue)
+template <typename T> class ReplaceTargetImpl : public ReplaceTarget
 {
-  typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
+public:
+  ReplaceTargetImpl(T* data, T value)
+  : m_Data(data)
+  , m_Value(value)
+  {
+  }
+  ~ReplaceTargetImpl() override = default;
 
-  T replaceVal = static_cast<T>(replaceValue);
+  void replace(size_t start, size_t end, const bool* mask) const override
+  {
+    T* data = m_Data;
+    const T value = m_Value;
+    // Always storing the selected value keeps the loop branch free so the compiler can vectorize it
+    for(size_t i = start; i < end; i++)
+    {
+      data[i] = mask[i] ? value : data[i];
+    }
+  }
 
-  T* inData = inputArrayPtr->getPointer(0);
-  bool* condData = condDataPtr->getPointer(0);
-  size_t numTuples = inputArrayPtr->getNumberOfTuples();
+  void replace(size_t start, size_t end, const BitMaskArray::Word* words) const override
+  {
+    T* data = m_Data;
+    const T value = m_Value;
+    size_t i = start;
+    while(i < end)
+    {
+      size_t wordIndex = i / BitMaskArray::k_BitsPerWord;
+      BitMaskArray::Word word = words[wordIndex];
+      size_t wordEnd = (wordIndex + 1) * BitMaskArray::k_BitsPerWord;
+      wordEnd = (wordEnd > end) ? end : wordEnd;
+      // Whole words without a set bit are skipped, which makes sparse masks cheap to apply
+      if(word == 0)
+      {
+        i = wordEnd;
+        continue;
+      }
+      for(; i < wordEnd; i++)
+      {
+        data[i] = ((word >> (i % BitMaskArray::k_BitsPerWord)) & 1) ? value : data[i];
+      }
+    }
+  }
+
+private:
+  T* m_Data;
+  T m_Value;
+};
+
+/**
+ * @brief The BitMaskReplaceTarget class sets or clears the bits of a packed mask. Blocks start on a
+ * word boundary, so concurrent blocks never write to the same word.
+ */
+class BitMaskReplaceTarget : public ReplaceTarget
+{
+public:
+  BitMaskReplaceTarget(BitMaskArray::Word* data, bool value)
+  : m_Data(data)
+  , m_Value(value)
+  {
+  }
+  ~BitMaskReplaceTarget() override = default;
 
-  for(size_t iter = 0; iter < numTuples; iter++)
+  void replace(size_t start, size_t end, const bool* mask) const override
   {
-    if(condData[iter] == true)
+    for(size_t i = start; i < end; i += BitMaskArray::k_BitsPerWord)
     {
-      inData[iter] = replaceVal;
+      size_t numBits = end - i;
+      numBits = (numBits > BitMaskArray::k_BitsPerWord) ? BitMaskArray::k_BitsPerWord : numBits;
+      BitMaskArray::Word word = 0;
+      for(size_t b = 0; b < numBits; b++)
+      {
+        word |= static_cast<BitMaskArray::Word>(mask[i + b]) << b;
+      }
+      apply(i / BitMaskArray::k_BitsPerWord, word);
     }
   }
+
+  void replace(size_t start, size_t end, const BitMaskArray::Word* words) const override
+  {
+    // Bits past the last tuple are always cleared in the conditional mask, so whole words can be used
+    for(size_t w = start / BitMaskArray::k_BitsPerWord; w * BitMaskArray::k_BitsPerWord < end; w++)
+    {
+      apply(w, words[w]);
+    }
+  }
+
+private:
+  void apply(size_t wordIndex, BitMaskArray::Word selected) const
+  {
+    BitMaskArray::Word& word = m_Data[wordIndex];
+    word = m_Value ? (word | selected) : (word & ~selected);
+  }
+
+  BitMaskArray::Word* m_Data;
+  bool m_Value;
+};
+
+using ReplaceTargets = std::vector<std::shared_ptr<ReplaceTarget>>;
+
+/**
+ * @brief addReplaceTarget Wraps the selected array in a typed ReplaceTarget
+ */
+template <typename T> void addReplaceTarget(IDataArray::Pointer inDataPtr, double replaceValue, ReplaceTargets& targets)
+{
+  typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
+  targets.push_back(std::shared_ptr<ReplaceTarget>(new ReplaceTargetImpl<T>(inputArrayPtr->getPointer(0), static_cast<T>(replaceValue))));
 }
+}
+
+/**
+ * @brief The ConditionalSetValueImpl class applies one mask to every target array,
+ * block by block, so each block of the mask is read once regardless of the number
+ * of arrays.
+ */
+class ConditionalSetValueImpl
+{
+public:
+  ConditionalSetValueImpl(const ReplaceTargets& targets, const bool* mask, const BitMaskArray::Word* words, size_t numTuples)
+  : m_Targets(targets)
+  , m_Mask(mask)
+  , m_Words(words)
+  , m_NumTuples(numTuples)
+  {
+  }
+  virtual ~ConditionalSetValueImpl() = default;
+
+  static size_t NumberOfBlocks(size_t numTuples)
+  {
+    return (numTuples + k_BlockSize - 1) / k_BlockSize;
+  }
+
+  void replace(size_t startBlock, size_t endBlock) const
+  {
+    for(size_t block = startBlock; block < endBlock; block++)
+    {
+      size_t start = block * k_BlockSize;
+      size_t end = start + k_BlockSize;
+      end = (end > m_NumTuples) ? m_NumTuples : end;
+      for(const auto& target : m_Targets)
+      {
+        if(nullptr != m_Words)
+        {
+          target->replace(start, end, m_Words);
+        }
+        else
+        {
+          target->replace(start, end, m_Mask);
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    replace(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const ReplaceTargets& m_Targets;
+  const bool* m_Mask;
+  const BitMaskArray::Word* m_Words;
+  size_t m_NumTuples;
+};
 
 // -----------------------------------------------------------------------------
 //
@@ -170,23 +353,42 @@ void ConditionalSetValue::dataCheck()
     dataArrayPaths.push_back(getSelectedArrayPath());
   }
 
-  if(m_ArrayPtr.lock()->getNumberOfComponents() > 1)
+  if(!checkNumberOfComponents(getSelectedArrayPath(), m_ArrayPtr.lock()))
   {
-    QString ss = QObject::tr("Selected array '%1' must be a scalar array (1 component). The number of components is %2")
-                     .arg(getSelectedArrayPath().getDataArrayName())
-                     .arg(m_ArrayPtr.lock()->getNumberOfComponents());
-    setErrorCondition(-11002);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
 
+  // Every additional array is replaced in the same pass over the conditional array
+  m_AdditionalArrayPtrs.clear();
+  for(const DataArrayPath& path : getAdditionalArrayPaths())
+  {
+    IDataArray::Pointer arrayPtr = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, path);
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+    if(!checkNumberOfComponents(path, arrayPtr))
+    {
+      return;
+    }
+    m_AdditionalArrayPtrs.push_back(arrayPtr);
+    dataArrayPaths.push_back(path);
+  }
+
   QVector<size_t> cDims(1, 1);
-  m_ConditionalArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getConditionalArrayPath(),
-                                                                                                           cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
-  if(nullptr != m_ConditionalArrayPtr.lock())                                                                      /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+  // A packed mask is used as is, anything else must be a DataArray<bool>
+  m_ConditionalArray = nullptr;
+  m_ConditionalArrayPtr.reset();
+  m_ConditionalBitMaskPtr = getDataContainerArray()->getPrereqArrayFromPath<BitMaskArray, AbstractFilter>(nullptr, getConditionalArrayPath(), cDims);
+  if(nullptr == m_ConditionalBitMaskPtr.lock())
   {
-    m_ConditionalArray = m_ConditionalArrayPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
+    m_ConditionalArrayPtr = getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getConditionalArrayPath(),
+                                                                                                             cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+    if(nullptr != m_ConditionalArrayPtr.lock())                                                                      /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+    {
+      m_ConditionalArray = m_ConditionalArrayPtr.lock()->getPointer(0);
+    } /* Now assign the raw pointer to data from the DataArray<T> object */
+  }
   if(getErrorCondition() >= 0)
   {
     dataArrayPaths.push_back(getConditionalArrayPath());
@@ -194,7 +396,34 @@ void ConditionalSetValue::dataCheck()
 
   getDataContainerArray()->validateNumberOfTuples<AbstractFilter>(this, dataArrayPaths);
 
-  QString dType = m_ArrayPtr.lock()->getTypeAsString();
+  checkReplaceValue(m_ArrayPtr.lock());
+  for(const IDataArray::WeakPointer& arrayPtr : m_AdditionalArrayPtrs)
+  {
+    checkReplaceValue(arrayPtr.lock());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ConditionalSetValue::checkNumberOfComponents(const DataArrayPath& path, const IDataArray::Pointer& arrayPtr)
+{
+  if(arrayPtr->getNumberOfComponents() > 1)
+  {
+    QString ss = QObject::tr("Selected array '%1' must be a scalar array (1 component). The number of components is %2").arg(path.getDataArrayName()).arg(arrayPtr->getNumberOfComponents());
+    setErrorCondition(-11002);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return false;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ConditionalSetValue::checkReplaceValue(const IDataArray::Pointer& arrayPtr)
+{
+  QString dType = arrayPtr->getTypeAsString();
   if(dType.compare(SIMPL::TypeNames::Int8) == 0)
   {
     checkValuesInt<int8_t>(this, m_ReplaceValue, SIMPL::TypeNames::Int8);
@@ -235,12 +464,9 @@ void ConditionalSetValue::dataCheck()
   {
     checkValuesFloatDouble<double>(this, m_ReplaceValue, SIMPL::TypeNames::Double);
   }
-  else if(dType.compare(SIMPL::TypeNames::Bool) == 0)
+  else if(dType.compare(SIMPL::TypeNames::Bool) == 0 || dType.compare(SIMPL::TypeNames::BitMask) == 0)
   {
-    if(m_ReplaceValue != 0.0)
-    {
-      m_ReplaceValue = 1.0; // anything that is not a zero is a one
-    }
+    // anything that is not a zero is converted to true when the value is applied
   }
   else
   {
@@ -276,7 +502,46 @@ void ConditionalSetValue::execute()
     return;
   }
 
-  EXECUTE_FUNCTION_TEMPLATE(this, replaceValue, m_ArrayPtr.lock(), this, m_ArrayPtr.lock(), m_ConditionalArrayPtr.lock(), m_ReplaceValue)
+  QVector<IDataArray::Pointer> arrays;
+  arrays.push_back(m_ArrayPtr.lock());
+  for(const IDataArray::WeakPointer& arrayPtr : m_AdditionalArrayPtrs)
+  {
+    arrays.push_back(arrayPtr.lock());
+  }
+
+  ReplaceTargets targets;
+  for(const IDataArray::Pointer& arrayPtr : arrays)
+  {
+    BitMaskArray::Pointer maskPtr = std::dynamic_pointer_cast<BitMaskArray>(arrayPtr);
+    if(nullptr != maskPtr)
+    {
+      targets.push_back(std::shared_ptr<ReplaceTarget>(new BitMaskReplaceTarget(maskPtr->getWords(), m_ReplaceValue != 0.0)));
+      continue;
+    }
+    EXECUTE_FUNCTION_TEMPLATE(this, addReplaceTarget, arrayPtr, arrayPtr, m_ReplaceValue, targets)
+  }
+
+  BitMaskArray::Pointer bitMask = m_ConditionalBitMaskPtr.lock();
+  const BitMaskArray::Word* words = (nullptr != bitMask) ? bitMask->getWords() : nullptr;
+  size_t numTuples = m_ArrayPtr.lock()->getNumberOfTuples();
+  size_t numBlocks = ConditionalSetValueImpl::NumberOfBlocks(numTuples);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks), ConditionalSetValueImpl(targets, m_ConditionalArray, words, numTuples), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ConditionalSetValueImpl serial(targets, m_ConditionalArray, words, numTuples);
+    serial.replace(0, numBlocks);
+  }
 
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
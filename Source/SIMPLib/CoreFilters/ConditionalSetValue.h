@@ -38,6 +38,7 @@
 #define _conditionalsetvalue_h_
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/BitMaskArray.hpp"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -61,6 +62,9 @@ class SIMPLib_EXPORT ConditionalSetValue : public AbstractFilter
     SIMPL_FILTER_PARAMETER(DataArrayPath, ConditionalArrayPath)
     Q_PROPERTY(DataArrayPath ConditionalArrayPath READ getConditionalArrayPath WRITE setConditionalArrayPath)
 
+    SIMPL_FILTER_PARAMETER(QVector<DataArrayPath>, AdditionalArrayPaths)
+    Q_PROPERTY(QVector<DataArrayPath> AdditionalArrayPaths READ getAdditionalArrayPaths WRITE setAdditionalArrayPaths)
+
     SIMPL_FILTER_PARAMETER(double, ReplaceValue)
     Q_PROPERTY(double ReplaceValue READ getReplaceValue WRITE setReplaceValue)
 
@@ -164,10 +168,25 @@ class SIMPLib_EXPORT ConditionalSetValue : public AbstractFilter
      */
     void initialize();
 
+    /**
+     * @brief checkNumberOfComponents Ensures the array at the given path is a scalar array
+     * @param path Path of the array, used for the error message
+     * @param arrayPtr Array to check
+     * @return False if an error was set
+     */
+    bool checkNumberOfComponents(const DataArrayPath& path, const IDataArray::Pointer& arrayPtr);
+
+    /**
+     * @brief checkReplaceValue Ensures the replace value is representable in the type of the given array
+     * @param arrayPtr Array that will receive the replace value
+     */
+    void checkReplaceValue(const IDataArray::Pointer& arrayPtr);
 
   private:
     IDataArray::WeakPointer m_ArrayPtr;
+    QVector<IDataArray::WeakPointer> m_AdditionalArrayPtrs;
     DEFINE_DATAARRAY_VARIABLE(bool, ConditionalArray)
+    std::weak_ptr<BitMaskArray> m_ConditionalBitMaskPtr;
 
   public:
     ConditionalSetValue(const ConditionalSetValue&) = delete; // Copy Constructor Not Implemented
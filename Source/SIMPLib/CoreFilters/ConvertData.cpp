@@ -35,10 +35,24 @@
 
 #include "ConvertData.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/NumericTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -47,130 +61,300 @@
 #define CHECK_AND_CONVERT(Type, DataContainer, ScalarType, Array, AttributeMatrixName, OutputName)                                                                                                     \
   if(false == completed)                                                                                                                                                                               \
   {                                                                                                                                                                                                    \
-    Type::Pointer Type##Ptr = std::dynamic_pointer_cast<Type>(Array);                                                                                                                                  \
+    DataArray<Type>::Pointer Type##Ptr = std::dynamic_pointer_cast<DataArray<Type>>(Array);                                                                                                            \
     if(nullptr != Type##Ptr)                                                                                                                                                                           \
     {                                                                                                                                                                                                  \
-      QVector<size_t> dims = Array->getComponentDimensions();                                                                                                                                          \
-      Detail::ConvertData<Type>(this, Type##Ptr.get(), dims, DataContainer, ScalarType, AttributeMatrixName, OutputName);                                                                              \
+      Detail::ConvertData<Type>(this, Type##Ptr, DataContainer, ScalarType, AttributeMatrixName, OutputName);                                                                                         \
       completed = true;                                                                                                                                                                                \
     }                                                                                                                                                                                                  \
   }
 
 namespace Detail
 {
-template <typename T>
+// Number of elements that are staged through a temporary buffer per step of an in place conversion
+static const size_t k_InPlaceBlockSize = 1024 * 1024;
+
+/**
+ * @brief The ClampedCast struct converts a single value to the target type, clamping values that are
+ * outside of the range of the target type to the closest representable value. The specializations are
+ * written as selects without data dependent branches so that the conversion loops can be vectorized.
+ * This is the integer to integer version.
+ */
+template <typename TIn, typename TOut, typename Enable = void> struct ClampedCast
+{
+  static inline TOut Convert(TIn v)
+  {
+    // Intersection of the two ranges, expressed in the source type
+    const TIn lo = (std::numeric_limits<TIn>::is_signed && std::numeric_limits<TOut>::is_signed)
+                       ? ((static_cast<intmax_t>(std::numeric_limits<TOut>::min()) > static_cast<intmax_t>(std::numeric_limits<TIn>::min())) ? static_cast<TIn>(std::numeric_limits<TOut>::min())
+                                                                                                                                           : std::numeric_limits<TIn>::min())
+                       : static_cast<TIn>(0);
+    const TIn hi = (static_cast<uintmax_t>(std::numeric_limits<TOut>::max()) < static_cast<uintmax_t>(std::numeric_limits<TIn>::max())) ? static_cast<TIn>(std::numeric_limits<TOut>::max())
+                                                                                                                                     : std::numeric_limits<TIn>::max();
+    return static_cast<TOut>(v < lo ? lo : (v > hi ? hi : v));
+  }
+};
+
+/**
+ * @brief Floating point to integer: NaN values are converted to zero.
+ */
+template <typename TIn, typename TOut>
+struct ClampedCast<TIn, TOut, typename std::enable_if<std::is_floating_point<TIn>::value && std::is_integral<TOut>::value && !std::is_same<TOut, bool>::value>::type>
+{
+  static inline TOut Convert(TIn v)
+  {
+    // The upper bound may round up to the next power of two, which is why it is only used as an exclusive limit
+    const TIn lo = static_cast<TIn>(std::numeric_limits<TOut>::min());
+    const TIn hi = static_cast<TIn>(std::numeric_limits<TOut>::max());
+    return (v >= hi) ? std::numeric_limits<TOut>::max() : ((v > lo) ? static_cast<TOut>(v) : ((v <= lo) ? std::numeric_limits<TOut>::min() : static_cast<TOut>(0)));
+  }
+};
+
+/**
+ * @brief Narrowing floating point conversion (double to float).
+ */
+template <typename TIn, typename TOut>
+struct ClampedCast<TIn, TOut, typename std::enable_if<std::is_floating_point<TIn>::value && std::is_floating_point<TOut>::value && (sizeof(TOut) < sizeof(TIn))>::type>
+{
+  static inline TOut Convert(TIn v)
+  {
+    const TIn lo = static_cast<TIn>(std::numeric_limits<TOut>::lowest());
+    const TIn hi = static_cast<TIn>(std::numeric_limits<TOut>::max());
+    return static_cast<TOut>(v < lo ? lo : (v > hi ? hi : v));
+  }
+};
+
+/**
+ * @brief Widening floating point conversion: every value fits.
+ */
+template <typename TIn, typename TOut>
+struct ClampedCast<TIn, TOut, typename std::enable_if<std::is_floating_point<TIn>::value && std::is_floating_point<TOut>::value && (sizeof(TOut) >= sizeof(TIn))>::type>
+{
+  static inline TOut Convert(TIn v)
+  {
+    return static_cast<TOut>(v);
+  }
+};
+
+/**
+ * @brief Integer to floating point: every integer value is inside the range of float and double.
+ */
+template <typename TIn, typename TOut> struct ClampedCast<TIn, TOut, typename std::enable_if<std::is_integral<TIn>::value && std::is_floating_point<TOut>::value>::type>
+{
+  static inline TOut Convert(TIn v)
+  {
+    return static_cast<TOut>(v);
+  }
+};
+
+/**
+ * @brief Anything to bool: every non-zero value is true.
+ */
+template <typename TIn> struct ClampedCast<TIn, bool, typename std::enable_if<!std::is_same<TIn, bool>::value>::type>
+{
+  static inline bool Convert(TIn v)
+  {
+    return v != static_cast<TIn>(0);
+  }
+};
+
+/**
+ * @brief The ConvertDataImpl class implements a threaded algorithm that converts a contiguous range of
+ * values from one primitive type to another. The loops work on raw pointers so that the compiler is
+ * able to vectorize them.
+ */
+template <typename TIn, typename TOut> class ConvertDataImpl
+{
+public:
+  ConvertDataImpl(const TIn* src, TOut* dest, bool clamp)
+  : m_Src(src)
+  , m_Dest(dest)
+  , m_Clamp(clamp)
+  {
+  }
+  virtual ~ConvertDataImpl() = default;
+
+  void convert(size_t start, size_t end) const
+  {
+    const TIn* src = m_Src;
+    TOut* dest = m_Dest;
+    if(m_Clamp)
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        dest[i] = ClampedCast<TIn, TOut>::Convert(src[i]);
+      }
+    }
+    else
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        dest[i] = static_cast<TOut>(src[i]);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const TIn* m_Src;
+  TOut* m_Dest;
+  bool m_Clamp;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename TIn, typename TOut> void RunConversion(const TIn* src, TOut* dest, size_t numElements, bool clamp)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numElements), ConvertDataImpl<TIn, TOut>(src, dest, clamp), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ConvertDataImpl<TIn, TOut> serial(src, dest, clamp);
+    serial.convert(0, numElements);
+  }
+}
+
+/**
+ * @brief ConvertArray Converts the source array into a new array of type TOut. In place conversions reuse the
+ * memory of the source array when the array owns it and the target type is not larger than the source type: the
+ * values are converted block by block into a small staging buffer which is then copied to the front of the source
+ * memory. A block only ever overwrites source values of its own or of earlier blocks, both of which have already
+ * been read.
+ * @param filter The filter doing the conversion
+ * @param ptr The source array
+ * @param am The AttributeMatrix that receives the converted array
+ * @param name Name of converted array
+ * @param clamp Clamp values to the range of the target type
+ * @param inPlace Replace the source array with the converted array
+ */
+template <typename TIn, typename TOut> void ConvertArray(AbstractFilter* filter, typename DataArray<TIn>::Pointer ptr, AttributeMatrix::Pointer am, const QString& name, bool clamp, bool inPlace)
+{
+  size_t size = ptr->getSize();
+  size_t numTuples = ptr->getNumberOfTuples();
+  QVector<size_t> dims = ptr->getComponentDimensions();
+
+  // Take the memory before anything is written to it. A wrapped array that does not own its memory gives back
+  // nullptr and is converted into a new array instead, leaving the memory of the caller untouched
+  void* buffer = nullptr;
+  if(inPlace && sizeof(TOut) <= sizeof(TIn) && ptr->isAllocated() && size > 0)
+  {
+    buffer = ptr->releaseBuffer();
+  }
+
+  if(nullptr != buffer)
+  {
+    TIn* src = static_cast<TIn*>(buffer);
+    std::vector<TOut> staging(std::min(size, k_InPlaceBlockSize));
+    for(size_t start = 0; start < size; start += k_InPlaceBlockSize)
+    {
+      size_t count = std::min(k_InPlaceBlockSize, size - start);
+      RunConversion<TIn, TOut>(src + start, staging.data(), count, clamp);
+      std::memcpy(reinterpret_cast<char*>(src) + start * sizeof(TOut), staging.data(), count * sizeof(TOut));
+    }
+
+    // Hand the memory over to the converted array and give back what is no longer needed
+    am->removeAttributeArray(ptr->getName());
+    void* shrunk = DataArrayAllocator::Reallocate(buffer, size * sizeof(TIn), size * sizeof(TOut));
+    if(nullptr != shrunk)
+    {
+      buffer = shrunk;
+    }
+    typename DataArray<TOut>::Pointer p = DataArray<TOut>::WrapPointer(static_cast<TOut*>(buffer), numTuples, dims, name, true);
+    am->addAttributeArray(p->getName(), p);
+    return;
+  }
+
+  typename DataArray<TOut>::Pointer p = DataArray<TOut>::CreateArray(numTuples, dims, name);
+  if(nullptr == p.get())
+  {
+    filter->setErrorCondition(-397);
+    QString ss = QString("Unable to allocate the converted DataArray '%1'").arg(name);
+    filter->notifyErrorMessage(filter->getHumanLabel(), ss, filter->getErrorCondition());
+    return;
+  }
+  RunConversion<TIn, TOut>(ptr->getPointer(0), p->getPointer(0), size, clamp);
+  if(inPlace)
+  {
+    am->removeAttributeArray(ptr->getName());
+  }
+  am->addAttributeArray(p->getName(), p);
+}
+
 /**
  * @brief ConvertData Templated function that converts an IDataArray to a given primitive type
- * @param ptr IDataArray instance pointer
- * @param dims Component dimensions
+ * @param filter The filter doing the conversion
+ * @param ptr DataArray instance pointer
  * @param m DataContainer instance pointer
  * @param scalarType Primitive type to convert to
  * @param attributeMatrixName Name of target AttributeMatrix
  * @param name Name of converted array
  */
-void ConvertData(AbstractFilter* filter, T* ptr, QVector<size_t> dims, DataContainer::Pointer m, SIMPL::NumericTypes::Type scalarType, const QString attributeMatrixName, const QString& name)
+template <typename T>
+void ConvertData(::ConvertData* filter, typename DataArray<T>::Pointer ptr, DataContainer::Pointer m, SIMPL::NumericTypes::Type scalarType, const QString attributeMatrixName, const QString& name)
 {
-  size_t voxels = ptr->getNumberOfTuples();
-  size_t size = ptr->getSize();
+  AttributeMatrix::Pointer am = m->getAttributeMatrix(attributeMatrixName);
+  bool clamp = filter->getClampToTargetRange();
+  bool inPlace = filter->getConvertInPlace();
 
   if(scalarType == SIMPL::NumericTypes::Type::Int8)
   {
-    Int8ArrayType::Pointer p = Int8ArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int8_t>(ptr->getValue(v)));
-    }
+    ConvertArray<T, int8_t>(filter, ptr, am, name, clamp, inPlace);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt8)
   {
-    UInt8ArrayType::Pointer p = UInt8ArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint8_t>(ptr->getValue(v)));
-    }
+    ConvertArray<T, uint8_t>(filter, ptr, am, name, clamp, inPlace);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Int16)
   {
-    Int16ArrayType::Pointer p = Int16ArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int16_t>(ptr->getValue(v)));
-    }
+    ConvertArray<T, int16_t>(filter, ptr, am, name, clamp, inPlace);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt16)
   {
-    UInt16ArrayType::Pointer p = UInt16ArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint16_t>(ptr->getValue(v)));
-    }
+    ConvertArray<T, uint16_t>(filter, ptr, am, name, clamp, inPlace);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Int32)
   {
-    Int32ArrayType::Pointer p = Int32ArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int32_t>(ptr->getValue(v)));
-    }
+    ConvertArray<T, int32_t>(filter, ptr, am, name, clamp, inPlace);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt32)
   {
-    UInt32ArrayType::Pointer p = UInt32ArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint32_t>(ptr->getValue(v)));
-    }
+    ConvertArray<T, uint32_t>(filter, ptr, am, name, clamp, inPlace);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Int64)
   {
-    Int64ArrayType::Pointer p = Int64ArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<int64_t>(ptr->getValue(v)));
-    }
+    ConvertArray<T, int64_t>(filter, ptr, am, name, clamp, inPlace);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::UInt64)
   {
-    UInt64ArrayType::Pointer p = UInt64ArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<uint64_t>(ptr->getValue(v)));
-    }
+    ConvertArray<T, uint64_t>(filter, ptr, am, name, clamp, inPlace);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Float)
   {
-    FloatArrayType::Pointer p = FloatArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<float>(ptr->getValue(v)));
-    }
+    ConvertArray<T, float>(filter, ptr, am, name, clamp, inPlace);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Double)
   {
-    DoubleArrayType::Pointer p = DoubleArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<double>(ptr->getValue(v)));
-    }
+    ConvertArray<T, double>(filter, ptr, am, name, clamp, inPlace);
   }
   else if(scalarType == SIMPL::NumericTypes::Type::Bool)
   {
-    BoolArrayType::Pointer p = BoolArrayType::CreateArray(voxels, dims, name);
-    m->getAttributeMatrix(attributeMatrixName)->addAttributeArray(p->getName(), p);
-    for(size_t v = 0; v < size; ++v)
-    {
-      p->setValue(v, static_cast<bool>(ptr->getValue(v)));
-    }
+    ConvertArray<T, bool>(filter, ptr, am, name, clamp, inPlace);
   }
   else
   {
@@ -189,6 +373,8 @@ ConvertData::ConvertData()
 : m_ScalarType(SIMPL::NumericTypes::Type::Int8)
 , m_OutputArrayName("")
 , m_SelectedCellArrayPath("", "", "")
+, m_ClampToTargetRange(false)
+, m_ConvertInPlace(false)
 {
 }
 
@@ -213,6 +399,9 @@ void ConvertData::setupFilterParameters()
 
   parameters.push_back(SIMPL_NEW_STRING_FP("Converted Attribute Array", OutputArrayName, FilterParameter::CreatedArray, ConvertData));
 
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Clamp Values to Target Range", ClampToTargetRange, FilterParameter::Parameter, ConvertData));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Convert In Place (Removes Input Array)", ConvertInPlace, FilterParameter::Parameter, ConvertData));
+
   setFilterParameters(parameters);
 }
 
@@ -225,6 +414,8 @@ void ConvertData::readFilterParameters(AbstractFilterParametersReader* reader, i
   setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
   setScalarType(static_cast<SIMPL::NumericTypes::Type>(reader->readValue("ScalarType", static_cast<int>(getScalarType()))));
   setOutputArrayName(reader->readString("OutputArrayName", getOutputArrayName()));
+  setClampToTargetRange(reader->readValue("ClampToTargetRange", getClampToTargetRange()));
+  setConvertInPlace(reader->readValue("ConvertInPlace", getConvertInPlace()));
   reader->closeFilterGroup();
 }
 
@@ -314,6 +505,10 @@ void ConvertData::dataCheck()
     {
       p = BoolArrayType::CreateArray(voxels, dims, m_OutputArrayName, false);
     }
+    if(m_ConvertInPlace)
+    {
+      cellAttrMat->removeAttributeArray(m_SelectedCellArrayPath.getDataArrayName());
+    }
     cellAttrMat->addAttributeArray(p->getName(), p);
   }
 }
@@ -356,18 +551,18 @@ void ConvertData::execute()
   }
 
   bool completed = false;
-  CHECK_AND_CONVERT(Int8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-
-  CHECK_AND_CONVERT(UInt8ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(UInt16ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(Int16ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(UInt32ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(Int32ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(UInt64ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(Int64ArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(FloatArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(DoubleArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
-  CHECK_AND_CONVERT(BoolArrayType, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(int8_t, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+
+  CHECK_AND_CONVERT(uint8_t, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(uint16_t, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(int16_t, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(uint32_t, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(int32_t, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(uint64_t, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(int64_t, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(float, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(double, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
+  CHECK_AND_CONVERT(bool, m, m_ScalarType, iArray, m_SelectedCellArrayPath.getAttributeMatrixName(), m_OutputArrayName)
 
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
@@ -63,6 +63,12 @@ class SIMPLib_EXPORT ConvertData : public AbstractFilter
     SIMPL_FILTER_PARAMETER(DataArrayPath, SelectedCellArrayPath)
     Q_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
 
+    SIMPL_FILTER_PARAMETER(bool, ClampToTargetRange)
+    Q_PROPERTY(bool ClampToTargetRange READ getClampToTargetRange WRITE setClampToTargetRange)
+
+    SIMPL_FILTER_PARAMETER(bool, ConvertInPlace)
+    Q_PROPERTY(bool ConvertInPlace READ getConvertInPlace WRITE setConvertInPlace)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
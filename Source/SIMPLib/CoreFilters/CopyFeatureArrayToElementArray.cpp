@@ -38,6 +38,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.hpp"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/Math/FeatureGatherScatter.hpp"
 #include "SIMPLib/SIMPLibVersion.h"
 
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
@@ -171,24 +172,9 @@ template <typename T> IDataArray::Pointer copyData(IDataArray::Pointer inputData
   QVector<size_t> cDims = inputData->getComponentDimensions();
   typename DataArray<T>::Pointer cell = DataArray<T>::CreateArray(totalPoints, cDims, cellArrayName);
 
-  T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
-
   int32_t numComp = feature->getNumberOfComponents();
-  int32_t featureIdx = 0;
+  FeatureGatherScatter<T>::Gather(feature->getPointer(0), featureIds, totalPoints, numComp, feature->getNumberOfTuples(), cell->getPointer(0));
 
-  for(size_t i = 0; i < totalPoints; ++i)
-  {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-    // Now get the pointer to the start of the tuple for the Feature Array at the given Feature Id Index value
-    T* fSourcePtr = fPtr + (numComp * featureIdx);
-    // Now get the pointer to the start of the tuple for the Cell Array at the proper index
-    T* cDestPtr = cPtr + (numComp * i);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(cDestPtr, fSourcePtr, sizeof(T) * numComp);
-  }
   return cell;
 }
 
@@ -37,20 +37,135 @@
 
 #include <QtCore/QDateTime>
 
+#include <algorithm>
 #include <limits>
-#include <random>
-#include <chrono>
+#include <type_traits>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.hpp"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/ScalarTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Math/CounterBasedRandom.hpp"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/Utilities/ParallelProgress.h"
+
+namespace
+{
+// Number of values generated between progress updates and cancel checks
+static const size_t k_ProgressBlockSize = 1 << 20;
+
+template <typename T> T RandomValue(const CounterBasedRandom& random, uint64_t index, T min, T max, std::true_type)
+{
+  return random.uniformInt<T>(index, min, max);
+}
+
+template <typename T> T RandomValue(const CounterBasedRandom& random, uint64_t index, T min, T max, std::false_type)
+{
+  return random.uniformReal<T>(index, min, max);
+}
+
+/**
+ * @brief RandomValue Returns the value for one element. It only depends on the seed and the element
+ * index, so the array comes out the same however the work is split between threads.
+ */
+template <typename T> T RandomValue(const CounterBasedRandom& random, uint64_t index, T min, T max)
+{
+  return RandomValue<T>(random, index, min, max, std::is_integral<T>());
+}
+
+template <> bool RandomValue<bool>(const CounterBasedRandom& random, uint64_t index, bool min, bool max)
+{
+  (void)min;
+  (void)max;
+  return (random.generate(index) & 1) != 0;
+}
+}
+
+/**
+ * @brief The InitializeRandomImpl class fills a block of an array with uniformly distributed random values.
+ */
+template <typename T> class InitializeRandomImpl
+{
+public:
+  InitializeRandomImpl(T* data, T rangeMin, T rangeMax, uint64_t seed, ParallelProgress* progress)
+  : m_Data(data)
+  , m_RangeMin(rangeMin)
+  , m_RangeMax(rangeMax)
+  , m_Random(seed)
+  , m_Progress(progress)
+  {
+  }
+  virtual ~InitializeRandomImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    for(size_t blockStart = start; blockStart < end; blockStart += k_ProgressBlockSize)
+    {
+      if(m_Progress->wasCanceled())
+      {
+        return;
+      }
+      size_t blockEnd = std::min(end, blockStart + k_ProgressBlockSize);
+      for(size_t i = blockStart; i < blockEnd; i++)
+      {
+        m_Data[i] = RandomValue<T>(m_Random, i, m_RangeMin, m_RangeMax);
+      }
+      m_Progress->increment(static_cast<int64_t>(blockEnd - blockStart));
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  T* m_Data;
+  T m_RangeMin;
+  T m_RangeMax;
+  CounterBasedRandom m_Random;
+  ParallelProgress* m_Progress;
+};
+
+/**
+ * @brief initializeArrayWithRandomValues Fills the array with random values in the given range, in parallel when available.
+ */
+template <typename T> void initializeArrayWithRandomValues(AbstractFilter* filter, T* rawPointer, size_t count, T rangeMin, T rangeMax, uint64_t seed)
+{
+  ParallelProgress progress(filter, static_cast<int64_t>(count), filter->getMessagePrefix(), filter->getHumanLabel(), QObject::tr("Generating Random Values"), filter);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count), InitializeRandomImpl<T>(rawPointer, rangeMin, rangeMax, seed, &progress), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    InitializeRandomImpl<T> serial(rawPointer, rangeMin, rangeMax, seed, &progress);
+    serial.generate(0, count);
+  }
+}
 
 /**
 * @brief initializeArrayWithInts Initializes the array p with integers, either from the
@@ -59,7 +174,8 @@
 * unexpected results when passing anything other than an integer as a template parameter.
 * @param p The array that will be initialized
 */
-template <typename T> void initializeArrayWithInts(IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue, SIMPL::ScalarTypes::Type scalarType)
+template <typename T>
+void initializeArrayWithInts(AbstractFilter* filter, IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue, SIMPL::ScalarTypes::Type scalarType, uint64_t seed)
 {
 
   typename DataArray<T>::Pointer array = std::dynamic_pointer_cast<DataArray<T>>(outputArrayPtr);
@@ -137,16 +253,7 @@ template <typename T> void initializeArrayWithInts(IDataArray::Pointer outputArr
   {
     T rangeMin = static_cast<T>(initializationRange.first);
     T rangeMax = static_cast<T>(initializationRange.second);
-
-    std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-    std::mt19937_64 generator(seed); // Standard mersenne_twister_engine seeded with milliseconds
-    std::uniform_int_distribution<> distribution(rangeMin , rangeMax);
-
-    for(size_t i = 0; i < count; i++)
-    {
-      T value = static_cast<T>(distribution(generator));
-      rawPointer[i] = value;
-    }
+    initializeArrayWithRandomValues<T>(filter, rawPointer, count, rangeMin, rangeMax, seed);
   }
 }
 
@@ -157,7 +264,9 @@ template <typename T> void initializeArrayWithInts(IDataArray::Pointer outputArr
 * unexpected results when passing anything other than an integer as a template parameter.
 * @param p The array that will be initialized
 */
-template <> void initializeArrayWithInts<bool>(IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue, SIMPL::ScalarTypes::Type scalarType)
+template <>
+void initializeArrayWithInts<bool>(AbstractFilter* filter, IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue, SIMPL::ScalarTypes::Type scalarType,
+                                   uint64_t seed)
 {
   DataArray<bool>::Pointer array = std::dynamic_pointer_cast<DataArray<bool>>(outputArrayPtr);
   size_t count = array->getSize();
@@ -182,22 +291,7 @@ template <> void initializeArrayWithInts<bool>(IDataArray::Pointer outputArrayPt
   }
   else
   {
-    std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-    std::mt19937_64 generator(seed); // Standard mersenne_twister_engine seeded with milliseconds
-    std::uniform_int_distribution<int32_t> distribution(0, 1);
-
-    for(size_t i = 0; i < count; i++)
-    {
-      int8_t result = static_cast<int8_t>(distribution(generator));
-      if(result == 0)
-      {
-        rawPointer[i] = false;
-      }
-      else
-      {
-        rawPointer[i] = true;
-      }
-    }
+    initializeArrayWithRandomValues<bool>(filter, rawPointer, count, false, true, seed);
   }
 }
 
@@ -209,7 +303,7 @@ template <> void initializeArrayWithInts<bool>(IDataArray::Pointer outputArrayPt
 * parameter.
 * @param p The array that will be initialized
 */
-template <typename T> void initializeArrayWithReals(IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue)
+template <typename T> void initializeArrayWithReals(AbstractFilter* filter, IDataArray::Pointer outputArrayPtr, int initializationType, FPRangePair initializationRange, const QString& initializationValue, uint64_t seed)
 {
   typename DataArray<T>::Pointer array = std::dynamic_pointer_cast<DataArray<T>>(outputArrayPtr);
   size_t count = array->getSize();
@@ -227,17 +321,7 @@ template <typename T> void initializeArrayWithReals(IDataArray::Pointer outputAr
   {
     T rangeMin = static_cast<T>(initializationRange.first);
     T rangeMax = static_cast<T>(initializationRange.second);
-
-    std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-    std::mt19937_64 generator(seed); // Standard mersenne_twister_engine seeded with milliseconds
-    std::uniform_real_distribution<> distribution(rangeMin, rangeMax);
-
-    size_t count = array->getSize();
-    for(size_t i = 0; i < count; i++)
-    {
-      T value = distribution(generator);
-      rawPointer[i] = value;
-    }
+    initializeArrayWithRandomValues<T>(filter, rawPointer, count, rangeMin, rangeMax, seed);
   }
 }
 
@@ -250,6 +334,8 @@ CreateDataArray::CreateDataArray()
 , m_NewArray("", "", "")
 , m_InitializationType(Manual)
 , m_InitializationValue("0")
+, m_UseSeed(false)
+, m_Seed(5489)
 {
 }
 
@@ -283,7 +369,9 @@ void CreateDataArray::setupFilterParameters()
     parameter->setChoices(choices);
     QStringList linkedProps;
     linkedProps << "InitializationValue"
-                << "InitializationRange";
+                << "InitializationRange"
+                << "UseSeed"
+                << "Seed";
     parameter->setLinkedProperties(linkedProps);
     parameter->setEditable(false);
     parameter->setCategory(FilterParameter::Parameter);
@@ -291,6 +379,8 @@ void CreateDataArray::setupFilterParameters()
   }
   parameters.push_back(SIMPL_NEW_STRING_FP("Initialization Value", InitializationValue, FilterParameter::Parameter, CreateDataArray, Manual));
   parameters.push_back(SIMPL_NEW_RANGE_FP("Initialization Range", InitializationRange, FilterParameter::Parameter, CreateDataArray, RandomWithRange));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Use Seed", UseSeed, FilterParameter::Parameter, CreateDataArray, RandomWithRange));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Seed", Seed, FilterParameter::Parameter, CreateDataArray, RandomWithRange));
   {
     DataArrayCreationFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Created Attribute Array", NewArray, FilterParameter::CreatedArray, CreateDataArray, req));
@@ -311,6 +401,8 @@ void CreateDataArray::readFilterParameters(AbstractFilterParametersReader* reade
   setInitializationValue(reader->readString("InitializationValue", getInitializationValue()));
   setInitializationType(reader->readValue("InitializationType", getInitializationType()));
   setInitializationRange(reader->readPairOfDoubles("InitializationRange", getInitializationRange()));
+  setUseSeed(reader->readValue("UseSeed", getUseSeed()));
+  setSeed(reader->readValue("Seed", getSeed()));
   reader->closeFilterGroup();
 }
 
@@ -442,49 +534,57 @@ void CreateDataArray::execute()
     return;
   }
 
+  uint64_t seed = static_cast<uint64_t>(m_Seed);
+  if(m_InitializationType == RandomWithRange && !m_UseSeed)
+  {
+    // Kept within the range of the Seed parameter so the run can be reproduced from the message
+    seed = CounterBasedRandom::GenerateSeed() & 0x7FFFFFFF;
+    notifyStatusMessage(getHumanLabel(), QObject::tr("Initializing with random seed %1").arg(seed));
+  }
+
   if(m_ScalarType == SIMPL::ScalarTypes::Type::Int8)
   {
-    initializeArrayWithInts<int8_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<int8_t>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Int16)
   {
-    initializeArrayWithInts<int16_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<int16_t>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Int32)
   {
-    initializeArrayWithInts<int32_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<int32_t>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Int64)
   {
-    initializeArrayWithInts<int64_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<int64_t>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::UInt8)
   {
-    initializeArrayWithInts<uint8_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<uint8_t>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::UInt16)
   {
-    initializeArrayWithInts<uint16_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<uint16_t>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::UInt32)
   {
-    initializeArrayWithInts<uint32_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<uint32_t>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::UInt64)
   {
-    initializeArrayWithInts<uint64_t>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<uint64_t>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Float)
   {
-    initializeArrayWithReals<float>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue);
+    initializeArrayWithReals<float>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Double)
   {
-    initializeArrayWithReals<double>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue);
+    initializeArrayWithReals<double>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, seed);
   }
   else if(m_ScalarType == SIMPL::ScalarTypes::Type::Bool)
   {
-    initializeArrayWithInts<bool>(m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType);
+    initializeArrayWithInts<bool>(this, m_OutputArrayPtr.lock(), m_InitializationType, m_InitializationRange, m_InitializationValue, m_ScalarType, seed);
   }
 
   /* Let the GUI know we are done with this filter */
@@ -79,6 +79,12 @@ class SIMPLib_EXPORT CreateDataArray : public AbstractFilter
     SIMPL_FILTER_PARAMETER(FPRangePair, InitializationRange)
     Q_PROPERTY(FPRangePair InitializationRange READ getInitializationRange WRITE setInitializationRange)
 
+    SIMPL_FILTER_PARAMETER(bool, UseSeed)
+    Q_PROPERTY(bool UseSeed READ getUseSeed WRITE setUseSeed)
+
+    SIMPL_FILTER_PARAMETER(int, Seed)
+    Q_PROPERTY(int Seed READ getSeed WRITE setSeed)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
@@ -38,6 +38,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.hpp"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/Math/FeatureGatherScatter.hpp"
 #include "SIMPLib/SIMPLibVersion.h"
 
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
@@ -172,50 +173,17 @@ template <typename T> IDataArray::Pointer copyCellData(AbstractFilter* filter, I
   QVector<size_t> dims = inputData->getComponentDimensions();
   typename DataArray<T>::Pointer feature = DataArray<T>::CreateArray(features, dims, createdArrayName);
 
-  T* fPtr = feature->getPointer(0);
-  T* cPtr = cell->getPointer(0);
-
   int32_t numComp = cell->getNumberOfComponents();
-  int32_t featureIdx = 0;
-
   size_t cells = inputData->getNumberOfTuples();
 
-  QMap<int32_t, T*> featureMap;
-  bool warningThrown = false;
-
-  for(size_t i = 0; i < cells; ++i)
+  // The last value of each feature is copied, the elements of a feature are expected to all have the same value
+  FeatureScatterResult result = FeatureGatherScatter<T>::Scatter(cell->getPointer(0), featureIds, cells, numComp, static_cast<size_t>(features), FeatureReduction::Last, feature->getPointer(0));
+  if(result.inconsistentFeatures > 0)
   {
-    // Get the feature id (or what ever the user has selected as their "Feature" identifier
-    featureIdx = featureIds[i];
-
-    // Now get the pointer to the start of the tuple for the Cell Array at the given Feature Id Index value
-    T* cSourcePtr = cPtr + (numComp * i);
-
-    // Store the first value(s) with this feature id in the map
-    if(featureMap.contains(featureIdx) == false)
-    {
-      featureMap.insert(featureIdx, cSourcePtr);
-    }
-
-    // Check that the values that are currently being pointed to by the source pointer match the first values
-    T* currentDataPtr = featureMap.value(featureIdx);
-    for(int j = 0; j < numComp; j++)
-    {
-      if(currentDataPtr[j] != cSourcePtr[j] && !warningThrown)
-      {
-        // The values are inconsistent with the first values for this feature id, so throw a warning
-        filter->setWarningCondition(-1000);
-        QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(featureIdx);
-        filter->notifyWarningMessage(filter->getHumanLabel(), ss, filter->getWarningCondition());
-        warningThrown = true;
-      }
-    }
-
-    // Now get the pointer to the start of the tuple for the Feature Array at the proper index
-    T* fDestPtr = fPtr + (numComp * featureIdx);
-
-    // Now just raw copy the bytes from the source to the destination
-    ::memcpy(fDestPtr, cSourcePtr, sizeof(T) * numComp);
+    // The values are inconsistent with the first values for this feature id, so throw a warning
+    filter->setWarningCondition(-1000);
+    QString ss = QObject::tr("Elements from Feature %1 do not all have the same value. The last value copied into Feature %1 will be used").arg(result.firstInconsistentFeature);
+    filter->notifyWarningMessage(filter->getHumanLabel(), ss, filter->getWarningCondition());
   }
   return feature;
 }
@@ -35,7 +35,11 @@
 
 #include "DataContainerWriter.h"
 
+#include <future>
+
 #include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
 
 #include "H5Support/H5Utilities.h"
 #include "H5Support/QH5Utilities.h"
@@ -227,25 +231,42 @@ void DataContainerWriter::execute()
   // Write our File Version string to the Root "/" group
   QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::FileVersionName, SIMPL::HDF5::FileVersion);
   QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::DREAM3DVersion, SIMPLib::Version::Complete());
-  QFile xdmfFile;
-  QTextStream xdmfOut(&xdmfFile);
+
+  QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
+
+  // The Xdmf light data only depends on the structure of the DataContainers, so it is generated on a separate
+  // thread while the heavy data is written to the HDF5 file below. The future waits for that thread if we return early.
+  QString xdmfFileName;
+  QString xdmfText;
+  std::future<int> xdmfFuture;
   if(m_WriteXdmfFile == true)
   {
     QFileInfo ofFi(m_OutputFile);
-    QString name = ofFi.completeBaseName();
+    xdmfFileName = ofFi.completeBaseName();
     if(parentPath.isEmpty() == true)
     {
-      name = name + ".xdmf";
+      xdmfFileName = xdmfFileName + ".xdmf";
     }
     else
     {
-      name = parentPath + "/" + name + ".xdmf";
+      xdmfFileName = parentPath + "/" + xdmfFileName + ".xdmf";
     }
-    xdmfFile.setFileName(name);
-    if(xdmfFile.open(QIODevice::WriteOnly | QIODevice::Text))
+
+    if(getWriteTimeSeries())
     {
-      writeXdmfHeader(xdmfOut);
+      for(int iter = 0; iter < dcNames.size(); iter++)
+      {
+        IGeometry::Pointer geometry = getDataContainerArray()->getDataContainer(dcNames[iter])->getGeometry();
+        if(geometry.get() != nullptr)
+        {
+          geometry->setEnableTimeSeries(true);
+          geometry->setTimeValue(static_cast<float>(iter));
+        }
+      }
     }
+
+    QString hdfFileName = QH5Utilities::fileNameFromFileId(m_FileId);
+    xdmfFuture = std::async(std::launch::async, [this, &xdmfText, hdfFileName] { return generateXdmf(xdmfText, hdfFileName); });
   }
 
   // Write the Pipeline to the File
@@ -262,11 +283,9 @@ void DataContainerWriter::execute()
   hid_t dcaGid = H5Gopen(m_FileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
   scopedFileSentinel.addGroupId(&dcaGid);
 
-  QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
   for(int iter = 0; iter < getDataContainerArray()->getNumDataContainers(); iter++)
   {
     DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcNames[iter]);
-    IGeometry::Pointer geometry = dc->getGeometry();
     err = H5Utilities::createGroupsFromPath(dcNames[iter].toLatin1().data(), dcaGid);
     if(err < 0)
     {
@@ -293,27 +312,6 @@ void DataContainerWriter::execute()
       notifyErrorMessage(getHumanLabel(), "Error writing DataContainer Geometry", -804);
       return;
     }
-    if(m_WriteXdmfFile == true && geometry.get() != nullptr)
-    {
-
-      if(getWriteTimeSeries())
-      {
-        dc->getGeometry()->setEnableTimeSeries(true);
-        dc->getGeometry()->setTimeValue(static_cast<float>(iter));
-      }
-#if 0
-      dc->getGeometry()->addAttributeMatrix(SIMPL::StringConstants::MetaData, dc->getAttributeMatrix(SIMPL::StringConstants::MetaData));
-      dc->getGeometry()->setTemporalDataPath(DataArrayPath(dc->getName(), SIMPL::StringConstants::MetaData, "Step #"));
-#endif
-
-      QString hdfFileName = QH5Utilities::fileNameFromFileId(m_FileId);
-      err = dc->writeXdmf(xdmfOut, hdfFileName);
-      if(err < 0)
-      {
-        notifyErrorMessage(getHumanLabel(), "Error writing Xdmf File", -805);
-        return;
-      }
-    }
   }
 
   // Write the Data ContainerBundles
@@ -329,7 +327,18 @@ void DataContainerWriter::execute()
   // Write the XDMF File
   if(m_WriteXdmfFile == true)
   {
-    writeXdmfFooter(xdmfOut);
+    err = xdmfFuture.get();
+    if(err < 0)
+    {
+      notifyErrorMessage(getHumanLabel(), "Error writing Xdmf File", -805);
+      return;
+    }
+    QFile xdmfFile(xdmfFileName);
+    if(xdmfFile.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+      QTextStream xdmfOut(&xdmfFile);
+      xdmfOut << xdmfText;
+    }
   }
 
   H5Gclose(dcaGid);
@@ -373,6 +382,34 @@ int DataContainerWriter::writeDataContainerBundles(hid_t fileId)
   return 0;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerWriter::generateXdmf(QString& xdmfText, const QString& hdfFileName)
+{
+  QTextStream xdmfOut(&xdmfText);
+  writeXdmfHeader(xdmfOut);
+
+  QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
+  for(QList<QString>::const_iterator name = dcNames.constBegin(); name != dcNames.constEnd(); ++name)
+  {
+    DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(*name);
+    if(dc->getGeometry().get() == nullptr)
+    {
+      continue;
+    }
+    int err = dc->writeXdmf(xdmfOut, hdfFileName);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+
+  writeXdmfFooter(xdmfOut);
+  xdmfOut.flush();
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -194,6 +194,15 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
      */
     int writeDataContainerBundles(hid_t fileId);
 
+    /**
+     * @brief generateXdmf Generates the complete Xdmf document for the DataContainerArray. Only the structure
+     * of the DataContainers is read, so the document can be generated while the arrays are written to the HDF5 file
+     * @param xdmfText String that receives the document
+     * @param hdfFileName Name of the HDF5 file that holds the heavy data
+     * @return 0 on success, negative if a DataContainer could not generate its Xdmf
+     */
+    int generateXdmf(QString& xdmfText, const QString& hdfFileName);
+
     /**
      * @brief writeXdmfHeader Writes the Xdmf header
      * @param out QTextStream for output
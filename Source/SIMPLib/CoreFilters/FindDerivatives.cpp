@@ -36,14 +36,17 @@
 #include "FindDerivatives.h"
 
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArrayCreationFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/Geometry/EdgeGeom.h"
-#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
 #include "SIMPLib/Geometry/TetrahedralGeom.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Math/SIMPLibRandom.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
@@ -53,6 +56,7 @@
 FindDerivatives::FindDerivatives()
 : m_SelectedArrayPath("", "", "")
 , m_DerivativesArrayPath(SIMPL::Defaults::DataContainerName, SIMPL::Defaults::CellAttributeMatrixName, "Derivatives")
+, m_UseFloatDerivatives(false)
 , m_Interpolate(false)
 {
 }
@@ -89,6 +93,7 @@ void FindDerivatives::setupFilterParameters()
     req.amTypes = amTypes;
     parameters.push_back(SIMPL_NEW_DA_CREATION_FP("Derivatives Array", DerivativesArrayPath, FilterParameter::CreatedArray, FindDerivatives, req));
   }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Store Derivatives as Float", UseFloatDerivatives, FilterParameter::Parameter, FindDerivatives));
   setFilterParameters(parameters);
 }
 
@@ -100,81 +105,88 @@ void FindDerivatives::readFilterParameters(AbstractFilterParametersReader* reade
   reader->openFilterGroup(this, index);
   setSelectedArrayPath(reader->readDataArrayPath("SelectedArrayPath", getSelectedArrayPath()));
   setDerivativesArrayPath(reader->readDataArrayPath("DerivativesArrayPath", getDerivativesArrayPath()));
+  setUseFloatDerivatives(reader->readValue("UseFloatDerivatives", getUseFloatDerivatives()));
   reader->closeFilterGroup();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename DataType> void findDerivs(IDataArray::Pointer inDataPtr, DoubleArrayType::Pointer derivs, DataContainer::Pointer m, Observable* observable)
+template <typename DataType, typename K>
+void findDerivsAs(IDataArray::Pointer inDataPtr, typename DataArray<K>::Pointer derivs, DataContainer::Pointer m, bool interpolate, Observable* observable)
 {
   typename DataArray<DataType>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<DataType>>(inDataPtr);
-  IGeometry::Pointer geom = m->getGeometry();
-  DoubleArrayType::Pointer dblInArray = DoubleArrayType::CreateArray(inputDataPtr->getNumberOfTuples(), inputDataPtr->getComponentDimensions(), "FIND_DERIVS_INTERNAL_USE_ONLY");
-
-  size_t size = inputDataPtr->getSize();
+  IGeometry::Type geomType = m->getGeometry()->getGeometryType();
 
-  for(size_t i = 0; i < size; i++)
+  // The geometries read the input in its native type and, for element centered data on the
+  // unstructured geometries, average it onto the vertices while the derivatives are computed
+  switch(geomType)
+  {
+  case IGeometry::Type::Image:
   {
-    dblInArray->setValue(i, static_cast<double>(inputDataPtr->getValue(i)));
+    m->getGeometryAs<ImageGeom>()->findDerivatives<DataType, K>(inputDataPtr, derivs, observable);
+    break;
   }
-
-  geom->findDerivatives(dblInArray, derivs, observable);
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename DataType> void interpolateCellValues(IDataArray::Pointer inDataPtr, DoubleArrayType::Pointer outDataPtr, DataContainer::Pointer m)
-{
-  typename DataArray<DataType>::Pointer inputDataPtr = std::dynamic_pointer_cast<DataArray<DataType>>(inDataPtr);
-  IGeometry::Pointer geom = m->getGeometry();
-  int err = 0;
-
-  if(geom->getElementsContainingVert().get() == nullptr)
+  case IGeometry::Type::RectGrid:
   {
-    err = geom->findElementsContainingVert();
-    if(err < 0)
-    {
-      return;
-    }
+    m->getGeometryAs<RectGridGeom>()->findDerivatives<DataType, K>(inputDataPtr, derivs, observable);
+    break;
   }
-
-  ElementDynamicList::Pointer elemsContainingVert = geom->getElementsContainingVert();
-  IGeometry::Type geomType = geom->getGeometryType();
-
-  switch(geomType)
+  case IGeometry::Type::Vertex:
   {
+    m->getGeometryAs<VertexGeom>()->findDerivatives<DataType, K>(inputDataPtr, derivs, observable);
+    break;
+  }
   case IGeometry::Type::Edge:
   {
     EdgeGeom::Pointer edgeGeom = m->getGeometryAs<EdgeGeom>();
-    SharedVertexList::Pointer verts = edgeGeom->getVertices();
-    outDataPtr->resize(edgeGeom->getNumberOfVertices());
-    GeometryHelpers::Generic::AverageCellArrayValues<int64_t, DataType, uint16_t, double>(elemsContainingVert, verts, inputDataPtr, outDataPtr);
+    if(interpolate)
+    {
+      edgeGeom->findDerivativesFromElementValues<DataType, K>(inputDataPtr, derivs, observable);
+    }
+    else
+    {
+      edgeGeom->findDerivatives<DataType, K>(inputDataPtr, derivs, observable);
+    }
     break;
   }
   case IGeometry::Type::Triangle:
   {
     TriangleGeom::Pointer triGeom = m->getGeometryAs<TriangleGeom>();
-    SharedVertexList::Pointer verts = triGeom->getVertices();
-    outDataPtr->resize(triGeom->getNumberOfVertices());
-    GeometryHelpers::Generic::AverageCellArrayValues<int64_t, DataType, uint16_t, double>(elemsContainingVert, verts, inputDataPtr, outDataPtr);
+    if(interpolate)
+    {
+      triGeom->findDerivativesFromElementValues<DataType, K>(inputDataPtr, derivs, observable);
+    }
+    else
+    {
+      triGeom->findDerivatives<DataType, K>(inputDataPtr, derivs, observable);
+    }
     break;
   }
   case IGeometry::Type::Quad:
   {
     QuadGeom::Pointer quadGeom = m->getGeometryAs<QuadGeom>();
-    SharedVertexList::Pointer verts = quadGeom->getVertices();
-    outDataPtr->resize(quadGeom->getNumberOfVertices());
-    GeometryHelpers::Generic::AverageCellArrayValues<int64_t, DataType, uint16_t, double>(elemsContainingVert, verts, inputDataPtr, outDataPtr);
+    if(interpolate)
+    {
+      quadGeom->findDerivativesFromElementValues<DataType, K>(inputDataPtr, derivs, observable);
+    }
+    else
+    {
+      quadGeom->findDerivatives<DataType, K>(inputDataPtr, derivs, observable);
+    }
     break;
   }
   case IGeometry::Type::Tetrahedral:
   {
     TetrahedralGeom::Pointer tets = m->getGeometryAs<TetrahedralGeom>();
-    SharedVertexList::Pointer verts = tets->getVertices();
-    outDataPtr->resize(tets->getNumberOfVertices());
-    GeometryHelpers::Generic::AverageCellArrayValues<int64_t, DataType, uint16_t, double>(elemsContainingVert, verts, inputDataPtr, outDataPtr);
+    if(interpolate)
+    {
+      tets->findDerivativesFromElementValues<DataType, K>(inputDataPtr, derivs, observable);
+    }
+    else
+    {
+      tets->findDerivatives<DataType, K>(inputDataPtr, derivs, observable);
+    }
     break;
   }
   default:
@@ -184,6 +196,22 @@ template <typename DataType> void interpolateCellValues(IDataArray::Pointer inDa
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename DataType> void findDerivs(IDataArray::Pointer inDataPtr, IDataArray::Pointer derivs, DataContainer::Pointer m, bool interpolate, Observable* observable)
+{
+  FloatArrayType::Pointer floatDerivs = std::dynamic_pointer_cast<FloatArrayType>(derivs);
+  if(nullptr != floatDerivs.get())
+  {
+    findDerivsAs<DataType, float>(inDataPtr, floatDerivs, m, interpolate, observable);
+  }
+  else
+  {
+    findDerivsAs<DataType, double>(inDataPtr, std::dynamic_pointer_cast<DoubleArrayType>(derivs), m, interpolate, observable);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -309,12 +337,14 @@ void FindDerivatives::dataCheck()
   cDims *= 3;
   QVector<size_t> dims(1, cDims);
 
-  m_DerivativesArrayPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<double>, AbstractFilter, double>(
-      this, getDerivativesArrayPath(), 0, dims);    /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
-  if(nullptr != m_DerivativesArrayPtr.lock())       /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+  if(m_UseFloatDerivatives)
   {
-    m_DerivativesArray = m_DerivativesArrayPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
+    m_DerivativesArrayPtr = getDataContainerArray()->createNonPrereqArrayFromPath<FloatArrayType, AbstractFilter, float>(this, getDerivativesArrayPath(), 0, dims);
+  }
+  else
+  {
+    m_DerivativesArrayPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DoubleArrayType, AbstractFilter, double>(this, getDerivativesArrayPath(), 0, dims);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -349,17 +379,7 @@ void FindDerivatives::execute()
   geom->setMessagePrefix(getMessagePrefix());
   geom->setMessageTitle("Computing Derivatives");
 
-  if(m_Interpolate)
-  {
-    DoubleArrayType::Pointer interpolatedValues =
-        DoubleArrayType::CreateArray(m_InArrayPtr.lock()->getNumberOfTuples(), m_InArrayPtr.lock()->getComponentDimensions(), "FIND_DERIVATIVES_INTERNAL_USE_ONLY");
-    EXECUTE_FUNCTION_TEMPLATE(this, interpolateCellValues, m_InArrayPtr.lock(), m_InArrayPtr.lock(), interpolatedValues, m)
-    geom->findDerivatives(interpolatedValues, m_DerivativesArrayPtr.lock(), this);
-  }
-  else
-  {
-    EXECUTE_FUNCTION_TEMPLATE(this, findDerivs, m_InArrayPtr.lock(), m_InArrayPtr.lock(), m_DerivativesArrayPtr.lock(), m, this);
-  }
+  EXECUTE_FUNCTION_TEMPLATE(this, findDerivs, m_InArrayPtr.lock(), m_InArrayPtr.lock(), m_DerivativesArrayPtr.lock(), m, m_Interpolate, this);
 
   geom->setMessagePrefix("");
   geom->setMessageTitle("");
@@ -65,6 +65,9 @@ class SIMPLib_EXPORT FindDerivatives : public AbstractFilter
     SIMPL_FILTER_PARAMETER(DataArrayPath, DerivativesArrayPath)
     Q_PROPERTY(DataArrayPath DerivativesArrayPath READ getDerivativesArrayPath WRITE setDerivativesArrayPath)
 
+    SIMPL_FILTER_PARAMETER(bool, UseFloatDerivatives)
+    Q_PROPERTY(bool UseFloatDerivatives READ getUseFloatDerivatives WRITE setUseFloatDerivatives)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
@@ -172,7 +175,7 @@ class SIMPLib_EXPORT FindDerivatives : public AbstractFilter
 
   private:
     DEFINE_IDATAARRAY_WEAKPTR(InArray)
-    DEFINE_DATAARRAY_VARIABLE(double, DerivativesArray)
+    DEFINE_IDATAARRAY_WEAKPTR(DerivativesArray)
 
     bool m_Interpolate;
 
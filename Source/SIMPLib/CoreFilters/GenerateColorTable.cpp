@@ -4,6 +4,10 @@
 
 #include "GenerateColorTable.h"
 
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
@@ -12,120 +16,171 @@
 #endif
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/FilterParameters/GenerateColorTableFilterParameter.h"
+#include "SIMPLib/Math/DataArrayReductions.hpp"
 #include "SIMPLib/Utilities/ColorTable.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-template <typename T>
-int findRightBinIndex(T nValue, QVector<float> binPoints)
+namespace
 {
-  /* This is a brute-force way of finding the proper bins.
-     We will need to change this method to a binary search. */
-  int rightBinIndex = 0;
-  while (binPoints[rightBinIndex] < nValue)
-  {
-    rightBinIndex++;
-  }
+// Number of cells of the quantized bin index, must be a power of 2
+const int k_BinLookupSize = 4096;
+// Integer arrays spanning at most this many distinct values get a full RGB(A) entry per value
+const int64_t k_MaxColorLookupEntries = 65536;
 
-  return rightBinIndex;
+template <typename T> typename std::enable_if<std::is_floating_point<T>::value, bool>::type isFiniteValue(T value)
+{
+  return std::isfinite(value);
 }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int findRightBinIndex_Binary(float nValue, QVector<float> binPoints)
+template <typename T> typename std::enable_if<!std::is_floating_point<T>::value, bool>::type isFiniteValue(T)
+{
+  return true;
+}
+
+/**
+ * @brief The ColorTableSegments class holds the normalized bin points and the colors of a preset in flat arrays,
+ * together with a table that maps a quantized normalized value to the first bin that can contain it so that
+ * the bin of a value is found with a lookup and at most a couple of compares.
+ */
+class ColorTableSegments
 {
-  int min = 0, max = binPoints.size() - 1;
-  while (min < max)
+public:
+  ColorTableSegments(const QVector<float>& binPoints, const std::vector<double>& colors)
+  : m_BinPoints(binPoints.begin(), binPoints.end())
+  , m_Colors(colors)
+  , m_BinLookup(k_BinLookupSize + 1, 0)
+  {
+    const int numBins = static_cast<int>(m_BinPoints.size());
+    int bin = 0;
+    for(int q = 0; q <= k_BinLookupSize; q++)
+    {
+      // Start one cell early so that rounding in the quantization can never skip the right bin
+      const float lowerBound = static_cast<float>(q - 1) / static_cast<float>(k_BinLookupSize);
+      while(bin < numBins - 1 && m_BinPoints[bin] < lowerBound)
+      {
+        bin++;
+      }
+      m_BinLookup[q] = bin;
+    }
+  }
+
+  /**
+   * @brief findRightBinIndex Returns the first bin point that is not smaller than nValue, or the last bin point
+   */
+  inline int findRightBinIndex(float nValue) const
+  {
+    const int lastBin = static_cast<int>(m_BinPoints.size()) - 1;
+    int bin = m_BinLookup[static_cast<int>(nValue * k_BinLookupSize)];
+    while(bin < lastBin && m_BinPoints[bin] < nValue)
+    {
+      bin++;
+    }
+    return bin;
+  }
+
+  /**
+   * @brief computeColor Interpolates the RGB color of a normalized value in [0, 1]
+   */
+  inline void computeColor(float nValue, uint8_t* rgb) const
   {
-    int middle = (min + max) / 2;
-    if (nValue > binPoints[middle])
+    int rightBinIndex = findRightBinIndex(nValue);
+    int leftBinIndex = rightBinIndex - 1;
+    if(leftBinIndex < 0)
     {
-      min = middle + 1;
+      leftBinIndex = 0;
+      rightBinIndex = 1;
     }
-    else
+
+    // Find the fractional distance traveled between the beginning and end of the current color bin
+    float currFraction = (nValue - m_BinPoints[leftBinIndex]) / (m_BinPoints[rightBinIndex] - m_BinPoints[leftBinIndex]);
+
+    const double* left = m_Colors.data() + 3 * leftBinIndex;
+    const double* right = m_Colors.data() + 3 * rightBinIndex;
+    for(int c = 0; c < 3; c++)
     {
-      max = middle;
+      rgb[c] = static_cast<uint8_t>((left[c] * (1.0 - currFraction) + right[c] * currFraction) * 255);
     }
   }
-  return min;
-}
+
+private:
+  std::vector<float> m_BinPoints;
+  std::vector<double> m_Colors;
+  std::vector<int> m_BinLookup;
+};
 
 /**
- * @brief The GenerateColorTableImpl class implements a threaded algorithm that computes the RGB values
- * for each element in a given array of data
+ * @brief The GenerateColorTableImpl class implements a threaded algorithm that computes the RGB(A) values
+ * for each element in a given array of data. Integer arrays with a small range are colored through a lookup
+ * table with one entry per value; everything else is normalized and interpolated between the control points.
+ * Values that are not finite get a black, fully transparent color.
  */
-template <typename T>
-class GenerateColorTableImpl
+template <typename T> class GenerateColorTableImpl
 {
 public:
-  GenerateColorTableImpl(typename DataArray<T>::Pointer arrayPtr, QVector<float> binPoints,
-                         std::vector<std::vector<double> > controlPoints, int numControlColors, UInt8ArrayType::Pointer colorArray) :
-    m_ArrayPtr(arrayPtr),
-    m_BinPoints(binPoints),
-    m_NumControlColors(numControlColors),
-    m_ControlPoints(controlPoints),
-    m_ColorArray(colorArray)
+  GenerateColorTableImpl(const T* data, T arrayMin, T arrayMax, const ColorTableSegments& segments, const uint8_t* colorLookup, int numComps, uint8_t* colors)
+  : m_Data(data)
+  , m_ArrayMin(arrayMin)
+  , m_ArrayMax(arrayMax)
+  , m_Segments(segments)
+  , m_ColorLookup(colorLookup)
+  , m_NumComps(numComps)
+  , m_Colors(colors)
   {
-    m_ArrayMin = arrayPtr->getValue(0);
-    m_ArrayMax = arrayPtr->getValue(0);
-    for (int i=1; i<arrayPtr->getNumberOfTuples(); i++)
-    {
-      if (arrayPtr->getValue(i) < m_ArrayMin) { m_ArrayMin = arrayPtr->getValue(i); }
-      if (arrayPtr->getValue(i) > m_ArrayMax) { m_ArrayMax = arrayPtr->getValue(i); }
-    }
   }
   virtual ~GenerateColorTableImpl()
   {
   }
 
-  void convert(size_t start, size_t end) const
+  /**
+   * @brief normalize Maps a value of the array into [0, 1]
+   */
+  inline float normalize(T value) const
   {
-    for (size_t i = start; i < end; i++)
+    if(m_ArrayMax == m_ArrayMin)
     {
-      // Normalize value
-      float nValue = (static_cast<float>(m_ArrayPtr->getValue(i) - m_ArrayMin)) / static_cast<float>((m_ArrayMax - m_ArrayMin));
-
-      int rightBinIndex = findRightBinIndex_Binary(nValue, m_BinPoints);
-
-      int leftBinIndex = rightBinIndex - 1;
-      if (leftBinIndex < 0)
-      {
-        leftBinIndex = 0;
-        rightBinIndex = 1;
-      }
+      return 0.0f;
+    }
+    float nValue = (static_cast<float>(value - m_ArrayMin)) / static_cast<float>((m_ArrayMax - m_ArrayMin));
+    nValue = (nValue < 0.0f) ? 0.0f : nValue;
+    return (nValue > 1.0f) ? 1.0f : nValue;
+  }
 
-      // Find the fractional distance traveled between the beginning and end of the current color bin
-      float currFraction = 0.0f;
-      if (rightBinIndex < m_BinPoints.size())
-      {
-        currFraction = (nValue - m_BinPoints[leftBinIndex]) / (m_BinPoints[rightBinIndex] - m_BinPoints[leftBinIndex]);
-      }
-      else
-      {
-        currFraction = (nValue - m_BinPoints[leftBinIndex]) / (1 - m_BinPoints[leftBinIndex]);
-      }
+  /**
+   * @brief colorOf Writes the RGB(A) color of a single value
+   */
+  inline void colorOf(T value, uint8_t* color) const
+  {
+    if(!isFiniteValue(value))
+    {
+      std::memset(color, 0, m_NumComps);
+      return;
+    }
+    m_Segments.computeColor(normalize(value), color);
+    if(m_NumComps == 4)
+    {
+      color[3] = 255;
+    }
+  }
 
-      // If the current color bin index is larger than the total number of control colors, automatically set the currentBinIndex
-      // to the last control color.
-      if(leftBinIndex > m_NumControlColors - 1)
+  void convert(size_t start, size_t end) const
+  {
+    const size_t numComps = static_cast<size_t>(m_NumComps);
+    if(m_ColorLookup != nullptr)
+    {
+      for(size_t i = start; i < end; i++)
       {
-        leftBinIndex = m_NumControlColors - 1;
+        const size_t entry = static_cast<size_t>(static_cast<int64_t>(m_Data[i]) - static_cast<int64_t>(m_ArrayMin));
+        std::memcpy(m_Colors + i * numComps, m_ColorLookup + entry * numComps, numComps);
       }
-
-      // Calculate the RGB values
-      unsigned char r = (m_ControlPoints[leftBinIndex][1] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][1] * currFraction) * 255;
-      unsigned char g = (m_ControlPoints[leftBinIndex][2] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][2] * currFraction) * 255;
-      unsigned char b = (m_ControlPoints[leftBinIndex][3] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][3] * currFraction) * 255;
-
-      m_ColorArray->setComponent(i, 0, r);
-      m_ColorArray->setComponent(i, 1, g);
-      m_ColorArray->setComponent(i, 2, b);
+      return;
+    }
+    for(size_t i = start; i < end; i++)
+    {
+      colorOf(m_Data[i], m_Colors + i * numComps);
     }
   }
 
@@ -136,40 +191,48 @@ public:
   }
 #endif
 private:
-  typename DataArray<T>::Pointer                        m_ArrayPtr;
-  QVector<float>                                        m_BinPoints;
-  T                                                     m_ArrayMin;
-  T                                                     m_ArrayMax;
-  int                                                   m_NumControlColors;
-  std::vector<std::vector<double> >                     m_ControlPoints;
-  UInt8ArrayType::Pointer                               m_ColorArray;
+  const T* m_Data;
+  T m_ArrayMin;
+  T m_ArrayMax;
+  const ColorTableSegments& m_Segments;
+  const uint8_t* m_ColorLookup;
+  int m_NumComps;
+  uint8_t* m_Colors;
 };
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T>
-void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray presetControlPoints, DataArrayPath selectedDAP, QString rgbArrayName, DataContainerArray::Pointer dca)
+template <typename T> bool useColorLookup(T arrayMin, T arrayMax)
 {
-  if (arrayPtr->getNumberOfTuples() <= 0) { return; }
+  if(!std::is_integral<T>::value)
+  {
+    return false;
+  }
+  return (static_cast<double>(arrayMax) - static_cast<double>(arrayMin)) < static_cast<double>(k_MaxColorLookupEntries);
+}
 
-  if (presetControlPoints.size() <= 0) { return; }
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray presetControlPoints, DataArrayPath selectedDAP, QString rgbArrayName, bool addAlphaChannel, DataContainerArray::Pointer dca)
+{
+  size_t numTuples = arrayPtr->getNumberOfTuples();
+  if(numTuples <= 0) { return; }
 
   int numControlColors = presetControlPoints.count() / 4;
-  int numComponents = 4;
-  std::vector<std::vector<double> > controlPoints(numControlColors, std::vector<double>(numComponents));
+  if(numControlColors < 2) { return; }
 
-  // Migrate colorControlPoints values from QJsonArray to 2D array.  Store A-values in binPoints vector.
+  // Migrate colorControlPoints values from QJsonArray to flat arrays. Store A-values in binPoints vector.
   QVector<float> binPoints;
-  for (int i=0; i<numControlColors; i++)
+  std::vector<double> colors(3 * numControlColors, 0.0);
+  for(int i = 0; i < numControlColors; i++)
   {
-    for (int j=0; j<numComponents; j++)
+    binPoints.push_back(static_cast<float>(presetControlPoints[4 * i].toDouble()));
+    for(int j = 0; j < 3; j++)
     {
-      controlPoints[i][j] = static_cast<float>(presetControlPoints[numComponents*i + j].toDouble());
-      if (j == 0)
-      {
-        binPoints.push_back(controlPoints[i][j]);
-      }
+      colors[3 * i + j] = static_cast<float>(presetControlPoints[4 * i + j + 1].toDouble());
     }
   }
 
@@ -180,30 +243,59 @@ void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray pres
   {
     binPoints[i] = (binPoints[i] - binMin) / (binMax - binMin);
   }
+  ColorTableSegments segments(binPoints, colors);
 
+  int numComps = addAlphaChannel ? 4 : 3;
   DataArrayPath tmpPath = selectedDAP;
   tmpPath.setDataArrayName(rgbArrayName);
 
-  UInt8ArrayType::Pointer colorArray = dca->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(nullptr, tmpPath, QVector<size_t>(1, 3));
+  UInt8ArrayType::Pointer colorArray = dca->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(nullptr, tmpPath, QVector<size_t>(1, numComps));
   if (colorArray.get() == nullptr) { return; }
 
+  const T* data = arrayPtr->getPointer(0);
+  uint8_t* colorPtr = colorArray->getPointer(0);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
   bool doParallel = true;
 #endif
 
+  // The range of the finite values, found in parallel
+  ReductionRange finiteValues;
+  finiteValues.finiteOnly = true;
+  std::vector<T> mins;
+  std::vector<T> maxs;
+  DataArrayReductions<T>::ComponentMinMax(data, numTuples, 1, mins, maxs, finiteValues);
+  T arrayMin = mins[0];
+  T arrayMax = maxs[0];
+
+  // Integer arrays with a small range get every one of their colors computed up front
+  std::vector<uint8_t> colorLookup;
+  if(useColorLookup(arrayMin, arrayMax))
+  {
+    GenerateColorTableImpl<T> lookupBuilder(data, arrayMin, arrayMax, segments, nullptr, numComps, colorPtr);
+    size_t numEntries = static_cast<size_t>(static_cast<int64_t>(arrayMax) - static_cast<int64_t>(arrayMin)) + 1;
+    colorLookup.resize(numEntries * numComps);
+    for(size_t i = 0; i < numEntries; i++)
+    {
+      lookupBuilder.colorOf(static_cast<T>(static_cast<int64_t>(arrayMin) + static_cast<int64_t>(i)), colorLookup.data() + i * numComps);
+    }
+  }
+  const uint8_t* colorLookupPtr = colorLookup.empty() ? nullptr : colorLookup.data();
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, arrayPtr->getNumberOfTuples()), GenerateColorTableImpl<T>(arrayPtr, binPoints, controlPoints, numControlColors, colorArray),
-                      tbb::auto_partitioner());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numTuples), GenerateColorTableImpl<T>(data, arrayMin, arrayMax, segments, colorLookupPtr, numComps, colorPtr), tbb::auto_partitioner());
   }
   else
 #endif
   {
-    GenerateColorTableImpl<T> serial(arrayPtr, binPoints, controlPoints, numControlColors, colorArray);
-    serial.convert(0, arrayPtr->getNumberOfTuples());
+    GenerateColorTableImpl<T> serial(data, arrayMin, arrayMax, segments, colorLookupPtr, numComps, colorPtr);
+    serial.convert(0, numTuples);
   }
 }
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -213,6 +305,7 @@ GenerateColorTable::GenerateColorTable()
 , m_SelectedPresetControlPoints(QJsonArray())
 , m_SelectedDataArrayPath(DataArrayPath("", "", ""))
 , m_RGB_ArrayName("")
+, m_AddAlphaChannel(false)
 {
   initialize();
 }
@@ -253,6 +346,7 @@ void GenerateColorTable::setupFilterParameters()
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Data Array", SelectedDataArrayPath, FilterParameter::RequiredArray, GenerateColorTable, req));
   }
 
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Add Alpha Channel", AddAlphaChannel, FilterParameter::Parameter, GenerateColorTable));
   parameters.push_back(SIMPL_NEW_STRING_FP("RGB Array Name", RGB_ArrayName, FilterParameter::CreatedArray, GenerateColorTable));
 
   setFilterParameters(parameters);
@@ -271,7 +365,7 @@ void GenerateColorTable::dataCheck()
   DataArrayPath tmpPath = getSelectedDataArrayPath();
   tmpPath.setDataArrayName(getRGB_ArrayName());
 
-  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint8_t>, AbstractFilter, uint8_t>(this, tmpPath, 0, QVector<size_t>(1, 3));
+  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint8_t>, AbstractFilter, uint8_t>(this, tmpPath, 0, QVector<size_t>(1, getAddAlphaChannel() ? 4 : 3));
 }
 
 // -----------------------------------------------------------------------------
@@ -300,57 +394,57 @@ void GenerateColorTable::execute()
   if (getDataContainerArray()->getPrereqArrayFromPath<Int8ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int8ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int8ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<int8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt8ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<uint8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<Int16ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int16ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int16ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<int16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt16ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt16ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt16ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<uint16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int32ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<int32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt32ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt32ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt32ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<uint32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<Int64ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int64ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int64ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<int64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt64ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt64ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt64ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<uint64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<DoubleArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     DoubleArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<DoubleArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<double>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<double>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<FloatArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     FloatArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<FloatArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<float>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<float>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<BoolArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     BoolArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<BoolArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<bool>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getDataContainerArray());
+    generateColorArray<bool>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRGB_ArrayName(), getAddAlphaChannel(), getDataContainerArray());
   }
   else
   {
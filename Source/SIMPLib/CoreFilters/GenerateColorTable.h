@@ -38,6 +38,9 @@ class SIMPLib_EXPORT GenerateColorTable : public AbstractFilter
     SIMPL_INSTANCE_PROPERTY(QString, RGB_ArrayName)
     Q_PROPERTY(QString RGB_ArrayName READ getRGB_ArrayName WRITE setRGB_ArrayName)
 
+    SIMPL_INSTANCE_PROPERTY(bool, AddAlphaChannel)
+    Q_PROPERTY(bool AddAlphaChannel READ getAddAlphaChannel WRITE setAddAlphaChannel)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
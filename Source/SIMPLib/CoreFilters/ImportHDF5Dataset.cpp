@@ -32,12 +32,18 @@
 
 #include "ImportHDF5Dataset.h"
 
+#include <algorithm>
+#include <vector>
+
 #include <QtCore/QFileInfo>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/NumericTypeFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/FilterParameters/UInt64FilterParameter.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
 #include "H5Support/H5ScopedSentinel.h"
@@ -46,22 +52,181 @@
 
 namespace Detail
 {
+// Approximate size in bytes of each slab that is streamed from the dataset into the created array
+static const size_t k_SlabByteSize = 64 * 1024 * 1024;
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T> IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const size_t& numOfTuples, const QVector<size_t>& cDims)
+SIMPL::NumericTypes::Type getNumericType(hid_t typeId, H5T_class_t typeClass, size_t typeSize)
 {
-  herr_t err = -1;
-  IDataArray::Pointer ptr;
+  if(typeClass == H5T_INTEGER)
+  {
+    if(H5Tequal(typeId, H5T_STD_U8BE) || H5Tequal(typeId, H5T_STD_U8LE))
+    {
+      return SIMPL::NumericTypes::Type::UInt8;
+    }
+    if(H5Tequal(typeId, H5T_STD_U16BE) || H5Tequal(typeId, H5T_STD_U16LE))
+    {
+      return SIMPL::NumericTypes::Type::UInt16;
+    }
+    if(H5Tequal(typeId, H5T_STD_U32BE) || H5Tequal(typeId, H5T_STD_U32LE))
+    {
+      return SIMPL::NumericTypes::Type::UInt32;
+    }
+    if(H5Tequal(typeId, H5T_STD_U64BE) || H5Tequal(typeId, H5T_STD_U64LE))
+    {
+      return SIMPL::NumericTypes::Type::UInt64;
+    }
+    if(H5Tequal(typeId, H5T_STD_I8BE) || H5Tequal(typeId, H5T_STD_I8LE))
+    {
+      return SIMPL::NumericTypes::Type::Int8;
+    }
+    if(H5Tequal(typeId, H5T_STD_I16BE) || H5Tequal(typeId, H5T_STD_I16LE))
+    {
+      return SIMPL::NumericTypes::Type::Int16;
+    }
+    if(H5Tequal(typeId, H5T_STD_I32BE) || H5Tequal(typeId, H5T_STD_I32LE))
+    {
+      return SIMPL::NumericTypes::Type::Int32;
+    }
+    if(H5Tequal(typeId, H5T_STD_I64BE) || H5Tequal(typeId, H5T_STD_I64LE))
+    {
+      return SIMPL::NumericTypes::Type::Int64;
+    }
+  }
+  else if(typeClass == H5T_FLOAT)
+  {
+    if(typeSize == 4)
+    {
+      return SIMPL::NumericTypes::Type::Float;
+    }
+    if(typeSize == 8)
+    {
+      return SIMPL::NumericTypes::Type::Double;
+    }
+  }
+  return SIMPL::NumericTypes::Type::UnknownNumType;
+}
+
+// -----------------------------------------------------------------------------
+// Reads the selected part of the dataset directly into the destination. HDF5 converts
+// from the file type to the memory type while reading, using its own bounded conversion buffer.
+// -----------------------------------------------------------------------------
+template <typename T> herr_t readSlab(hid_t did, hid_t memSpaceId, hid_t fileSpaceId, T* dest)
+{
+  T value = 0x0;
+  return H5Dread(did, H5Lite::HDFTypeForPrimitive(value), memSpaceId, fileSpaceId, H5P_DEFAULT, dest);
+}
+
+// -----------------------------------------------------------------------------
+// HDF5 has no boolean memory type, so the slab is staged as doubles and every non-zero
+// value becomes true, matching what a static_cast<bool> of the source value would give.
+// -----------------------------------------------------------------------------
+herr_t readSlab(hid_t did, hid_t memSpaceId, hid_t fileSpaceId, bool* dest)
+{
+  size_t numElements = static_cast<size_t>(H5Sget_simple_extent_npoints(memSpaceId));
+  std::vector<double> staging(numElements);
+  herr_t err = H5Dread(did, H5T_NATIVE_DOUBLE, memSpaceId, fileSpaceId, H5P_DEFAULT, staging.data());
+  for(size_t i = 0; i < numElements; i++)
+  {
+    dest[i] = (staging[i] != 0.0);
+  }
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+// The type a slab is held in while HDF5 reads it, which sets how many rows fit in k_SlabByteSize
+// -----------------------------------------------------------------------------
+template <typename T> struct SlabStagingType
+{
+  typedef T Type;
+};
+
+template <> struct SlabStagingType<bool>
+{
+  typedef double Type;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer readH5Dataset(AbstractFilter* filter, hid_t locId, const QString& datasetPath, size_t tupleOffset, size_t numOfTuples, const QVector<size_t>& cDims, bool metaDataOnly)
+{
+  typename DataArray<T>::Pointer ptr = DataArray<T>::CreateArray(numOfTuples, cDims, datasetPath, !metaDataOnly);
+  if(metaDataOnly || nullptr == ptr.get() || ptr->getSize() == 0)
+  {
+    return ptr;
+  }
+
+  hid_t did = H5Dopen(locId, datasetPath.toLatin1().data(), H5P_DEFAULT);
+  if(did < 0)
+  {
+    QString ss = QObject::tr("Unable to open the dataset with path '%1'").arg(datasetPath);
+    filter->setErrorCondition(-20013);
+    filter->notifyErrorMessage(filter->getHumanLabel(), ss, filter->getErrorCondition());
+    return IDataArray::NullPointer();
+  }
+  hid_t fileSpaceId = H5Dget_space(did);
+  int rank = H5Sget_simple_extent_ndims(fileSpaceId);
+  std::vector<hsize_t> dims(rank > 0 ? rank : 1, 1);
+  H5Sget_simple_extent_dims(fileSpaceId, dims.data(), nullptr);
+
+  // Slabs are taken along the slowest varying dimension of the dataset. The dataCheck has already
+  // made sure that the requested tuples start and end on a row of that dimension.
+  hsize_t rowElements = 1;
+  for(int i = 1; i < rank; i++)
+  {
+    rowElements *= dims[i];
+  }
+  hsize_t numComps = static_cast<hsize_t>(ptr->getNumberOfComponents());
+  hsize_t rowStart = (tupleOffset * numComps) / rowElements;
+  hsize_t rowCount = ptr->getSize() / rowElements;
+  hsize_t rowsPerSlab = std::max<hsize_t>(1, k_SlabByteSize / (rowElements * sizeof(typename SlabStagingType<T>::Type)));
+
+  std::vector<hsize_t> start(dims.size(), 0);
+  std::vector<hsize_t> count(dims);
+
+  herr_t err = 0;
+  for(hsize_t row = 0; row < rowCount; row += rowsPerSlab)
+  {
+    if(filter->getCancel())
+    {
+      err = -1;
+      break;
+    }
+
+    hsize_t slabRows = std::min(rowsPerSlab, rowCount - row);
+    hsize_t slabElements = slabRows * rowElements;
+    start[0] = rowStart + row;
+    count[0] = slabRows;
+    err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr);
+    if(err < 0)
+    {
+      break;
+    }
+    hid_t memSpaceId = H5Screate_simple(1, &slabElements, nullptr);
+    err = readSlab(did, memSpaceId, fileSpaceId, ptr->getPointer(row * rowElements));
+    H5Sclose(memSpaceId);
+    if(err < 0)
+    {
+      QString ss = QObject::tr("Error reading rows %1 to %2 of the dataset with path '%3'").arg(rowStart + row).arg(rowStart + row + slabRows - 1).arg(datasetPath);
+      filter->setErrorCondition(-20014);
+      filter->notifyErrorMessage(filter->getHumanLabel(), ss, filter->getErrorCondition());
+      break;
+    }
+
+    QString ss = QObject::tr("Reading Dataset || %1% Complete").arg(static_cast<int>((row + slabRows) * 100 / rowCount));
+    filter->notifyStatusMessage(filter->getMessagePrefix(), filter->getHumanLabel(), ss);
+  }
 
-  ptr = DataArray<T>::CreateArray(numOfTuples, cDims, datasetPath);
+  H5Sclose(fileSpaceId);
+  H5Dclose(did);
 
-  T* data = (T*)(ptr->getVoidPointer(0));
-  err = QH5Lite::readPointerDataset(locId, datasetPath, data);
   if(err < 0)
   {
-    qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
-    ptr = IDataArray::NullPointer();
+    return IDataArray::NullPointer();
   }
   return ptr;
 }
@@ -71,6 +236,10 @@ template <typename T> IDataArray::Pointer readH5Dataset(hid_t locId, const QStri
 //
 // -----------------------------------------------------------------------------
 ImportHDF5Dataset::ImportHDF5Dataset()
+: m_ConvertToScalarType(false)
+, m_ScalarType(SIMPL::NumericTypes::Type::Float)
+, m_UseTupleHyperslab(false)
+, m_TupleStartIndex(0)
 {
   initialize();
 }
@@ -108,6 +277,16 @@ void ImportHDF5Dataset::setupFilterParameters()
 
   parameters.push_back(SIMPL_NEW_STRING_FP("Component Dimensions", ComponentDimensions, FilterParameter::Parameter, ImportHDF5Dataset));
 
+  QStringList linkedProps;
+  linkedProps << "ScalarType";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Convert to Scalar Type", ConvertToScalarType, FilterParameter::Parameter, ImportHDF5Dataset, linkedProps));
+  parameters.push_back(SIMPL_NEW_NUMERICTYPE_FP("Scalar Type", ScalarType, FilterParameter::Parameter, ImportHDF5Dataset));
+
+  linkedProps.clear();
+  linkedProps << "TupleStartIndex";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Read Tuple Hyperslab", UseTupleHyperslab, FilterParameter::Parameter, ImportHDF5Dataset, linkedProps));
+  parameters.push_back(SIMPL_NEW_UINT64_FP("Start Tuple Index", TupleStartIndex, FilterParameter::Parameter, ImportHDF5Dataset));
+
   {
     AttributeMatrixSelectionFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_AM_SELECTION_FP("Attribute Matrix", SelectedAttributeMatrix, FilterParameter::RequiredArray, ImportHDF5Dataset, req));
@@ -263,7 +442,38 @@ void ImportHDF5Dataset::dataCheck()
   stream << tr("Attribute Matrix Path: %1/%2\n").arg(m_SelectedAttributeMatrix.getDataContainerName()).arg(m_SelectedAttributeMatrix.getAttributeMatrixName());
   stream << tr("Attribute Matrix Tuple Count: %1\n\n").arg(am->getNumberOfTuples());
 
-  if(dsetDimsProduct % cDimsProduct != 0 || dsetDimsProduct / cDimsProduct != am->getNumberOfTuples())
+  size_t tupleOffset = 0;
+  if(m_UseTupleHyperslab)
+  {
+    tupleOffset = m_TupleStartIndex;
+
+    size_t dsetTuples = dsetDimsProduct / cDimsProduct;
+    if(dsetDimsProduct % cDimsProduct != 0 || tupleOffset > dsetTuples || am->getNumberOfTuples() > dsetTuples - tupleOffset)
+    {
+      stream << tr("This dataset cannot be read because the requested tuples do not fit inside the dataset:\n"
+                   "(Start Tuple Index) + (Attribute Matrix Tuple Count) <= (Product of dataset dimensions) / (Product of component dimensions)\n"
+                   "%1 + %2 <= %3 / %4")
+                    .arg(QString::number(tupleOffset))
+                    .arg(QString::number(am->getNumberOfTuples()))
+                    .arg(QString::number(dsetDimsProduct))
+                    .arg(QString::number(cDimsProduct));
+
+      setErrorCondition(-20008);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+
+    // The hyperslab is streamed as whole rows of the slowest varying dataset dimension
+    size_t rowElements = (dims.size() > 0 && dims[0] > 0) ? dsetDimsProduct / dims[0] : 1;
+    if((tupleOffset * cDimsProduct) % rowElements != 0 || (am->getNumberOfTuples() * cDimsProduct) % rowElements != 0)
+    {
+      QString ss = tr("The requested tuples must start and end on a boundary of the first dataset dimension, which holds %1 values per index.").arg(rowElements);
+      setErrorCondition(-20010);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+  }
+  else if(dsetDimsProduct % cDimsProduct != 0 || dsetDimsProduct / cDimsProduct != am->getNumberOfTuples())
   {
     stream << tr("This dataset cannot be read because this equation is not satisfied:\n"
                  "(Product of dataset dimensions) / (Product of component dimensions) = (Attribute Matrix Tuple Count)\n"
@@ -279,7 +489,26 @@ void ImportHDF5Dataset::dataCheck()
     return;
   }
 
-  IDataArray::Pointer dPtr = readIDataArray(parentId, objectName, am->getNumberOfTuples(), cDims, getInPreflight());
+  if(m_ConvertToScalarType && m_ScalarType == SIMPL::NumericTypes::Type::UnknownNumType)
+  {
+    QString ss = tr("The selected scalar type is not supported.  Please select one of: %1").arg(SIMPL::NumericTypes::SupportedTypeList);
+    setErrorCondition(-20011);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
+  IDataArray::Pointer dPtr = readIDataArray(parentId, objectName, tupleOffset, am->getNumberOfTuples(), cDims, getInPreflight());
+  if(nullptr == dPtr.get())
+  {
+    if(getCancel() || getErrorCondition() < 0)
+    {
+      return;
+    }
+    QString ss = tr("Error reading dataset with path '%1'").arg(datasetPath);
+    setErrorCondition(-20012);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
   am->addAttributeArray(dPtr->getName(), dPtr);
 
   // The sentinel will close the HDF5 File and any groups that were open.
@@ -342,19 +571,15 @@ QVector<size_t> ImportHDF5Dataset::createComponentDimensions()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-IDataArray::Pointer ImportHDF5Dataset::readIDataArray(hid_t gid, const QString& name, size_t numOfTuples, QVector<size_t> cDims, bool metaDataOnly)
+IDataArray::Pointer ImportHDF5Dataset::readIDataArray(hid_t gid, const QString& name, size_t tupleOffset, size_t numOfTuples, QVector<size_t> cDims, bool metaDataOnly)
 {
   herr_t err = -1;
-  // herr_t retErr = 1;
-  hid_t typeId = -1;
   H5T_class_t attr_type;
   size_t attr_size;
-  QString res;
 
-  QVector<hsize_t> dims; // Reusable for the loop
+  QVector<hsize_t> dims;
   IDataArray::Pointer ptr = IDataArray::NullPointer();
-  // qDebug() << "Reading Attribute " << *iter ;
-  typeId = QH5Lite::getDatasetType(gid, name);
+  hid_t typeId = QH5Lite::getDatasetType(gid, name);
   if(typeId < 0)
   {
     return ptr;
@@ -366,151 +591,62 @@ IDataArray::Pointer ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
     qDebug() << "Error in getAttributeInfo method in readUserMetaData.";
   }
 
-  switch(attr_type)
+  SIMPL::NumericTypes::Type numericType = Detail::getNumericType(typeId, attr_type, attr_size);
+  // Close the H5A type Id that was retrieved above
+  err = H5Tclose(typeId);
+
+  if(numericType == SIMPL::NumericTypes::Type::UnknownNumType)
+  {
+    qDebug() << "Error: readIDataArray() Unknown dataset type: " << attr_type;
+    QH5Utilities::printHDFClassType(attr_type);
+    return ptr;
+  }
+
+  // Read straight into the requested type so that no full size copy in the native type is needed
+  if(m_ConvertToScalarType)
   {
-  case H5T_STRING:
-    res.clear(); // Clear the string out first
-    err = QH5Lite::readStringDataset(gid, name, res);
-    //        if(err >= 0)
-    //        {
-    //          IDataArray::Pointer attr = MXAAsciiStringData::Create(res);
-    //          attr->setName(name);
-    //          attributes[*iter] = attr;
-    //        }
+    numericType = m_ScalarType;
+  }
+
+  switch(numericType)
+  {
+  case SIMPL::NumericTypes::Type::Int8:
+    ptr = Detail::readH5Dataset<int8_t>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
     break;
-  case H5T_INTEGER:
-    // qDebug() << "User Meta Data Type is Integer" ;
-    if(H5Tequal(typeId, H5T_STD_U8BE) || H5Tequal(typeId, H5T_STD_U8LE))
-    {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<uint8_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<uint8_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
-    }
-    else if(H5Tequal(typeId, H5T_STD_U16BE) || H5Tequal(typeId, H5T_STD_U16LE))
-    {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<uint16_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<uint16_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
-    }
-    else if(H5Tequal(typeId, H5T_STD_U32BE) || H5Tequal(typeId, H5T_STD_U32LE))
-    {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<uint32_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<uint32_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
-    }
-    else if(H5Tequal(typeId, H5T_STD_U64BE) || H5Tequal(typeId, H5T_STD_U64LE))
-    {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<uint64_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<uint64_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
-    }
-    else if(H5Tequal(typeId, H5T_STD_I8BE) || H5Tequal(typeId, H5T_STD_I8LE))
-    {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<int8_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<int8_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
-    }
-    else if(H5Tequal(typeId, H5T_STD_I16BE) || H5Tequal(typeId, H5T_STD_I16LE))
-    {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<int16_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<int16_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
-    }
-    else if(H5Tequal(typeId, H5T_STD_I32BE) || H5Tequal(typeId, H5T_STD_I32LE))
-    {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<int32_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<int32_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
-    }
-    else if(H5Tequal(typeId, H5T_STD_I64BE) || H5Tequal(typeId, H5T_STD_I64LE))
-    {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<int64_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<int64_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
-    }
-    else
-    {
-      qDebug() << "Unknown Type: " << typeId << " at " << name;
-      err = -1;
-    }
+  case SIMPL::NumericTypes::Type::UInt8:
+    ptr = Detail::readH5Dataset<uint8_t>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
     break;
-  case H5T_FLOAT:
-    if(attr_size == 4)
-    {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<float>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<float>::CreateArray(numOfTuples, cDims, name, false);
-      }
-    }
-    else if(attr_size == 8)
-    {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<double>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<double>::CreateArray(numOfTuples, cDims, name, false);
-      }
-    }
-    else
-    {
-      qDebug() << "Unknown Floating point type";
-      err = -1;
-    }
+  case SIMPL::NumericTypes::Type::Int16:
+    ptr = Detail::readH5Dataset<int16_t>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
+    break;
+  case SIMPL::NumericTypes::Type::UInt16:
+    ptr = Detail::readH5Dataset<uint16_t>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
+    break;
+  case SIMPL::NumericTypes::Type::Int32:
+    ptr = Detail::readH5Dataset<int32_t>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
+    break;
+  case SIMPL::NumericTypes::Type::UInt32:
+    ptr = Detail::readH5Dataset<uint32_t>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
+    break;
+  case SIMPL::NumericTypes::Type::Int64:
+    ptr = Detail::readH5Dataset<int64_t>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
+    break;
+  case SIMPL::NumericTypes::Type::UInt64:
+    ptr = Detail::readH5Dataset<uint64_t>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
+    break;
+  case SIMPL::NumericTypes::Type::Float:
+    ptr = Detail::readH5Dataset<float>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
+    break;
+  case SIMPL::NumericTypes::Type::Double:
+    ptr = Detail::readH5Dataset<double>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
+    break;
+  case SIMPL::NumericTypes::Type::Bool:
+    ptr = Detail::readH5Dataset<bool>(this, gid, name, tupleOffset, numOfTuples, cDims, metaDataOnly);
     break;
   default:
-    qDebug() << "Error: readUserMetaData() Unknown attribute type: " << attr_type;
-    QH5Utilities::printHDFClassType(attr_type);
+    break;
   }
 
-  err = H5Tclose(typeId);
-  // Close the H5A type Id that was retrieved during the loop
-
   return ptr;
 }
 
@@ -535,6 +671,10 @@ AbstractFilter::Pointer ImportHDF5Dataset::newFilterInstance(bool copyFilterPara
     filter->setDatasetPaths(getDatasetPaths());
     filter->setComponentDimensions(getComponentDimensions());
     filter->setSelectedAttributeMatrix(getSelectedAttributeMatrix());
+    filter->setConvertToScalarType(getConvertToScalarType());
+    filter->setScalarType(getScalarType());
+    filter->setUseTupleHyperslab(getUseTupleHyperslab());
+    filter->setTupleStartIndex(getTupleStartIndex());
   }
   return filter;
 }
@@ -66,6 +66,18 @@ public:
   SIMPL_INSTANCE_PROPERTY(DataArrayPath, SelectedAttributeMatrix)
   Q_PROPERTY(DataArrayPath SelectedAttributeMatrix READ getSelectedAttributeMatrix WRITE setSelectedAttributeMatrix)
 
+  SIMPL_INSTANCE_PROPERTY(bool, ConvertToScalarType)
+  Q_PROPERTY(bool ConvertToScalarType READ getConvertToScalarType WRITE setConvertToScalarType)
+
+  SIMPL_INSTANCE_PROPERTY(SIMPL::NumericTypes::Type, ScalarType)
+  Q_PROPERTY(SIMPL::NumericTypes::Type ScalarType READ getScalarType WRITE setScalarType)
+
+  SIMPL_INSTANCE_PROPERTY(bool, UseTupleHyperslab)
+  Q_PROPERTY(bool UseTupleHyperslab READ getUseTupleHyperslab WRITE setUseTupleHyperslab)
+
+  SIMPL_INSTANCE_PROPERTY(size_t, TupleStartIndex)
+  Q_PROPERTY(quint64 TupleStartIndex READ getTupleStartIndex WRITE setTupleStartIndex)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -165,7 +177,19 @@ protected:
 private:
   QString m_HDF5Dimensions = "";
 
-  IDataArray::Pointer readIDataArray(hid_t gid, const QString& name, size_t numOfTuples, QVector<size_t> cDims, bool metaDataOnly);
+  /**
+   * @brief readIDataArray Creates the target array for the dataset and, unless only the meta data is requested,
+   * streams the selected tuples from the dataset into it. The element type is either the native type of the
+   * dataset or the requested ScalarType, in which case HDF5 converts the values while reading.
+   * @param gid Parent HDF5 location of the dataset
+   * @param name Name of the dataset
+   * @param tupleOffset First tuple to read from the dataset
+   * @param numOfTuples Number of tuples to read
+   * @param cDims Component dimensions of the created array
+   * @param metaDataOnly Only create an unallocated array
+   * @return
+   */
+  IDataArray::Pointer readIDataArray(hid_t gid, const QString& name, size_t tupleOffset, size_t numOfTuples, QVector<size_t> cDims, bool metaDataOnly);
 
   /**
    * @brief createComponentDimensions
@@ -66,6 +66,7 @@ void MaskCountDecision::setupFilterParameters()
   FilterParameterVector parameters = getFilterParameters();
   DataArraySelectionFilterParameter::RequirementType req =
       DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Bool, 1, AttributeMatrix::Type::Any, IGeometry::Type::Any);
+  req.daTypes.push_back(SIMPL::TypeNames::BitMask);
   parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Mask", MaskArrayPath, FilterParameter::RequiredArray, MaskCountDecision, req));
   parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of True Instances", NumberOfTrues, FilterParameter::Parameter, MaskCountDecision, 0));
   setFilterParameters(parameters);
@@ -100,6 +101,15 @@ void MaskCountDecision::dataCheck()
 
   QVector<size_t> cDims(1, 1);
 
+  // A packed mask is used as is, anything else must be a DataArray<bool>
+  m_Mask = nullptr;
+  m_MaskPtr.reset();
+  m_BitMaskPtr = getDataContainerArray()->getPrereqArrayFromPath<BitMaskArray, AbstractFilter>(nullptr, getMaskArrayPath(), cDims);
+  if(nullptr != m_BitMaskPtr.lock())
+  {
+    return;
+  }
+
   m_MaskPtr =
       getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getMaskArrayPath(), cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
   if(nullptr != m_MaskPtr.lock()) /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
@@ -134,7 +144,30 @@ void MaskCountDecision::execute()
     return;
   }
 
-  size_t numTuples = m_MaskPtr.lock()->getNumberOfTuples();
+  BitMaskArray::Pointer bitMask = m_BitMaskPtr.lock();
+  if(nullptr != bitMask && m_NumberOfTrues > 0)
+  {
+    // Count a whole word of the packed mask at a time until enough true values are found
+    size_t trueCount = 0;
+    BitMaskArray::Word* words = bitMask->getWords();
+    size_t numWords = bitMask->getNumberOfWords();
+    for(size_t w = 0; w < numWords; w++)
+    {
+      trueCount += BitMaskArray::PopCount(words[w]);
+      if(trueCount >= static_cast<size_t>(m_NumberOfTrues))
+      {
+        emit decisionMade(false);
+        emit targetValue(m_NumberOfTrues);
+        return;
+      }
+    }
+
+    emit decisionMade(true);
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
+  }
+
+  size_t numTuples = (nullptr != bitMask) ? bitMask->getNumberOfTuples() : m_MaskPtr.lock()->getNumberOfTuples();
 
   int32_t trueCount = 0;
   bool dm = true;
@@ -143,13 +176,14 @@ void MaskCountDecision::execute()
 
   for(size_t i = 0; i < numTuples; i++)
   {
-    if(m_NumberOfTrues < 0 && !m_Mask[i])
+    bool value = (nullptr != bitMask) ? bitMask->getValue(i) : m_Mask[i];
+    if(m_NumberOfTrues < 0 && !value)
     {
       qDebug() << "First if check: " << dm;
       emit decisionMade(dm);
       return;
     }
-    if(m_Mask[i])
+    if(value)
     {
       trueCount++;
     }
@@ -38,6 +38,7 @@
 #define _maskcountdecision_h_
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/BitMaskArray.hpp"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -134,6 +135,7 @@ class SIMPLib_EXPORT MaskCountDecision : public AbstractDecisionFilter
 
   private:
     DEFINE_DATAARRAY_VARIABLE(bool, Mask)
+    std::weak_ptr<BitMaskArray> m_BitMaskPtr;
 
     MaskCountDecision(const MaskCountDecision&) = delete; // Copy Constructor Not Implemented
     void operator=(const MaskCountDecision&) = delete;    // Move assignment Not Implemented
@@ -37,10 +37,12 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ComparisonSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
+#include "SIMPLib/Filtering/ThresholdPredicate.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
 // -----------------------------------------------------------------------------
@@ -49,6 +51,7 @@
 MultiThresholdObjects::MultiThresholdObjects()
 : m_DestinationArrayName(SIMPL::GeneralData::Mask)
 , m_SelectedThresholds()
+, m_StoreAsBitMask(false)
 , m_Destination(nullptr)
 {
 }
@@ -75,6 +78,7 @@ void MultiThresholdObjects::setupFilterParameters()
     parameter->setGetterCallback(SIMPL_BIND_GETTER(MultiThresholdObjects, this, SelectedThresholds));
     parameters.push_back(parameter);
   }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Store As Bit Mask", StoreAsBitMask, FilterParameter::Parameter, MultiThresholdObjects));
   parameters.push_back(SIMPL_NEW_STRING_FP("Output Attribute Array", DestinationArrayName, FilterParameter::CreatedArray, MultiThresholdObjects));
   setFilterParameters(parameters);
 }
@@ -87,6 +91,7 @@ void MultiThresholdObjects::readFilterParameters(AbstractFilterParametersReader*
   reader->openFilterGroup(this, index);
   setDestinationArrayName(reader->readString("DestinationArrayName", getDestinationArrayName()));
   setSelectedThresholds(reader->readComparisonInputs("SelectedThresholds", getSelectedThresholds()));
+  setStoreAsBitMask(reader->readValue("StoreAsBitMask", getStoreAsBitMask()));
   reader->closeFilterGroup();
 }
 
@@ -141,12 +146,22 @@ void MultiThresholdObjects::dataCheck()
     ComparisonInput_t comp = m_SelectedThresholds[0];
     QVector<size_t> cDims(1, 1);
     DataArrayPath tempPath(comp.dataContainerName, comp.attributeMatrixName, getDestinationArrayName());
-    m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>, AbstractFilter, bool>(this, tempPath, true,
-                                                                                                                    cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
-    if(nullptr != m_DestinationPtr.lock()) /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+    m_Destination = nullptr;
+    if(m_StoreAsBitMask)
     {
-      m_Destination = m_DestinationPtr.lock()->getPointer(0);
-    } /* Now assign the raw pointer to data from the DataArray<T> object */
+      m_DestinationPtr.reset();
+      m_DestinationBitMaskPtr = getDataContainerArray()->createNonPrereqArrayFromPath<BitMaskArray, AbstractFilter, bool>(this, tempPath, false, cDims);
+    }
+    else
+    {
+      m_DestinationBitMaskPtr.reset();
+      m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>, AbstractFilter, bool>(this, tempPath, true,
+                                                                                                                      cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+      if(nullptr != m_DestinationPtr.lock()) /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+      {
+        m_Destination = m_DestinationPtr.lock()->getPointer(0);
+      } /* Now assign the raw pointer to data from the DataArray<T> object */
+    }
 
     // Do not allow non-scalar arrays
     for(size_t i = 0; i < m_SelectedThresholds.size(); ++i)
@@ -208,56 +223,41 @@ void MultiThresholdObjects::execute()
   DataContainerArray::Pointer dca = getDataContainerArray();
   DataContainer::Pointer m = dca->getDataContainer(dcName);
 
-  // Prime our output array with the result of the first comparison
+  // Every comparison of this filter is combined with a logical AND, evaluate them all in a single pass
+  ComparisonInputsAdvanced comparisons;
+  for(int32_t i = 0; i < m_SelectedThresholds.size(); ++i)
+  {
+    ComparisonInput_t& compRef = m_SelectedThresholds[i];
+    comparisons.addInput(SIMPL::Union::Operator_And, compRef.attributeArrayName, compRef.compOperator, compRef.compValue);
+  }
+
+  ThresholdPredicate predicate;
+  if(!predicate.compile(comparisons, m->getAttributeMatrix(amName)))
   {
-    ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(comp_0.compOperator), comp_0.compValue, m_DestinationPtr.lock().get());
-    // Run the first threshold and store the results in our output array
-    err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comp_0.attributeArrayName).get(), m_DestinationPtr.lock().get());
-    if(err < 0)
+    DataArrayPath tempPath(dcName, amName, predicate.getInvalidArrayName());
+    if(predicate.getInvalidArrayName() == comp_0.attributeArrayName)
     {
-      DataArrayPath tempPath(comp_0.dataContainerName, comp_0.attributeMatrixName, comp_0.attributeArrayName);
       QString ss = QObject::tr("Error Executing threshold filter on first array. The path is %1").arg(tempPath.serialize());
       setErrorCondition(-13001);
       notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-      return;
     }
+    else
+    {
+      QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
+      setErrorCondition(-13002);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    }
+    return;
   }
 
-  if(m_SelectedThresholds.size() > 1)
+  BitMaskArray::Pointer bitMask = m_DestinationBitMaskPtr.lock();
+  if(nullptr != bitMask)
   {
-    // Get the total number of tuples, create and initialize an array to use for these results
-    int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-    BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP");
-
-    // Loop on the remaining Comparison objects updating our final result array as we go
-    for(int32_t i = 1; i < m_SelectedThresholds.size(); ++i)
-    {
-      // Initialize the array to false
-      currentArrayPtr->initializeWithZeros();
-      // Get the pointer to the front of the array. Raw Pointers = fast access = NO Bounds Checking!!!
-      bool* currentArray = currentArrayPtr->getPointer(0);
-
-      ComparisonInput_t& compRef = m_SelectedThresholds[i];
-
-      ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compRef.compOperator), compRef.compValue, currentArrayPtr.get());
-
-      err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(compRef.attributeArrayName).get(), currentArrayPtr.get());
-      if(err < 0)
-      {
-        DataArrayPath tempPath(compRef.dataContainerName, compRef.attributeMatrixName, compRef.attributeArrayName);
-        QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
-        setErrorCondition(-13002);
-        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-        return;
-      }
-      for(int64_t p = 0; p < totalTuples; ++p)
-      {
-        if(m_Destination[p] == false || currentArray[p] == false)
-        {
-          m_Destination[p] = false;
-        }
-      }
-    }
+    predicate.evaluate(bitMask->getWords());
+  }
+  else
+  {
+    predicate.evaluate(m_Destination);
   }
 
   /* Let the GUI know we are done with this filter */
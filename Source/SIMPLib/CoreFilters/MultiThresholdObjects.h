@@ -38,6 +38,7 @@
 #define _multithresholdobjects_h_
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/BitMaskArray.hpp"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/ComparisonInputs.h"
 #include "SIMPLib/SIMPLib.h"
@@ -61,6 +62,9 @@ class MultiThresholdObjects : public AbstractFilter
     SIMPL_FILTER_PARAMETER(ComparisonInputs, SelectedThresholds)
     Q_PROPERTY(ComparisonInputs SelectedThresholds READ getSelectedThresholds WRITE setSelectedThresholds)
 
+    SIMPL_FILTER_PARAMETER(bool, StoreAsBitMask)
+    Q_PROPERTY(bool StoreAsBitMask READ getStoreAsBitMask WRITE setStoreAsBitMask)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
@@ -164,6 +168,7 @@ class MultiThresholdObjects : public AbstractFilter
 
   private:
     DEFINE_DATAARRAY_VARIABLE(bool, Destination)
+    std::weak_ptr<BitMaskArray> m_DestinationBitMaskPtr;
 
   public:
     MultiThresholdObjects(const MultiThresholdObjects&) = delete; // Copy Constructor Not Implemented
@@ -37,10 +37,11 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/ComparisonSelectionAdvancedFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
-#include "SIMPLib/Filtering/ThresholdFilterHelper.h"
+#include "SIMPLib/Filtering/ThresholdPredicate.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
 // -----------------------------------------------------------------------------
@@ -49,6 +50,7 @@
 MultiThresholdObjects2::MultiThresholdObjects2()
 : m_DestinationArrayName(SIMPL::GeneralData::Mask)
 , m_SelectedThresholds()
+, m_StoreAsBitMask(false)
 , m_Destination(nullptr)
 {
 }
@@ -75,6 +77,7 @@ void MultiThresholdObjects2::setupFilterParameters()
     parameter->setGetterCallback(SIMPL_BIND_GETTER(MultiThresholdObjects2, this, SelectedThresholds));
     parameters.push_back(parameter);
   }
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Store As Bit Mask", StoreAsBitMask, FilterParameter::Parameter, MultiThresholdObjects2));
   parameters.push_back(SIMPL_NEW_STRING_FP("Output Attribute Array", DestinationArrayName, FilterParameter::CreatedArray, MultiThresholdObjects2));
   setFilterParameters(parameters);
 }
@@ -87,6 +90,7 @@ void MultiThresholdObjects2::readFilterParameters(AbstractFilterParametersReader
   reader->openFilterGroup(this, index);
   setDestinationArrayName(reader->readString("DestinationArrayName", getDestinationArrayName()));
   setSelectedThresholds(reader->readComparisonInputsAdvanced("SelectedThresholds", getSelectedThresholds()));
+  setStoreAsBitMask(reader->readValue("StoreAsBitMask", getStoreAsBitMask()));
   reader->closeFilterGroup();
 }
 
@@ -135,12 +139,22 @@ void MultiThresholdObjects2::dataCheck()
     //AbstractComparison::Pointer comp = m_SelectedThresholds[0];
     QVector<size_t> cDims(1, 1);
     DataArrayPath tempPath(dcName, amName, getDestinationArrayName());
-    m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>, AbstractFilter, bool>(this, tempPath, true,
-                                                                                                                    cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
-    if(nullptr != m_DestinationPtr.lock()) /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+    m_Destination = nullptr;
+    if(m_StoreAsBitMask)
     {
-      m_Destination = m_DestinationPtr.lock()->getPointer(0);
-    } /* Now assign the raw pointer to data from the DataArray<T> object */
+      m_DestinationPtr.reset();
+      m_DestinationBitMaskPtr = getDataContainerArray()->createNonPrereqArrayFromPath<BitMaskArray, AbstractFilter, bool>(this, tempPath, false, cDims);
+    }
+    else
+    {
+      m_DestinationBitMaskPtr.reset();
+      m_DestinationPtr = getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<bool>, AbstractFilter, bool>(this, tempPath, true,
+                                                                                                                      cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
+      if(nullptr != m_DestinationPtr.lock()) /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
+      {
+        m_Destination = m_DestinationPtr.lock()->getPointer(0);
+      } /* Now assign the raw pointer to data from the DataArray<T> object */
+    }
 
     // Do not allow non-scalar arrays
     for(size_t i = 0; i < comparisonValues.size(); ++i)
@@ -214,227 +228,30 @@ void MultiThresholdObjects2::execute()
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
-  else
-  {
-    bool invert = m_SelectedThresholds.shouldInvert();
-
-    int64_t thresholdSize;
-    BoolArrayType::Pointer thresholdArray;
-
-    createBoolArray(thresholdSize, thresholdArray);
-    bool firstValueFound = false;
-
-    // Loop on the remaining Comparison objects updating our final result array as we go
-    for(int32_t i = 0; i < m_SelectedThresholds.size() && err >= 0; ++i)
-    {
-      if (std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]))
-      {
-        ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(m_SelectedThresholds[i]);
-        thresholdSet(comparisonSet, thresholdArray, err, !firstValueFound, false);
-        firstValueFound = true;
-      }
-      else if(std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]))
-      {
-        ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(m_SelectedThresholds[i]);
-        thresholdValue(comparisonValue, thresholdArray, err, !firstValueFound, false);
-        firstValueFound = true;
-      }
-    }
-
-    if (invert)
-    {
-      invertThreshold(thresholdSize, thresholdArray);
-    }
-
-    bool* threshold = thresholdArray->getPointer(0);
-    for (int64_t p = 0; p < thresholdSize; p++)
-    {
-      m_Destination[p] = threshold[p];
-    }
-    
-  }
-  
-  /* Let the GUI know we are done with this filter */
-  notifyStatusMessage(getHumanLabel(), "Complete");
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::createBoolArray(int64_t& totalTuples, BoolArrayType::Pointer& thresholdArrayPtr)
-{
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  thresholdArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP");
-
-  // Initialize the array to false
-  thresholdArrayPtr->initializeWithZeros();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::insertThreshold(int64_t numItems, BoolArrayType::Pointer currentArrayPtr, int unionOperator, const BoolArrayType::Pointer newArrayPtr, bool inverse)
-{
-  bool* newArray = newArrayPtr->getPointer(0);
-  bool* currentArray = currentArrayPtr->getPointer(0);
-
-  for (int64_t i = 0; i < numItems; i++)
-  {
-    // invert the current comparison if necessary
-    if (inverse)
-    {
-      newArray[i] = !newArray[i];
-    }
-
-    if (SIMPL::Union::Operator_Or == unionOperator)
-    {
-      currentArray[i] = currentArray[i] || newArray[i];
-    }
-    else if (currentArray[i] == false || newArray[i] == false)
-    {
-      currentArray[i] = false;
-    }
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::invertThreshold(int64_t numItems, BoolArrayType::Pointer thresholdArray)
-{
-  bool* threshold = thresholdArray->getPointer(0);
-
-  for (int64_t i = 0; i < numItems; i++)
-  {
-    threshold[i] = !threshold[i];
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdSet(ComparisonSet::Pointer comparisonSet, BoolArrayType::Pointer& currentThreshold, int32_t &err, bool replaceInput, bool inverse)
-{
-  if (nullptr == comparisonSet)
-  {
-    return;
-  }
-
-  if (inverse)
-  {
-    inverse = !comparisonSet->getInvertComparison();
-  }
-  else
-  {
-    inverse = comparisonSet->getInvertComparison();
-  }
-
-  int64_t setArraySize;
-  BoolArrayType::Pointer setThresholdArray;
-
-  createBoolArray(setArraySize, setThresholdArray);
-  bool firstValueFound = false;
-
-  QVector<AbstractComparison::Pointer> comparisons = comparisonSet->getComparisons();
-  for (int i = 0; i < comparisons.size(); i++)
-  {
-    // Check all contents of child Comparison Sets
-    if (std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i)))
-    { 
-      ComparisonSet::Pointer childSet = std::dynamic_pointer_cast<ComparisonSet>(comparisons.at(i));
-      thresholdSet(childSet, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-    // Check Comparison Values
-    if (std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i)))
-    {
-      ComparisonValue::Pointer childValue = std::dynamic_pointer_cast<ComparisonValue>(comparisons.at(i));
-      thresholdValue(childValue, setThresholdArray, err, !firstValueFound, false);
-      firstValueFound = true;
-    }
-
-    if (err < 0)
-    {
-      return;
-    }
-  }
-
-  if (replaceInput)
-  {
-    if (inverse)
-    {
-      invertThreshold(setArraySize, setThresholdArray);
-    }
-    currentThreshold.swap(setThresholdArray);
-  }
-  else
-  {
-    // insert into current threshold
-    insertThreshold(setArraySize, currentThreshold, comparisonSet->getUnionOperator(), setThresholdArray, inverse);
-  }
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void MultiThresholdObjects2::thresholdValue(ComparisonValue::Pointer comparisonValue, BoolArrayType::Pointer& inputThreshold, int32_t &err, bool replaceInput, bool inverse)
-{
-  if (nullptr == comparisonValue)
-  {
-    return;
-  }
 
-  // Get the names of the Data Container and AttributeMatrix for later
-  QString dcName = m_SelectedThresholds.getDataContainerName();
-  QString amName = m_SelectedThresholds.getAttributeMatrixName();
-
-  DataContainerArray::Pointer dca = getDataContainerArray();
-  DataContainer::Pointer m = dca->getDataContainer(dcName);
-
-  // Get the total number of tuples, create and initialize an array to use for these results
-  int64_t totalTuples = static_cast<int64_t>(m->getAttributeMatrix(amName)->getNumberOfTuples());
-  BoolArrayType::Pointer currentArrayPtr = BoolArrayType::CreateArray(totalTuples, "_INTERNAL_USE_ONLY_TEMP");
-
-  // Initialize the array to false
-  currentArrayPtr->initializeWithZeros();
-
-  //bool* currentArray = currentArrayPtr->getPointer(0);
-  int compOperator = comparisonValue->getCompOperator();
-  double compValue = comparisonValue->getCompValue();
-
-  ThresholdFilterHelper filter(static_cast<SIMPL::Comparison::Enumeration>(compOperator), compValue, currentArrayPtr.get());
-
-  err = filter.execute(m->getAttributeMatrix(amName)->getAttributeArray(comparisonValue->getAttributeArrayName()).get(), currentArrayPtr.get());
-  if (err < 0)
+  // Compile the whole comparison tree into one predicate and evaluate it in a single pass
+  ThresholdPredicate predicate;
+  if(!predicate.compile(m_SelectedThresholds, m->getAttributeMatrix(amName)))
   {
-    DataArrayPath tempPath(m_SelectedThresholds.getDataContainerName(), m_SelectedThresholds.getAttributeMatrixName(), comparisonValue->getAttributeArrayName());
+    DataArrayPath tempPath(dcName, amName, predicate.getInvalidArrayName());
     QString ss = QObject::tr("Error Executing threshold filter on array. The path is %1").arg(tempPath.serialize());
     setErrorCondition(-13002);
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
-  
-  if (replaceInput)
+
+  BitMaskArray::Pointer bitMask = m_DestinationBitMaskPtr.lock();
+  if(nullptr != bitMask)
   {
-    if (inverse)
-    {
-      invertThreshold(totalTuples, currentArrayPtr);
-    }
-    inputThreshold.swap(currentArrayPtr);
+    predicate.evaluate(bitMask->getWords());
   }
-  else 
+  else
   {
-    // insert into current threshold
-    insertThreshold(totalTuples, inputThreshold, comparisonValue->getUnionOperator(), currentArrayPtr, inverse);
+    predicate.evaluate(m_Destination);
   }
+
+  /* Let the GUI know we are done with this filter */
+  notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
 // -----------------------------------------------------------------------------
@@ -33,6 +33,7 @@
 #ifndef _postslackmessage_h_
 #define _postslackmessage_h_
 
+#include <QtCore/QMutex>
 #include <QtCore/QWaitCondition>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
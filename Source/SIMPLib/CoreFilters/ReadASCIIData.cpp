@@ -4,12 +4,26 @@
 
 #include "ReadASCIIData.h"
 
+#include <algorithm>
+#include <vector>
+
+#include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QTextStream>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/StringDataArray.hpp"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
+#include "SIMPLib/Utilities/LineOffsetIndex.h"
+#include "SIMPLib/Utilities/ParallelProgress.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
 #include "SIMPLib/FilterParameters/ReadASCIIDataFilterParameter.h"
@@ -18,6 +32,180 @@
 
 #include "SIMPLib/CoreFilters/util/AbstractDataParser.hpp"
 
+namespace
+{
+/**
+ * @brief parseLine Tokenizes one line of the file and parses every column into the tuple 'insertIndex'
+ * @return 0 on success or the ReadASCIIData error code, with 'errorMessage' describing the failure
+ */
+int parseLine(const QString& line, int64_t lineNum, size_t insertIndex, const QList<AbstractDataParser::Pointer>& dataParsers, int numColumns, const QList<char>& delimiters,
+              bool consecutiveDelimiters, QString& errorMessage)
+{
+  QStringList tokens = StringOperations::TokenizeString(line, delimiters, consecutiveDelimiters);
+
+  if(numColumns != tokens.size())
+  {
+    errorMessage = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
+    QTextStream out(&errorMessage);
+    out << "Expecting " << numColumns << " but found " << tokens.size() << "\n";
+    out << "Input line was:\n";
+    out << line;
+    return ReadASCIIData::INCONSISTENT_COLS;
+  }
+
+  for(int i = 0; i < dataParsers.size(); i++)
+  {
+    AbstractDataParser::Pointer parser = dataParsers[i];
+    int index = parser->getColumnIndex();
+
+    ParserFunctor::ErrorObject obj = parser->parse(tokens[index], insertIndex);
+    if(!obj.ok)
+    {
+      errorMessage = obj.errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
+      return ReadASCIIData::CONVERSION_FAILURE;
+    }
+  }
+  return 0;
+}
+}
+
+/**
+ * @brief The ParseASCIIBlocksImpl class parses the blocks of lines of a LineOffsetIndex. Each block is
+ * read through its own seek into the file and writes its own tuples, so blocks can be parsed concurrently.
+ * The first error of each block is stored at the block's position so the error on the lowest line can be
+ * reported once every block is done.
+ */
+class ParseASCIIBlocksImpl
+{
+public:
+  ParseASCIIBlocksImpl(LineOffsetIndex* index, int64_t beginIndex, int64_t numLines, const QList<AbstractDataParser::Pointer>& dataParsers, int numColumns, const QList<char>& delimiters,
+                       bool consecutiveDelimiters, std::vector<int>& errorCodes, std::vector<QString>& errorMessages, ParallelProgress* progress)
+  : m_Index(index)
+  , m_BeginIndex(beginIndex)
+  , m_NumLines(numLines)
+  , m_DataParsers(dataParsers)
+  , m_NumColumns(numColumns)
+  , m_Delimiters(delimiters)
+  , m_ConsecutiveDelimiters(consecutiveDelimiters)
+  , m_ErrorCodes(errorCodes)
+  , m_ErrorMessages(errorMessages)
+  , m_Progress(progress)
+  {
+  }
+  virtual ~ParseASCIIBlocksImpl() = default;
+
+  void parse(size_t start, size_t end) const
+  {
+    QFile inputFile(m_Index->getFilePath());
+    if(!inputFile.open(QIODevice::ReadOnly))
+    {
+      return;
+    }
+    QTextStream in(&inputFile);
+
+    size_t numBlocks = m_Index->getNumberOfBlocks();
+    for(size_t block = start; block < end; block++)
+    {
+      if(m_Progress->wasCanceled())
+      {
+        return;
+      }
+
+      int64_t firstLine = std::max(m_Index->getBlockFirstLine(block), m_BeginIndex);
+      int64_t lastLine = (block + 1 < numBlocks) ? std::min(m_Index->getBlockFirstLine(block + 1) - 1, m_NumLines) : m_NumLines;
+      if(firstLine > lastLine)
+      {
+        continue;
+      }
+
+      // Lines past the end of the file are read as empty lines, as the serial reader does
+      bool pastEnd = !m_Index->seekToLine(in, firstLine);
+      for(int64_t lineNum = firstLine; lineNum <= lastLine; lineNum++)
+      {
+        QString line = pastEnd ? QString() : in.readLine();
+        int err = parseLine(line, lineNum, static_cast<size_t>(lineNum - m_BeginIndex), m_DataParsers, m_NumColumns, m_Delimiters, m_ConsecutiveDelimiters, m_ErrorMessages[block]);
+        if(err < 0)
+        {
+          m_ErrorCodes[block] = err;
+          return;
+        }
+      }
+      m_Progress->increment(lastLine - firstLine + 1);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    parse(r.begin(), r.end());
+  }
+#endif
+
+private:
+  LineOffsetIndex* m_Index;
+  int64_t m_BeginIndex;
+  int64_t m_NumLines;
+  const QList<AbstractDataParser::Pointer>& m_DataParsers;
+  int m_NumColumns;
+  const QList<char>& m_Delimiters;
+  bool m_ConsecutiveDelimiters;
+  std::vector<int>& m_ErrorCodes;
+  std::vector<QString>& m_ErrorMessages;
+  ParallelProgress* m_Progress;
+};
+
+namespace
+{
+/**
+ * @brief parseBlocks Parses the lines of the wizard data through the blocks of the line index, in parallel when available.
+ */
+void parseBlocks(AbstractFilter* filter, const ASCIIWizardData& wizardData, LineOffsetIndex* lineIndex, const QList<AbstractDataParser::Pointer>& dataParsers)
+{
+  int64_t beginIndex = wizardData.beginIndex;
+  int64_t numLines = wizardData.numberOfLines;
+
+  size_t numBlocks = lineIndex->getNumberOfBlocks();
+  size_t firstBlock = std::min(static_cast<size_t>((beginIndex - 1) / lineIndex->getStride()), numBlocks - 1);
+  std::vector<int> errorCodes(numBlocks, 0);
+  std::vector<QString> errorMessages(numBlocks);
+
+  ParallelProgress progress(filter, numLines - beginIndex + 1, filter->getMessagePrefix(), filter->getHumanLabel(), QObject::tr("Importing ASCII Data"), filter);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(firstBlock, numBlocks),
+                      ParseASCIIBlocksImpl(lineIndex, beginIndex, numLines, dataParsers, wizardData.dataTypes.size(), wizardData.delimiters, wizardData.consecutiveDelimiters, errorCodes,
+                                           errorMessages, &progress),
+                      tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ParseASCIIBlocksImpl serial(lineIndex, beginIndex, numLines, dataParsers, wizardData.dataTypes.size(), wizardData.delimiters, wizardData.consecutiveDelimiters, errorCodes, errorMessages,
+                                &progress);
+    serial.parse(firstBlock, numBlocks);
+  }
+  progress.stop();
+
+  // Report the error on the lowest line, as reading the file in order would
+  for(size_t block = firstBlock; block < numBlocks; block++)
+  {
+    if(errorCodes[block] < 0)
+    {
+      filter->setErrorCondition(errorCodes[block]);
+      filter->notifyErrorMessage(filter->getHumanLabel(), errorMessages[block], filter->getErrorCondition());
+      return;
+    }
+  }
+}
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -517,6 +705,29 @@ void ReadASCIIData::execute()
     }
   }
 
+  // The blocks of the line index are parsed concurrently. The index built by the import wizard is reused
+  // when it still matches the file, otherwise a new one is built with a single scan of the file.
+  LineOffsetIndex::Pointer lineIndex = wizardData.lineOffsetIndex;
+  if(nullptr == lineIndex.get() || !lineIndex->matchesFile(inputFilePath))
+  {
+    lineIndex = LineOffsetIndex::New();
+    if(!lineIndex->build(inputFilePath))
+    {
+      lineIndex = LineOffsetIndex::NullPointer();
+    }
+  }
+
+  if(nullptr != lineIndex.get() && lineIndex->getNumberOfBlocks() > 0 && beginIndex >= 1 && beginIndex <= numLines)
+  {
+    parseBlocks(this, wizardData, lineIndex.get(), dataParsers);
+    if(getErrorCondition() < 0 || getCancel())
+    {
+      return;
+    }
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
+  }
+
   int insertIndex = 0;
 
   QFile inputFile(inputFilePath);
@@ -536,38 +747,15 @@ void ReadASCIIData::execute()
     for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
     {
       QString line = in.readLine();
-      QStringList tokens = StringOperations::TokenizeString(line, delimiters, consecutiveDelimiters);
-
-      if(dataTypes.size() != tokens.size())
+      QString errorMessage;
+      int err = parseLine(line, lineNum, insertIndex, dataParsers, dataTypes.size(), delimiters, consecutiveDelimiters, errorMessage);
+      if(err < 0)
       {
-        QString ss = "Line " + QString::number(lineNum) + " has an inconsistent number of columns.\n";
-        QTextStream out(&ss);
-        out << "Expecting " << dataTypes.size() << " but found " << tokens.size() << "\n";
-        out << "Input line was:\n";
-        out << line;
-        setErrorCondition(INCONSISTENT_COLS);
-        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        setErrorCondition(err);
+        notifyErrorMessage(getHumanLabel(), errorMessage, getErrorCondition());
         return;
       }
 
-      for(int i = 0; i < dataParsers.size(); i++)
-      {
-        AbstractDataParser::Pointer parser = dataParsers[i];
-        int index = parser->getColumnIndex();
-        QString name = parser->getColumnName();
-
-        ParserFunctor::ErrorObject obj = parser->parse(tokens[index], insertIndex);
-        if(!obj.ok)
-        {
-          QString dataType = parser->getDataArray()->getTypeAsString();
-          QString errorMessage = obj.errorMessage;
-          QString ss = errorMessage + "(line " + QString::number(lineNum) + ", column " + QString::number(index) + ").";
-          setErrorCondition(CONVERSION_FAILURE);
-          notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-          return;
-        }
-      }
-
       if(((float)lineNum / numTuples) * 100.0f > threshold)
       {
         // Print the status of the import
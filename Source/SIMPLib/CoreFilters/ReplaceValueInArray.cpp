@@ -35,6 +35,13 @@
 
 #include "ReplaceValueInArray.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/TemplateHelpers.hpp"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
@@ -133,6 +140,49 @@ template <typename T> void checkValuesFloatDouble(AbstractFilter* filter, double
 //
 // -----------------------------------------------------------------------------
 
+/**
+ * @brief The ReplaceValueInArrayImpl class replaces every occurrence of a value over a range of tuples
+ */
+template <typename T> class ReplaceValueInArrayImpl
+{
+public:
+  ReplaceValueInArrayImpl(T* data, T removeValue, T replaceValue)
+  : m_Data(data)
+  , m_RemoveValue(removeValue)
+  , m_ReplaceValue(replaceValue)
+  {
+  }
+  virtual ~ReplaceValueInArrayImpl() = default;
+
+  void replace(size_t start, size_t end) const
+  {
+    T* data = m_Data;
+    const T removeVal = m_RemoveValue;
+    const T replaceVal = m_ReplaceValue;
+    // Compare and select without a branch so the loop vectorizes; every element is written back
+    for(size_t i = start; i < end; i++)
+    {
+      const T value = data[i];
+      data[i] = (value == removeVal) ? replaceVal : value;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    replace(r.begin(), r.end());
+  }
+#endif
+
+private:
+  T* m_Data;
+  T m_RemoveValue;
+  T m_ReplaceValue;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
 template <typename T> void replaceValue(AbstractFilter* filter, IDataArray::Pointer inDataPtr, double removeValue, double replaceValue)
 {
   typename DataArray<T>::Pointer inputArrayPtr = std::dynamic_pointer_cast<DataArray<T>>(inDataPtr);
@@ -143,12 +193,21 @@ template <typename T> void replaceValue(AbstractFilter* filter, IDataArray::Poin
   T* inData = inputArrayPtr->getPointer(0);
   size_t numTuples = inputArrayPtr->getNumberOfTuples();
 
-  for(size_t iter = 0; iter < numTuples; iter++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
   {
-    if(inData[iter] == removeVal)
-    {
-      inData[iter] = replaceVal;
-    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numTuples), ReplaceValueInArrayImpl<T>(inData, removeVal, replaceVal), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ReplaceValueInArrayImpl<T> serial(inData, removeVal, replaceVal);
+    serial.replace(0, numTuples);
   }
 }
 
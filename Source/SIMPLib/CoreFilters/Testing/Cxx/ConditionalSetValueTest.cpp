@@ -38,6 +38,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Common/TemplateHelpers.hpp"
+#include "SIMPLib/DataArrays/BitMaskArray.hpp"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Filtering/FilterFactory.hpp"
 #include "SIMPLib/Filtering/FilterManager.h"
@@ -333,6 +334,128 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int ReplaceMultipleArraysTest()
+  {
+    DataContainerArray::Pointer dca = initializeDataContainerArray();
+    DataContainer::Pointer dc = dca->getDataContainer("ConditionalSetValueTest");
+
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName("ConditionalSetValue");
+    DREAM3D_REQUIRE(factory.get() != nullptr)
+
+    AbstractFilter::Pointer filter = factory->create();
+    DREAM3D_REQUIRE(filter.get() != nullptr)
+    filter->setDataContainerArray(dca);
+
+    DataArrayPath attrMat_int32_1("ConditionalSetValueTest", "ConditionalSetValueAttrMat", "int32_t1");
+    DataArrayPath attrMat_float_1("ConditionalSetValueTest", "ConditionalSetValueAttrMat", "float1");
+    DataArrayPath attrMat_int8_1("ConditionalSetValueTest", "ConditionalSetValueAttrMat", "int8_t1");
+    DataArrayPath attrMat_int8_3("ConditionalSetValueTest", "ConditionalSetValueAttrMat", "int8_t3");
+    DataArrayPath conditionalArray("ConditionalSetValueTest", "ConditionalSetValueAttrMat", "ConditionalArray");
+
+    QVariant var;
+    var.setValue(attrMat_int32_1);
+    DREAM3D_REQUIRE(filter->setProperty("SelectedArrayPath", var))
+    var.setValue(conditionalArray);
+    DREAM3D_REQUIRE(filter->setProperty("ConditionalArrayPath", var))
+
+    // Every additional array must be scalar
+    QVector<DataArrayPath> additionalPaths;
+    additionalPaths << attrMat_float_1 << attrMat_int8_3;
+    var.setValue(additionalPaths);
+    DREAM3D_REQUIRE(filter->setProperty("AdditionalArrayPaths", var))
+    var.setValue(5.0);
+    DREAM3D_REQUIRE(filter->setProperty("ReplaceValue", var))
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -11002)
+
+    // The replace value must fit every additional array
+    additionalPaths.clear();
+    additionalPaths << attrMat_float_1 << attrMat_int8_1;
+    var.setValue(additionalPaths);
+    DREAM3D_REQUIRE(filter->setProperty("AdditionalArrayPaths", var))
+    var.setValue(128.0);
+    DREAM3D_REQUIRE(filter->setProperty("ReplaceValue", var))
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -100)
+
+    var.setValue(5.0);
+    DREAM3D_REQUIRE(filter->setProperty("ReplaceValue", var))
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+    IDataArray::Pointer condArray = dc->getAttributeMatrix(conditionalArray.getAttributeMatrixName())->getAttributeArray(conditionalArray.getDataArrayName());
+    validateReplacedValues<int32_t>(dc->getAttributeMatrix(attrMat_int32_1.getAttributeMatrixName())->getAttributeArray(attrMat_int32_1.getDataArrayName()), condArray);
+    validateReplacedValues<float>(dc->getAttributeMatrix(attrMat_float_1.getAttributeMatrixName())->getAttributeArray(attrMat_float_1.getDataArrayName()), condArray);
+    validateReplacedValues<int8_t>(dc->getAttributeMatrix(attrMat_int8_1.getAttributeMatrixName())->getAttributeArray(attrMat_int8_1.getDataArrayName()), condArray);
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int ReplaceBitMaskTest()
+  {
+    DataContainerArray::Pointer dca = initializeDataContainerArray();
+    DataContainer::Pointer dc = dca->getDataContainer("ConditionalSetValueTest");
+    AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix("ConditionalSetValueAttrMat");
+    size_t numTuples = attrMat->getNumberOfTuples();
+
+    BitMaskArray::Pointer target = BitMaskArray::CreateArray(numTuples, "MaskTarget");
+    target->initializeWithValue(true);
+    attrMat->addAttributeArray(target->getName(), target);
+
+    BitMaskArray::Pointer condMask = BitMaskArray::CreateArray(numTuples, "ConditionalMask");
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      condMask->setValue(i, i % 2 == 0);
+    }
+    attrMat->addAttributeArray(condMask->getName(), condMask);
+
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName("ConditionalSetValue");
+    DREAM3D_REQUIRE(factory.get() != nullptr)
+
+    AbstractFilter::Pointer filter = factory->create();
+    DREAM3D_REQUIRE(filter.get() != nullptr)
+    filter->setDataContainerArray(dca);
+
+    // A packed target array with a DataArray<bool> conditional array
+    QVariant var;
+    var.setValue(DataArrayPath("ConditionalSetValueTest", "ConditionalSetValueAttrMat", "MaskTarget"));
+    DREAM3D_REQUIRE(filter->setProperty("SelectedArrayPath", var))
+    var.setValue(DataArrayPath("ConditionalSetValueTest", "ConditionalSetValueAttrMat", "ConditionalArray"));
+    DREAM3D_REQUIRE(filter->setProperty("ConditionalArrayPath", var))
+    var.setValue(0.0);
+    DREAM3D_REQUIRE(filter->setProperty("ReplaceValue", var))
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(target->getValue(i), i % 2 == 0)
+    }
+
+    // A packed target array with a packed conditional array
+    var.setValue(DataArrayPath("ConditionalSetValueTest", "ConditionalSetValueAttrMat", "ConditionalMask"));
+    DREAM3D_REQUIRE(filter->setProperty("ConditionalArrayPath", var))
+    target->initializeWithValue(false);
+    var.setValue(1.0);
+    DREAM3D_REQUIRE(filter->setProperty("ReplaceValue", var))
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(target->getValue(i), i % 2 == 0)
+    }
+    DREAM3D_REQUIRE_EQUAL(target->countTrue(), (numTuples + 1) / 2)
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -343,6 +466,8 @@ public:
     int err = EXIT_SUCCESS;
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
     DREAM3D_REGISTER_TEST(ReplaceValueTest())
+    DREAM3D_REGISTER_TEST(ReplaceMultipleArraysTest())
+    DREAM3D_REGISTER_TEST(ReplaceBitMaskTest())
   }
 
 private:
@@ -37,6 +37,7 @@
 #include <QtCore/QDir>
 
 #include <assert.h>
+#include <limits>
 #include <stdint.h>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -605,6 +606,133 @@ public:
     DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer createFloatDataContainerArray(const QVector<float>& values)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New();
+    dc->setName("DataContainer");
+    dca->addDataContainer(dc);
+
+    AttributeMatrix::Pointer am = AttributeMatrix::New(QVector<size_t>(1, values.size()), "AttributeMatrix", AttributeMatrix::Type::Any);
+    dc->addAttributeMatrix("AttributeMatrix", am);
+
+    FloatArrayType::Pointer da = FloatArrayType::CreateArray(values.size(), "DataArray");
+    for(int i = 0; i < values.size(); i++)
+    {
+      da->setValue(i, values[i]);
+    }
+    am->addAttributeArray("DataArray", da);
+
+    return dca;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestClampToTargetRange()
+  {
+    QVector<float> values = {-10.0f, 0.0f, 12.75f, 255.0f, 300.0f, std::numeric_limits<float>::quiet_NaN()};
+    QVector<uint8_t> exemplar = {0, 0, 12, 255, 255, 0};
+
+    ConvertData::Pointer filter = createFilter();
+    filter->setDataContainerArray(createFloatDataContainerArray(values));
+    setValues(filter, "DataArray", SIMPL::NumericTypes::Type::UInt8, "NewArrayUChar");
+    filter->setClampToTargetRange(true);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    AttributeMatrix::Pointer am = filter->getDataContainerArray()->getDataContainer("DataContainer")->getAttributeMatrix("AttributeMatrix");
+    UInt8ArrayType::Pointer converted = getDataArray<uint8_t>(am, "NewArrayUChar");
+    DREAM3D_REQUIRE_VALID_POINTER(converted.get());
+    for(int i = 0; i < exemplar.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(converted->getValue(i), exemplar[i]);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConvertInPlace()
+  {
+    QVector<float> values = {-10.0f, 0.0f, 12.75f, 255.0f, 300.0f, 1.0f};
+
+    // Narrowing conversion reuses the memory of the input array
+    {
+      ConvertData::Pointer filter = createFilter();
+      filter->setDataContainerArray(createFloatDataContainerArray(values));
+      setValues(filter, "DataArray", SIMPL::NumericTypes::Type::Int16, "NewArrayShort");
+      filter->setConvertInPlace(true);
+
+      filter->preflight();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+      filter->setDataContainerArray(createFloatDataContainerArray(values));
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+      AttributeMatrix::Pointer am = filter->getDataContainerArray()->getDataContainer("DataContainer")->getAttributeMatrix("AttributeMatrix");
+      DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("DataArray"), false);
+      Int16ArrayType::Pointer converted = getDataArray<int16_t>(am, "NewArrayShort");
+      DREAM3D_REQUIRE_VALID_POINTER(converted.get());
+      DREAM3D_REQUIRE_EQUAL(converted->getNumberOfTuples(), static_cast<size_t>(values.size()));
+      for(int i = 0; i < values.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(converted->getValue(i), static_cast<int16_t>(values[i]));
+      }
+    }
+
+    // An array that wraps memory it does not own is converted into a new array and leaves that memory untouched
+    {
+      std::vector<float> external(values.begin(), values.end());
+      DataContainerArray::Pointer dca = createFloatDataContainerArray(values);
+      AttributeMatrix::Pointer am = dca->getDataContainer("DataContainer")->getAttributeMatrix("AttributeMatrix");
+      FloatArrayType::Pointer wrapped = FloatArrayType::WrapPointer(external.data(), external.size(), QVector<size_t>(1, 1), "DataArray", false);
+      am->addAttributeArray("DataArray", wrapped);
+
+      ConvertData::Pointer filter = createFilter();
+      filter->setDataContainerArray(dca);
+      setValues(filter, "DataArray", SIMPL::NumericTypes::Type::Int16, "NewArrayShort");
+      filter->setConvertInPlace(true);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+      for(int i = 0; i < values.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(external[i], values[i]);
+      }
+      DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("DataArray"), false);
+      Int16ArrayType::Pointer converted = getDataArray<int16_t>(am, "NewArrayShort");
+      DREAM3D_REQUIRE_VALID_POINTER(converted.get());
+      DREAM3D_REQUIRE_VALID_POINTER(converted->getPointer(0));
+      for(int i = 0; i < values.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(converted->getValue(i), static_cast<int16_t>(values[i]));
+      }
+    }
+
+    // Widening conversion still replaces the input array
+    {
+      ConvertData::Pointer filter = createFilter();
+      filter->setDataContainerArray(createFloatDataContainerArray(values));
+      setValues(filter, "DataArray", SIMPL::NumericTypes::Type::Double, "DataArray");
+      filter->setConvertInPlace(true);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+      AttributeMatrix::Pointer am = filter->getDataContainerArray()->getDataContainer("DataContainer")->getAttributeMatrix("AttributeMatrix");
+      DoubleArrayType::Pointer converted = getDataArray<double>(am, "DataArray");
+      DREAM3D_REQUIRE_VALID_POINTER(converted.get());
+      for(int i = 0; i < values.size(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(converted->getValue(i), static_cast<double>(values[i]));
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -643,6 +771,9 @@ public:
 
     DREAM3D_REGISTER_TEST(TestInvalidDataArray());
     DREAM3D_REGISTER_TEST(TestOverwriteArray());
+
+    DREAM3D_REGISTER_TEST(TestClampToTargetRange());
+    DREAM3D_REGISTER_TEST(TestConvertInPlace());
   }
 
 private:
@@ -347,6 +347,76 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> typename DataArray<T>::Pointer CreateRandomArray(SIMPL::ScalarTypes::Type scalarType, FPRangePair range, bool useSeed, int seed)
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer m = DataContainer::New(SIMPL::Defaults::DataContainerName);
+    dca->addDataContainer(m);
+    AttributeMatrix::Pointer attrMatrix = AttributeMatrix::New(QVector<size_t>(1, 50000), SIMPL::Defaults::AttributeMatrixName, AttributeMatrix::Type::Generic);
+    m->addAttributeMatrix(SIMPL::Defaults::AttributeMatrixName, attrMatrix);
+
+    DataArrayPath path(SIMPL::Defaults::DataContainerName, SIMPL::Defaults::AttributeMatrixName, "RandomArray");
+    CreateDataArray::Pointer filter = CreateDataArray::New();
+    filter->setDataContainerArray(dca);
+    filter->setScalarType(scalarType);
+    filter->setNumberOfComponents(2);
+    filter->setNewArray(path);
+    filter->setInitializationType(CreateDataArray::RandomWithRange);
+    filter->setInitializationRange(range);
+    filter->setUseSeed(useSeed);
+    filter->setSeed(seed);
+    filter->execute();
+    int err = filter->getErrorCondition();
+    DREAM3D_REQUIRE_EQUAL(err, NO_ERROR);
+
+    typename DataArray<T>::Pointer array = dca->getPrereqArrayFromPath<DataArray<T>, AbstractFilter>(nullptr, path, QVector<size_t>(1, 2));
+    DREAM3D_REQUIRE_VALID_POINTER(array.get());
+    return array;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestRandomWithSeed(SIMPL::ScalarTypes::Type scalarType, FPRangePair range)
+  {
+    typename DataArray<T>::Pointer first = CreateRandomArray<T>(scalarType, range, true, 1234);
+    typename DataArray<T>::Pointer second = CreateRandomArray<T>(scalarType, range, true, 1234);
+    typename DataArray<T>::Pointer otherSeed = CreateRandomArray<T>(scalarType, range, true, 4321);
+
+    size_t count = first->getSize();
+    size_t differences = 0;
+    size_t otherSeedDifferences = 0;
+    T rangeMin = static_cast<T>(range.first);
+    T rangeMax = static_cast<T>(range.second);
+    for(size_t i = 0; i < count; i++)
+    {
+      T value = first->getValue(i);
+      DREAM3D_REQUIRED(value, >=, rangeMin)
+      DREAM3D_REQUIRED(value, <=, rangeMax)
+      differences += (value != second->getValue(i)) ? 1 : 0;
+      otherSeedDifferences += (value != otherSeed->getValue(i)) ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(differences, 0u)
+    DREAM3D_REQUIRED(otherSeedDifferences, >, 0u)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestRandomInitialization()
+  {
+    TestRandomWithSeed<int8_t>(SIMPL::ScalarTypes::Type::Int8, FPRangePair(-10.0, 10.0));
+    TestRandomWithSeed<uint32_t>(SIMPL::ScalarTypes::Type::UInt32, FPRangePair(5.0, 100000.0));
+    TestRandomWithSeed<int64_t>(SIMPL::ScalarTypes::Type::Int64, FPRangePair(-1.0e12, 1.0e12));
+    TestRandomWithSeed<float>(SIMPL::ScalarTypes::Type::Float, FPRangePair(-1.0, 1.0));
+    TestRandomWithSeed<double>(SIMPL::ScalarTypes::Type::Double, FPRangePair(0.0, 500.0));
+    TestRandomWithSeed<bool>(SIMPL::ScalarTypes::Type::Bool, FPRangePair(0.0, 1.0));
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -359,6 +429,7 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestCreateDataArray())
+    DREAM3D_REGISTER_TEST(TestRandomInitialization())
   }
 
 private:
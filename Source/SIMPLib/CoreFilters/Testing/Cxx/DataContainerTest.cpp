@@ -40,12 +40,14 @@
 #include <QtCore/QList>
 #include <QtCore/QMap>
 #include <QtCore/QString>
+#include <QtCore/QTextStream>
 #include <QtCore/QVector>
 
 #include "SIMPLib/SIMPLib.h"
 
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/DataArrays/StructArray.hpp"
 #include "SIMPLib/DataContainers/DataContainer.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
@@ -110,6 +112,16 @@ QString TestFile3()
   return TestDir() + QString::fromLatin1("/DataContainerIOTest_Subset.h5");
 }
 
+QString XdmfTestFile()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerXdmfTest.dream3d");
+}
+
+QString XdmfFile()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerXdmfTest.xdmf");
+}
+
 QString JsonFile()
 {
   return TestDir() + QString::fromLatin1("/DataContainerProxyTest.json");
@@ -140,6 +152,8 @@ public:
     QFile::remove(DataContainerIOTest::TestFile());
     QFile::remove(DataContainerIOTest::TestFile2());
     QFile::remove(DataContainerIOTest::TestFile3());
+    QFile::remove(DataContainerIOTest::XdmfTestFile());
+    QFile::remove(DataContainerIOTest::XdmfFile());
     QFile::remove(DataContainerIOTest::JsonFile());
     QFile::remove(DataContainerIOTest::H5File());
 
@@ -371,6 +385,106 @@ public:
     DREAM3D_REQUIRE_EQUAL(err, 0);
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestXdmfWriter()
+  {
+    const int numArrays = 100;
+    const size_t numFeatures = 500;
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    QVector<size_t> tupleDims;
+    tupleDims.push_back(DataContainerIOTest::XSize);
+    tupleDims.push_back(DataContainerIOTest::YSize);
+    tupleDims.push_back(DataContainerIOTest::ZSize);
+
+    QStringList dcNames;
+    dcNames << "XdmfDataContainer_A"
+            << "XdmfDataContainer_B";
+    for(int d = 0; d < dcNames.size(); d++)
+    {
+      DataContainer::Pointer dc = DataContainer::New(dcNames[d]);
+      dca->addDataContainer(dc);
+      ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+      image->setDimensions(std::make_tuple(DataContainerIOTest::XSize, DataContainerIOTest::YSize, DataContainerIOTest::ZSize));
+      dc->setGeometry(image);
+
+      AttributeMatrix::Pointer cellAttrMat = AttributeMatrix::New(tupleDims, getCellAttributeMatrixName(), AttributeMatrix::Type::Cell);
+      dc->addAttributeMatrix(cellAttrMat->getName(), cellAttrMat);
+      for(int i = 0; i < numArrays; i++)
+      {
+        QString name = QString("Array_%1").arg(i, 3, 10, QChar('0'));
+        FloatArrayType::Pointer array = FloatArrayType::CreateArray(cellAttrMat->getNumberOfTuples(), name);
+        array->initializeWithValue(static_cast<float>(i));
+        cellAttrMat->addAttributeArray(name, array);
+      }
+
+      QVector<size_t> featureDims(1, numFeatures);
+      AttributeMatrix::Pointer featureAttrMat = AttributeMatrix::New(featureDims, getCellFeatureAttributeMatrixName(), AttributeMatrix::Type::CellFeature);
+      dc->addAttributeMatrix(featureAttrMat->getName(), featureAttrMat);
+      NeighborList<int32_t>::Pointer neighbors = NeighborList<int32_t>::CreateArray(numFeatures, SIMPL::FeatureData::NeighborList);
+      for(size_t f = 0; f < numFeatures; f++)
+      {
+        // Every seventh list is empty
+        for(size_t n = 0; n < f % 7; n++)
+        {
+          neighbors->addEntry(static_cast<int32_t>(f), static_cast<int32_t>(f * 10 + n + d));
+        }
+      }
+      featureAttrMat->addAttributeArray(neighbors->getName(), neighbors);
+    }
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::XdmfTestFile());
+    writer->setWriteXdmfFile(true);
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), 0);
+
+    // The Xdmf file holds both DataContainers and every cell array in the order of the AttributeMatrix
+    QFile xdmfFile(DataContainerIOTest::XdmfFile());
+    DREAM3D_REQUIRE_EQUAL(xdmfFile.open(QIODevice::ReadOnly | QIODevice::Text), true);
+    QString xdmf = QTextStream(&xdmfFile).readAll();
+    DREAM3D_REQUIRE_EQUAL(xdmf.startsWith("<?xml"), true);
+    DREAM3D_REQUIRE_EQUAL(xdmf.endsWith("</Xdmf>\n"), true);
+    for(int d = 0; d < dcNames.size(); d++)
+    {
+      int gridStart = xdmf.indexOf(QString("<Grid Name=\"%1\"").arg(dcNames[d]));
+      DREAM3D_REQUIRE(gridStart >= 0)
+      int previous = gridStart;
+      for(int i = 0; i < numArrays; i++)
+      {
+        QString path = QString(":/DataContainers/%1/%2/Array_%3").arg(dcNames[d]).arg(getCellAttributeMatrixName()).arg(i, 3, 10, QChar('0'));
+        int position = xdmf.indexOf(path, previous);
+        DREAM3D_REQUIRE(position > previous)
+        previous = position;
+      }
+    }
+
+    // The flattened NeighborLists read back unchanged
+    DataContainerArray::Pointer dca2 = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::XdmfTestFile());
+    reader->setDataContainerArray(dca2);
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(DataContainerIOTest::XdmfTestFile()));
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCondition() >= 0)
+    for(int d = 0; d < dcNames.size(); d++)
+    {
+      DataArrayPath path(dcNames[d], getCellFeatureAttributeMatrixName(), SIMPL::FeatureData::NeighborList);
+      NeighborList<int32_t>::Pointer expected = std::dynamic_pointer_cast<NeighborList<int32_t>>(dca->getAttributeMatrix(path)->getAttributeArray(path.getDataArrayName()));
+      DREAM3D_REQUIRE_VALID_POINTER(dca2->getAttributeMatrix(path).get())
+      NeighborList<int32_t>::Pointer neighbors = std::dynamic_pointer_cast<NeighborList<int32_t>>(dca2->getAttributeMatrix(path)->getAttributeArray(path.getDataArrayName()));
+      DREAM3D_REQUIRE_VALID_POINTER(neighbors.get())
+      DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfTuples(), numFeatures);
+      for(size_t f = 0; f < numFeatures; f++)
+      {
+        int32_t feature = static_cast<int32_t>(f);
+        DREAM3D_REQUIRE_EQUAL(neighbors->getListReference(feature) == expected->getListReference(feature), true);
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -906,6 +1020,7 @@ public:
     DREAM3D_REGISTER_TEST(TestInsertDelete())
 
     DREAM3D_REGISTER_TEST(TestDataContainerWriter())
+    DREAM3D_REGISTER_TEST(TestXdmfWriter())
     DREAM3D_REGISTER_TEST(TestDataContainerArrayProxy())
 
     DREAM3D_REGISTER_TEST(TestDataContainerReader())
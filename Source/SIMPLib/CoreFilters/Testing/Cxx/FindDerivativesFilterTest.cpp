@@ -479,6 +479,42 @@ public:
     validateDerivativeValues(quad, faceOutPath_Q, derivativeName);
     FDTEST_SET_PROPERTIES_AND_CHECK_EQ(filter, tet, facePathD_Tet, cellOutPath_Tet, data);
     validateDerivativeValues(tet, cellOutPath_Tet, derivativeName);
+
+    // Succeed with float derivatives on a grid and on interpolated element values
+    var.setValue(true);
+    propWasSet = filter->setProperty("UseFloatDerivatives", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+    dca->getDataContainer(cellOutPath_I.getDataContainerName())->getAttributeMatrix(cellOutPath_I.getAttributeMatrixName())->removeAttributeArray(cellOutPath_I.getDataArrayName());
+    dca->getDataContainer(cellOutPath_Tet.getDataContainerName())->getAttributeMatrix(cellOutPath_Tet.getAttributeMatrixName())->removeAttributeArray(cellOutPath_Tet.getDataArrayName());
+    validateFloatDerivatives(filter, image, i32Path_I, cellOutPath_I);
+    validateFloatDerivatives(filter, tet, facePathD_Tet, cellOutPath_Tet);
+    var.setValue(false);
+    filter->setProperty("UseFloatDerivatives", var);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void validateFloatDerivatives(AbstractFilter::Pointer filter, DataContainer::Pointer dc, DataArrayPath path, DataArrayPath derivsPath)
+  {
+    QVariant var;
+    var.setValue(path);
+    filter->setProperty("SelectedArrayPath", var);
+    var.setValue(derivsPath);
+    filter->setProperty("DerivativesArrayPath", var);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    IDataArray::Pointer iArray = dc->getAttributeMatrix(derivsPath.getAttributeMatrixName())->getAttributeArray(derivsPath.getDataArrayName());
+    FloatArrayType::Pointer array = std::dynamic_pointer_cast<FloatArrayType>(iArray);
+    DREAM3D_REQUIRE(array.get() != nullptr);
+
+    size_t size = array->getSize();
+    float* arrayPtr = array->getPointer(0);
+    for(size_t i = 0; i < size; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(arrayPtr[i], 0.0f);
+    }
   }
 
   // -----------------------------------------------------------------------------
@@ -33,6 +33,8 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <limits>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
 #include <QtCore/QJsonArray>
@@ -282,6 +284,81 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestAlphaAndNonFiniteValues()
+  {
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(QVector<size_t>(1, 256), SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Generic);
+    dc->addAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName, am);
+    dca->addDataContainer(dc);
+
+    FloatArrayType::Pointer floats = FloatArrayType::CreateArray(256, "Floats");
+    Int8ArrayType::Pointer int8s = Int8ArrayType::CreateArray(256, "Int8s");
+    for(size_t i = 0; i < 256; i++)
+    {
+      floats->setValue(i, static_cast<float>(i) / 253.0f);
+      int8s->setValue(i, static_cast<int8_t>(static_cast<int>(i) - 128));
+    }
+    floats->setValue(255, std::numeric_limits<float>::quiet_NaN());
+    floats->setValue(254, std::numeric_limits<float>::infinity());
+    am->addAttributeArray(floats->getName(), floats);
+    am->addAttributeArray(int8s->getName(), int8s);
+
+    // Grayscale from black to white
+    QJsonArray grayscale;
+    const double points[8] = {0.0, 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 1.0};
+    for(int i = 0; i < 8; i++)
+    {
+      grayscale.append(points[i]);
+    }
+
+    QStringList arrayNames;
+    arrayNames << floats->getName() << int8s->getName();
+    for(int a = 0; a < arrayNames.size(); a++)
+    {
+      GenerateColorTable::Pointer filter = GenerateColorTable::New();
+      filter->setRGB_ArrayName("RGBA");
+      filter->setAddAlphaChannel(true);
+      filter->setSelectedDataArrayPath(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, arrayNames[a]));
+      filter->setSelectedPresetName("Grayscale");
+      filter->setSelectedPresetControlPoints(grayscale);
+      filter->setDataContainerArray(dca);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+
+      UInt8ArrayType::Pointer rgba = std::dynamic_pointer_cast<UInt8ArrayType>(am->getAttributeArray("RGBA"));
+      DREAM3D_REQUIRE_VALID_POINTER(rgba.get())
+      DREAM3D_REQUIRE_EQUAL(rgba->getNumberOfComponents(), 4)
+
+      // The float array spans [0, 1] once the infinite and NaN values are left out; the int8 array spans [-128, 127]
+      size_t numFinite = (a == 0) ? 254 : 256;
+      float range = (a == 0) ? 1.0f : 255.0f;
+      for(size_t i = 0; i < numFinite; i++)
+      {
+        float nValue = (a == 0) ? floats->getValue(i) : static_cast<float>(i) / range;
+        uint8_t expected = static_cast<uint8_t>((0.0 * (1.0 - nValue) + 1.0 * nValue) * 255);
+        uint8_t red = rgba->getComponent(i, 0);
+        uint8_t alpha = rgba->getComponent(i, 3);
+        DREAM3D_REQUIRE_EQUAL(red, expected)
+        DREAM3D_REQUIRE_EQUAL(alpha, 255)
+      }
+      for(size_t i = numFinite; i < 256; i++)
+      {
+        for(int c = 0; c < 4; c++)
+        {
+          uint8_t value = rgba->getComponent(i, c);
+          DREAM3D_REQUIRE_EQUAL(value, 0)
+        }
+      }
+      am->removeAttributeArray("RGBA");
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -294,6 +371,8 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestGenerateColorTable())
+
+    DREAM3D_REGISTER_TEST(TestAlphaAndNonFiniteValues())
   }
 
 private:
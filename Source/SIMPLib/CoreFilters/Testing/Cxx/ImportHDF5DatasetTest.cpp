@@ -3,6 +3,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <limits>
 
 #include <QtCore/QDir>
 #include <QtCore/QFile>
@@ -606,6 +607,165 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer createConversionFilter(QVector<size_t> tDims, const QString& dsetPath, bool convert, SIMPL::NumericTypes::Type scalarType, bool useHyperslab, size_t tupleStart)
+  {
+    AbstractFilter::Pointer filter = createFilter();
+    DataContainerArray::Pointer dca = createDataContainerArray(tDims);
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(m_FilePath);
+    bool propSet = filter->setProperty("HDF5FilePath", var);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+
+    var.setValue(QStringList(dsetPath));
+    propSet = filter->setProperty("DatasetPaths", var);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+
+    var.setValue(QString::number(COMPDIMPROD));
+    propSet = filter->setProperty("ComponentDimensions", var);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+
+    var.setValue(convert);
+    propSet = filter->setProperty("ConvertToScalarType", var);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+
+    var.setValue(scalarType);
+    propSet = filter->setProperty("ScalarType", var);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+
+    var.setValue(useHyperslab);
+    propSet = filter->setProperty("UseTupleHyperslab", var);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+
+    var.setValue(static_cast<quint64>(tupleStart));
+    propSet = filter->setProperty("TupleStartIndex", var);
+    DREAM3D_REQUIRE_EQUAL(propSet, true);
+
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> typename DataArray<T>::Pointer getImportedArray(AbstractFilter::Pointer filter, const QString& dsetName)
+  {
+    DataArrayPath path("DataContainer", "AttributeMatrix", dsetName);
+    typename DataArray<T>::Pointer da = filter->getDataContainerArray()->getPrereqArrayFromPath<DataArray<T>, AbstractFilter>(nullptr, path, QVector<size_t>(1, COMPDIMPROD));
+    DREAM3D_REQUIRE_VALID_POINTER(da.get());
+    return da;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RunConversionAndHyperslabTest()
+  {
+    writeHDF5File();
+
+    QString dset1DName = "Pointer1DArrayDataset<H5T_NATIVE_INT32>";
+    QString dset2DName = "Pointer2DArrayDataset<H5T_NATIVE_INT32>";
+
+    // Convert the whole dataset while reading it
+    {
+      AbstractFilter::Pointer filter = createConversionFilter(QVector<size_t>(1, TUPLEDIMPROD), "/Pointer/" + dset1DName, true, SIMPL::NumericTypes::Type::Double, false, 0);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+      DoubleArrayType::Pointer da = getImportedArray<double>(filter, dset1DName);
+      for(size_t i = 0; i < da->getSize(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(da->getValue(i), static_cast<double>(i * 5));
+      }
+    }
+
+    // Values outside of the target range are clamped by the HDF5 conversion
+    {
+      AbstractFilter::Pointer filter = createConversionFilter(QVector<size_t>(1, TUPLEDIMPROD), "/Pointer/" + dset1DName, true, SIMPL::NumericTypes::Type::UInt8, false, 0);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+      UInt8ArrayType::Pointer da = getImportedArray<uint8_t>(filter, dset1DName);
+      for(size_t i = 0; i < da->getSize(); i++)
+      {
+        uint8_t exemplar = (i * 5 > 255) ? 255 : static_cast<uint8_t>(i * 5);
+        DREAM3D_REQUIRE_EQUAL(da->getValue(i), exemplar);
+      }
+    }
+
+    // Any non-zero value is true
+    {
+      AbstractFilter::Pointer filter = createConversionFilter(QVector<size_t>(1, TUPLEDIMPROD), "/Pointer/" + dset1DName, true, SIMPL::NumericTypes::Type::Bool, false, 0);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+      BoolArrayType::Pointer da = getImportedArray<bool>(filter, dset1DName);
+      for(size_t i = 0; i < da->getSize(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(da->getValue(i), (i != 0));
+      }
+    }
+
+    // Each row of the 2D dataset holds 4 tuples, so read rows 2 through 4 and convert them to float
+    {
+      size_t tupleStart = 8;
+      AbstractFilter::Pointer filter = createConversionFilter(QVector<size_t>(1, 12), "/Pointer/" + dset2DName, true, SIMPL::NumericTypes::Type::Float, true, tupleStart);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+      FloatArrayType::Pointer da = getImportedArray<float>(filter, dset2DName);
+      DREAM3D_REQUIRE_EQUAL(da->getNumberOfTuples(), 12);
+      for(size_t i = 0; i < da->getSize(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(da->getValue(i), static_cast<float>((tupleStart * COMPDIMPROD + i) * 5));
+      }
+    }
+
+    // The hyperslab keeps the native type when no conversion is requested
+    {
+      size_t tupleStart = 4;
+      AbstractFilter::Pointer filter = createConversionFilter(QVector<size_t>(1, 4), "/Pointer/" + dset2DName, false, SIMPL::NumericTypes::Type::Float, true, tupleStart);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+      Int32ArrayType::Pointer da = getImportedArray<int32_t>(filter, dset2DName);
+      for(size_t i = 0; i < da->getSize(); i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(da->getValue(i), static_cast<int32_t>((tupleStart * COMPDIMPROD + i) * 5));
+      }
+    }
+
+    // Hyperslab that does not start on a row of the dataset
+    {
+      AbstractFilter::Pointer filter = createConversionFilter(QVector<size_t>(1, 4), "/Pointer/" + dset2DName, false, SIMPL::NumericTypes::Type::Float, true, 1);
+      filter->preflight();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -20010);
+    }
+
+    // Hyperslab that runs past the end of the dataset
+    {
+      AbstractFilter::Pointer filter = createConversionFilter(QVector<size_t>(1, 8), "/Pointer/" + dset2DName, false, SIMPL::NumericTypes::Type::Float, true, 36);
+      filter->preflight();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -20008);
+    }
+
+    // Start index beyond the range of a 32 bit integer
+    {
+      size_t tupleStart = static_cast<size_t>(std::numeric_limits<uint32_t>::max()) + 8;
+      AbstractFilter::Pointer filter = createConversionFilter(QVector<size_t>(1, 4), "/Pointer/" + dset2DName, false, SIMPL::NumericTypes::Type::Float, true, tupleStart);
+      DREAM3D_REQUIRE_EQUAL(filter->property("TupleStartIndex").toULongLong(), static_cast<quint64>(tupleStart));
+      filter->preflight();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -20008);
+    }
+
+    QFileInfo fi(m_FilePath);
+    if(fi.exists())
+    {
+      if(QFile::remove(m_FilePath) == false)
+      {
+        DREAM3D_REQUIRE_EQUAL(0, 1);
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -620,6 +780,7 @@ public:
     //#endif
 
     DREAM3D_REGISTER_TEST(RunImportHDF5DatasetTest())
+    DREAM3D_REGISTER_TEST(RunConversionAndHyperslabTest())
 
     //#if REMOVE_TEST_FILES
     //    DREAM3D_REGISTER_TEST(RemoveTestFiles())
@@ -33,10 +33,13 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <vector>
+
 #include <QtCore/QCoreApplication>
 #include <QtCore/QString>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/BitMaskArray.hpp"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
 #include "SIMPLib/Filtering/ComparisonSet.h"
@@ -45,6 +48,7 @@
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Filtering/ThresholdPredicate.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
@@ -341,6 +345,203 @@ public:
     return 1;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int RunMultiBlockNestedSetTest()
+  {
+    // Enough tuples to span several evaluation blocks and end on a partial word
+    const size_t numTuples = 3 * ThresholdPredicate::k_BlockSize + 77;
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("dc");
+    QVector<size_t> tDims(1, numTuples);
+    QVector<size_t> cDims(1, 1);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer datai = Int32ArrayType::CreateArray(tDims, cDims, "TestArrayInt");
+    FloatArrayType::Pointer dataf = FloatArrayType::CreateArray(tDims, cDims, "TestArrayFloat");
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      datai->setValue(i, static_cast<int32_t>(i % 97));
+      dataf->setValue(i, static_cast<float>(i) * 0.5f);
+    }
+    am->addAttributeArray(datai->getName(), datai);
+    am->addAttributeArray(dataf->getName(), dataf);
+    dc->addAttributeMatrix(am->getName(), am);
+    dca->addDataContainer(dc);
+
+    // ((Int > 10 AND Int < 50) OR NOT(Float < 3000)) AND Int != 20
+    ComparisonSet::Pointer rangeSet = ComparisonSet::New();
+    ComparisonValue::Pointer comp0 = ComparisonValue::New();
+    comp0->setAttributeArrayName(datai->getName());
+    comp0->setCompOperator(SIMPL::Comparison::Operator_GreaterThan);
+    comp0->setCompValue(10);
+    rangeSet->addComparison(comp0);
+    ComparisonValue::Pointer comp1 = ComparisonValue::New();
+    comp1->setUnionOperator(SIMPL::Union::Operator_And);
+    comp1->setAttributeArrayName(datai->getName());
+    comp1->setCompOperator(SIMPL::Comparison::Operator_LessThan);
+    comp1->setCompValue(50);
+    rangeSet->addComparison(comp1);
+
+    ComparisonSet::Pointer floatSet = ComparisonSet::New();
+    floatSet->setUnionOperator(SIMPL::Union::Operator_Or);
+    floatSet->setInvertComparison(true);
+    ComparisonValue::Pointer comp2 = ComparisonValue::New();
+    comp2->setAttributeArrayName(dataf->getName());
+    comp2->setCompOperator(SIMPL::Comparison::Operator_LessThan);
+    comp2->setCompValue(3000.0);
+    floatSet->addComparison(comp2);
+
+    ComparisonSet::Pointer outerSet = ComparisonSet::New();
+    outerSet->addComparison(rangeSet);
+    outerSet->addComparison(floatSet);
+
+    ComparisonValue::Pointer comp3 = ComparisonValue::New();
+    comp3->setUnionOperator(SIMPL::Union::Operator_And);
+    comp3->setAttributeArrayName(datai->getName());
+    comp3->setCompOperator(SIMPL::Comparison::Operator_NotEqual);
+    comp3->setCompValue(20);
+
+    ComparisonInputsAdvanced comp;
+    comp.setDataContainerName(dc->getName());
+    comp.setAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName);
+    comp.addInput(outerSet);
+    comp.addInput(comp3);
+
+    QVector<bool> expected(static_cast<int>(numTuples));
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int32_t iv = datai->getValue(i);
+      float fv = dataf->getValue(i);
+      expected[i] = ((iv > 10 && iv < 50) || !(fv < 3000.0f)) && iv != 20;
+    }
+
+    // Run through the filter
+    QString filtName = "MultiThresholdObjects2";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get())
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(comp);
+    bool propWasSet = filter->setProperty("SelectedThresholds", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+    var.setValue(QString("MultiBlockMask"));
+    propWasSet = filter->setProperty("DestinationArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+
+    BoolArrayType::Pointer mask = std::dynamic_pointer_cast<BoolArrayType>(am->getAttributeArray("MultiBlockMask"));
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), expected[i])
+    }
+
+    // The packed result must match bit for bit and leave the tail of the last word cleared
+    ThresholdPredicate predicate;
+    DREAM3D_REQUIRE_EQUAL(predicate.compile(comp, am), true)
+    DREAM3D_REQUIRE_EQUAL(predicate.getNumberOfTuples(), numTuples)
+    std::vector<ThresholdPredicate::Word> words(predicate.getNumberOfWords(), ~static_cast<ThresholdPredicate::Word>(0));
+    predicate.evaluate(words.data());
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      bool bit = ((words[i / ThresholdPredicate::k_BitsPerWord] >> (i % ThresholdPredicate::k_BitsPerWord)) & 1) != 0;
+      DREAM3D_REQUIRE_EQUAL(bit, expected[i])
+    }
+    DREAM3D_REQUIRE_EQUAL(words.back() >> (numTuples % ThresholdPredicate::k_BitsPerWord), static_cast<ThresholdPredicate::Word>(0))
+
+    // Unknown arrays are reported by name
+    ComparisonInputsAdvanced badComp;
+    badComp.addInput(SIMPL::Union::Operator_And, "DoesNotExist", SIMPL::Comparison::Operator_Equal, 1.0);
+    DREAM3D_REQUIRE_EQUAL(predicate.compile(badComp, am), false)
+    DREAM3D_REQUIRE_EQUAL(predicate.getInvalidArrayName(), QString("DoesNotExist"))
+
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int RunBitMaskTest()
+  {
+    const size_t numTuples = 2 * ThresholdPredicate::k_BlockSize + 45;
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New("dc");
+    QVector<size_t> tDims(1, numTuples);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+    BitMaskArray::Pointer input = BitMaskArray::CreateArray(numTuples, "TestBitMask");
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      input->setValue(i, i % 3 == 0);
+    }
+    am->addAttributeArray(input->getName(), input);
+    dc->addAttributeMatrix(am->getName(), am);
+    dca->addDataContainer(dc);
+
+    // Every operator against both values, compared with the same comparison on unpacked bools
+    const int operators[4] = {SIMPL::Comparison::Operator_LessThan, SIMPL::Comparison::Operator_GreaterThan, SIMPL::Comparison::Operator_Equal, SIMPL::Comparison::Operator_NotEqual};
+    for(int op : operators)
+    {
+      for(int value = 0; value < 2; value++)
+      {
+        ComparisonInputsAdvanced comp;
+        comp.addInput(SIMPL::Union::Operator_And, input->getName(), op, static_cast<double>(value));
+        ThresholdPredicate predicate;
+        DREAM3D_REQUIRE_EQUAL(predicate.compile(comp, am), true)
+        std::vector<ThresholdPredicate::Word> words(predicate.getNumberOfWords(), 0);
+        predicate.evaluate(words.data());
+        for(size_t i = 0; i < numTuples; i++)
+        {
+          bool bit = ((words[i / ThresholdPredicate::k_BitsPerWord] >> (i % ThresholdPredicate::k_BitsPerWord)) & 1) != 0;
+          bool v = (value != 0);
+          bool b = input->getValue(i);
+          bool expected = (op == SIMPL::Comparison::Operator_LessThan) ? (b < v) : (op == SIMPL::Comparison::Operator_GreaterThan) ? (b > v) : (op == SIMPL::Comparison::Operator_Equal) ? (b == v) : (b != v);
+          DREAM3D_REQUIRE_EQUAL(bit, expected)
+        }
+      }
+    }
+
+    // A packed mask passes through the filter as well
+    ComparisonInputsAdvanced comp;
+    comp.setDataContainerName(dc->getName());
+    comp.setAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName);
+    comp.addInput(SIMPL::Union::Operator_And, input->getName(), SIMPL::Comparison::Operator_Equal, 0.0);
+
+    QString filtName = "MultiThresholdObjects2";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get())
+    AbstractFilter::Pointer filter = filterFactory->create();
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    var.setValue(comp);
+    bool propWasSet = filter->setProperty("SelectedThresholds", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+    var.setValue(QString("BitMaskThreshold"));
+    propWasSet = filter->setProperty("DestinationArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true)
+
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+
+    BoolArrayType::Pointer mask = std::dynamic_pointer_cast<BoolArrayType>(am->getAttributeArray("BitMaskThreshold"));
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), i % 3 != 0)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   /**
 * @brief
 */
@@ -350,6 +551,8 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
     DREAM3D_REGISTER_TEST(RunComparisonValueTests())
     DREAM3D_REGISTER_TEST(RunComparisonSetTests())
+    DREAM3D_REGISTER_TEST(RunMultiBlockNestedSetTest())
+    DREAM3D_REGISTER_TEST(RunBitMaskTest())
   }
 
 private:
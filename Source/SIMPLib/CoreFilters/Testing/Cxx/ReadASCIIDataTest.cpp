@@ -54,6 +54,7 @@
 
 #include "SIMPLib/CoreFilters/ReadASCIIData.h"
 #include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
+#include "SIMPLib/Utilities/LineOffsetIndex.h"
 
 const QString DataContainerName = "DataContainer";
 const QString AttributeMatrixName = "AttributeMatrix";
@@ -414,6 +415,75 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBlockParsing()
+  {
+    char delimiter = '\t';
+    const int numLines = 5000;
+    QVector<QString> rows;
+    for(int i = 0; i < numLines; i++)
+    {
+      rows.push_back(QString("%1\t%2").arg(i).arg(i * 0.5));
+    }
+    CreateFile(UnitTest::ReadASCIIDataTest::TestFile1, rows, delimiter);
+
+    ASCIIWizardData data;
+    data.automaticAM = false;
+    data.beginIndex = 1;
+    data.consecutiveDelimiters = false;
+    data.dataHeaders << "Ints"
+                     << "Doubles";
+    data.dataTypes << SIMPL::TypeNames::Int32 << SIMPL::TypeNames::Double;
+    data.delimiters.push_back(delimiter);
+    data.inputFilePath = UnitTest::ReadASCIIDataTest::TestFile1;
+    data.numberOfLines = numLines;
+    data.selectedPath = DataArrayPath(DataContainerName, AttributeMatrixName, "");
+    data.tupleDims = QVector<size_t>(1, numLines);
+
+    // An index handed over by the wizard with a small stride splits the file into many blocks
+    data.lineOffsetIndex = LineOffsetIndex::New();
+    DREAM3D_REQUIRE_EQUAL(data.lineOffsetIndex->build(UnitTest::ReadASCIIDataTest::TestFile1, 64), true)
+    DREAM3D_REQUIRE_EQUAL(data.lineOffsetIndex->getNumberOfBlocks(), (numLines + 63) / 64)
+
+    {
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCondition();
+      DREAM3D_REQUIRE_EQUAL(err, 0)
+
+      AttributeMatrix::Pointer am = importASCIIData->getDataContainerArray()->getAttributeMatrix(DataArrayPath(DataContainerName, AttributeMatrixName, ""));
+      Int32ArrayType::Pointer ints = std::dynamic_pointer_cast<Int32ArrayType>(am->getAttributeArray("Ints"));
+      DoubleArrayType::Pointer doubles = std::dynamic_pointer_cast<DoubleArrayType>(am->getAttributeArray("Doubles"));
+      DREAM3D_REQUIRE_VALID_POINTER(ints.get())
+      DREAM3D_REQUIRE_VALID_POINTER(doubles.get())
+      for(int i = 0; i < numLines; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(ints->getValue(i), i)
+        DREAM3D_REQUIRE_EQUAL(doubles->getValue(i), i * 0.5)
+      }
+    }
+
+    // Two later blocks fail, the error on the lowest line is the one reported. The file changed, so the
+    // filter builds a new index instead of using the out of date one.
+    rows[3000] = "x\t1";
+    rows[4500] = "1";
+    CreateFile(UnitTest::ReadASCIIDataTest::TestFile1, rows, delimiter);
+    {
+      AbstractFilter::Pointer importASCIIData = PrepFilter(data);
+      DREAM3D_REQUIRE_VALID_POINTER(importASCIIData.get())
+
+      importASCIIData->execute();
+      int err = importASCIIData->getErrorCondition();
+      DREAM3D_REQUIRE_EQUAL(err, ReadASCIIData::CONVERSION_FAILURE)
+    }
+
+    RemoveTestFiles();
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -446,6 +516,7 @@ public:
     DREAM3D_REGISTER_TEST(RemoveTestFiles()) // In case the previous test asserted or stopped prematurely
 
     DREAM3D_REGISTER_TEST(RunTest())
+    DREAM3D_REGISTER_TEST(TestBlockParsing())
 
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
@@ -177,8 +177,9 @@ void WriteTriangleGeometry::execute()
 
   TriangleGeom::Pointer triangleGeom = dataContainer->getGeometryAs<TriangleGeom>();
   QString geometryType = triangleGeom->getGeometryTypeAsString();
-  float* nodes = triangleGeom->getVertexPointer(0);
-  int64_t* triangles = triangleGeom->getTriPointer(0);
+  const TriangleGeom* constGeom = triangleGeom.get();
+  const float* nodes = constGeom->getVertexPointer(0);
+  const int64_t* triangles = constGeom->getTriPointer(0);
 
   qint64 numNodes = triangleGeom->getNumberOfVertices();
   qint64 maxNodeId = numNodes - 1;
@@ -44,6 +44,7 @@
 #include <QtCore/QMetaType>
 
 #include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Utilities/LineOffsetIndex.h"
 
 class ASCIIWizardData
 {
@@ -72,6 +73,8 @@ public:
   bool headerIsCustom = false; // The user has set their own header names
   bool headerUsesDefaults = false; // The user just wants to use the automatically generated headers
 
+  LineOffsetIndex::Pointer lineOffsetIndex; // Built by the import wizard, not written to pipeline files
+
 
   void updateDataArrayPath(DataArrayPath::RenameType renamePath)
   {
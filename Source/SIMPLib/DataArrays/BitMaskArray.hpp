@@ -0,0 +1,842 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#ifndef _bitmaskarray_h_
+#define _bitmaskarray_h_
+
+#include <algorithm>
+#include <vector>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+#include <QtCore/QLocale>
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+/**
+ * @class BitMaskArray BitMaskArray.hpp SIMPLib/DataArrays/BitMaskArray.hpp
+ * @brief Stores a scalar mask with one bit per tuple packed into 64 bit words. A mask
+ * held in a BitMaskArray needs one eighth of the memory of the equivalent DataArray<bool>
+ * and supports whole word AND/OR/NOT and population count operations.
+ *
+ * Bits past the last tuple of the last word are always kept cleared so word level
+ * operations never need to special case the tail.
+ *
+ * On disk the mask is stored exactly like a DataArray<bool> (one uint8 per tuple with
+ * an ObjectType of DataArray<bool>) so files stay readable by every existing reader.
+ * Both writeH5Data() and readH5Data() stage the data through a temporary DataArray<bool>.
+ */
+class BitMaskArray : public IDataArray
+{
+  public:
+    SIMPL_SHARED_POINTERS(BitMaskArray)
+    SIMPL_TYPE_MACRO_SUPER(BitMaskArray, IDataArray)
+    SIMPL_CLASS_VERSION(2)
+
+    using Word = uint64_t;
+    static const size_t k_BitsPerWord = 64;
+
+    /**
+     * @brief CreateArray
+     * @param numTuples
+     * @param name
+     * @param allocate
+     * @return
+     */
+    static Pointer CreateArray(size_t numTuples, const QString& name, bool allocate = true)
+    {
+      if (name.isEmpty() == true)
+      {
+        return NullPointer();
+      }
+      Pointer ptr(new BitMaskArray(numTuples, name, allocate));
+      return ptr;
+    }
+
+    /**
+     * @brief CreateArray
+     * @param numTuples
+     * @param compDims NOT USED. A mask always has a single component.
+     * @param name
+     * @param allocate
+     * @return
+     */
+    static Pointer CreateArray(size_t numTuples, QVector<size_t> compDims, const QString& name, bool allocate = true)
+    {
+      return CreateArray(numTuples, name, allocate);
+    }
+
+    /**
+     * @brief CreateArray
+     * @param tupleDims
+     * @param compDims NOT USED. A mask always has a single component.
+     * @param name
+     * @param allocate
+     * @return
+     */
+    static Pointer CreateArray(QVector<size_t> tupleDims, QVector<size_t> compDims, const QString& name, bool allocate = true)
+    {
+      size_t numTuples = tupleDims.empty() ? 0 : 1;
+      for(int i = 0; i < tupleDims.size(); i++)
+      {
+        numTuples *= tupleDims[i];
+      }
+      return CreateArray(numTuples, name, allocate);
+    }
+
+    /**
+     * @brief Packs the values of a DataArray<bool> into a new BitMaskArray
+     * @param boolArray The array to pack. It must have a single component
+     * @param name The name of the new array
+     * @return The new array or a nullptr if boolArray is not a scalar array
+     */
+    static Pointer FromBoolArray(BoolArrayType* boolArray, const QString& name)
+    {
+      if(nullptr == boolArray || boolArray->getNumberOfComponents() != 1)
+      {
+        return NullPointer();
+      }
+      Pointer ptr = CreateArray(boolArray->getNumberOfTuples(), name, true);
+      if(nullptr != ptr)
+      {
+        ptr->copyFromBools(boolArray->getPointer(0));
+      }
+      return ptr;
+    }
+
+    /**
+     * @brief Unpacks this mask into a new DataArray<bool>
+     * @param name The name of the new array
+     * @return
+     */
+    BoolArrayType::Pointer toBoolArray(const QString& name)
+    {
+      QVector<size_t> cDims(1, 1);
+      BoolArrayType::Pointer boolArray = BoolArrayType::CreateArray(m_NumTuples, cDims, name, true);
+      if(nullptr != boolArray && m_NumTuples > 0)
+      {
+        copyToBools(boolArray->getPointer(0));
+      }
+      return boolArray;
+    }
+
+    /**
+     * @brief createNewArray
+     * @param numElements
+     * @param rank NOT USED
+     * @param dims NOT USED
+     * @param name
+     * @param allocate
+     * @return
+     */
+    virtual IDataArray::Pointer createNewArray(size_t numElements, int rank, size_t* dims, const QString& name, bool allocate = true)
+    {
+      IDataArray::Pointer p = BitMaskArray::CreateArray(numElements, name, allocate);
+      return p;
+    }
+
+    virtual IDataArray::Pointer createNewArray(size_t numElements, std::vector<size_t> dims, const QString& name, bool allocate = true)
+    {
+      IDataArray::Pointer p = BitMaskArray::CreateArray(numElements, name, allocate);
+      return p;
+    }
+
+    virtual IDataArray::Pointer createNewArray(size_t numElements, QVector<size_t> dims, const QString& name, bool allocate = true)
+    {
+      IDataArray::Pointer p = BitMaskArray::CreateArray(numElements, name, allocate);
+      return p;
+    }
+
+    virtual ~BitMaskArray() {}
+
+    /**
+     * @brief Returns the number of set bits in a word
+     */
+    static size_t PopCount(Word word)
+    {
+#if defined(_MSC_VER) && defined(_M_X64)
+      return static_cast<size_t>(__popcnt64(word));
+#elif defined(__GNUC__) || defined(__clang__)
+      return static_cast<size_t>(__builtin_popcountll(word));
+#else
+      word = word - ((word >> 1) & 0x5555555555555555ULL);
+      word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+      word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+      return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    /**
+     * @brief isAllocated
+     * @return
+     */
+    virtual bool isAllocated()
+    {
+      return m_IsAllocated;
+    }
+
+    /**
+     * @brief setInitValue
+     * @param initValue
+     */
+    virtual void setInitValue(bool initValue)
+    {
+      m_InitValue = initValue;
+    }
+
+    /**
+     * @brief getXdmfTypeAndSize The mask is written as one uint8 per tuple
+     * @param xdmfTypeName
+     * @param precision
+     */
+    void getXdmfTypeAndSize(QString& xdmfTypeName, int& precision)
+    {
+      xdmfTypeName = "uchar";
+      precision = 1;
+    }
+
+    /**
+     * @brief getTypeAsString Masks have their own type so they are never mistaken for a
+     * DataArray<bool>, whose values are read through a bool pointer.
+     * @return
+     */
+    virtual QString getTypeAsString()
+    {
+      return SIMPL::TypeNames::BitMask;
+    }
+
+    /**
+     * @brief Gives this array a human readable name
+     * @param name The name of this array
+     */
+    void setName(const QString& name)
+    {
+      m_Name = name;
+    }
+
+    /**
+     * @brief Returns the human readable name of this array
+     * @return
+     */
+    QString getName()
+    {
+      return m_Name;
+    }
+
+    /**
+     * @brief The words are always owned by this array
+     */
+    virtual void takeOwnership()
+    {
+    }
+
+    /**
+     * @brief The words are always owned by this array
+     */
+    virtual void releaseOwnership()
+    {
+    }
+
+    /**
+     * @brief Returns a pointer to the 64 bit word holding the bit of tuple i. The memory is
+     * packed, it can not be read as one bool per tuple.
+     * @param i The tuple index
+     * @return
+     */
+    virtual void* getVoidPointer(size_t i)
+    {
+      if(m_Words.empty())
+      {
+        return nullptr;
+      }
+      return static_cast<void*>(&(m_Words[i / k_BitsPerWord]));
+    }
+
+    /**
+     * @brief Returns a pointer to the packed words. Bit b of word w holds tuple w * 64 + b
+     * @return
+     */
+    Word* getWords()
+    {
+      return m_Words.empty() ? nullptr : m_Words.data();
+    }
+
+    /**
+     * @brief Returns the number of words used to hold the mask
+     * @return
+     */
+    size_t getNumberOfWords()
+    {
+      return m_Words.size();
+    }
+
+    /**
+    * @brief Returns the number of Tuples in the array.
+    */
+    virtual size_t getNumberOfTuples()
+    {
+      return m_NumTuples;
+    }
+
+    /**
+     * @brief Return the number of elements in the array
+     * @return
+     */
+    virtual size_t getSize()
+    {
+      return m_NumTuples;
+    }
+
+    virtual int getNumberOfComponents()
+    {
+      return 1;
+    }
+
+    QVector<size_t> getComponentDimensions()
+    {
+      QVector<size_t> dims(1, 1);
+      return dims;
+    }
+
+    /**
+     * @brief Returns the number of bytes of one word of the packed storage
+     */
+    virtual size_t getTypeSize()
+    {
+      return sizeof(Word);
+    }
+
+    /**
+     * @brief getValue
+     * @param i
+     * @return
+     */
+    bool getValue(size_t i)
+    {
+      return ((m_Words[i / k_BitsPerWord] >> (i % k_BitsPerWord)) & 1) != 0;
+    }
+
+    /**
+     * @brief setValue
+     * @param i
+     * @param value
+     */
+    void setValue(size_t i, bool value)
+    {
+      Word bit = static_cast<Word>(1) << (i % k_BitsPerWord);
+      Word& word = m_Words[i / k_BitsPerWord];
+      word = (word & ~bit) | ((static_cast<Word>(0) - static_cast<Word>(value)) & bit);
+    }
+
+    /**
+     * @brief Returns the number of true values
+     * @return
+     */
+    size_t countTrue()
+    {
+      size_t count = 0;
+      for(size_t w = 0; w < m_Words.size(); w++)
+      {
+        count += PopCount(m_Words[w]);
+      }
+      return count;
+    }
+
+    /**
+     * @brief Combines this mask with other using a logical AND
+     * @param other A mask with the same number of tuples
+     * @return False if the number of tuples differ
+     */
+    bool bitwiseAnd(BitMaskArray* other)
+    {
+      if(nullptr == other || other->getNumberOfTuples() != m_NumTuples)
+      {
+        return false;
+      }
+      const Word* rhs = other->getWords();
+      for(size_t w = 0; w < m_Words.size(); w++)
+      {
+        m_Words[w] &= rhs[w];
+      }
+      return true;
+    }
+
+    /**
+     * @brief Combines this mask with other using a logical OR
+     * @param other A mask with the same number of tuples
+     * @return False if the number of tuples differ
+     */
+    bool bitwiseOr(BitMaskArray* other)
+    {
+      if(nullptr == other || other->getNumberOfTuples() != m_NumTuples)
+      {
+        return false;
+      }
+      const Word* rhs = other->getWords();
+      for(size_t w = 0; w < m_Words.size(); w++)
+      {
+        m_Words[w] |= rhs[w];
+      }
+      return true;
+    }
+
+    /**
+     * @brief Flips every value of this mask
+     */
+    void bitwiseNot()
+    {
+      for(size_t w = 0; w < m_Words.size(); w++)
+      {
+        m_Words[w] = ~m_Words[w];
+      }
+      clearTailBits();
+    }
+
+    /**
+     * @brief Packs getNumberOfTuples() bool values into this mask
+     * @param values
+     */
+    void copyFromBools(const bool* values)
+    {
+      for(size_t w = 0; w < m_Words.size(); w++)
+      {
+        const bool* chunk = values + w * k_BitsPerWord;
+        size_t remaining = m_NumTuples - w * k_BitsPerWord;
+        size_t numBits = remaining < k_BitsPerWord ? remaining : k_BitsPerWord;
+        Word word = 0;
+        for(size_t b = 0; b < numBits; b++)
+        {
+          word |= static_cast<Word>(chunk[b]) << b;
+        }
+        m_Words[w] = word;
+      }
+    }
+
+    /**
+     * @brief Unpacks this mask into getNumberOfTuples() bool values
+     * @param values
+     */
+    void copyToBools(bool* values)
+    {
+      for(size_t i = 0; i < m_NumTuples; i++)
+      {
+        values[i] = ((m_Words[i / k_BitsPerWord] >> (i % k_BitsPerWord)) & 1) != 0;
+      }
+    }
+
+    /**
+     * @brief Clears the unused bits of the last word. Call this after writing the words directly.
+     */
+    void clearTailBits()
+    {
+      size_t tailBits = m_NumTuples % k_BitsPerWord;
+      if(tailBits != 0 && !m_Words.empty())
+      {
+        m_Words.back() &= (static_cast<Word>(1) << tailBits) - 1;
+      }
+    }
+
+    /**
+     * @brief Removes Tuples from the Array. If the size of the vector is Zero nothing is done. If the size of the
+     * vector is greater than or Equal to the number of Tuples then the Array is Resized to Zero. If there are
+     * indices that are larger than the size of the original (before erasing operations) then an error code (-100) is
+     * returned from the program.
+     * @param idxs The indices to remove
+     * @return error code.
+     */
+    virtual int eraseTuples(QVector<size_t>& idxs)
+    {
+      // If nothing is to be erased just return
+      if(idxs.size() == 0)
+      {
+        return 0;
+      }
+      if(static_cast<size_t>(idxs.size()) >= getNumberOfTuples())
+      {
+        resize(0);
+        return 0;
+      }
+
+      // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
+      // off the end of the array and return an error code.
+      std::vector<size_t> sorted(idxs.begin(), idxs.end());
+      std::sort(sorted.begin(), sorted.end());
+      if(sorted.back() >= m_NumTuples)
+      {
+        return -100;
+      }
+
+      // Compact the kept bits towards the front of the array
+      size_t dest = 0;
+      std::vector<size_t>::size_type next = 0;
+      for(size_t i = 0; i < m_NumTuples; i++)
+      {
+        if(next < sorted.size() && sorted[next] == i)
+        {
+          while(next < sorted.size() && sorted[next] == i)
+          {
+            next++;
+          }
+          continue;
+        }
+        setValue(dest, getValue(i));
+        dest++;
+      }
+      resize(dest);
+      return 0;
+    }
+
+    /**
+     * @brief Copies a Tuple from one position to another.
+     * @param currentPos The index of the source data
+     * @param newPos The destination index to place the copied data
+     * @return
+     */
+    virtual int copyTuple(size_t currentPos, size_t newPos)
+    {
+      if(currentPos >= m_NumTuples || newPos >= m_NumTuples)
+      {
+        return -1;
+      }
+      setValue(newPos, getValue(currentPos));
+      return 0;
+    }
+
+    // This line must be here, because we are overloading the copyData pure virtual function in IDataArray.
+    // This is required so that other classes can call this version of copyData from the subclasses.
+    using IDataArray::copyFromArray;
+
+    /**
+     * @brief copyFromArray Copies totalSrcTuples values starting at srcTupleOffset of sourceArray into
+     * this mask starting at destTupleOffset. The source may be a BitMaskArray or a DataArray<bool>.
+     * @param destTupleOffset
+     * @param sourceArray
+     * @param srcTupleOffset
+     * @param totalSrcTuples
+     * @return
+     */
+    bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
+    {
+      if(!m_IsAllocated || nullptr == sourceArray || !sourceArray->isAllocated())
+      {
+        return false;
+      }
+      if(srcTupleOffset + totalSrcTuples > sourceArray->getNumberOfTuples() || destTupleOffset + totalSrcTuples > m_NumTuples)
+      {
+        return false;
+      }
+
+      Self* mask = dynamic_cast<Self*>(sourceArray.get());
+      BoolArrayType* boolArray = dynamic_cast<BoolArrayType*>(sourceArray.get());
+      if(nullptr != mask)
+      {
+        for(size_t i = 0; i < totalSrcTuples; i++)
+        {
+          setValue(destTupleOffset + i, mask->getValue(srcTupleOffset + i));
+        }
+        return true;
+      }
+      if(nullptr != boolArray && boolArray->getNumberOfComponents() == 1)
+      {
+        bool* values = boolArray->getPointer(0);
+        for(size_t i = 0; i < totalSrcTuples; i++)
+        {
+          setValue(destTupleOffset + i, values[srcTupleOffset + i]);
+        }
+        return true;
+      }
+      return false;
+    }
+
+    /**
+     * @brief Sets the value of a tuple
+     * @param pos The index of the Tuple
+     * @param value pointer to a bool value
+     */
+    virtual void initializeTuple(size_t pos, void* value)
+    {
+      setValue(pos, *(reinterpret_cast<bool*>(value)));
+    }
+
+    /**
+     * @brief Sets all the values to false.
+     */
+    virtual void initializeWithZeros()
+    {
+      std::fill(m_Words.begin(), m_Words.end(), 0);
+    }
+
+    /**
+     * @brief initializeWithValue
+     * @param value
+     */
+    virtual void initializeWithValue(bool value)
+    {
+      std::fill(m_Words.begin(), m_Words.end(), value ? ~static_cast<Word>(0) : 0);
+      clearTailBits();
+    }
+
+    /**
+     * @brief deepCopy
+     * @param forceNoAllocate
+     * @return
+     */
+    virtual IDataArray::Pointer deepCopy(bool forceNoAllocate = false)
+    {
+      BitMaskArray::Pointer daCopy = BitMaskArray::CreateArray(getNumberOfTuples(), getName(), !forceNoAllocate);
+      if(forceNoAllocate == false)
+      {
+        daCopy->m_Words = m_Words;
+      }
+      daCopy->setInitValue(m_InitValue);
+      return daCopy;
+    }
+
+    /**
+     * @brief Reseizes the internal array
+     * @param size The new size of the internal array
+     * @return 1 on success, 0 on failure
+     */
+    virtual int32_t resizeTotalElements(size_t size)
+    {
+      return resize(size);
+    }
+
+    /**
+     * @brief Resizes the mask keeping the existing values. New tuples are set to the init value.
+     * @param numTuples The new number of tuples
+     * @return 1 on success, 0 on failure
+     */
+    virtual int32_t resize(size_t numTuples)
+    {
+      size_t oldNumTuples = m_NumTuples;
+      m_Words.resize((numTuples + k_BitsPerWord - 1) / k_BitsPerWord, 0);
+      m_NumTuples = numTuples;
+      m_IsAllocated = true;
+      clearTailBits();
+      for(size_t i = oldNumTuples; i < numTuples && m_InitValue; i++)
+      {
+        setValue(i, true);
+      }
+      return 1;
+    }
+
+    /**
+     * @brief printTuple
+     * @param out
+     * @param i
+     * @param delimiter
+     */
+    virtual void printTuple(QTextStream& out, size_t i, char delimiter = ',')
+    {
+      out << getValue(i);
+    }
+
+    /**
+     * @brief printComponent
+     * @param out
+     * @param i
+     * @param j
+     */
+    virtual void printComponent(QTextStream& out, size_t i, int j)
+    {
+      out << getValue(i);
+    }
+
+    /**
+     * @brief getFullNameOfClass
+     * @return
+     */
+    QString getFullNameOfClass()
+    {
+      return "BitMaskArray";
+    }
+
+    /**
+     * @brief writeH5Data Writes the mask as a DataArray<bool>
+     * @param parentId
+     * @param tDims
+     * @return
+     */
+    virtual int writeH5Data(hid_t parentId, QVector<size_t> tDims)
+    {
+      if(!m_IsAllocated)
+      {
+        return -85648;
+      }
+      BoolArrayType::Pointer boolArray = toBoolArray(getName());
+      return boolArray->writeH5Data(parentId, tDims);
+    }
+
+    /**
+     * @brief writeXdmfAttribute
+     * @param out
+     * @param volDims
+     * @param hdfFileName
+     * @param groupPath
+     * @param label
+     * @return
+     */
+    virtual int writeXdmfAttribute(QTextStream& out, int64_t* volDims, const QString& hdfFileName, const QString& groupPath, const QString& label)
+    {
+      if(!m_IsAllocated)
+      {
+        return -85648;
+      }
+      QString xdmfTypeName;
+      int precision = 0;
+      getXdmfTypeAndSize(xdmfTypeName, precision);
+      QString dimStr = QString("%1 %2 %3 ").arg(volDims[2]).arg(volDims[1]).arg(volDims[0]);
+
+      out << "    <Attribute Name=\"" << getName() << label << "\" ";
+      out << "AttributeType=\"Scalar\" ";
+      out << "Center=\"Cell\">\n";
+      out << "      <DataItem Format=\"HDF\" Dimensions=\"" << dimStr << "\" ";
+      out << "NumberType=\"" << xdmfTypeName << "\" " << "Precision=\"" << precision << "\" >\n";
+      out << "        " << hdfFileName << groupPath << "/" << getName() << "\n";
+      out << "      </DataItem>" << "\n";
+      out << "    </Attribute>" << "\n";
+      return 1;
+    }
+
+    /**
+     * @brief getInfoString
+     * @return Returns a formatted string that contains general infomation about
+     * the instance of the object.
+     */
+    virtual QString getInfoString(SIMPL::InfoStringFormat format)
+    {
+      QString info;
+      QTextStream ss(&info);
+      if(format == SIMPL::HtmlFormat)
+      {
+        QLocale usa(QLocale::English, QLocale::UnitedStates);
+        ss << "<html><head></head>\n";
+        ss << "<body>\n";
+        ss << "<table cellpadding=\"4\" cellspacing=\"0\" border=\"0\">\n";
+        ss << "<tbody>\n";
+        ss << "<tr bgcolor=\"#FFFCEA\"><th colspan=2>Attribute Array Info</th></tr>";
+        ss << "<tr bgcolor=\"#E9E7D6\"><th align=\"right\">Name:</th><td>" << getName() << "</td></tr>";
+        ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Type:</th><td>" << getNameOfClass() << "</td></tr>";
+        QString numStr = usa.toString(static_cast<qlonglong>(getNumberOfTuples()));
+        ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Number of Tuples:</th><td>" << numStr << "</td></tr>";
+        numStr = usa.toString(static_cast<qlonglong>(m_Words.size() * sizeof(Word)));
+        ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Total Memory Required:</th><td>" << numStr << "</td></tr>";
+        ss << "</tbody></table>\n";
+        ss << "</body></html>";
+      }
+      return info;
+    }
+
+    /**
+     * @brief readH5Data Reads a DataArray<bool> or uint8 dataset and packs it. Non zero values are true.
+     * @param parentId
+     * @return
+     */
+    virtual int readH5Data(hid_t parentId)
+    {
+      resize(0);
+      IDataArray::Pointer p = H5DataArrayReader::ReadIDataArray(parentId, getName());
+      if(p.get() == nullptr || p->getNumberOfComponents() != 1)
+      {
+        return -1;
+      }
+
+      BoolArrayType::Pointer boolArray = std::dynamic_pointer_cast<BoolArrayType>(p);
+      UInt8ArrayType::Pointer uint8Array = std::dynamic_pointer_cast<UInt8ArrayType>(p);
+      if(nullptr == boolArray && nullptr == uint8Array)
+      {
+        return -1;
+      }
+
+      bool initValue = m_InitValue;
+      m_InitValue = false;
+      resize(p->getNumberOfTuples());
+      m_InitValue = initValue;
+      if(nullptr != boolArray)
+      {
+        copyFromBools(boolArray->getPointer(0));
+      }
+      else
+      {
+        uint8_t* values = uint8Array->getPointer(0);
+        for(size_t i = 0; i < m_NumTuples; i++)
+        {
+          setValue(i, values[i] != 0);
+        }
+      }
+      return 0;
+    }
+
+  protected:
+    /**
+    * @brief Protected Constructor
+    * @param numTuples The number of tuples in the mask
+    * @param name The name of the mask
+    * @param allocate Will the words be allocated
+    */
+    BitMaskArray(size_t numTuples, const QString& name, bool allocate = true)
+    : m_Name(name)
+    , m_NumTuples(numTuples)
+    , m_IsAllocated(allocate)
+    , m_InitValue(false)
+    {
+      if(allocate == true)
+      {
+        m_Words.resize((numTuples + k_BitsPerWord - 1) / k_BitsPerWord, 0);
+      }
+    }
+
+  private:
+    QString m_Name;
+    std::vector<Word> m_Words;
+    size_t m_NumTuples;
+    bool m_IsAllocated;
+    bool m_InitValue;
+
+    BitMaskArray(const BitMaskArray&) = delete; // Copy Constructor Not Implemented
+    void operator=(const BitMaskArray&) = delete; // Move assignment Not Implemented
+};
+
+#endif /* _bitmaskarray_h_ */
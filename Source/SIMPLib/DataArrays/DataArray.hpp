@@ -37,11 +37,14 @@
 #define _dataarray_h_
 
 // STL Includes
+#include <algorithm>
+#include <memory>
 #include <vector>
 #include <cstring>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
@@ -561,13 +564,36 @@ class DataArray : public IDataArray
     /**
      * @brief This class will NOT free the memory associated with the internal pointer.
      * This can be useful if the user wishes to keep the data around after this
-     * class goes out of scope.
+     * class goes out of scope. Whoever takes the memory gives it back with DataArrayAllocator::Release().
      */
     virtual void releaseOwnership()
     {
+      if(m_OwnsData && nullptr != m_Array)
+      {
+        // The allocator stops counting the memory and keeps it out of the pool until it is released
+        DataArrayAllocator::Forget(m_Array);
+      }
       m_OwnsData = false;
     }
 
+    /**
+     * @brief Hands the memory of this array over to the caller and leaves the array empty. The memory
+     * still belongs to the DataArrayAllocator, so the caller gives it back with DataArrayAllocator::Release()
+     * or hands it to another array with WrapPointer(..., true).
+     * @return The memory, or nullptr if this array does not own any
+     */
+    virtual void* releaseBuffer()
+    {
+      if(!m_OwnsData || nullptr == m_Array)
+      {
+        return nullptr;
+      }
+      void* buffer = static_cast<void*>(m_Array);
+      m_Array = nullptr;
+      clear();
+      return buffer;
+    }
+
     /**
      * @brief Allocates the memory needed for this class
      * @return 1 on success, -1 on failure
@@ -589,11 +615,7 @@ class DataArray : public IDataArray
 
 
       size_t newSize = m_Size;
-#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
-      m_Array = static_cast<T*>( _mm_malloc (newSize * sizeof(T), 16) );
-#else
-      m_Array = (T*)malloc(newSize * sizeof(T));
-#endif
+      m_Array = static_cast<T*>(DataArrayAllocator::Allocate(newSize * sizeof(T)));
       if (!m_Array)
       {
         qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
@@ -658,9 +680,6 @@ class DataArray : public IDataArray
      */
     virtual int eraseTuples(QVector<size_t>& idxs)
     {
-
-      int err = 0;
-
       // If nothing is to be erased just return
       if(idxs.size() == 0)
       {
@@ -673,95 +692,80 @@ class DataArray : public IDataArray
         return 0;
       }
 
-      // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
+      TupleCompactionMap map(getNumberOfTuples(), idxs);
+      return compactTuples(map);
+    }
+
+    /**
+     * @brief Removes the tuples described by a compaction map by moving the kept runs of tuples
+     * down inside the current allocation and then shrinking it.
+     * @param map The compaction map, built for the current number of tuples
+     * @return 0 on success, -100 if the map does not match this array
+     */
+    virtual int compactTuples(const TupleCompactionMap& map)
+    {
+      // Sanity Check the map to make sure we are not trying to remove any indices that are
       // off the end of the array and return an error code.
-      for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
+      if(!map.isValid() || map.getOldNumberOfTuples() != getNumberOfTuples())
       {
-        if (idxs[i] * m_NumComponents > m_MaxId) { return -100; }
+        return -100;
+      }
+      if(map.getNewNumberOfTuples() == map.getOldNumberOfTuples())
+      {
+        return 0;
+      }
+      if(map.getNewNumberOfTuples() == 0)
+      {
+        resize(0);
+        return 0;
       }
 
-      // Calculate the new size of the array to copy into
-      size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents ;
-
-      // Create a new m_Array to copy into
-      T* newArray = (T*)malloc(newSize * sizeof(T));
-      // Splat AB across the array so we know if we are copying the values or not
-      ::memset(newArray, 0xAB, newSize * sizeof(T));
-
-      // Keep the current Destination Pointer
-      T* currentDest = newArray;
-      size_t j = 0;
-      int k = 0;
-      // Find the first chunk to copy by walking the idxs array until we get an
-      // index that is NOT a continuous increment from the start
-      for (k = 0; k < idxs.size(); ++k)
+      const std::vector<TupleCompactionMap::Run>& runs = map.getRuns();
+      for(std::vector<TupleCompactionMap::Run>::const_iterator run = runs.begin(); run != runs.end(); ++run)
       {
-        if(j == idxs[k])
+        if(run->srcTuple != run->destTuple)
         {
-          ++j;
-        }
-        else
-        {
-          break;
+          // Runs only ever move towards the front so they are moved in order
+          std::memmove(m_Array + run->destTuple * m_NumComponents, m_Array + run->srcTuple * m_NumComponents, run->numTuples * m_NumComponents * sizeof(T));
         }
       }
 
-      if(k == idxs.size()) // Only front elements are being dropped
+      return (resize(map.getNewNumberOfTuples()) > 0) ? 0 : -1;
+    }
+
+    /**
+     * @brief Reorders the tuples in place so that tuple i holds the old tuple newOrder[i]. The values are
+     * copied once into a scratch buffer and gathered back, so arrays that do not own their memory work too.
+     * @param newOrder A permutation of the tuple indices
+     * @return 0 on success, -100 if newOrder does not have one entry per tuple or holds an invalid index
+     */
+    virtual int permuteTuples(const std::vector<size_t>& newOrder)
+    {
+      size_t numTuples = getNumberOfTuples();
+      if(newOrder.size() != numTuples)
+      {
+        return -100;
+      }
+      if(numTuples == 0 || !m_IsAllocated || nullptr == m_Array)
       {
-        T* currentSrc = m_Array + (j * m_NumComponents);
-        std::memcpy(currentDest, currentSrc, (getNumberOfTuples() - idxs.size()) * m_NumComponents * sizeof(T));
-        _deallocate(); // We are done copying - delete the current m_Array
-        m_Size = newSize;
-        m_Array = newArray;
-        m_OwnsData = true;
-        m_MaxId = newSize - 1;
-        m_IsAllocated = true;
         return 0;
       }
-
-      QVector<size_t> srcIdx(idxs.size() + 1);
-      QVector<size_t> destIdx(idxs.size() + 1);
-      QVector<size_t> copyElements(idxs.size() + 1);
-      srcIdx[0] = 0;
-      destIdx[0] = 0;
-      copyElements[0] = (idxs[0] - 0) * m_NumComponents;
-
-      for (int i = 1; i < srcIdx.size(); ++i)
+      for(std::vector<size_t>::const_iterator iter = newOrder.begin(); iter != newOrder.end(); ++iter)
       {
-        srcIdx[i] = (idxs[i - 1] + 1) * m_NumComponents;
-
-        if(i < srcIdx.size() - 1)
-        {
-          copyElements[i] = (idxs[i] - idxs[i - 1] - 1) * m_NumComponents;
-        }
-        else
+        if(*iter >= numTuples)
         {
-          copyElements[i] = (getNumberOfTuples() - idxs[i - 1] - 1) * m_NumComponents;
+          return -100;
         }
-        destIdx[i] = copyElements[i - 1] + destIdx[i - 1];
       }
 
-      // Copy the data
-      for (int i = 0; i < srcIdx.size(); ++i)
+      const size_t numComps = static_cast<size_t>(m_NumComponents);
+      std::unique_ptr<T[]> scratch(new T[numTuples * numComps]);
+      std::copy(m_Array, m_Array + numTuples * numComps, scratch.get());
+      for(size_t i = 0; i < numTuples; i++)
       {
-        currentDest = newArray + destIdx[i];
-        T* currentSrc = m_Array + srcIdx[i];
-        size_t bytes = copyElements[i] * sizeof(T);
-        std::memcpy(currentDest, currentSrc, bytes);
+        std::copy(scratch.get() + newOrder[i] * numComps, scratch.get() + (newOrder[i] + 1) * numComps, m_Array + i * numComps);
       }
-
-      // We are done copying - delete the current m_Array
-      _deallocate();
-
-      // Allocation was successful.  Save it.
-      m_Size = newSize;
-      m_Array = newArray;
-      // This object has now allocated its memory and owns it.
-      m_OwnsData = true;
-      m_IsAllocated = true;
-      m_MaxId = newSize - 1;
-
-      return err;
+      return 0;
     }
 
     /**
@@ -1370,11 +1374,7 @@ class DataArray : public IDataArray
       }
 #endif
 
-#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
-      _mm_free( m_buffer );
-#else
-      free(m_Array);
-#endif
+      DataArrayAllocator::Release(m_Array);
       m_Array = nullptr;
       m_IsAllocated = false;
     }
@@ -1428,20 +1428,12 @@ class DataArray : public IDataArray
         clear();
         return m_Array;
       }
-      // OS X's realloc does not free memory if the new block is smaller.  This
-      // is a very serious problem and causes huge amount of memory to be
-      // wasted. Do not use realloc on the Mac.
-      bool dontUseRealloc = false;
-#if defined __APPLE__
-      dontUseRealloc = true;
-#endif
-
       // Allocate a new array if we DO NOT own the current array
       if ((nullptr != m_Array) && (false == m_OwnsData))
       {
         // The old array is owned by the user so we cannot try to
         // reallocate it.  Just allocate new memory that we will own.
-        newArray = (T*)malloc(newSize * sizeof(T));
+        newArray = static_cast<T*>(DataArrayAllocator::Allocate(newSize * sizeof(T)));
         if (!newArray)
         {
           qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
@@ -1451,32 +1443,15 @@ class DataArray : public IDataArray
         // Copy the data from the old array.
         std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
       }
-      else if (!dontUseRealloc)
-      {
-        // Try to reallocate with minimal memory usage and possibly avoid copying.
-        newArray = (T*)realloc(m_Array, newSize * sizeof(T));
-        if (!newArray)
-        {
-          qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
-          return nullptr;
-        }
-      }
       else
       {
-        newArray = (T*)malloc(newSize * sizeof(T));
+        // The allocator keeps the block when it is large enough and moves the data otherwise
+        newArray = static_cast<T*>(DataArrayAllocator::Reallocate(m_Array, m_Size * sizeof(T), newSize * sizeof(T)));
         if (!newArray)
         {
           qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
           return nullptr;
         }
-
-        // Copy the data from the old array.
-        if (m_Array != nullptr)
-        {
-          std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
-        }
-        // Free the old array
-        _deallocate();
       }
 
       // Allocation was successful.  Save it.
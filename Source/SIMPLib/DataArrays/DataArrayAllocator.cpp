@@ -0,0 +1,569 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataArrayAllocator.h"
+
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+namespace
+{
+static const size_t k_HugePageSize = 2 * 1024 * 1024;
+static const size_t k_FirstTouchBlockSize = 4 * 1024 * 1024;
+
+#if defined(_WIN32)
+// Blocks from _aligned_malloc() can only be given to _aligned_free(), so Release() has to recognize forgotten blocks
+static const bool k_TrackForgottenBlocks = true;
+#else
+// Blocks from posix_memalign() can be given to free() and realloc(), so forgotten blocks need no bookkeeping
+static const bool k_TrackForgottenBlocks = false;
+#endif
+
+/**
+ * @brief The Block struct describes a live block
+ */
+struct Block
+{
+  size_t capacity;
+  const DataArrayAllocator::Scope* scope; // Scope the block counts for, or nullptr
+};
+
+/**
+ * @brief The AllocatorState struct holds everything the allocator knows. Pooled blocks are not in blocks. forgotten
+ * is only filled where k_TrackForgottenBlocks is set, and a block leaves it once it is released or its address is
+ * handed out again.
+ */
+struct AllocatorState
+{
+  std::mutex mutex;
+  DataArrayAllocator::Settings settings;
+  DataArrayAllocator::Statistics statistics;
+  std::unordered_map<void*, Block> blocks;                                            // Every live block
+  std::unordered_set<void*> forgotten;                                                // Blocks handed over with Forget() that are not released yet
+  std::multimap<size_t, void*> pool;                                                  // Released blocks by capacity
+  std::map<const DataArrayAllocator::Scope*, DataArrayAllocator::Statistics> scopes; // Statistics of every open scope
+};
+
+AllocatorState& State()
+{
+  static AllocatorState state;
+  return state;
+}
+
+thread_local DataArrayAllocator::Scope* t_CurrentScope = nullptr;
+
+bool IsPowerOfTwo(size_t value)
+{
+  return value != 0 && (value & (value - 1)) == 0;
+}
+
+size_t RoundUp(size_t value, size_t multiple)
+{
+  return ((value + multiple - 1) / multiple) * multiple;
+}
+
+/**
+ * @brief Capacity Rounds a request up so that blocks of nearly the same size share a pool entry
+ */
+size_t Capacity(size_t bytes, const DataArrayAllocator::Settings& settings)
+{
+  if(settings.useHugePages && bytes >= settings.hugePageThreshold)
+  {
+    return RoundUp(bytes, k_HugePageSize);
+  }
+  return RoundUp(bytes, settings.alignment);
+}
+
+void* SystemAllocate(size_t capacity, const DataArrayAllocator::Settings& settings)
+{
+  bool hugePages = settings.useHugePages && capacity >= settings.hugePageThreshold;
+  size_t alignment = hugePages ? std::max(settings.alignment, k_HugePageSize) : settings.alignment;
+  alignment = std::max(alignment, sizeof(void*));
+#if defined(_WIN32)
+  return _aligned_malloc(capacity, alignment);
+#else
+  void* ptr = nullptr;
+  if(posix_memalign(&ptr, alignment, capacity) != 0)
+  {
+    return nullptr;
+  }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if(hugePages)
+  {
+    madvise(ptr, capacity, MADV_HUGEPAGE);
+  }
+#endif
+  return ptr;
+#endif
+}
+
+void SystemFree(void* ptr)
+{
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+/**
+ * @brief The FirstTouchImpl class zeroes a fresh block in parallel so that every page is mapped by one of the
+ * worker threads
+ */
+class FirstTouchImpl
+{
+public:
+  FirstTouchImpl(char* ptr, size_t bytes)
+  : m_Ptr(ptr)
+  , m_Bytes(bytes)
+  {
+  }
+
+  void touch(size_t start, size_t end) const
+  {
+    for(size_t block = start; block < end; block++)
+    {
+      size_t offset = block * k_FirstTouchBlockSize;
+      std::memset(m_Ptr + offset, 0, std::min(k_FirstTouchBlockSize, m_Bytes - offset));
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    touch(r.begin(), r.end());
+  }
+#endif
+
+private:
+  char* m_Ptr;
+  size_t m_Bytes;
+};
+
+void FirstTouch(void* ptr, size_t bytes)
+{
+  size_t numBlocks = (bytes + k_FirstTouchBlockSize - 1) / k_FirstTouchBlockSize;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks), FirstTouchImpl(static_cast<char*>(ptr), bytes), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    FirstTouchImpl serial(static_cast<char*>(ptr), bytes);
+    serial.touch(0, numBlocks);
+  }
+}
+
+void CountAllocation(DataArrayAllocator::Statistics& statistics, size_t capacity, bool poolHit)
+{
+  statistics.liveBytes += capacity;
+  statistics.peakBytes = std::max(statistics.peakBytes, statistics.liveBytes);
+  statistics.allocations++;
+  if(poolHit)
+  {
+    statistics.poolHits++;
+  }
+}
+
+void AddLiveBlock(AllocatorState& state, void* ptr, size_t capacity, bool poolHit)
+{
+  Block block;
+  block.capacity = capacity;
+  block.scope = t_CurrentScope;
+  state.blocks[ptr] = block;
+  state.forgotten.erase(ptr);
+
+  CountAllocation(state.statistics, capacity, poolHit);
+  if(nullptr != block.scope)
+  {
+    CountAllocation(state.scopes[block.scope], capacity, poolHit);
+  }
+}
+
+/**
+ * @brief RemoveLiveBlock Stops tracking a live block and returns its capacity
+ */
+size_t RemoveLiveBlock(AllocatorState& state, std::unordered_map<void*, Block>::iterator block)
+{
+  size_t capacity = block->second.capacity;
+  state.statistics.liveBytes -= capacity;
+  if(nullptr != block->second.scope)
+  {
+    state.scopes[block->second.scope].liveBytes -= capacity;
+  }
+  state.blocks.erase(block);
+  return capacity;
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Settings::Settings()
+: alignment(64)
+, useHugePages(true)
+, hugePageThreshold(8 * 1024 * 1024)
+, usePool(true)
+, poolMinBlockSize(1024 * 1024)
+, poolCapacity(256 * 1024 * 1024)
+, parallelFirstTouch(true)
+, firstTouchThreshold(64 * 1024 * 1024)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Statistics::Statistics()
+: liveBytes(0)
+, peakBytes(0)
+, pooledBytes(0)
+, allocations(0)
+, poolHits(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Scope::Scope()
+: m_Parent(t_CurrentScope)
+{
+  AllocatorState& state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.scopes[this] = Statistics();
+  t_CurrentScope = this;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Scope::~Scope()
+{
+  t_CurrentScope = m_Parent;
+  AllocatorState& state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.scopes.erase(this);
+  // Arrays that outlive the scope, e.g. those of the returned DataContainerArray, no longer count for it
+  for(std::unordered_map<void*, Block>::iterator block = state.blocks.begin(); block != state.blocks.end(); ++block)
+  {
+    if(block->second.scope == this)
+    {
+      block->second.scope = nullptr;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Statistics DataArrayAllocator::Scope::getStatistics() const
+{
+  AllocatorState& state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.scopes[this];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::DataArrayAllocator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::~DataArrayAllocator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::SetSettings(const Settings& settings)
+{
+  Settings sanitized = settings;
+  if(!IsPowerOfTwo(sanitized.alignment))
+  {
+    sanitized.alignment = Settings().alignment;
+  }
+  {
+    AllocatorState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.settings = sanitized;
+  }
+  if(!sanitized.usePool)
+  {
+    ReleasePool();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Settings DataArrayAllocator::GetSettings()
+{
+  AllocatorState& state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.settings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayAllocator::Allocate(size_t bytes)
+{
+  if(bytes == 0)
+  {
+    return nullptr;
+  }
+
+  AllocatorState& state = State();
+  Settings settings;
+  size_t capacity = 0;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    settings = state.settings;
+    capacity = Capacity(bytes, settings);
+    std::multimap<size_t, void*>::iterator pooled = state.pool.find(capacity);
+    if(pooled != state.pool.end())
+    {
+      void* ptr = pooled->second;
+      state.pool.erase(pooled);
+      state.statistics.pooledBytes -= capacity;
+      AddLiveBlock(state, ptr, capacity, true);
+      return ptr;
+    }
+  }
+
+  void* ptr = SystemAllocate(capacity, settings);
+  if(nullptr == ptr)
+  {
+    // Give the pooled memory back to the system and try once more
+    ReleasePool();
+    ptr = SystemAllocate(capacity, settings);
+    if(nullptr == ptr)
+    {
+      return nullptr;
+    }
+  }
+  if(settings.parallelFirstTouch && capacity >= settings.firstTouchThreshold)
+  {
+    FirstTouch(ptr, capacity);
+  }
+
+  std::lock_guard<std::mutex> lock(state.mutex);
+  AddLiveBlock(state, ptr, capacity, false);
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayAllocator::Reallocate(void* ptr, size_t oldBytes, size_t newBytes)
+{
+  if(nullptr == ptr)
+  {
+    return Allocate(newBytes);
+  }
+  if(newBytes == 0)
+  {
+    Release(ptr);
+    return nullptr;
+  }
+
+  AllocatorState& state = State();
+  bool tracked = false;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::unordered_map<void*, Block>::iterator block = state.blocks.find(ptr);
+    if(block != state.blocks.end())
+    {
+      tracked = true;
+      if(newBytes <= block->second.capacity && newBytes >= block->second.capacity / 2)
+      {
+        return ptr;
+      }
+    }
+    else if(state.forgotten.count(ptr) > 0)
+    {
+      // The block comes from SystemAllocate(), so realloc() can not resize it
+      tracked = true;
+    }
+  }
+
+  if(!tracked)
+  {
+#if defined(__APPLE__)
+    // OS X's realloc does not free memory if the new block is smaller, so the data is always moved
+    void* newPtr = malloc(newBytes);
+    if(nullptr != newPtr)
+    {
+      std::memcpy(newPtr, ptr, std::min(oldBytes, newBytes));
+      free(ptr);
+    }
+    return newPtr;
+#else
+    return realloc(ptr, newBytes);
+#endif
+  }
+
+  void* newPtr = Allocate(newBytes);
+  if(nullptr != newPtr)
+  {
+    std::memcpy(newPtr, ptr, std::min(oldBytes, newBytes));
+    Release(ptr);
+  }
+  return newPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::Release(void* ptr)
+{
+  if(nullptr == ptr)
+  {
+    return;
+  }
+
+  AllocatorState& state = State();
+  bool ours = true;
+  {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    std::unordered_map<void*, Block>::iterator block = state.blocks.find(ptr);
+    if(block != state.blocks.end())
+    {
+      size_t capacity = RemoveLiveBlock(state, block);
+      const Settings& settings = state.settings;
+      if(settings.usePool && capacity >= settings.poolMinBlockSize && state.statistics.pooledBytes + capacity <= settings.poolCapacity)
+      {
+        state.pool.insert(std::make_pair(capacity, ptr));
+        state.statistics.pooledBytes += capacity;
+        return;
+      }
+    }
+    else
+    {
+      ours = state.forgotten.erase(ptr) > 0;
+    }
+  }
+  if(ours)
+  {
+    SystemFree(ptr);
+  }
+  else
+  {
+    free(ptr);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::Forget(void* ptr)
+{
+  AllocatorState& state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  std::unordered_map<void*, Block>::iterator block = state.blocks.find(ptr);
+  if(block != state.blocks.end())
+  {
+    RemoveLiveBlock(state, block);
+    if(k_TrackForgottenBlocks)
+    {
+      state.forgotten.insert(ptr);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Statistics DataArrayAllocator::GetStatistics()
+{
+  AllocatorState& state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  return state.statistics;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::ResetPeakBytes()
+{
+  AllocatorState& state = State();
+  std::lock_guard<std::mutex> lock(state.mutex);
+  state.statistics.peakBytes = state.statistics.liveBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::ReleasePool()
+{
+  std::multimap<size_t, void*> pool;
+  {
+    AllocatorState& state = State();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    pool.swap(state.pool);
+    state.statistics.pooledBytes = 0;
+  }
+  for(std::multimap<size_t, void*>::iterator block = pool.begin(); block != pool.end(); ++block)
+  {
+    SystemFree(block->second);
+  }
+}
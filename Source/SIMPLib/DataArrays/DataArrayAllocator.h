@@ -0,0 +1,161 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _dataarrayallocator_h_
+#define _dataarrayallocator_h_
+
+#include <cstddef>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The DataArrayAllocator class provides the memory of DataArray. Blocks are aligned for wide SIMD
+ * loads, large blocks are aligned to and advised for transparent huge pages, large fresh blocks are first
+ * touched in parallel so that their pages are spread over the NUMA nodes of the threads that will work on
+ * them, and released large blocks are kept in a pool so that temporaries of the same size are recycled
+ * instead of being unmapped and faulted in again. The statistics cover every block the allocator handed out
+ * and that has not been released or forgotten. The allocator is shared by the whole process and is thread safe.
+ *
+ * Blocks handed over with Forget(), e.g. by DataArray::releaseOwnership(), must still be given back with
+ * Release(). On Windows the blocks come from _aligned_malloc() and free() can not be used on them.
+ */
+class SIMPLib_EXPORT DataArrayAllocator
+{
+  public:
+    /**
+     * @brief The Settings struct configures the allocator
+     */
+    struct SIMPLib_EXPORT Settings
+    {
+      Settings();
+
+      size_t alignment;           // Alignment of every block, a power of 2; 64 matches an AVX-512 register
+      bool useHugePages;          // Align large blocks to 2 MiB and advise the kernel to back them with huge pages
+      size_t hugePageThreshold;   // Smallest block size, in bytes, that uses huge pages
+      bool usePool;               // Keep released blocks for reuse
+      size_t poolMinBlockSize;    // Smallest block size, in bytes, that is kept in the pool
+      size_t poolCapacity;        // Maximum number of bytes the pool holds on to, 256 MiB by default
+      bool parallelFirstTouch;    // Zero large fresh blocks in parallel
+      size_t firstTouchThreshold; // Smallest block size, in bytes, that is touched in parallel
+    };
+
+    /**
+     * @brief The Statistics struct reports the memory handed out by the allocator
+     */
+    struct SIMPLib_EXPORT Statistics
+    {
+      Statistics();
+
+      size_t liveBytes;   // Bytes in blocks that are in use
+      size_t peakBytes;   // Largest value of liveBytes since the last ResetPeakBytes()
+      size_t pooledBytes; // Bytes in released blocks that are kept for reuse
+      size_t allocations; // Number of blocks handed out
+      size_t poolHits;    // Number of blocks that were taken from the pool
+    };
+
+    /**
+     * @brief The Scope class collects the statistics of the blocks that the creating thread allocates while the
+     * scope exists, e.g. for the duration of one pipeline, without touching the process wide statistics. Scopes
+     * may be nested, in which case a block counts for the innermost scope of its thread only. pooledBytes is
+     * not tracked per scope and stays 0.
+     */
+    class SIMPLib_EXPORT Scope
+    {
+      public:
+        Scope();
+        virtual ~Scope();
+
+        Statistics getStatistics() const;
+
+      private:
+        Scope* m_Parent;
+
+        Scope(const Scope&);          // Copy Constructor Not Implemented
+        void operator=(const Scope&); // Move assignment Not Implemented
+    };
+
+    virtual ~DataArrayAllocator();
+
+    static void SetSettings(const Settings& settings);
+    static Settings GetSettings();
+
+    /**
+     * @brief Allocate Returns a block of at least the given number of bytes, or nullptr if the system is out
+     * of memory or bytes is 0. The content of the block is undefined.
+     */
+    static void* Allocate(size_t bytes);
+
+    /**
+     * @brief Reallocate Resizes a block like realloc(). A block that shrinks by less than half is kept as it is.
+     * Blocks that do not come from this allocator are resized with realloc().
+     * @param ptr The block, may be nullptr
+     * @param oldBytes The number of bytes of the block that are in use
+     * @param newBytes The new number of bytes
+     * @return The new block, or nullptr on failure in which case ptr is still valid
+     */
+    static void* Reallocate(void* ptr, size_t oldBytes, size_t newBytes);
+
+    /**
+     * @brief Release Gives a block back. Blocks that do not come from this allocator are given to free().
+     */
+    static void Release(void* ptr);
+
+    /**
+     * @brief Forget Removes a block from the statistics and keeps it out of the pool because its ownership is
+     * handed over to other code. That code gives it back with Release().
+     */
+    static void Forget(void* ptr);
+
+    static Statistics GetStatistics();
+
+    /**
+     * @brief ResetPeakBytes Sets the peak to the current number of live bytes, e.g. at the start of a pipeline
+     */
+    static void ResetPeakBytes();
+
+    /**
+     * @brief ReleasePool Frees every block that is kept in the pool
+     */
+    static void ReleasePool();
+
+  protected:
+    DataArrayAllocator();
+
+  private:
+    DataArrayAllocator(const DataArrayAllocator&); // Copy Constructor Not Implemented
+    void operator=(const DataArrayAllocator&);     // Move assignment Not Implemented
+};
+
+#endif /* _dataarrayallocator_h_ */
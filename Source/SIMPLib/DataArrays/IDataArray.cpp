@@ -30,3 +30,41 @@ bool IDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourc
 {
   return copyFromArray(destTupleOffset, sourceArray, 0, sourceArray->getNumberOfTuples());
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::compactTuples(const TupleCompactionMap& map)
+{
+  if(!map.isValid() || map.getOldNumberOfTuples() != getNumberOfTuples())
+  {
+    return -100;
+  }
+  QVector<size_t> idxs = map.getRemoveList();
+  return eraseTuples(idxs);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::permuteTuples(const std::vector<size_t>& newOrder)
+{
+  size_t numTuples = getNumberOfTuples();
+  if(newOrder.size() != numTuples)
+  {
+    return -100;
+  }
+  IDataArray::Pointer source = deepCopy();
+  if(nullptr == source.get())
+  {
+    return -1;
+  }
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    if(newOrder[i] != i && !copyFromArray(i, source, newOrder[i], 1))
+    {
+      return -1;
+    }
+  }
+  return 0;
+}
@@ -25,6 +25,7 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/TupleCompactionMap.h"
 
 
 /**
@@ -144,6 +145,22 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual int eraseTuples(QVector<size_t>& idxs) = 0;
 
+    /**
+     * @brief Removes the tuples described by a compaction map in place. The default implementation
+     * falls back to eraseTuples().
+     * @param map The compaction map, built for the current number of tuples of this array
+     * @return 0 on success, -100 if the map does not match this array
+     */
+    virtual int compactTuples(const TupleCompactionMap& map);
+
+    /**
+     * @brief Reorders the tuples in place so that tuple i holds the old tuple newOrder[i]. The default
+     * implementation copies the tuples one at a time from a deep copy of the array.
+     * @param newOrder A permutation of the tuple indices
+     * @return 0 on success, -100 if newOrder does not have one entry per tuple, -1 if a tuple could not be copied
+     */
+    virtual int permuteTuples(const std::vector<size_t>& newOrder);
+
     /**
      * @brief Copies a Tuple from one position to another.
      * @param currentPos The index of the source data
@@ -37,8 +37,17 @@
 #ifndef _NEIGHBORLIST_H_
 #define _NEIGHBORLIST_H_
 
+#include <cstring>
+#include <memory>
 #include <vector>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include <QtCore/QString>
 #include <QtCore/QMap>
 #include <QtCore/QTextStream>
@@ -54,6 +63,45 @@
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
 
+/**
+ * @brief The FlattenNeighborListImpl class copies a range of lists into their slots of a single flat array. The
+ * offset of every list is known up front, so every range can be copied independently.
+ */
+template <typename T> class FlattenNeighborListImpl
+{
+public:
+  FlattenNeighborListImpl(const std::vector<std::shared_ptr<std::vector<T>>>& lists, const std::vector<size_t>& offsets, T* flat)
+  : m_Lists(lists)
+  , m_Offsets(offsets)
+  , m_Flat(flat)
+  {
+  }
+
+  void flatten(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      size_t nEle = m_Lists[i]->size();
+      if(nEle == 0)
+      {
+        continue;
+      }
+      ::memcpy(m_Flat + m_Offsets[i], &(m_Lists[i]->front()), nEle * sizeof(T));
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    flatten(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const std::vector<std::shared_ptr<std::vector<T>>>& m_Lists;
+  const std::vector<size_t>& m_Offsets;
+  T* m_Flat;
+};
 
 /**
  * @class NeighborList NeighborList.hpp DREAM3DLib/Common/NeighborList.hpp
@@ -342,7 +390,6 @@ class NeighborList : public IDataArray
      */
     virtual int eraseTuples(QVector<size_t>& idxs)
     {
-      int err = 0;
       // If nothing is to be erased just return
       if(idxs.size() == 0)
       {
@@ -356,34 +403,126 @@ class NeighborList : public IDataArray
         return 0;
       }
 
-      size_t arraySize = m_Array.size();
-      // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
-      // off the end of the array and return an error code.
-      for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
+      TupleCompactionMap map(m_Array.size(), idxs);
+      return compactTuples(map);
+    }
+
+    /**
+     * @brief Removes the lists described by a compaction map in place. Only the shared pointers
+     * to the lists are moved.
+     * @param map The compaction map, built for the current number of tuples
+     * @return 0 on success, -100 if the map does not match this array
+     */
+    virtual int compactTuples(const TupleCompactionMap& map)
+    {
+      if(!map.isValid() || map.getOldNumberOfTuples() != m_Array.size())
       {
-        if (idxs[i] >= arraySize) { return -100; }
+        return -100;
       }
+      map.compactElements(m_Array);
+      m_NumTuples = m_Array.size();
+      return 0;
+    }
 
-      std::vector<SharedVectorType> replacement(arraySize - idxsSize);
+    /**
+     * @brief Reorders the lists in place so that list i is the old list newOrder[i]. Only the shared
+     * pointers to the lists are moved.
+     * @param newOrder A permutation of the tuple indices
+     * @return 0 on success, -100 if newOrder does not have one entry per tuple or holds an invalid index
+     */
+    virtual int permuteTuples(const std::vector<size_t>& newOrder)
+    {
+      if(newOrder.size() != m_Array.size())
+      {
+        return -100;
+      }
+      std::vector<SharedVectorType> lists(m_Array.size());
+      for(size_t i = 0; i < newOrder.size(); i++)
+      {
+        if(newOrder[i] >= m_Array.size())
+        {
+          return -100;
+        }
+        lists[i] = m_Array[newOrder[i]];
+      }
+      m_Array.swap(lists);
+      return 0;
+    }
 
-      size_t idxsIndex = 0;
-      size_t rIdx = 0;
-      for(size_t dIdx = 0; dIdx < arraySize; ++dIdx)
+    /**
+     * @brief renumberValues Replaces every value v of every list with newValues[v] and erases the values
+     * whose new value is negative. Values that are not valid indices into newValues are left as they are.
+     * This keeps lists of feature ids valid after features have been removed and the remaining ones renumbered.
+     * @param newValues The new value of every old value, negative for values to erase
+     */
+    void renumberValues(const std::vector<T>& newValues)
+    {
+      const size_t numValues = newValues.size();
+      for(typename std::vector<SharedVectorType>::iterator list = m_Array.begin(); list != m_Array.end(); ++list)
       {
-        if (dIdx != idxs[idxsIndex])
+        if(nullptr == list->get())
         {
-          replacement[rIdx] = m_Array[dIdx];
-          ++rIdx;
+          continue;
         }
-        else
+        typename VectorType::iterator dest = (*list)->begin();
+        for(typename VectorType::iterator value = (*list)->begin(); value != (*list)->end(); ++value)
         {
-          ++idxsIndex;
-          if (idxsIndex == idxsSize ) { idxsIndex--;}
+          T newValue = *value;
+          if(*value >= 0 && static_cast<size_t>(*value) < numValues)
+          {
+            newValue = newValues[static_cast<size_t>(*value)];
+            if(newValue < 0)
+            {
+              continue;
+            }
+          }
+          *dest = newValue;
+          ++dest;
         }
+        (*list)->erase(dest, (*list)->end());
       }
-      m_Array = replacement;
-      m_NumTuples = m_Array.size();
-      return err;
+    }
+
+    /**
+     * @brief eraseValues Erases the values whose flag is false. A list that holds one value per entry of another
+     * list, such as the shared surface areas of the neighbor list, loses the same positions when it is given the
+     * same flags.
+     * @param keep One vector of flags per tuple, as long as the list of that tuple
+     * @return 0 on success, -100 if keep does not have the shape of this array, in which case nothing is erased
+     */
+    int eraseValues(const std::vector<std::vector<bool>>& keep)
+    {
+      if(keep.size() != m_Array.size())
+      {
+        return -100;
+      }
+      for(size_t i = 0; i < m_Array.size(); i++)
+      {
+        size_t listSize = (nullptr == m_Array[i].get()) ? 0 : m_Array[i]->size();
+        if(keep[i].size() != listSize)
+        {
+          return -100;
+        }
+      }
+      for(size_t i = 0; i < m_Array.size(); i++)
+      {
+        if(nullptr == m_Array[i].get())
+        {
+          continue;
+        }
+        VectorType& list = *(m_Array[i]);
+        size_t dest = 0;
+        for(size_t j = 0; j < list.size(); j++)
+        {
+          if(keep[i][j])
+          {
+            list[dest] = list[j];
+            dest++;
+          }
+        }
+        list.resize(dest);
+      }
+      return 0;
     }
 
     /**
@@ -641,10 +780,12 @@ class NeighborList : public IDataArray
       // we compute here.
       Int32ArrayType::Pointer numNeighborsPtr = Int32ArrayType::CreateArray(m_Array.size(), m_NumNeighborsArrayName);
       int32_t* numNeighbors = numNeighborsPtr->getPointer(0);
+      std::vector<size_t> offsets(m_Array.size());
       size_t total = 0;
       for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
       {
         numNeighbors[dIdx] = static_cast<int32_t>(m_Array[dIdx]->size());
+        offsets[dIdx] = total;
         total += m_Array[dIdx]->size();
       }
 
@@ -689,19 +830,20 @@ class NeighborList : public IDataArray
 
       // Allocate an array of the proper size so we can concatenate all the arrays together into a single array that
       // can be written to the HDF5 File. This operation can ballon the memory size temporarily until this operation
-      // is complete.
-      QVector<T> flat (total);
-      size_t currentStart = 0;
-      for(size_t dIdx = 0; dIdx < m_Array.size(); ++dIdx)
+      // is complete. The lists are copied in parallel since the offset of every list is already known.
+      std::unique_ptr<T[]> flat(new T[total > 0 ? total : 1]);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      tbb::task_scheduler_init init;
+      bool doParallel = true;
+      if(doParallel == true)
+      {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, m_Array.size()), FlattenNeighborListImpl<T>(m_Array, offsets, flat.get()), tbb::auto_partitioner());
+      }
+      else
+#endif
       {
-        size_t nEle = m_Array[dIdx]->size();
-        if (nEle == 0) { continue; }
-        T* start = &(m_Array[dIdx]->front()); // get the pointer to the front of the array
-        //    T* end = start + nEle; // get the pointer to the end of the array
-        T* dst = &(flat.front()) + currentStart;
-        ::memcpy(dst, start, nEle * sizeof(T));
-
-        currentStart += m_Array[dIdx]->size();
+        FlattenNeighborListImpl<T> serial(m_Array, offsets, flat.get());
+        serial.flatten(0, m_Array.size());
       }
 
       // Now we can actually write the actual array data.
@@ -709,7 +851,7 @@ class NeighborList : public IDataArray
       hsize_t dims[1] = { total };
       if (total > 0)
       {
-        err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, &(flat.front()));
+        err = QH5Lite::writePointerDataset(parentId, getName(), rank, dims, flat.get());
         if(err < 0)
         {
           return -605;
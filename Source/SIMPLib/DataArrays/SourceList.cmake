@@ -3,20 +3,25 @@ set(SUBDIR_NAME DataArrays)
 
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BitMaskArray.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArray.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayAllocator.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/NeighborList.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StatsDataArray.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StringDataArray.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StructArray.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/TupleCompactionMap.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DynamicListArray.hpp
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayAllocator.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArray.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IDataArrayFilter.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/StatsDataArray.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/TupleCompactionMap.cpp
 )
 cmp_IDE_SOURCE_PROPERTIES( "${SUBDIR_NAME}" "${SIMPLib_${SUBDIR_NAME}_HDRS};${SIMPLib_${SUBDIR_NAME}_Moc_HDRS}" "${SIMPLib_${SUBDIR_NAME}_SRCS}" "${PROJECT_INSTALL_HEADERS}")
 cmp_IDE_SOURCE_PROPERTIES( "Generated/${SUBDIR_NAME}" "" "${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS}" "0")
@@ -294,9 +294,6 @@ class StringDataArray : public IDataArray
      */
     virtual int eraseTuples(QVector<size_t>& idxs)
     {
-
-      int err = 0;
-
       // If nothing is to be erased just return
       if(idxs.size() == 0)
       {
@@ -309,31 +306,23 @@ class StringDataArray : public IDataArray
         return 0;
       }
 
-      // Sanity Check the Indices in the vector to make sure we are not trying to remove any indices that are
-      // off the end of the array and return an error code.
-      for(QVector<size_t>::size_type i = 0; i < idxs.size(); ++i)
-      {
-        if (idxs[i] >= static_cast<size_t>(m_Array.size())) { return -100; }
-      }
-
+      TupleCompactionMap map(getNumberOfTuples(), idxs);
+      return compactTuples(map);
+    }
 
-      // Create a new Array to copy into
-      std::vector<QString> newArray;
-      std::vector<size_t>::size_type start = 0;
-      for(QVector<QString>::size_type i = 0; i < m_Array.size(); ++i)
+    /**
+     * @brief Removes the tuples described by a compaction map in place
+     * @param map The compaction map, built for the current number of tuples
+     * @return 0 on success, -100 if the map does not match this array
+     */
+    virtual int compactTuples(const TupleCompactionMap& map)
+    {
+      if(!map.isValid() || map.getOldNumberOfTuples() != getNumberOfTuples())
       {
-        bool keep = true;
-        for(QVector<size_t>::size_type j = start; j < idxs.size(); ++j)
-        {
-          if (static_cast<size_t>(i) == idxs[j]) { keep = false; break;}
-        }
-        if (keep)
-        {
-          newArray.push_back(m_Array[i]);
-        }
+        return -100;
       }
-      m_Array = newArray;
-      return err;
+      map.compactElements(m_Array);
+      return 0;
     }
 
     /**
@@ -0,0 +1,302 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/BitMaskArray.hpp"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class BitMaskArrayTest
+{
+public:
+  // Spans two full words plus a partial third word
+  const size_t k_NumTuples = 150;
+
+  BitMaskArrayTest()
+  {
+  }
+  virtual ~BitMaskArrayTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString getTestFile()
+  {
+    return UnitTest::TestTempDir + QString::fromLatin1("/BitMaskArrayTest.h5");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(getTestFile());
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  bool expectedValue(size_t i)
+  {
+    return (i % 3) == 0 || i == 149;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  BitMaskArray::Pointer createMask()
+  {
+    BitMaskArray::Pointer mask = BitMaskArray::CreateArray(k_NumTuples, "Mask");
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get())
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_NumTuples)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfWords(), 3)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 0)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      mask->setValue(i, expectedValue(i));
+    }
+    return mask;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  size_t expectedCount()
+  {
+    size_t count = 0;
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      count += expectedValue(i) ? 1 : 0;
+    }
+    return count;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestValuesAndCount()
+  {
+    BitMaskArray::Pointer mask = createMask();
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), expectedValue(i))
+    }
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), expectedCount())
+    DREAM3D_REQUIRE_EQUAL(mask->getTypeAsString(), SIMPL::TypeNames::BitMask)
+    DREAM3D_REQUIRE_EQUAL(mask->getTypeSize(), sizeof(BitMaskArray::Word))
+    DREAM3D_REQUIRE_EQUAL(mask->getVoidPointer(BitMaskArray::k_BitsPerWord + 1), static_cast<void*>(mask->getWords() + 1))
+
+    // Clearing a bit must leave its neighbours untouched
+    mask->setValue(3, false);
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(2), false)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(3), false)
+    DREAM3D_REQUIRE_EQUAL(mask->getValue(6), true)
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), expectedCount() - 1)
+
+    mask->initializeWithValue(true);
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), k_NumTuples)
+    mask->initializeWithZeros();
+    DREAM3D_REQUIRE_EQUAL(mask->countTrue(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestWordOperations()
+  {
+    BitMaskArray::Pointer mask = createMask();
+    BitMaskArray::Pointer other = BitMaskArray::CreateArray(k_NumTuples, "Other");
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      other->setValue(i, i < 100);
+    }
+
+    BitMaskArray::Pointer andMask = std::dynamic_pointer_cast<BitMaskArray>(mask->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(andMask->bitwiseAnd(other.get()), true)
+    BitMaskArray::Pointer orMask = std::dynamic_pointer_cast<BitMaskArray>(mask->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(orMask->bitwiseOr(other.get()), true)
+    BitMaskArray::Pointer notMask = std::dynamic_pointer_cast<BitMaskArray>(mask->deepCopy());
+    notMask->bitwiseNot();
+
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      bool expectedAnd = expectedValue(i) && i < 100;
+      bool expectedOr = expectedValue(i) || i < 100;
+      bool expectedNot = !expectedValue(i);
+      DREAM3D_REQUIRE_EQUAL(andMask->getValue(i), expectedAnd)
+      DREAM3D_REQUIRE_EQUAL(orMask->getValue(i), expectedOr)
+      DREAM3D_REQUIRE_EQUAL(notMask->getValue(i), expectedNot)
+    }
+    // The unused bits of the last word must stay cleared after a NOT
+    DREAM3D_REQUIRE_EQUAL(notMask->countTrue(), k_NumTuples - expectedCount())
+
+    BitMaskArray::Pointer shortMask = BitMaskArray::CreateArray(k_NumTuples - 1, "Short");
+    DREAM3D_REQUIRE_EQUAL(mask->bitwiseAnd(shortMask.get()), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBoolConversion()
+  {
+    BitMaskArray::Pointer mask = createMask();
+    BoolArrayType::Pointer boolArray = mask->toBoolArray("Bools");
+    DREAM3D_REQUIRE_EQUAL(boolArray->getNumberOfTuples(), k_NumTuples)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(boolArray->getValue(i), expectedValue(i))
+    }
+
+    BitMaskArray::Pointer packed = BitMaskArray::FromBoolArray(boolArray.get(), "Packed");
+    DREAM3D_REQUIRE_VALID_POINTER(packed.get())
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(packed->getValue(i), expectedValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestResizeAndErase()
+  {
+    BitMaskArray::Pointer mask = createMask();
+
+    // Remove the first tuple of every word so values shift across word boundaries
+    QVector<size_t> idxs;
+    idxs << 128 << 0 << 64;
+    DREAM3D_REQUIRE_EQUAL(mask->eraseTuples(idxs), 0)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), k_NumTuples - 3)
+
+    size_t dest = 0;
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      if(i == 0 || i == 64 || i == 128)
+      {
+        continue;
+      }
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(dest), expectedValue(i))
+      dest++;
+    }
+
+    QVector<size_t> badIdxs(1, k_NumTuples * 2);
+    DREAM3D_REQUIRE_EQUAL(mask->eraseTuples(badIdxs), -100)
+
+    mask->setInitValue(true);
+    mask->resize(k_NumTuples + 10);
+    for(size_t i = k_NumTuples - 3; i < k_NumTuples + 10; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(mask->getValue(i), true)
+    }
+    mask->resize(10);
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfWords(), 1)
+    DREAM3D_REQUIRE_EQUAL(mask->getNumberOfTuples(), 10)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHDF5RoundTrip()
+  {
+    BitMaskArray::Pointer mask = createMask();
+    QVector<size_t> tDims(1, k_NumTuples);
+
+    QDir dir(UnitTest::TestTempDir);
+    dir.mkpath(".");
+
+    {
+      hid_t fileId = QH5Utilities::createFile(getTestFile());
+      DREAM3D_REQUIRED(fileId, >, 0)
+      int err = mask->writeH5Data(fileId, tDims);
+      DREAM3D_REQUIRED(err, >=, 0)
+      QH5Utilities::closeFile(fileId);
+    }
+
+    hid_t fileId = QH5Utilities::openFile(getTestFile(), true);
+    DREAM3D_REQUIRED(fileId, >, 0)
+
+    // The mask is stored exactly like a DataArray<bool> so the existing reader understands it
+    IDataArray::Pointer boolData = H5DataArrayReader::ReadIDataArray(fileId, mask->getName());
+    BoolArrayType::Pointer boolArray = std::dynamic_pointer_cast<BoolArrayType>(boolData);
+    DREAM3D_REQUIRE_VALID_POINTER(boolArray.get())
+
+    BitMaskArray::Pointer readBack = BitMaskArray::CreateArray(0, mask->getName());
+    int err = readBack->readH5Data(fileId);
+    QH5Utilities::closeFile(fileId);
+    DREAM3D_REQUIRED(err, >=, 0)
+
+    DREAM3D_REQUIRE_EQUAL(readBack->getNumberOfTuples(), k_NumTuples)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(boolArray->getValue(i), expectedValue(i))
+      DREAM3D_REQUIRE_EQUAL(readBack->getValue(i), expectedValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### BitMaskArrayTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestValuesAndCount())
+    DREAM3D_REGISTER_TEST(TestWordOperations())
+    DREAM3D_REGISTER_TEST(TestBoolConversion())
+    DREAM3D_REGISTER_TEST(TestResizeAndErase())
+    DREAM3D_REGISTER_TEST(TestHDF5RoundTrip())
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+private:
+  BitMaskArrayTest(const BitMaskArrayTest&); // Copy Constructor Not Implemented
+  void operator=(const BitMaskArrayTest&);   // Move assignment Not Implemented
+};
@@ -0,0 +1,220 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DataArrayAllocatorTest
+{
+
+public:
+  DataArrayAllocatorTest()
+  {
+  }
+
+  virtual ~DataArrayAllocatorTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAlignmentAndStatistics()
+  {
+    DataArrayAllocator::ReleasePool();
+    DataArrayAllocator::ResetPeakBytes();
+    DataArrayAllocator::Statistics before = DataArrayAllocator::GetStatistics();
+
+    void* ptr = DataArrayAllocator::Allocate(1000);
+    DREAM3D_REQUIRE_VALID_POINTER(ptr)
+#if !defined(_WIN32)
+    size_t misalignment = reinterpret_cast<uintptr_t>(ptr) % DataArrayAllocator::GetSettings().alignment;
+    DREAM3D_REQUIRE_EQUAL(misalignment, 0)
+#endif
+    std::memset(ptr, 1, 1000);
+
+    DataArrayAllocator::Statistics during = DataArrayAllocator::GetStatistics();
+    DREAM3D_REQUIRED(during.liveBytes, >=, before.liveBytes + 1000)
+    DREAM3D_REQUIRED(during.peakBytes, >=, during.liveBytes)
+
+    DataArrayAllocator::Release(ptr);
+    DataArrayAllocator::Statistics after = DataArrayAllocator::GetStatistics();
+    DREAM3D_REQUIRE_EQUAL(after.liveBytes, before.liveBytes)
+    DREAM3D_REQUIRE_EQUAL(after.peakBytes, during.peakBytes)
+
+    void* empty = DataArrayAllocator::Allocate(0);
+    DREAM3D_REQUIRE_NULL_POINTER(empty)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPool()
+  {
+    DataArrayAllocator::ReleasePool();
+    const size_t bytes = DataArrayAllocator::GetSettings().poolMinBlockSize * 2 + 24;
+
+    void* first = DataArrayAllocator::Allocate(bytes);
+    DREAM3D_REQUIRE_VALID_POINTER(first)
+    DataArrayAllocator::Release(first);
+    DataArrayAllocator::Statistics pooled = DataArrayAllocator::GetStatistics();
+    DREAM3D_REQUIRED(pooled.pooledBytes, >=, bytes)
+
+    // A temporary of the same size gets the same block back
+    void* second = DataArrayAllocator::Allocate(bytes);
+    DREAM3D_REQUIRED(second, ==, first)
+    DataArrayAllocator::Statistics reused = DataArrayAllocator::GetStatistics();
+    DREAM3D_REQUIRE_EQUAL(reused.poolHits, pooled.poolHits + 1)
+    DREAM3D_REQUIRE_EQUAL(reused.pooledBytes, 0)
+
+    // A block that shrinks a little is kept, one that grows is moved with its data
+    static_cast<char*>(second)[0] = 42;
+    void* shrunk = DataArrayAllocator::Reallocate(second, bytes, bytes - 100);
+    DREAM3D_REQUIRED(shrunk, ==, second)
+    void* grown = DataArrayAllocator::Reallocate(shrunk, bytes - 100, bytes * 4);
+    DREAM3D_REQUIRE_VALID_POINTER(grown)
+    char value = static_cast<char*>(grown)[0];
+    DREAM3D_REQUIRE_EQUAL(value, 42)
+    DataArrayAllocator::Release(grown);
+
+    DataArrayAllocator::ReleasePool();
+    DataArrayAllocator::Statistics released = DataArrayAllocator::GetStatistics();
+    DREAM3D_REQUIRE_EQUAL(released.pooledBytes, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDataArrayOwnership()
+  {
+    DataArrayAllocator::Statistics before = DataArrayAllocator::GetStatistics();
+    {
+      Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(1000, "Test", true);
+      array->initializeWithValue(7);
+      DataArrayAllocator::Statistics during = DataArrayAllocator::GetStatistics();
+      DREAM3D_REQUIRED(during.liveBytes, >=, before.liveBytes + 1000 * sizeof(int32_t))
+
+      array->resize(2000);
+      int32_t value = array->getValue(999);
+      DREAM3D_REQUIRE_EQUAL(value, 7)
+    }
+    DataArrayAllocator::Statistics after = DataArrayAllocator::GetStatistics();
+    DREAM3D_REQUIRE_EQUAL(after.liveBytes, before.liveBytes)
+
+    // Memory handed over by an array is no longer counted but still goes back through Release()
+    Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(1000, "Test", true);
+    int32_t* ptr = array->getPointer(0);
+    array->releaseOwnership();
+    array = Int32ArrayType::NullPointer();
+    after = DataArrayAllocator::GetStatistics();
+    DREAM3D_REQUIRE_EQUAL(after.liveBytes, before.liveBytes)
+    DataArrayAllocator::Release(ptr);
+    after = DataArrayAllocator::GetStatistics();
+    DREAM3D_REQUIRE_EQUAL(after.liveBytes, before.liveBytes)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestScope()
+  {
+    void* outside = DataArrayAllocator::Allocate(1000);
+    DataArrayAllocator::Statistics globalBefore = DataArrayAllocator::GetStatistics();
+    {
+      DataArrayAllocator::Scope scope;
+      DataArrayAllocator::Statistics statistics = scope.getStatistics();
+      DREAM3D_REQUIRE_EQUAL(statistics.liveBytes, 0)
+      DREAM3D_REQUIRE_EQUAL(statistics.peakBytes, 0)
+
+      // Releasing a block from before the scope does not change the statistics of the scope
+      DataArrayAllocator::Release(outside);
+      statistics = scope.getStatistics();
+      DREAM3D_REQUIRE_EQUAL(statistics.liveBytes, 0)
+
+      void* first = DataArrayAllocator::Allocate(4000);
+      void* second = DataArrayAllocator::Allocate(4000);
+      DataArrayAllocator::Release(first);
+      statistics = scope.getStatistics();
+      DREAM3D_REQUIRE_EQUAL(statistics.allocations, 2)
+      DREAM3D_REQUIRED(statistics.liveBytes, >=, 4000)
+      DREAM3D_REQUIRED(statistics.peakBytes, >=, 8000)
+      DREAM3D_REQUIRED(statistics.peakBytes, >, statistics.liveBytes)
+
+      {
+        DataArrayAllocator::Scope inner;
+        void* third = DataArrayAllocator::Allocate(4000);
+        DREAM3D_REQUIRE_EQUAL(inner.getStatistics().allocations, 1)
+        DREAM3D_REQUIRE_EQUAL(scope.getStatistics().allocations, 2)
+        DataArrayAllocator::Release(third);
+      }
+
+      DataArrayAllocator::Release(second);
+      statistics = scope.getStatistics();
+      DREAM3D_REQUIRE_EQUAL(statistics.liveBytes, 0)
+    }
+
+    // The process wide peak is not reset by a scope
+    DataArrayAllocator::Statistics globalAfter = DataArrayAllocator::GetStatistics();
+    DREAM3D_REQUIRED(globalAfter.peakBytes, >=, globalBefore.peakBytes)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DataArrayAllocatorTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestAlignmentAndStatistics())
+    DREAM3D_REGISTER_TEST(TestPool())
+    DREAM3D_REGISTER_TEST(TestDataArrayOwnership())
+    DREAM3D_REGISTER_TEST(TestScope())
+  }
+
+private:
+  DataArrayAllocatorTest(const DataArrayAllocatorTest&); // Copy Constructor Not Implemented
+  void operator=(const DataArrayAllocatorTest&);         // Move assignment Not Implemented
+};
@@ -1,8 +1,11 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  BitMaskArrayTest
+  DataArrayAllocatorTest
   DataArrayTest
   StringDataArrayTest
   StructArrayTest
+  TupleCompactionMapTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
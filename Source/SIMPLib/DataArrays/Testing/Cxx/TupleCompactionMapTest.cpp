@@ -0,0 +1,273 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.hpp"
+#include "SIMPLib/DataArrays/TupleCompactionMap.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class TupleCompactionMapTest
+{
+
+public:
+  TupleCompactionMapTest()
+  {
+  }
+
+  virtual ~TupleCompactionMapTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMap()
+  {
+    // Unsorted with a duplicate
+    QVector<size_t> removeList;
+    removeList << 7 << 0 << 3 << 4 << 3;
+    TupleCompactionMap map(10, removeList);
+    DREAM3D_REQUIRE_EQUAL(map.isValid(), true)
+    DREAM3D_REQUIRE_EQUAL(map.getOldNumberOfTuples(), 10)
+    DREAM3D_REQUIRE_EQUAL(map.getNewNumberOfTuples(), 6)
+    DREAM3D_REQUIRE_EQUAL(map.getRemoveList().size(), 4)
+
+    const std::vector<TupleCompactionMap::Run>& runs = map.getRuns();
+    DREAM3D_REQUIRE_EQUAL(runs.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(runs[0].srcTuple, 1)
+    DREAM3D_REQUIRE_EQUAL(runs[0].destTuple, 0)
+    DREAM3D_REQUIRE_EQUAL(runs[0].numTuples, 2)
+    DREAM3D_REQUIRE_EQUAL(runs[1].srcTuple, 5)
+    DREAM3D_REQUIRE_EQUAL(runs[1].destTuple, 2)
+    DREAM3D_REQUIRE_EQUAL(runs[1].numTuples, 2)
+    DREAM3D_REQUIRE_EQUAL(runs[2].srcTuple, 8)
+    DREAM3D_REQUIRE_EQUAL(runs[2].destTuple, 4)
+    DREAM3D_REQUIRE_EQUAL(runs[2].numTuples, 2)
+
+    removeList << 10;
+    TupleCompactionMap invalidMap(10, removeList);
+    DREAM3D_REQUIRE_EQUAL(invalidMap.isValid(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCompactArrays()
+  {
+    const size_t numTuples = 1000;
+    QVector<size_t> removeList;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      if(i % 3 == 0 || (i > 500 && i < 600))
+      {
+        removeList.push_back(i);
+      }
+    }
+    TupleCompactionMap map(numTuples, removeList);
+    std::vector<size_t> kept;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      if(!(i % 3 == 0 || (i > 500 && i < 600)))
+      {
+        kept.push_back(i);
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(map.getNewNumberOfTuples(), kept.size())
+
+    QVector<size_t> cDims(1, 3);
+    Int32ArrayType::Pointer data = Int32ArrayType::CreateArray(numTuples, cDims, "Data", true);
+    StringDataArray::Pointer strings = StringDataArray::CreateArray(numTuples, "Strings", true);
+    NeighborList<int32_t>::Pointer neighbors = NeighborList<int32_t>::CreateArray(numTuples, "Neighbors", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      for(int c = 0; c < 3; c++)
+      {
+        data->setComponent(i, c, static_cast<int32_t>(i * 3 + c));
+      }
+      strings->setValue(i, QString::number(i));
+      neighbors->addEntry(static_cast<int>(i), static_cast<int32_t>(i));
+    }
+
+    int err = data->compactTuples(map);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    err = strings->compactTuples(map);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    err = neighbors->compactTuples(map);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    size_t nTuples = data->getNumberOfTuples();
+    DREAM3D_REQUIRE_EQUAL(nTuples, kept.size())
+    nTuples = strings->getNumberOfTuples();
+    DREAM3D_REQUIRE_EQUAL(nTuples, kept.size())
+    nTuples = neighbors->getNumberOfTuples();
+    DREAM3D_REQUIRE_EQUAL(nTuples, kept.size())
+    for(size_t i = 0; i < kept.size(); i++)
+    {
+      for(int c = 0; c < 3; c++)
+      {
+        int32_t value = data->getComponent(i, c);
+        int32_t expected = static_cast<int32_t>(kept[i] * 3 + c);
+        DREAM3D_REQUIRE_EQUAL(value, expected)
+      }
+      QString string = strings->getValue(i);
+      DREAM3D_REQUIRED(string, ==, QString::number(kept[i]))
+      int32_t neighbor = neighbors->getListReference(static_cast<int>(i))[0];
+      int32_t expected = static_cast<int32_t>(kept[i]);
+      DREAM3D_REQUIRE_EQUAL(neighbor, expected)
+    }
+
+    // A map built for a different number of tuples is rejected
+    err = data->compactTuples(map);
+    DREAM3D_REQUIRE_EQUAL(err, -100)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRenumberNeighbors()
+  {
+    NeighborList<int32_t>::Pointer neighbors = NeighborList<int32_t>::CreateArray(3, "Neighbors", true);
+    neighbors->addEntry(0, 1);
+    neighbors->addEntry(0, 2);
+    neighbors->addEntry(1, 0);
+    neighbors->addEntry(1, 3);
+    neighbors->addEntry(2, 7);
+
+    // Feature 2 was removed, feature 3 becomes feature 2
+    std::vector<int32_t> newIds = {0, 1, -1, 2};
+    neighbors->renumberValues(newIds);
+
+    DREAM3D_REQUIRE_EQUAL(neighbors->getListSize(0), 1)
+    int32_t value = neighbors->getListReference(0)[0];
+    DREAM3D_REQUIRE_EQUAL(value, 1)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getListSize(1), 2)
+    value = neighbors->getListReference(1)[0];
+    DREAM3D_REQUIRE_EQUAL(value, 0)
+    value = neighbors->getListReference(1)[1];
+    DREAM3D_REQUIRE_EQUAL(value, 2)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getListSize(2), 1)
+    value = neighbors->getListReference(2)[0];
+    DREAM3D_REQUIRE_EQUAL(value, 7)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveInactiveObjects()
+  {
+    QVector<size_t> tDims(1, 4);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "Features", AttributeMatrix::Type::CellFeature);
+
+    NeighborList<int32_t>::Pointer neighbors = NeighborList<int32_t>::CreateArray(4, SIMPL::FeatureData::NeighborList, true);
+    neighbors->addEntry(1, 2);
+    neighbors->addEntry(1, 3);
+    neighbors->addEntry(3, 1);
+    neighbors->addEntry(3, 2);
+    am->addAttributeArray(neighbors->getName(), neighbors);
+
+    // One value per neighbor, which must stay aligned with the neighbor ids
+    NeighborList<float>::Pointer areas = NeighborList<float>::CreateArray(4, SIMPL::FeatureData::SharedSurfaceAreaList, true);
+    areas->addEntry(1, 12.0f);
+    areas->addEntry(1, 13.0f);
+    areas->addEntry(3, 31.0f);
+    areas->addEntry(3, 32.0f);
+    am->addAttributeArray(areas->getName(), areas);
+
+    // A list that is not aligned with the neighbor ids cannot be compacted correctly and is removed
+    NeighborList<int32_t>::Pointer counts = NeighborList<int32_t>::CreateArray(4, "Counts", true);
+    counts->addEntry(1, 2);
+    counts->addEntry(3, 2);
+    am->addAttributeArray(counts->getName(), counts);
+
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(4, "FeatureIds");
+    for(int32_t i = 0; i < 4; i++)
+    {
+      featureIds->setValue(i, i);
+    }
+
+    QVector<bool> activeObjects(4, true);
+    activeObjects[2] = false;
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(activeObjects, featureIds.get()), true)
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), 3)
+
+    // Old feature 3 is now feature 2 and the removed feature 2 is gone from the neighbor lists
+    DREAM3D_REQUIRE_EQUAL(neighbors->getListSize(1), 1)
+    int32_t value = neighbors->getListReference(1)[0];
+    DREAM3D_REQUIRE_EQUAL(value, 2)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getListSize(2), 1)
+    value = neighbors->getListReference(2)[0];
+    DREAM3D_REQUIRE_EQUAL(value, 1)
+
+    DREAM3D_REQUIRE_EQUAL(areas->getNumberOfTuples(), 3)
+    DREAM3D_REQUIRE_EQUAL(areas->getListSize(1), 1)
+    float area = areas->getListReference(1)[0];
+    DREAM3D_REQUIRE_EQUAL(area, 13.0f)
+    DREAM3D_REQUIRE_EQUAL(areas->getListSize(2), 1)
+    area = areas->getListReference(2)[0];
+    DREAM3D_REQUIRE_EQUAL(area, 31.0f)
+
+    DREAM3D_REQUIRE_NULL_POINTER(am->getAttributeArray(counts->getName()).get())
+
+    DREAM3D_REQUIRE_EQUAL(featureIds->getValue(2), 0)
+    DREAM3D_REQUIRE_EQUAL(featureIds->getValue(3), 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### TupleCompactionMapTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestMap())
+    DREAM3D_REGISTER_TEST(TestCompactArrays())
+    DREAM3D_REGISTER_TEST(TestRenumberNeighbors())
+    DREAM3D_REGISTER_TEST(TestRemoveInactiveObjects())
+  }
+
+private:
+  TupleCompactionMapTest(const TupleCompactionMapTest&); // Copy Constructor Not Implemented
+  void operator=(const TupleCompactionMapTest&);         // Move assignment Not Implemented
+};
@@ -0,0 +1,120 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "TupleCompactionMap.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TupleCompactionMap::TupleCompactionMap(size_t numTuples, const QVector<size_t>& removeList)
+: m_OldNumberOfTuples(numTuples)
+, m_NewNumberOfTuples(numTuples)
+, m_Valid(true)
+, m_RemoveList(removeList)
+{
+  // removeInactiveObjects and most callers already hand over a sorted list
+  if(!std::is_sorted(m_RemoveList.begin(), m_RemoveList.end()))
+  {
+    std::sort(m_RemoveList.begin(), m_RemoveList.end());
+  }
+  m_RemoveList.erase(std::unique(m_RemoveList.begin(), m_RemoveList.end()), m_RemoveList.end());
+
+  if(!m_RemoveList.isEmpty() && m_RemoveList.back() >= numTuples)
+  {
+    m_Valid = false;
+    return;
+  }
+
+  m_Runs.reserve(static_cast<size_t>(m_RemoveList.size()) + 1);
+  size_t src = 0;
+  size_t dest = 0;
+  for(QVector<size_t>::size_type i = 0; i <= m_RemoveList.size(); i++)
+  {
+    size_t end = (i < m_RemoveList.size()) ? m_RemoveList[i] : numTuples;
+    if(end > src)
+    {
+      Run run = {src, dest, end - src};
+      m_Runs.push_back(run);
+      dest += end - src;
+    }
+    src = end + 1;
+  }
+  m_NewNumberOfTuples = dest;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TupleCompactionMap::~TupleCompactionMap() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TupleCompactionMap::isValid() const
+{
+  return m_Valid;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TupleCompactionMap::getOldNumberOfTuples() const
+{
+  return m_OldNumberOfTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TupleCompactionMap::getNewNumberOfTuples() const
+{
+  return m_NewNumberOfTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QVector<size_t>& TupleCompactionMap::getRemoveList() const
+{
+  return m_RemoveList;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<TupleCompactionMap::Run>& TupleCompactionMap::getRuns() const
+{
+  return m_Runs;
+}
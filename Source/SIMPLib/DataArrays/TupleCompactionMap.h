@@ -0,0 +1,117 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _tuplecompactionmap_h_
+#define _tuplecompactionmap_h_
+
+#include <algorithm>
+#include <vector>
+
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The TupleCompactionMap class describes the removal of a set of tuples from arrays that all have the same
+ * number of tuples. It is computed once from the indices to remove and stores the runs of tuples that are kept, so
+ * every array can then be compacted in place with one move per run instead of a new allocation and a full copy.
+ */
+class SIMPLib_EXPORT TupleCompactionMap
+{
+  public:
+    /**
+     * @brief The Run struct is a range of consecutive kept tuples and the position it moves to
+     */
+    struct Run
+    {
+      size_t srcTuple;
+      size_t destTuple;
+      size_t numTuples;
+    };
+
+    /**
+     * @brief TupleCompactionMap
+     * @param numTuples The number of tuples of the arrays before the compaction
+     * @param removeList The indices of the tuples to remove, in any order; duplicates are allowed
+     */
+    TupleCompactionMap(size_t numTuples, const QVector<size_t>& removeList);
+
+    virtual ~TupleCompactionMap();
+
+    /**
+     * @brief isValid Returns false when one of the indices to remove is not smaller than the number of tuples
+     */
+    bool isValid() const;
+
+    size_t getOldNumberOfTuples() const;
+    size_t getNewNumberOfTuples() const;
+
+    /**
+     * @brief getRemoveList Returns the sorted indices of the removed tuples without duplicates
+     */
+    const QVector<size_t>& getRemoveList() const;
+
+    /**
+     * @brief getRuns Returns the runs of kept tuples in increasing order; runs that do not move are included
+     */
+    const std::vector<Run>& getRuns() const;
+
+    /**
+     * @brief compactElements Compacts a container that holds numComps consecutive elements per tuple in place and
+     * shrinks it to the new number of tuples. Elements are moved, not copied.
+     * @param values The container, which must hold getOldNumberOfTuples() * numComps elements
+     * @param numComps The number of elements of each tuple
+     */
+    template <typename Container> void compactElements(Container& values, size_t numComps = 1) const
+    {
+      for(const Run& run : m_Runs)
+      {
+        if(run.srcTuple != run.destTuple)
+        {
+          std::move(values.begin() + run.srcTuple * numComps, values.begin() + (run.srcTuple + run.numTuples) * numComps, values.begin() + run.destTuple * numComps);
+        }
+      }
+      values.resize(m_NewNumberOfTuples * numComps);
+    }
+
+  private:
+    size_t m_OldNumberOfTuples;
+    size_t m_NewNumberOfTuples;
+    bool m_Valid;
+    QVector<size_t> m_RemoveList;
+    std::vector<Run> m_Runs;
+};
+
+#endif /* _tuplecompactionmap_h_ */
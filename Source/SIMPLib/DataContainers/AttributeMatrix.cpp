@@ -46,9 +46,18 @@
 #include "H5Support/QH5Lite.h"
 #include "H5Support/QH5Utilities.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 // DREAM3D Includes
 #include "SIMPLib/DataArrays/StatsDataArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataArrays/TupleCompactionMap.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
@@ -56,6 +65,279 @@
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
+namespace
+{
+/**
+ * @brief One flag per value of every list of a feature id NeighborList, false for the ids of removed features
+ */
+typedef std::vector<std::vector<bool>> ListKeepMask;
+
+/**
+ * @brief FindKeptValues Flags the values of a feature id list that survive the renumbering with newIds
+ * @param idList
+ * @param newIds The new id of every old id, negative for removed features
+ * @return
+ */
+ListKeepMask FindKeptValues(NeighborList<int32_t>::Pointer idList, const std::vector<int32_t>& newIds)
+{
+  const size_t numIds = newIds.size();
+  ListKeepMask keep(idList->getNumberOfTuples());
+  for(size_t i = 0; i < keep.size(); i++)
+  {
+    NeighborList<int32_t>::SharedVectorType list = idList->getList(static_cast<int>(i));
+    if(nullptr == list.get())
+    {
+      continue;
+    }
+    keep[i].resize(list->size(), true);
+    for(size_t j = 0; j < list->size(); j++)
+    {
+      int32_t id = (*list)[j];
+      if(id >= 0 && static_cast<size_t>(id) < numIds && newIds[static_cast<size_t>(id)] < 0)
+      {
+        keep[i][j] = false;
+      }
+    }
+  }
+  return keep;
+}
+
+/**
+ * @brief EraseListValues Erases the flagged values from the array if it is a NeighborList<T>, using the first mask
+ * whose shape matches the lists of the array
+ * @return 1 if a mask was applied, 0 if no mask matches, -1 if the array is not a NeighborList<T>
+ */
+template <typename T> int EraseListValues(const IDataArray::Pointer& array, const std::vector<const ListKeepMask*>& masks)
+{
+  typename NeighborList<T>::Pointer neighborList = std::dynamic_pointer_cast<NeighborList<T>>(array);
+  if(nullptr == neighborList.get())
+  {
+    return -1;
+  }
+  for(const ListKeepMask* mask : masks)
+  {
+    if(neighborList->eraseValues(*mask) >= 0)
+    {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief EraseNeighborListValues Dispatches EraseListValues over the numeric NeighborList types
+ * @return true if a mask was applied
+ */
+bool EraseNeighborListValues(const IDataArray::Pointer& array, const std::vector<const ListKeepMask*>& masks)
+{
+  int err = EraseListValues<int8_t>(array, masks);
+  err = (err < 0) ? EraseListValues<uint8_t>(array, masks) : err;
+  err = (err < 0) ? EraseListValues<int16_t>(array, masks) : err;
+  err = (err < 0) ? EraseListValues<uint16_t>(array, masks) : err;
+  err = (err < 0) ? EraseListValues<int32_t>(array, masks) : err;
+  err = (err < 0) ? EraseListValues<uint32_t>(array, masks) : err;
+  err = (err < 0) ? EraseListValues<int64_t>(array, masks) : err;
+  err = (err < 0) ? EraseListValues<uint64_t>(array, masks) : err;
+  err = (err < 0) ? EraseListValues<float>(array, masks) : err;
+  err = (err < 0) ? EraseListValues<double>(array, masks) : err;
+  return err > 0;
+}
+
+/**
+ * @brief The CompactArraysImpl class compacts a set of arrays with the same compaction map. Every array is
+ * compacted by a single task. When features are removed, the Int32 NeighborLists named in featureIdLists hold
+ * feature ids: the ids of removed features are erased from them and the others are renumbered with newIds. Every
+ * other NeighborList loses the same positions as the first of those lists with the same list lengths, so values
+ * stored per neighbor stay aligned with the neighbor ids. A NeighborList that matches none of them can no longer be
+ * aligned, is left as it is and is flagged in removed.
+ */
+class CompactArraysImpl
+{
+public:
+  CompactArraysImpl(const QVector<IDataArray::Pointer>& arrays, const TupleCompactionMap& compactionMap, const std::vector<int32_t>& newIds, const QStringList& featureIdLists,
+                    const std::vector<ListKeepMask>& masks, std::vector<int>& removed)
+  : m_Arrays(arrays)
+  , m_CompactionMap(compactionMap)
+  , m_NewIds(newIds)
+  , m_FeatureIdLists(featureIdLists)
+  , m_Masks(masks)
+  , m_Removed(removed)
+  {
+  }
+
+  void compact(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      IDataArray::Pointer array = m_Arrays[static_cast<int>(i)];
+      if(!m_NewIds.empty() && array->getTypeAsString().compare("NeighborList<T>") == 0)
+      {
+        // A feature id list is always matched with its own mask
+        std::vector<const ListKeepMask*> masks;
+        int idList = m_FeatureIdLists.indexOf(array->getName());
+        if(idList >= 0)
+        {
+          masks.push_back(&(m_Masks[static_cast<size_t>(idList)]));
+        }
+        else
+        {
+          for(const ListKeepMask& mask : m_Masks)
+          {
+            masks.push_back(&mask);
+          }
+        }
+        if(!EraseNeighborListValues(array, masks))
+        {
+          m_Removed[i] = 1;
+          continue;
+        }
+      }
+      array->compactTuples(m_CompactionMap);
+      NeighborList<int32_t>::Pointer neighborList = std::dynamic_pointer_cast<NeighborList<int32_t>>(array);
+      if(!m_NewIds.empty() && nullptr != neighborList && m_FeatureIdLists.contains(array->getName()))
+      {
+        neighborList->renumberValues(m_NewIds);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compact(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const QVector<IDataArray::Pointer>& m_Arrays;
+  const TupleCompactionMap& m_CompactionMap;
+  const std::vector<int32_t>& m_NewIds;
+  const QStringList& m_FeatureIdLists;
+  const std::vector<ListKeepMask>& m_Masks;
+  std::vector<int>& m_Removed;
+};
+
+/**
+ * @brief The RelabelFeatureIdsImpl class replaces every feature id with its new id. Ids outside of the old range are
+ * left as they are. The select has no branch, so the loop can be vectorized.
+ */
+class RelabelFeatureIdsImpl
+{
+public:
+  RelabelFeatureIdsImpl(int32_t* featureIds, const std::vector<int32_t>& newIds)
+  : m_FeatureIds(featureIds)
+  , m_NewIds(newIds.data())
+  , m_NumIds(static_cast<int64_t>(newIds.size()))
+  {
+  }
+
+  void relabel(size_t start, size_t end) const
+  {
+    int32_t* featureIds = m_FeatureIds;
+    const int32_t* newIds = m_NewIds;
+    const int64_t numIds = m_NumIds;
+    for(size_t i = start; i < end; i++)
+    {
+      const int32_t id = featureIds[i];
+      const bool inRange = (id >= 0 && static_cast<int64_t>(id) < numIds);
+      featureIds[i] = inRange ? newIds[inRange ? id : 0] : id;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    relabel(r.begin(), r.end());
+  }
+#endif
+
+private:
+  int32_t* m_FeatureIds;
+  const int32_t* m_NewIds;
+  int64_t m_NumIds;
+};
+
+/**
+ * @brief The PermuteArraysImpl class reorders a set of arrays with the same permutation. Every array is
+ * reordered by a single task.
+ */
+class PermuteArraysImpl
+{
+public:
+  PermuteArraysImpl(const QVector<IDataArray::Pointer>& arrays, const std::vector<size_t>& newOrder, std::vector<int>& errors)
+  : m_Arrays(arrays)
+  , m_NewOrder(newOrder)
+  , m_Errors(errors)
+  {
+  }
+
+  void permute(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_Errors[i] = m_Arrays[static_cast<int>(i)]->permuteTuples(m_NewOrder);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    permute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const QVector<IDataArray::Pointer>& m_Arrays;
+  const std::vector<size_t>& m_NewOrder;
+  std::vector<int>& m_Errors;
+};
+}
+
+/**
+ * @brief The GenerateXdmfTextImpl class generates the Xdmf Attribute blocks of a set of arrays. Every block only
+ * reads the name, type and dimensions of its array and is stored at the index of that array.
+ */
+class GenerateXdmfTextImpl
+{
+public:
+  GenerateXdmfTextImpl(AttributeMatrix* attributeMatrix, const QVector<IDataArray::Pointer>& arrays, const QString& centering, const QString& dataContainerName, const QString& hdfFileName,
+                       uint8_t gridType, QVector<QString>& blocks)
+  : m_AttributeMatrix(attributeMatrix)
+  , m_Arrays(arrays)
+  , m_Centering(centering)
+  , m_DataContainerName(dataContainerName)
+  , m_HdfFileName(hdfFileName)
+  , m_GridType(gridType)
+  , m_Blocks(blocks)
+  {
+  }
+
+  void generate(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      int index = static_cast<int>(i);
+      m_Blocks[index] = m_AttributeMatrix->writeXdmfAttributeData(m_Arrays[index], m_Centering, m_DataContainerName, m_HdfFileName, m_GridType);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  AttributeMatrix* m_AttributeMatrix;
+  const QVector<IDataArray::Pointer>& m_Arrays;
+  const QString& m_Centering;
+  const QString& m_DataContainerName;
+  const QString& m_HdfFileName;
+  uint8_t m_GridType;
+  QVector<QString>& m_Blocks;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -447,6 +729,16 @@ size_t AttributeMatrix::getNumberOfTuples()
 //
 // -----------------------------------------------------------------------------
 bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t> *featureIds)
+{
+  QStringList featureIdLists;
+  featureIdLists << SIMPL::FeatureData::NeighborList << SIMPL::FeatureData::NeighborhoodList;
+  return removeInactiveObjects(activeObjects, featureIds, featureIdLists);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool AttributeMatrix::removeInactiveObjects(const QVector<bool>& activeObjects, DataArray<int32_t>* featureIds, const QStringList& featureIdLists)
 {
   bool acceptableMatrix = false;
   // Only valid for feature or ensemble type matrices
@@ -459,8 +751,10 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects,
   size_t totalTuples = getNumberOfTuples();
   if(static_cast<size_t>(activeObjects.size()) == totalTuples && acceptableMatrix == true)
   {
-    size_t goodcount = 1;
-    QVector<size_t> newNames(totalTuples, 0);
+    int32_t goodcount = 1;
+    std::vector<int32_t> newNames(totalTuples, 0);
+    // Removed features are erased from the feature id lists, which is marked with a negative id
+    std::vector<int32_t> newListIds(totalTuples, 0);
     QVector<size_t> removeList;
 
     for(qint32 i = 1; i < activeObjects.size(); i++)
@@ -469,42 +763,37 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects,
       {
         removeList.push_back(i);
         newNames[i] = 0;
+        newListIds[i] = -1;
       }
       else
       {
         newNames[i] = goodcount;
+        newListIds[i] = goodcount;
         goodcount++;
       }
     }
 
     if(removeList.size() > 0)
     {
-      QList<QString> headers = getAttributeArrayNames();
-      for(QList<QString>::iterator iter = headers.begin(); iter != headers.end(); ++iter)
-      {
-        IDataArray::Pointer p = getAttributeArray(*iter);
-        QString type = p->getTypeAsString();
-        if(type.compare("NeighborList<T>") == 0)
-        {
-          removeAttributeArray(*iter);
-        }
-        else
-        {
-          p->eraseTuples(removeList);
-        }
-      }
-      QVector<size_t> tDims(1, (totalTuples - removeList.size()));
-      setTupleDimensions(tDims);
+      // The tuples to keep are found once and every array is compacted in place with them
+      TupleCompactionMap compactionMap(totalTuples, removeList);
+      compactArrays(compactionMap, newListIds, featureIdLists);
 
-      // Loop over all the points and correct all the feature names
+      // Correct all the feature names; ids outside of the old range are left as they are
       size_t totalPoints = featureIds->getNumberOfTuples();
       int32_t* featureIdPtr = featureIds->getPointer(0);
-      for(size_t i = 0; i < totalPoints; i++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      tbb::task_scheduler_init init;
+      bool doParallel = true;
+      if(doParallel == true)
       {
-        if(featureIdPtr[i] >= 0 && featureIdPtr[i] < newNames.size())
-        {
-          featureIdPtr[i] = static_cast<int32_t>(newNames[featureIdPtr[i]]);
-        }
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints), RelabelFeatureIdsImpl(featureIdPtr, newNames), tbb::auto_partitioner());
+      }
+      else
+#endif
+      {
+        RelabelFeatureIdsImpl serial(featureIdPtr, newNames);
+        serial.relabel(0, totalPoints);
       }
     }
   }
@@ -515,6 +804,104 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects,
   return true;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int AttributeMatrix::compactTuples(const TupleCompactionMap& compactionMap)
+{
+  if(!compactionMap.isValid() || compactionMap.getOldNumberOfTuples() != getNumberOfTuples())
+  {
+    return -100;
+  }
+  if(compactionMap.getNewNumberOfTuples() != compactionMap.getOldNumberOfTuples())
+  {
+    compactArrays(compactionMap, std::vector<int32_t>(), QStringList());
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int AttributeMatrix::permuteTuples(const std::vector<size_t>& newOrder)
+{
+  if(newOrder.size() != getNumberOfTuples())
+  {
+    return -100;
+  }
+  QVector<IDataArray::Pointer> arrays = m_AttributeArrays.values().toVector();
+  std::vector<int> errors(static_cast<size_t>(arrays.size()), 0);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, static_cast<size_t>(arrays.size()), 1), PermuteArraysImpl(arrays, newOrder, errors), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    PermuteArraysImpl serial(arrays, newOrder, errors);
+    serial.permute(0, static_cast<size_t>(arrays.size()));
+  }
+  for(std::vector<int>::const_iterator err = errors.begin(); err != errors.end(); ++err)
+  {
+    if(*err < 0)
+    {
+      return *err;
+    }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AttributeMatrix::compactArrays(const TupleCompactionMap& compactionMap, const std::vector<int32_t>& newIds, const QStringList& featureIdLists)
+{
+  // The positions to erase are found from the feature id lists before any list is touched
+  QStringList maskedLists;
+  std::vector<ListKeepMask> masks;
+  if(!newIds.empty())
+  {
+    for(const QString& name : featureIdLists)
+    {
+      NeighborList<int32_t>::Pointer idList = std::dynamic_pointer_cast<NeighborList<int32_t>>(getAttributeArray(name));
+      if(nullptr != idList.get())
+      {
+        maskedLists << name;
+        masks.push_back(FindKeptValues(idList, newIds));
+      }
+    }
+  }
+
+  QVector<IDataArray::Pointer> arrays = m_AttributeArrays.values().toVector();
+  std::vector<int> removed(static_cast<size_t>(arrays.size()), 0);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, static_cast<size_t>(arrays.size()), 1), CompactArraysImpl(arrays, compactionMap, newIds, maskedLists, masks, removed),
+                      tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    CompactArraysImpl serial(arrays, compactionMap, newIds, maskedLists, masks, removed);
+    serial.compact(0, static_cast<size_t>(arrays.size()));
+  }
+  for(int i = 0; i < arrays.size(); i++)
+  {
+    if(removed[static_cast<size_t>(i)] != 0)
+    {
+      removeAttributeArray(arrays[i]->getName());
+    }
+  }
+  QVector<size_t> tDims(1, compactionMap.getNewNumberOfTuples());
+  setTupleDimensions(tDims);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -724,15 +1111,33 @@ int AttributeMatrix::readAttributeArraysFromHDF5(hid_t amGid, bool preflight, At
 // -----------------------------------------------------------------------------
 QString AttributeMatrix::generateXdmfText(const QString& centering, const QString& dataContainerName, const QString& hdfFileName, const uint8_t gridType)
 {
-  QString xdmfText;
-  QString block;
-  QTextStream out(&xdmfText);
+  QVector<IDataArray::Pointer> arrays = m_AttributeArrays.values().toVector();
+  QVector<QString> blocks(arrays.size());
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, static_cast<size_t>(arrays.size()), 1), GenerateXdmfTextImpl(this, arrays, centering, dataContainerName, hdfFileName, gridType, blocks),
+                      tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    GenerateXdmfTextImpl serial(this, arrays, centering, dataContainerName, hdfFileName, gridType, blocks);
+    serial.generate(0, static_cast<size_t>(arrays.size()));
+  }
 
-  for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
+  int totalSize = 0;
+  for(QVector<QString>::const_iterator block = blocks.constBegin(); block != blocks.constEnd(); ++block)
   {
-    IDataArray::Pointer d = iter.value();
-    block = writeXdmfAttributeData(d, centering, dataContainerName, hdfFileName, gridType);
-    out << block;
+    totalSize += block->size();
+  }
+  QString xdmfText;
+  xdmfText.reserve(totalSize);
+  for(QVector<QString>::const_iterator block = blocks.constBegin(); block != blocks.constEnd(); ++block)
+  {
+    xdmfText.append(*block);
   }
   return xdmfText;
 }
@@ -43,12 +43,14 @@
 
 //-- C++ includes
 #include <memory>
+#include <vector>
 
 #include <hdf5.h>
 
 #include <QtCore/QObject>
 #include <QtCore/QList>
 #include <QtCore/QString>
+#include <QtCore/QStringList>
 #include <QtCore/QMap>
 #include <QtCore/QVector>
 
@@ -62,6 +64,7 @@
 class AttributeMatrixProxy;
 class DataContainerProxy;
 class SIMPLH5DataReaderRequirements;
+class TupleCompactionMap;
 template<class T> class DataArray;
 
 enum RenameErrorCodes
@@ -556,11 +559,38 @@ class SIMPLib_EXPORT AttributeMatrix : public Observable
 
     /**
     * @brief Removes inactive objects from the Attribute Matrix and renumbers the active objects to preserve a compact matrix
-      (only valid for feature or ensemble type matrices)
+      (only valid for feature or ensemble type matrices). The NeighborLists named SIMPL::FeatureData::NeighborList and
+      SIMPL::FeatureData::NeighborhoodList are treated as lists of feature ids, see the overload below.
     * @param size The new size of the array
     */
     bool removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t>* featureIds);
 
+    /**
+    * @brief Removes inactive objects from the Attribute Matrix and renumbers the active objects to preserve a compact matrix
+      (only valid for feature or ensemble type matrices)
+    * @param activeObjects Whether every object is kept
+    * @param featureIds The feature ids of the elements, renumbered in place
+    * @param featureIdLists Names of the Int32 NeighborLists that hold feature ids. Their values are renumbered and
+      the removed features are erased from them. Other NeighborLists hold one value per entry of the first of these
+      lists with the same list lengths and lose the same entries; NeighborLists that match none of them are removed.
+    */
+    bool removeInactiveObjects(const QVector<bool>& activeObjects, DataArray<int32_t>* featureIds, const QStringList& featureIdLists);
+
+    /**
+     * @brief compactTuples Removes the tuples described by the compaction map from every array, in place, and
+     * sets the tuple dimensions to the new number of tuples. Array values are not renumbered.
+     * @param compactionMap A map built for the current number of tuples
+     * @return 0 on success, negative if the map does not match the matrix
+     */
+    int compactTuples(const TupleCompactionMap& compactionMap);
+
+    /**
+     * @brief permuteTuples Reorders the tuples of every array in place so that tuple i holds the old tuple newOrder[i]
+     * @param newOrder A permutation of the tuple indices
+     * @return 0 on success, negative if newOrder does not have one entry per tuple or an array could not be reordered
+     */
+    int permuteTuples(const std::vector<size_t>& newOrder);
+
     /**
      * @brief Sets the Tuple Dimensions for the Attribute Matrix
      * @param tupleDims
@@ -613,7 +643,8 @@ class SIMPLib_EXPORT AttributeMatrix : public Observable
     virtual int readAttributeArraysFromHDF5(hid_t amGid, bool preflight, AttributeMatrixProxy* attrMatProxy);
 
     /**
-     * @brief generateXdmfText
+     * @brief generateXdmfText Generates the Xdmf Attribute blocks of every array. The blocks are generated in
+     * parallel and concatenated in the order of the arrays, so the text does not depend on the scheduling.
      * @param centering
      * @param dataContainerName
      * @param hdfFileName
@@ -671,11 +702,24 @@ class SIMPLib_EXPORT AttributeMatrix : public Observable
                                                  const QString& hdfFileName,
                                                  const uint8_t gridType = 0);
 
+    /**
+     * @brief compactArrays Compacts every array with the map, in parallel over the arrays, and updates the tuple
+     * dimensions. Unless newIds is empty, the ids of removed features are erased from the Int32 NeighborLists named
+     * in featureIdLists and the others are renumbered with newIds. Every other NeighborList loses the same positions as
+     * the first of those lists with the same list lengths. NeighborLists that match none of them are removed.
+     * @param compactionMap
+     * @param newIds
+     * @param featureIdLists
+     */
+    void compactArrays(const TupleCompactionMap& compactionMap, const std::vector<int32_t>& newIds, const QStringList& featureIdLists);
+
   private:
     QVector<size_t> m_TupleDims;
     QMap<QString, IDataArray::Pointer> m_AttributeArrays;
     Type m_Type;
 
+    friend class GenerateXdmfTextImpl;
+
     AttributeMatrix(const AttributeMatrix&);
     void operator =(const AttributeMatrix&);
 };
@@ -40,6 +40,7 @@
 #include "SIMPLib/Filtering/FilterManager.h"
 
 #include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
 #include "SIMPLib/Utilities/StringOperations.h"
 
@@ -49,7 +50,9 @@
 FilterPipeline::FilterPipeline()
 : QObject()
 , m_ErrorCondition(0)
+, m_PeakArrayBytes(0)
 , m_Cancel(false)
+, m_PreflightCancelFlag(nullptr)
 , m_PipelineName("")
 , m_Dca(nullptr)
 {
@@ -292,6 +295,14 @@ bool FilterPipeline::getCancel()
   return m_Cancel;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterPipeline::setPreflightCancelFlag(const std::atomic<bool>* flag)
+{
+  m_PreflightCancelFlag = flag;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -519,6 +530,12 @@ int FilterPipeline::preflightPipeline()
   // Start looping through each filter in the Pipeline and preflight everything
   for(FilterContainerType::iterator filter = m_Pipeline.begin(); filter != m_Pipeline.end(); ++filter)
   {
+    // A preflight running on a worker thread can be canceled between filters
+    if(nullptr != m_PreflightCancelFlag && *m_PreflightCancelFlag)
+    {
+      break;
+    }
+
     // Do not preflight disabled filters
     if((*filter)->getEnabled())
     {
@@ -590,6 +607,8 @@ DataContainerArray::Pointer FilterPipeline::execute()
   connectSignalsSlots();
 
   m_Dca = DataContainerArray::New();
+  // Collects the memory the arrays of this pipeline need, independent of other pipelines in the process
+  DataArrayAllocator::Scope allocatorScope;
 
   // Start looping through the Pipeline
   float progress = 0.0f;
@@ -660,6 +679,12 @@ DataContainerArray::Pointer FilterPipeline::execute()
 
   disconnectSignalsSlots();
 
+  // Report the memory the arrays needed
+  m_PeakArrayBytes = allocatorScope.getStatistics().peakBytes;
+  QString memoryMessage = QObject::tr("Peak Data Array Memory: %1 MB").arg(static_cast<double>(m_PeakArrayBytes) / (1024.0 * 1024.0), 0, 'f', 1);
+  PipelineMessage memoryStatusMessage("", memoryMessage, 0, PipelineMessage::MessageType::StatusMessage, -1);
+  emit pipelineGeneratedMessage(memoryStatusMessage);
+
   PipelineMessage completeMessage("", "Pipeline Complete", 0, PipelineMessage::MessageType::StatusMessage, -1);
   emit pipelineGeneratedMessage(completeMessage);
 
@@ -36,6 +36,8 @@
 #ifndef _filterpipeline_h_
 #define _filterpipeline_h_
 
+#include <atomic>
+
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
 #include <QtCore/QObject>
@@ -74,6 +76,11 @@ public:
   SIMPL_INSTANCE_PROPERTY(int, ErrorCondition)
   SIMPL_INSTANCE_PROPERTY(AbstractFilter::Pointer, CurrentFilter)
 
+  /**
+   * @brief The largest number of bytes held by DataArrays while the last execute() ran
+   */
+  SIMPL_INSTANCE_PROPERTY(size_t, PeakArrayBytes)
+
   /**
    * @brief Cancel the operation
    */
@@ -92,6 +99,14 @@ public:
    */
   virtual int preflightPipeline();
 
+  /**
+   * @brief setPreflightCancelFlag Makes preflightPipeline() stop before its next filter once the flag is set. The
+   * pipeline only reads the flag, so another thread may set it while the preflight runs. The flag must outlive
+   * every preflight that uses it
+   * @param flag The flag to poll, or nullptr to preflight every filter
+   */
+  void setPreflightCancelFlag(const std::atomic<bool>* flag);
+
   /**
    * @brief
    */
@@ -209,7 +224,8 @@ signals:
   void pipelineNameChanged(QString oldName, QString newName);
 
 private:
-  bool m_Cancel;
+  std::atomic<bool> m_Cancel;
+  const std::atomic<bool>* m_PreflightCancelFlag;
   FilterContainerType m_Pipeline;
   QString m_PipelineName;
 
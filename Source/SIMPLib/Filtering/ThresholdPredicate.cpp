@@ -0,0 +1,579 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "ThresholdPredicate.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/BitMaskArray.hpp"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Filtering/ComparisonSet.h"
+#include "SIMPLib/Filtering/ComparisonValue.h"
+
+const size_t ThresholdPredicate::k_BitsPerWord;
+const size_t ThresholdPredicate::k_BlockSize;
+const size_t ThresholdPredicate::k_BlockWords;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+class ThresholdPredicate::Leaf
+{
+public:
+  virtual ~Leaf() = default;
+
+  /**
+   * @brief Packs the comparison result for the tuples [start, start + count) into words
+   */
+  virtual void evaluate(size_t start, size_t count, ThresholdPredicate::Word* words) const = 0;
+};
+
+namespace
+{
+enum OpCode
+{
+  Op_PushLeaf = 0,
+  Op_PushFalse,
+  Op_And,
+  Op_Or,
+  Op_Not
+};
+
+/**
+ * @brief Compares count values against value and packs the results 64 tuples per word.
+ * The inner loop has a fixed trip count for every full word and no branches.
+ */
+template <typename T, typename Compare> void packComparison(const T* data, size_t count, T value, Compare compare, ThresholdPredicate::Word* words)
+{
+  size_t numWords = (count + ThresholdPredicate::k_BitsPerWord - 1) / ThresholdPredicate::k_BitsPerWord;
+  for(size_t w = 0; w < numWords; w++)
+  {
+    const T* chunk = data + w * ThresholdPredicate::k_BitsPerWord;
+    size_t numBits = std::min(ThresholdPredicate::k_BitsPerWord, count - w * ThresholdPredicate::k_BitsPerWord);
+    ThresholdPredicate::Word word = 0;
+    for(size_t b = 0; b < numBits; b++)
+    {
+      word |= static_cast<ThresholdPredicate::Word>(compare(chunk[b], value)) << b;
+    }
+    words[w] = word;
+  }
+}
+
+/**
+ * @brief The ComparisonLeaf class evaluates one ComparisonValue against a DataArray<T>
+ */
+template <typename T> class ComparisonLeaf : public ThresholdPredicate::Leaf
+{
+public:
+  ComparisonLeaf(typename DataArray<T>::Pointer array, int compOperator, double compValue)
+  : m_Array(array)
+  , m_Operator(compOperator)
+  , m_Value(static_cast<T>(compValue))
+  {
+  }
+
+  ~ComparisonLeaf() override = default;
+
+  void evaluate(size_t start, size_t count, ThresholdPredicate::Word* words) const override
+  {
+    const T* data = m_Array->getPointer(start);
+    switch(m_Operator)
+    {
+    case SIMPL::Comparison::Operator_LessThan:
+      packComparison(data, count, m_Value, std::less<T>(), words);
+      break;
+    case SIMPL::Comparison::Operator_GreaterThan:
+      packComparison(data, count, m_Value, std::greater<T>(), words);
+      break;
+    case SIMPL::Comparison::Operator_Equal:
+      packComparison(data, count, m_Value, std::equal_to<T>(), words);
+      break;
+    case SIMPL::Comparison::Operator_NotEqual:
+      packComparison(data, count, m_Value, std::not_equal_to<T>(), words);
+      break;
+    default:
+      std::fill_n(words, ThresholdPredicate::k_BlockWords, 0);
+      break;
+    }
+  }
+
+private:
+  typename DataArray<T>::Pointer m_Array;
+  int m_Operator;
+  T m_Value;
+};
+
+/**
+ * @brief The BitMaskLeaf class evaluates one ComparisonValue against a BitMaskArray. Blocks start on a word
+ * boundary of the mask, so every comparison is a copy, an inversion or a fill of the packed words.
+ */
+class BitMaskLeaf : public ThresholdPredicate::Leaf
+{
+public:
+  BitMaskLeaf(BitMaskArray::Pointer array, int compOperator, double compValue)
+  : m_Array(array)
+  , m_Operator(compOperator)
+  , m_Value(static_cast<bool>(compValue))
+  {
+  }
+
+  ~BitMaskLeaf() override = default;
+
+  void evaluate(size_t start, size_t count, ThresholdPredicate::Word* words) const override
+  {
+    const ThresholdPredicate::Word* data = m_Array->getWords() + start / ThresholdPredicate::k_BitsPerWord;
+    size_t numWords = (count + ThresholdPredicate::k_BitsPerWord - 1) / ThresholdPredicate::k_BitsPerWord;
+    switch(m_Operator)
+    {
+    case SIMPL::Comparison::Operator_LessThan:
+      // Only false < true holds
+      packWords(data, numWords, m_Value, false, words);
+      break;
+    case SIMPL::Comparison::Operator_GreaterThan:
+      // Only true > false holds
+      packWords(data, numWords, false, !m_Value, words);
+      break;
+    case SIMPL::Comparison::Operator_Equal:
+      packWords(data, numWords, !m_Value, m_Value, words);
+      break;
+    case SIMPL::Comparison::Operator_NotEqual:
+      packWords(data, numWords, m_Value, !m_Value, words);
+      break;
+    default:
+      std::fill_n(words, ThresholdPredicate::k_BlockWords, 0);
+      break;
+    }
+  }
+
+private:
+  /**
+   * @brief Sets every result bit to whenFalse or whenTrue depending on the mask bit
+   */
+  static void packWords(const ThresholdPredicate::Word* data, size_t numWords, bool whenFalse, bool whenTrue, ThresholdPredicate::Word* words)
+  {
+    const ThresholdPredicate::Word falseBits = whenFalse ? ~static_cast<ThresholdPredicate::Word>(0) : 0;
+    const ThresholdPredicate::Word trueBits = whenTrue ? ~static_cast<ThresholdPredicate::Word>(0) : 0;
+    for(size_t w = 0; w < numWords; w++)
+    {
+      words[w] = (data[w] & trueBits) | (~data[w] & falseBits);
+    }
+  }
+
+  BitMaskArray::Pointer m_Array;
+  int m_Operator;
+  bool m_Value;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T> std::shared_ptr<ThresholdPredicate::Leaf> createLeaf(const IDataArray::Pointer& array, int compOperator, double compValue)
+{
+  typename DataArray<T>::Pointer typedArray = std::dynamic_pointer_cast<DataArray<T>>(array);
+  if(nullptr == typedArray)
+  {
+    return std::shared_ptr<ThresholdPredicate::Leaf>();
+  }
+  return std::shared_ptr<ThresholdPredicate::Leaf>(new ComparisonLeaf<T>(typedArray, compOperator, compValue));
+}
+
+#define THRESHOLD_CREATE_LEAF(Type)                                                                                                                                                                    \
+  if(nullptr == leaf)                                                                                                                                                                                  \
+  {                                                                                                                                                                                                    \
+    leaf = createLeaf<Type>(array, compOperator, compValue);                                                                                                                                           \
+  }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::shared_ptr<ThresholdPredicate::Leaf> createLeaf(const IDataArray::Pointer& array, int compOperator, double compValue)
+{
+  BitMaskArray::Pointer bitMask = std::dynamic_pointer_cast<BitMaskArray>(array);
+  if(nullptr != bitMask)
+  {
+    return std::shared_ptr<ThresholdPredicate::Leaf>(new BitMaskLeaf(bitMask, compOperator, compValue));
+  }
+
+  std::shared_ptr<ThresholdPredicate::Leaf> leaf;
+  THRESHOLD_CREATE_LEAF(float)
+  THRESHOLD_CREATE_LEAF(double)
+  THRESHOLD_CREATE_LEAF(int8_t)
+  THRESHOLD_CREATE_LEAF(uint8_t)
+  THRESHOLD_CREATE_LEAF(int16_t)
+  THRESHOLD_CREATE_LEAF(uint16_t)
+  THRESHOLD_CREATE_LEAF(int32_t)
+  THRESHOLD_CREATE_LEAF(uint32_t)
+  THRESHOLD_CREATE_LEAF(int64_t)
+  THRESHOLD_CREATE_LEAF(uint64_t)
+  THRESHOLD_CREATE_LEAF(bool)
+  return leaf;
+}
+}
+
+/**
+ * @brief The ThresholdPredicateImpl class evaluates a range of blocks and writes either
+ * one bool per tuple or the packed words into the output.
+ */
+class ThresholdPredicateImpl
+{
+public:
+  ThresholdPredicateImpl(const ThresholdPredicate* predicate, bool* boolOutput, ThresholdPredicate::Word* wordOutput)
+  : m_Predicate(predicate)
+  , m_BoolOutput(boolOutput)
+  , m_WordOutput(wordOutput)
+  {
+  }
+  virtual ~ThresholdPredicateImpl() = default;
+
+  void evaluate(size_t startBlock, size_t endBlock) const
+  {
+    std::vector<ThresholdPredicate::Word> scratch(m_Predicate->getScratchWords());
+    ThresholdPredicate::Word words[ThresholdPredicate::k_BlockWords];
+    size_t numTuples = m_Predicate->getNumberOfTuples();
+
+    for(size_t block = startBlock; block < endBlock; block++)
+    {
+      size_t start = block * ThresholdPredicate::k_BlockSize;
+      size_t count = std::min(ThresholdPredicate::k_BlockSize, numTuples - start);
+      m_Predicate->evaluateBlock(start, count, words, scratch.data());
+
+      if(nullptr != m_WordOutput)
+      {
+        size_t numWords = (count + ThresholdPredicate::k_BitsPerWord - 1) / ThresholdPredicate::k_BitsPerWord;
+        ::memcpy(m_WordOutput + start / ThresholdPredicate::k_BitsPerWord, words, numWords * sizeof(ThresholdPredicate::Word));
+      }
+      else
+      {
+        bool* output = m_BoolOutput + start;
+        for(size_t i = 0; i < count; i++)
+        {
+          output[i] = ((words[i / ThresholdPredicate::k_BitsPerWord] >> (i % ThresholdPredicate::k_BitsPerWord)) & 1) != 0;
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    evaluate(r.begin(), r.end());
+  }
+#endif
+private:
+  const ThresholdPredicate* m_Predicate;
+  bool* m_BoolOutput;
+  ThresholdPredicate::Word* m_WordOutput;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdPredicate::ThresholdPredicate()
+: m_NumTuples(0)
+, m_MaxDepth(0)
+, m_Valid(false)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ThresholdPredicate::~ThresholdPredicate() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ThresholdPredicate::compile(ComparisonInputsAdvanced& inputs, const AttributeMatrix::Pointer& am)
+{
+  m_Program.clear();
+  m_Leaves.clear();
+  m_NumTuples = 0;
+  m_MaxDepth = 0;
+  m_Valid = false;
+  m_InvalidArrayName.clear();
+
+  if(nullptr == am)
+  {
+    return false;
+  }
+
+  m_NumTuples = am->getNumberOfTuples();
+  m_Valid = true;
+  int32_t depth = 0;
+  compileSet(inputs.getInputs(), inputs.shouldInvert(), am, depth);
+  if(!m_Valid)
+  {
+    m_Program.clear();
+    m_Leaves.clear();
+  }
+  return m_Valid;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdPredicate::compileSet(QVector<AbstractComparison::Pointer> comparisons, bool invert, const AttributeMatrix::Pointer& am, int32_t& depth)
+{
+  bool firstValueFound = false;
+  for(int32_t i = 0; i < comparisons.size() && m_Valid; i++)
+  {
+    if(nullptr == std::dynamic_pointer_cast<ComparisonSet>(comparisons[i]) && nullptr == std::dynamic_pointer_cast<ComparisonValue>(comparisons[i]))
+    {
+      continue;
+    }
+
+    compileComparison(comparisons[i], am, depth);
+    // The first comparison seeds the result, every other one is merged with its own union operator
+    if(firstValueFound)
+    {
+      addInstruction(SIMPL::Union::Operator_Or == comparisons[i]->getUnionOperator() ? Op_Or : Op_And, -1, depth, -1);
+    }
+    firstValueFound = true;
+  }
+
+  if(!firstValueFound)
+  {
+    addInstruction(Op_PushFalse, -1, depth, 1);
+  }
+  if(invert)
+  {
+    addInstruction(Op_Not, -1, depth, 0);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdPredicate::compileComparison(const AbstractComparison::Pointer& comparison, const AttributeMatrix::Pointer& am, int32_t& depth)
+{
+  ComparisonSet::Pointer comparisonSet = std::dynamic_pointer_cast<ComparisonSet>(comparison);
+  if(nullptr != comparisonSet)
+  {
+    compileSet(comparisonSet->getComparisons(), comparisonSet->getInvertComparison(), am, depth);
+    return;
+  }
+
+  ComparisonValue::Pointer comparisonValue = std::dynamic_pointer_cast<ComparisonValue>(comparison);
+  IDataArray::Pointer array = am->getAttributeArray(comparisonValue->getAttributeArrayName());
+  std::shared_ptr<Leaf> leaf;
+  if(nullptr != array && array->getNumberOfComponents() == 1 && array->getNumberOfTuples() >= m_NumTuples)
+  {
+    leaf = createLeaf(array, comparisonValue->getCompOperator(), comparisonValue->getCompValue());
+  }
+  if(nullptr == leaf)
+  {
+    m_Valid = false;
+    m_InvalidArrayName = comparisonValue->getAttributeArrayName();
+    return;
+  }
+
+  m_Leaves.push_back(leaf);
+  addInstruction(Op_PushLeaf, static_cast<int32_t>(m_Leaves.size() - 1), depth, 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdPredicate::addInstruction(int32_t opCode, int32_t leafIndex, int32_t& depth, int32_t stackChange)
+{
+  Instruction instruction = {opCode, leafIndex};
+  m_Program.push_back(instruction);
+  depth += stackChange;
+  m_MaxDepth = std::max(m_MaxDepth, depth);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ThresholdPredicate::getInvalidArrayName() const
+{
+  return m_InvalidArrayName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ThresholdPredicate::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ThresholdPredicate::getNumberOfWords() const
+{
+  return (m_NumTuples + k_BitsPerWord - 1) / k_BitsPerWord;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ThresholdPredicate::getScratchWords() const
+{
+  return static_cast<size_t>(std::max(m_MaxDepth, 1)) * k_BlockWords;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdPredicate::evaluateBlock(size_t start, size_t count, Word* words, Word* scratch) const
+{
+  size_t numWords = (count + k_BitsPerWord - 1) / k_BitsPerWord;
+  if(!m_Valid || m_Program.empty())
+  {
+    std::fill_n(words, numWords, 0);
+    return;
+  }
+
+  // Each stack slot holds the packed mask of one pending operand for this block
+  int32_t top = -1;
+  for(const Instruction& instruction : m_Program)
+  {
+    switch(instruction.opCode)
+    {
+    case Op_PushLeaf:
+      top++;
+      m_Leaves[instruction.leafIndex]->evaluate(start, count, scratch + top * k_BlockWords);
+      break;
+    case Op_PushFalse:
+      top++;
+      std::fill_n(scratch + top * k_BlockWords, numWords, 0);
+      break;
+    case Op_And:
+    {
+      Word* lhs = scratch + (top - 1) * k_BlockWords;
+      const Word* rhs = scratch + top * k_BlockWords;
+      for(size_t w = 0; w < numWords; w++)
+      {
+        lhs[w] &= rhs[w];
+      }
+      top--;
+      break;
+    }
+    case Op_Or:
+    {
+      Word* lhs = scratch + (top - 1) * k_BlockWords;
+      const Word* rhs = scratch + top * k_BlockWords;
+      for(size_t w = 0; w < numWords; w++)
+      {
+        lhs[w] |= rhs[w];
+      }
+      top--;
+      break;
+    }
+    case Op_Not:
+    {
+      Word* operand = scratch + top * k_BlockWords;
+      for(size_t w = 0; w < numWords; w++)
+      {
+        operand[w] = ~operand[w];
+      }
+      break;
+    }
+    default:
+      break;
+    }
+  }
+
+  ::memcpy(words, scratch, numWords * sizeof(Word));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdPredicate::evaluate(bool* output) const
+{
+  size_t numBlocks = (m_NumTuples + k_BlockSize - 1) / k_BlockSize;
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks), ThresholdPredicateImpl(this, output, nullptr), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ThresholdPredicateImpl serial(this, output, nullptr);
+    serial.evaluate(0, numBlocks);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ThresholdPredicate::evaluate(Word* output) const
+{
+  size_t numBlocks = (m_NumTuples + k_BlockSize - 1) / k_BlockSize;
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks), ThresholdPredicateImpl(this, nullptr, output), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ThresholdPredicateImpl serial(this, nullptr, output);
+    serial.evaluate(0, numBlocks);
+  }
+
+  size_t tailBits = m_NumTuples % k_BitsPerWord;
+  if(tailBits != 0)
+  {
+    output[getNumberOfWords() - 1] &= (static_cast<Word>(1) << tailBits) - 1;
+  }
+}
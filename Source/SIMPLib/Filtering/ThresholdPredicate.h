@@ -0,0 +1,150 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#ifndef _thresholdpredicate_h_
+#define _thresholdpredicate_h_
+
+#include <memory>
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The ThresholdPredicate class compiles the ComparisonSet tree held by a
+ * ComparisonInputsAdvanced into a single postfix program that is evaluated in one
+ * pass over the tuples of an AttributeMatrix. Tuples are processed in blocks of
+ * k_BlockSize; every intermediate result is a block sized mask packed 64 tuples per
+ * word, so no full length temporary array is allocated for any comparison or set.
+ * Blocks are independent and are evaluated in parallel when SIMPLib is built with TBB.
+ */
+class SIMPLib_EXPORT ThresholdPredicate
+{
+public:
+  using Word = uint64_t;
+
+  static const size_t k_BitsPerWord = 64;
+  static const size_t k_BlockSize = 4096;
+  static const size_t k_BlockWords = k_BlockSize / k_BitsPerWord;
+
+  ThresholdPredicate();
+  virtual ~ThresholdPredicate();
+
+  /**
+   * @brief Builds the program for the given comparisons against the arrays of the AttributeMatrix.
+   * Union operators, ComparisonSet inversion and the global inversion follow the semantics of
+   * MultiThresholdObjects2: the first comparison of a set seeds the result and every following
+   * comparison is merged with its own union operator.
+   * @param inputs The comparisons to compile
+   * @param am The AttributeMatrix holding the compared arrays
+   * @return True on success. On failure getInvalidArrayName() holds the array that could not be used
+   */
+  bool compile(ComparisonInputsAdvanced& inputs, const AttributeMatrix::Pointer& am);
+
+  /**
+   * @brief Returns the name of the array that made compile() fail
+   */
+  QString getInvalidArrayName() const;
+
+  /**
+   * @brief Returns the number of tuples the compiled program evaluates
+   */
+  size_t getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the number of words needed to store the packed result
+   */
+  size_t getNumberOfWords() const;
+
+  /**
+   * @brief Evaluates the program for the tuples [start, start + count) where start is a
+   * multiple of k_BlockSize and count is at most k_BlockSize. Bit b of words[w] holds the
+   * result for tuple start + w * k_BitsPerWord + b. Bits past count are undefined.
+   * @param start First tuple of the block
+   * @param count Number of tuples in the block
+   * @param words Destination holding at least k_BlockWords words
+   * @param scratch Scratch space holding at least getScratchWords() words
+   */
+  void evaluateBlock(size_t start, size_t count, Word* words, Word* scratch) const;
+
+  /**
+   * @brief Returns the number of scratch words evaluateBlock() requires
+   */
+  size_t getScratchWords() const;
+
+  /**
+   * @brief Evaluates all tuples and stores one bool per tuple
+   * @param output Destination holding getNumberOfTuples() values
+   */
+  void evaluate(bool* output) const;
+
+  /**
+   * @brief Evaluates all tuples and stores the packed result. Unused bits of the last word are cleared.
+   * @param output Destination holding getNumberOfWords() words
+   */
+  void evaluate(Word* output) const;
+
+  /**
+   * @brief The Leaf class evaluates a single ComparisonValue for one block of tuples
+   */
+  class Leaf;
+
+private:
+  struct Instruction
+  {
+    int32_t opCode;
+    int32_t leafIndex;
+  };
+
+  void compileSet(QVector<AbstractComparison::Pointer> comparisons, bool invert, const AttributeMatrix::Pointer& am, int32_t& depth);
+  void compileComparison(const AbstractComparison::Pointer& comparison, const AttributeMatrix::Pointer& am, int32_t& depth);
+  void addInstruction(int32_t opCode, int32_t leafIndex, int32_t& depth, int32_t stackChange);
+
+  std::vector<Instruction> m_Program;
+  std::vector<std::shared_ptr<Leaf>> m_Leaves;
+  size_t m_NumTuples;
+  int32_t m_MaxDepth;
+  bool m_Valid;
+  QString m_InvalidArrayName;
+
+  ThresholdPredicate(const ThresholdPredicate&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ThresholdPredicate&) = delete;     // Move assignment Not Implemented
+};
+
+#endif /* _thresholdpredicate_h_ */
@@ -41,6 +41,7 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DynamicListArray.hpp"
 
 #include "Eigen/LU"
 #include "Eigen/Eigenvalues"
@@ -116,6 +117,80 @@ namespace DerivativeHelpers
       void operator()(TetrahedralGeom* tets, int64_t tetId, double values[4], double derivs[3]);
   };
 
+  /**
+   * @brief GatherVertexValues Fills vertValues (numVerts x numComps) with the field values at the
+   * given vertices, read in the field's native type. If elemsContainingVert is supplied the field is
+   * element centered and each vertex value is the average of the elements that contain the vertex,
+   * which fuses the cell to vertex interpolation into the derivative loop.
+   * @param field
+   * @param numComps
+   * @param verts
+   * @param numVerts
+   * @param elemsContainingVert
+   * @param vertValues
+   */
+  template <typename T>
+  void GatherVertexValues(const T* field, int32_t numComps, const int64_t* verts, size_t numVerts, DynamicListArray<uint16_t, int64_t>* elemsContainingVert, double* vertValues)
+  {
+    for(size_t k = 0; k < numVerts; k++)
+    {
+      double* value = vertValues + k * numComps;
+      if(nullptr == elemsContainingVert)
+      {
+        const T* src = field + verts[k] * numComps;
+        for(int32_t j = 0; j < numComps; j++)
+        {
+          value[j] = static_cast<double>(src[j]);
+        }
+        continue;
+      }
+
+      for(int32_t j = 0; j < numComps; j++)
+      {
+        value[j] = 0.0;
+      }
+      uint16_t numElems = elemsContainingVert->getNumberOfElements(verts[k]);
+      int64_t* elems = elemsContainingVert->getElementListPointer(verts[k]);
+      for(uint16_t e = 0; e < numElems; e++)
+      {
+        const T* src = field + elems[e] * numComps;
+        for(int32_t j = 0; j < numComps; j++)
+        {
+          value[j] += static_cast<double>(src[j]);
+        }
+      }
+      if(numElems > 0)
+      {
+        double weight = 1.0 / static_cast<double>(numElems);
+        for(int32_t j = 0; j < numComps; j++)
+        {
+          value[j] *= weight;
+        }
+      }
+    }
+  }
+
 }
 
+/**
+ * @brief Explicitly instantiates a geometry's templated derivative method for every primitive input
+ * type with float and double output.
+ */
+#define SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, T)                                                          \
+  template void Geom::Method<T, float>(DataArray<T>::Pointer, DataArray<float>::Pointer, Observable*);                  \
+  template void Geom::Method<T, double>(DataArray<T>::Pointer, DataArray<double>::Pointer, Observable*);
+
+#define SIMPL_INSTANTIATE_DERIVATIVES(Geom, Method)                                                                     \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, int8_t)                                                           \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, uint8_t)                                                          \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, int16_t)                                                          \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, uint16_t)                                                         \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, int32_t)                                                          \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, uint32_t)                                                         \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, int64_t)                                                          \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, uint64_t)                                                         \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, float)                                                            \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, double)                                                           \
+  SIMPL_INSTANTIATE_DERIVATIVES_OUTPUTS(Geom, Method, bool)
+
 #endif /* _DerivativeHelpers_H_ */
@@ -55,18 +55,23 @@
 
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Utilities/ParallelProgress.h"
 
 /**
  * @brief The FindEdgeDerivativesImpl class implements a threaded algorithm that computes the
- * derivative of an arbitrary dimensional field on the underlying edges
+ * derivative of an arbitrary dimensional field on the underlying edges. The field is read in its
+ * native type; if a list of elements containing each vertex is supplied the field is element centered
+ * and is averaged onto the vertices as it is read.
  */
-class FindEdgeDerivativesImpl
+template <typename T, typename K> class FindEdgeDerivativesImpl
 {
 public:
-  FindEdgeDerivativesImpl(EdgeGeom* edges, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs)
+  FindEdgeDerivativesImpl(EdgeGeom* edges, typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivs, ElementDynamicList::Pointer elemsContainingVert, ParallelProgress* progress)
   : m_Edges(edges)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_ElemsContainingVert(elemsContainingVert)
+  , m_Progress(progress)
   {
   }
   virtual ~FindEdgeDerivativesImpl()
@@ -76,8 +81,9 @@ public:
   void compute(int64_t start, int64_t end) const
   {
     int32_t cDims = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    T* fieldPtr = m_Field->getPointer(0);
+    K* derivsPtr = m_Derivatives->getPointer(0);
+    std::vector<double> vertValues(2 * cDims, 0.0);
     double values[2] = {0.0, 0.0};
     double derivs[3] = {0.0, 0.0, 0.0};
     int64_t verts[2] = {0, 0};
@@ -89,25 +95,31 @@ public:
     for(int64_t i = start; i < end; i++)
     {
       m_Edges->getVertsAtEdge(i, verts);
+      DerivativeHelpers::GatherVertexValues<T>(fieldPtr, cDims, verts, 2, m_ElemsContainingVert.get(), vertValues.data());
       for(int32_t j = 0; j < cDims; j++)
       {
         for(size_t k = 0; k < 2; k++)
         {
-          values[k] = fieldPtr[cDims * verts[k] + j];
+          values[k] = vertValues[k * cDims + j];
         }
         DerivativeHelpers::EdgeDeriv()(m_Edges, i, values, derivs);
-        derivsPtr[i * 3 * cDims + j * 3] = derivs[0];
-        derivsPtr[i * 3 * cDims + j * 3 + 1] = derivs[1];
-        derivsPtr[i * 3 * cDims + j * 3 + 2] = derivs[2];
+        derivsPtr[i * 3 * cDims + j * 3] = static_cast<K>(derivs[0]);
+        derivsPtr[i * 3 * cDims + j * 3 + 1] = static_cast<K>(derivs[1]);
+        derivsPtr[i * 3 * cDims + j * 3 + 2] = static_cast<K>(derivs[2]);
       }
 
       if(counter > progIncrement)
       {
-        m_Edges->sendThreadSafeProgressMessage(counter, totalElements);
+        m_Progress->increment(counter);
         counter = 0;
+        if(m_Progress->wasCanceled())
+        {
+          return;
+        }
       }
       counter++;
     }
+    m_Progress->increment(counter);
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -118,8 +130,10 @@ public:
 #endif
 private:
   EdgeGeom* m_Edges;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  typename DataArray<T>::Pointer m_Field;
+  typename DataArray<K>::Pointer m_Derivatives;
+  ElementDynamicList::Pointer m_ElemsContainingVert;
+  ParallelProgress* m_Progress;
 };
 
 // -----------------------------------------------------------------------------
@@ -324,14 +338,7 @@ void EdgeGeom::deleteElementNeighbors()
 // -----------------------------------------------------------------------------
 int EdgeGeom::findElementCentroids()
 {
-  QVector<size_t> cDims(1, 3);
-  m_EdgeCentroids = FloatArrayType::CreateArray(getNumberOfElements(), cDims, SIMPL::StringConstants::EdgeCentroids);
-  GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_EdgeList, m_VertexList, m_EdgeCentroids);
-  if(m_EdgeCentroids.get() == nullptr)
-  {
-    return -1;
-  }
-  return 1;
+  return updateElementCentroidsAndSizes(true, false);
 }
 
 // -----------------------------------------------------------------------------
@@ -363,23 +370,39 @@ void EdgeGeom::deleteElementCentroids()
 // -----------------------------------------------------------------------------
 int EdgeGeom::findElementSizes()
 {
-  m_EdgeSizes = FloatArrayType::CreateArray(getNumberOfElements(), SIMPL::StringConstants::EdgeLengths);
-
-  float* sizes = m_EdgeSizes->getPointer(0);
-  float vert0[3] = {0.0f, 0.0f, 0.0f};
-  float vert1[3] = {0.0f, 0.0f, 0.0f};
+  return updateElementCentroidsAndSizes(false, true);
+}
 
-  for(int64_t i = 0; i < getNumberOfEdges(); i++)
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int EdgeGeom::findElementMeasures(bool centroids, bool sizes)
+{
+  FloatArrayType::Pointer elemCentroids = FloatArrayType::NullPointer();
+  FloatArrayType::Pointer elemSizes = FloatArrayType::NullPointer();
+  if(centroids)
   {
-    getVertCoordsAtEdge(i, vert0, vert1);
-    float length = 0.0f;
-    for(size_t j = 0; j < 3; j++)
-    {
-      length += (vert0[j] - vert1[j]) * (vert0[j] - vert1[j]);
-    }
-    sizes[i] = sqrtf(length);
+    QVector<size_t> cDims(1, 3);
+    elemCentroids = FloatArrayType::CreateArray(getNumberOfEdges(), cDims, SIMPL::StringConstants::EdgeCentroids);
+  }
+  if(sizes)
+  {
+    QVector<size_t> cDims(1, 1);
+    elemSizes = FloatArrayType::CreateArray(getNumberOfEdges(), cDims, SIMPL::StringConstants::EdgeLengths);
+  }
+  int err = GeometryHelpers::Topology::FindElementCentroidsAndSizes<int64_t>(m_EdgeList, m_VertexList, elemCentroids, elemSizes, IGeometry::Type::Edge);
+  if(err < 0)
+  {
+    return err;
+  }
+  if(centroids)
+  {
+    m_EdgeCentroids = elemCentroids;
+  }
+  if(sizes)
+  {
+    m_EdgeSizes = elemSizes;
   }
-
   return 1;
 }
 
@@ -432,6 +455,14 @@ void EdgeGeom::getShapeFunctions(double pCoords[3], double* shape)
 //
 // -----------------------------------------------------------------------------
 void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives<double, double>(field, derivatives, observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void EdgeGeom::findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   int64_t numEdges = getNumberOfEdges();
@@ -441,6 +472,8 @@ void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
 
+  ParallelProgress progress(this, numEdges, m_MessagePrefix, m_MessageLabel, m_MessageTitle, observable);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
   bool doParallel = true;
@@ -449,16 +482,61 @@ void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numEdges), FindEdgeDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numEdges), FindEdgeDerivativesImpl<T, K>(this, field, derivatives, ElementDynamicList::NullPointer(), &progress), tbb::auto_partitioner());
   }
   else
 #endif
   {
-    FindEdgeDerivativesImpl serial(this, field, derivatives);
+    FindEdgeDerivativesImpl<T, K> serial(this, field, derivatives, ElementDynamicList::NullPointer(), &progress);
     serial.compute(0, numEdges);
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void EdgeGeom::findDerivativesFromElementValues(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
+{
+  m_ProgressCounter = 0;
+  int64_t numEdges = getNumberOfEdges();
+
+  if(getElementsContainingVert().get() == nullptr)
+  {
+    if(findElementsContainingVert() < 0)
+    {
+      return;
+    }
+  }
+  ElementDynamicList::Pointer elemsContainingVert = getElementsContainingVert();
+
+  if(observable)
+  {
+    connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
+  }
+
+  ParallelProgress progress(this, numEdges, m_MessagePrefix, m_MessageLabel, m_MessageTitle, observable);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numEdges), FindEdgeDerivativesImpl<T, K>(this, field, derivatives, elemsContainingVert, &progress), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    FindEdgeDerivativesImpl<T, K> serial(this, field, derivatives, elemsContainingVert, &progress);
+    serial.compute(0, numEdges);
+  }
+}
+
+SIMPL_INSTANTIATE_DERIVATIVES(EdgeGeom, findDerivatives)
+SIMPL_INSTANTIATE_DERIVATIVES(EdgeGeom, findDerivativesFromElementValues)
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -651,8 +729,8 @@ int EdgeGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 // -----------------------------------------------------------------------------
 IGeometry::Pointer EdgeGeom::deepCopy(bool forceNoAllocate)
 {
-  SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
-  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((getEdges().get() == nullptr) ? nullptr : getEdges()->deepCopy(forceNoAllocate));
+  SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((m_VertexList.get() == nullptr) ? nullptr : m_VertexList->deepCopy(forceNoAllocate));
+  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((m_EdgeList.get() == nullptr) ? nullptr : m_EdgeList->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementsContainingVert =
       std::dynamic_pointer_cast<ElementDynamicList>((getElementsContainingVert().get() == nullptr) ? nullptr : getElementsContainingVert()->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementNeighbors = std::dynamic_pointer_cast<ElementDynamicList>((getElementNeighbors().get() == nullptr) ? nullptr : getElementNeighbors()->deepCopy(forceNoAllocate));
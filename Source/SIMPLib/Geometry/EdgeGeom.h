@@ -120,6 +120,13 @@ class SIMPLib_EXPORT EdgeGeom : public IGeometry
      */
     float* getVertexPointer(int64_t i);
 
+    /**
+     * @brief getVertexPointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    const float* getVertexPointer(int64_t i) const;
+
     /**
      * @brief getNumberOfVertices
      * @return
@@ -184,6 +191,13 @@ class SIMPLib_EXPORT EdgeGeom : public IGeometry
      */
     int64_t* getEdgePointer(int64_t i);
 
+    /**
+     * @brief getEdgePointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    const int64_t* getEdgePointer(int64_t i) const;
+
     /**
      * @brief getNumberOfEdges
      * @return
@@ -293,6 +307,22 @@ class SIMPLib_EXPORT EdgeGeom : public IGeometry
      */
     virtual void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr);
 
+    /**
+     * @brief findDerivatives Computes the derivatives of a vertex field in its native type
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
+    /**
+     * @brief findDerivativesFromElementValues Computes the derivatives of an element centered field
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivativesFromElementValues(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -364,6 +394,14 @@ class SIMPLib_EXPORT EdgeGeom : public IGeometry
      */
     virtual void setElementSizes(FloatArrayType::Pointer elementSizes);
 
+    /**
+     * @brief findElementMeasures Computes the requested element centroids and sizes in one parallel sweep
+     * @param centroids
+     * @param sizes
+     * @return
+     */
+    virtual int findElementMeasures(bool centroids, bool sizes);
+
   private:
     SharedVertexList::Pointer m_VertexList;
     SharedEdgeList::Pointer m_EdgeList;
@@ -372,7 +410,7 @@ class SIMPLib_EXPORT EdgeGeom : public IGeometry
     FloatArrayType::Pointer m_EdgeCentroids;
     FloatArrayType::Pointer m_EdgeSizes;
 
-    friend class FindEdgeDerivativesImpl;
+    template <typename T, typename K> friend class FindEdgeDerivativesImpl;
 
     EdgeGeom(const EdgeGeom&) = delete;       // Copy Constructor Not Implemented
     void operator=(const EdgeGeom&) = delete; // Move assignment Not Implemented
@@ -36,6 +36,14 @@
 
 #include <map>
 #include <set>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
 
 #include <QtCore/QString>
 
@@ -44,6 +52,7 @@
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Geometry/GridNeighborhood.h"
 #include "SIMPLib/Geometry/IGeometry.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
 #include "SIMPLib/Math/GeometryMath.h"
@@ -445,6 +454,57 @@ public:
     return err;
   }
 
+  /**
+   * @brief FindGridElementNeighbors Lists the face neighbors of every cell of a structured grid
+   * @param dims The grid dimensions
+   * @param dynamicList This should be an empty DynamicListArray object. It is not
+   * it <b>WILL</b> be cleared and reallocated.
+   * @return
+   */
+  template <typename T, typename K> static int FindGridElementNeighbors(const size_t dims[3], typename DynamicListArray<T, K>::Pointer dynamicList)
+  {
+    size_t numElems = dims[0] * dims[1] * dims[2];
+    if(numElems == 0)
+    {
+      return -1;
+    }
+
+    GridNeighborhood neighborhood(dims, GridNeighborhood::Connectivity::Face);
+    std::vector<T> linkCount(numElems, 0);
+    uint32_t masks[3] = {0, 0, 0};
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        neighborhood.getRowMasks(y, z, masks[0], masks[1], masks[2]);
+        size_t rowStart = (z * dims[1] + y) * dims[0];
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          uint32_t mask = (x == 0) ? masks[0] : ((x == dims[0] - 1) ? masks[2] : masks[1]);
+          linkCount[rowStart + x] = static_cast<T>(GridNeighborhood::CountNeighbors(mask));
+        }
+      }
+    }
+
+    dynamicList->allocateLists(linkCount);
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        neighborhood.getRowMasks(y, z, masks[0], masks[1], masks[2]);
+        size_t rowStart = (z * dims[1] + y) * dims[0];
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          size_t index = rowStart + x;
+          uint32_t mask = (x == 0) ? masks[0] : ((x == dims[0] - 1) ? masks[2] : masks[1]);
+          size_t pos = 0;
+          neighborhood.forEachNeighbor(static_cast<int64_t>(index), mask, [&](size_t, int64_t neighbor) { dynamicList->insertCellReference(index, pos++, static_cast<size_t>(neighbor)); });
+        }
+      }
+    }
+    return 1;
+  }
+
   /**
    * @brief Find2DElementEdges
    * @param elemList
@@ -793,6 +853,155 @@ public:
   }
 };
 
+/**
+ * @brief The ElementSizeType enum names the measure used as the size of a mesh element
+ */
+enum class ElementSizeType : int32_t
+{
+  Length = 0,
+  Area = 1,
+  Volume = 2
+};
+
+/**
+ * @brief The ElementSize struct computes the size of one element from the coordinates of its vertices
+ */
+template <size_t NumVerts, ElementSizeType SizeType> struct ElementSize;
+
+template <> struct ElementSize<2, ElementSizeType::Length>
+{
+  static float Compute(const float coords[2][3])
+  {
+    float length = 0.0f;
+    for(size_t j = 0; j < 3; j++)
+    {
+      length += (coords[0][j] - coords[1][j]) * (coords[0][j] - coords[1][j]);
+    }
+    return sqrtf(length);
+  }
+};
+
+template <size_t NumVerts> struct ElementSize<NumVerts, ElementSizeType::Area>
+{
+  static float Compute(const float coords[NumVerts][3])
+  {
+    // The polygon is projected onto the coordinate plane its normal is closest to, as in Topology::Find2DElementAreas
+    float coordinates[3 * NumVerts];
+    for(size_t k = 0; k < NumVerts; k++)
+    {
+      coordinates[3 * k + 0] = coords[k][0];
+      coordinates[3 * k + 1] = coords[k][1];
+      coordinates[3 * k + 2] = coords[k][2];
+    }
+    float normal[3] = {0.0f, 0.0f, 0.0f};
+    GeometryMath::FindPolygonNormal(coordinates, static_cast<int64_t>(NumVerts), normal);
+    MatrixMath::Normalize3x1(normal);
+
+    float nx = (normal[0] > 0.0 ? normal[0] : -normal[0]);
+    float ny = (normal[1] > 0.0 ? normal[1] : -normal[1]);
+    float nz = (normal[2] > 0.0 ? normal[2] : -normal[2]);
+    int32_t projection = (nx > ny ? (nx > nz ? 0 : 2) : (ny > nz ? 1 : 2));
+    size_t u = (projection == 0) ? 1 : 0;
+    size_t v = (projection == 2) ? 1 : 2;
+
+    float area = 0.0f;
+    for(size_t k = 0; k < NumVerts; k++)
+    {
+      area += coords[(k + 1) % NumVerts][u] * (coords[(k + 2) % NumVerts][v] - coords[k][v]);
+    }
+    switch(projection)
+    {
+    case 0:
+      area /= (2.0f * nx);
+      break;
+    case 1:
+      area /= (2.0f * ny);
+      break;
+    default:
+      area /= (2.0f * nz);
+      break;
+    }
+    return fabsf(area);
+  }
+};
+
+template <> struct ElementSize<4, ElementSizeType::Volume>
+{
+  static float Compute(const float coords[4][3])
+  {
+    float vertMatrix[3][3] = {{coords[1][0] - coords[0][0], coords[2][0] - coords[0][0], coords[3][0] - coords[0][0]},
+                              {coords[1][1] - coords[0][1], coords[2][1] - coords[0][1], coords[3][1] - coords[0][1]},
+                              {coords[1][2] - coords[0][2], coords[2][2] - coords[0][2], coords[3][2] - coords[0][2]}};
+    return (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
+  }
+};
+
+/**
+ * @brief The ElementMeasuresImpl class computes the centroids and/or sizes of a range of mesh elements in
+ * a single pass over the element list. The number of vertices per element and the size measure are template
+ * parameters, so each element's vertices are gathered once into a fixed size array and the loops over them
+ * are unrolled. Either output pointer may be nullptr.
+ */
+template <typename T, size_t NumVerts, ElementSizeType SizeType> class ElementMeasuresImpl
+{
+public:
+  ElementMeasuresImpl(const T* elems, const float* vertices, float* centroids, float* sizes)
+  : m_Elems(elems)
+  , m_Vertices(vertices)
+  , m_Centroids(centroids)
+  , m_Sizes(sizes)
+  {
+  }
+  virtual ~ElementMeasuresImpl()
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    float coords[NumVerts][3];
+    for(size_t i = start; i < end; i++)
+    {
+      const T* elem = m_Elems + NumVerts * i;
+      for(size_t k = 0; k < NumVerts; k++)
+      {
+        const float* vertex = m_Vertices + 3 * elem[k];
+        coords[k][0] = vertex[0];
+        coords[k][1] = vertex[1];
+        coords[k][2] = vertex[2];
+      }
+      if(nullptr != m_Centroids)
+      {
+        for(size_t j = 0; j < 3; j++)
+        {
+          float vertPos = 0.0f;
+          for(size_t k = 0; k < NumVerts; k++)
+          {
+            vertPos += coords[k][j];
+          }
+          m_Centroids[3 * i + j] = vertPos / static_cast<float>(NumVerts);
+        }
+      }
+      if(nullptr != m_Sizes)
+      {
+        m_Sizes[i] = ElementSize<NumVerts, SizeType>::Compute(coords);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_Elems;
+  const float* m_Vertices;
+  float* m_Centroids;
+  float* m_Sizes;
+};
+
 /**
  * @brief The Topology class
  */
@@ -836,6 +1045,36 @@ public:
     }
   }
 
+  /**
+   * @brief FindElementCentroidsAndSizes Computes the centroids and/or sizes of the elements of an edge,
+   * triangle, quadrilateral or tetrahedral mesh in one parallel sweep over the elements. The sizes are edge
+   * lengths, polygon areas or signed tetrahedral volumes
+   * @param elemList
+   * @param vertices
+   * @param centroids Output with 3 components per element, or a null pointer to skip the centroids
+   * @param sizes Output with 1 component per element, or a null pointer to skip the sizes
+   * @param geometryType
+   * @return Negative if the geometry type or the number of vertices per element is not supported
+   */
+  template <typename T>
+  static int FindElementCentroidsAndSizes(typename DataArray<T>::Pointer elemList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer centroids, FloatArrayType::Pointer sizes,
+                                          IGeometry::Type geometryType)
+  {
+    switch(geometryType)
+    {
+    case IGeometry::Type::Edge:
+      return FindElementMeasures<T, 2, ElementSizeType::Length>(elemList, vertices, centroids, sizes);
+    case IGeometry::Type::Triangle:
+      return FindElementMeasures<T, 3, ElementSizeType::Area>(elemList, vertices, centroids, sizes);
+    case IGeometry::Type::Quad:
+      return FindElementMeasures<T, 4, ElementSizeType::Area>(elemList, vertices, centroids, sizes);
+    case IGeometry::Type::Tetrahedral:
+      return FindElementMeasures<T, 4, ElementSizeType::Volume>(elemList, vertices, centroids, sizes);
+    default:
+      return -1;
+    }
+  }
+
   /**
    * @brief Find2DElementAreas
    * @param elemList
@@ -956,6 +1195,42 @@ public:
       volumePtr[i] = (MatrixMath::Determinant3x3(vertMatrix) / 6.0f);
     }
   }
+
+private:
+  template <typename T, size_t NumVerts, ElementSizeType SizeType>
+  static int FindElementMeasures(typename DataArray<T>::Pointer elemList, FloatArrayType::Pointer vertices, FloatArrayType::Pointer centroids, FloatArrayType::Pointer sizes)
+  {
+    if(elemList.get() == nullptr || vertices.get() == nullptr || elemList->getNumberOfComponents() != static_cast<int32_t>(NumVerts))
+    {
+      return -1;
+    }
+    size_t numElems = elemList->getNumberOfTuples();
+    float* centroidsPtr = (centroids.get() == nullptr) ? nullptr : centroids->getPointer(0);
+    float* sizesPtr = (sizes.get() == nullptr) ? nullptr : sizes->getPointer(0);
+    if(numElems == 0 || (nullptr == centroidsPtr && nullptr == sizesPtr))
+    {
+      return 1;
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numElems, 1024), ElementMeasuresImpl<T, NumVerts, SizeType>(elemList->getPointer(0), vertices->getPointer(0), centroidsPtr, sizesPtr),
+                        tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      ElementMeasuresImpl<T, NumVerts, SizeType> serial(elemList->getPointer(0), vertices->getPointer(0), centroidsPtr, sizesPtr);
+      serial.compute(0, numElems);
+    }
+    return 1;
+  }
 };
 
 /**
@@ -0,0 +1,232 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _gridneighborhood_h_
+#define _gridneighborhood_h_
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief The GridNeighborhood class holds the neighbor offsets of a structured grid for face (6),
+ * face and edge (18) or face, edge and corner (26) connectivity. Neighbor n of the cell at index i is the
+ * cell at i + offset(n). The first six neighbors are always the face neighbors in the order the filters
+ * have traditionally used: -Z, -Y, -X, +X, +Y, +Z; edge neighbors follow, then corner neighbors.
+ *
+ * Whether a neighbor lies inside the grid is given by a bit mask, where bit n is set if neighbor n exists.
+ * The masks are looked up from a small table, so the usual pattern for streaming over a row is:
+ *
+ * @code
+ * GridNeighborhood neighborhood(dims, GridNeighborhood::Connectivity::Face);
+ * uint32_t first = 0, interior = 0, last = 0;
+ * neighborhood.getRowMasks(y, z, first, interior, last);
+ * for(size_t x = 0; x < dims[0]; x++)
+ * {
+ *   uint32_t mask = (x == 0) ? first : ((x == dims[0] - 1) ? last : interior);
+ *   neighborhood.forEachNeighbor(rowStart + x, mask, [&](size_t n, int64_t neighbor) { ... });
+ * }
+ * @endcode
+ */
+class GridNeighborhood
+{
+  public:
+    enum class Connectivity : int32_t
+    {
+      Face = 6,
+      FaceEdge = 18,
+      FaceEdgeCorner = 26
+    };
+
+    GridNeighborhood(const size_t dims[3], Connectivity connectivity)
+    : m_Size(static_cast<size_t>(connectivity))
+    {
+      m_Dims[0] = dims[0];
+      m_Dims[1] = dims[1];
+      m_Dims[2] = dims[2];
+
+      // Neighbors are added by the number of axes they move along: faces, then edges, then corners
+      size_t n = 0;
+      for(int32_t numAxes = 1; numAxes <= 3; numAxes++)
+      {
+        for(int32_t k = -1; k <= 1; k++)
+        {
+          for(int32_t j = -1; j <= 1; j++)
+          {
+            for(int32_t i = -1; i <= 1; i++)
+            {
+              if((i != 0) + (j != 0) + (k != 0) != numAxes || n >= m_Size)
+              {
+                continue;
+              }
+              m_Directions[n][0] = i;
+              m_Directions[n][1] = j;
+              m_Directions[n][2] = k;
+              m_Offsets[n] = static_cast<int64_t>(k) * static_cast<int64_t>(m_Dims[0] * m_Dims[1]) + static_cast<int64_t>(j) * static_cast<int64_t>(m_Dims[0]) + i;
+              n++;
+            }
+          }
+        }
+      }
+
+      // Each axis contributes two bits of state: bit 0 if the cell is on the low face, bit 1 if it is on
+      // the high face. A neighbor is valid unless it steps off a face the cell lies on
+      for(uint32_t state = 0; state < 64; state++)
+      {
+        uint32_t mask = 0;
+        for(size_t neighbor = 0; neighbor < m_Size; neighbor++)
+        {
+          bool valid = true;
+          for(size_t axis = 0; axis < 3; axis++)
+          {
+            uint32_t onFaces = (state >> (2 * axis)) & 3;
+            if((m_Directions[neighbor][axis] < 0 && (onFaces & 1) != 0) || (m_Directions[neighbor][axis] > 0 && (onFaces & 2) != 0))
+            {
+              valid = false;
+            }
+          }
+          if(valid)
+          {
+            mask |= (1u << neighbor);
+          }
+        }
+        m_Masks[state] = mask;
+      }
+    }
+
+    virtual ~GridNeighborhood()
+    {
+    }
+
+    /**
+     * @brief size Returns the number of neighbors, 6, 18 or 26
+     */
+    inline size_t size() const
+    {
+      return m_Size;
+    }
+
+    /**
+     * @brief offset Returns the linear index offset of neighbor n
+     */
+    inline int64_t offset(size_t n) const
+    {
+      return m_Offsets[n];
+    }
+
+    /**
+     * @brief direction Returns the step, -1, 0 or 1, that neighbor n takes along an axis
+     */
+    inline int32_t direction(size_t n, size_t axis) const
+    {
+      return m_Directions[n][axis];
+    }
+
+    /**
+     * @brief getFullMask Returns the mask of a cell that has all of its neighbors
+     */
+    inline uint32_t getFullMask() const
+    {
+      return m_Masks[0];
+    }
+
+    /**
+     * @brief getMask Returns the mask of the neighbors of cell (x, y, z) that lie inside the grid
+     */
+    inline uint32_t getMask(size_t x, size_t y, size_t z) const
+    {
+      return m_Masks[axisState(x, 0) | (axisState(y, 1) << 2) | (axisState(z, 2) << 4)];
+    }
+
+    /**
+     * @brief getRowMasks Returns the masks of the first cell, the interior cells and the last cell of row (y, z).
+     * When the row holds a single cell, first and last are the same mask
+     */
+    inline void getRowMasks(size_t y, size_t z, uint32_t& first, uint32_t& interior, uint32_t& last) const
+    {
+      uint32_t yz = (axisState(y, 1) << 2) | (axisState(z, 2) << 4);
+      uint32_t xLow = 1;
+      uint32_t xHigh = 2;
+      if(m_Dims[0] <= 1)
+      {
+        xLow = 3;
+        xHigh = 3;
+      }
+      first = m_Masks[yz | xLow];
+      interior = m_Masks[yz];
+      last = m_Masks[yz | xHigh];
+    }
+
+    /**
+     * @brief forEachNeighbor Calls func(n, neighborIndex) for every neighbor n of cell index whose bit is set in mask
+     */
+    template <typename Func> inline void forEachNeighbor(int64_t index, uint32_t mask, Func func) const
+    {
+      for(size_t n = 0; n < m_Size; n++)
+      {
+        if((mask & (1u << n)) != 0)
+        {
+          func(n, index + m_Offsets[n]);
+        }
+      }
+    }
+
+    /**
+     * @brief CountNeighbors Returns the number of bits set in mask
+     */
+    static inline size_t CountNeighbors(uint32_t mask)
+    {
+      size_t count = 0;
+      while(mask != 0)
+      {
+        mask &= (mask - 1);
+        count++;
+      }
+      return count;
+    }
+
+  private:
+    size_t m_Dims[3];
+    size_t m_Size;
+    int64_t m_Offsets[26];
+    int32_t m_Directions[26][3];
+    uint32_t m_Masks[64];
+
+    inline uint32_t axisState(size_t coord, size_t axis) const
+    {
+      return (coord == 0 ? 1u : 0u) | (coord + 1 >= m_Dims[axis] ? 2u : 0u);
+    }
+};
+
+#endif /* _gridneighborhood_h_ */
@@ -35,6 +35,8 @@
 
 #include "SIMPLib/Geometry/IGeometry.h"
 
+#include <algorithm>
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -86,22 +88,18 @@ QString IGeometry::getGeometryTypeAsString()
 // -----------------------------------------------------------------------------
 void IGeometry::sendThreadSafeProgressMessage(int64_t counter, int64_t max)
 {
-  m_Mutex.lock();
-
-  m_ProgressCounter += counter;
-
-  int64_t progIncrement = max / 100;
-  int64_t prog = 1;
-
-  if(m_ProgressCounter > prog)
+  if(max <= 0)
+  {
+    return;
+  }
+  int64_t current = m_ProgressCounter.fetch_add(counter) + counter;
+  int64_t previousPercent = std::min(current - counter, max) * 100 / max;
+  int64_t percent = std::min(current, max) * 100 / max;
+  if(percent > previousPercent)
   {
-    int64_t progressInt = static_cast<int64_t>((static_cast<float>(m_ProgressCounter) / max) * 100.0f);
-    QString ss = m_MessageTitle + QObject::tr(" || %1% Complete").arg(progressInt);
+    QString ss = m_MessageTitle + QObject::tr(" || %1% Complete").arg(percent);
     notifyStatusMessage(m_MessagePrefix, m_MessageLabel, ss);
-    prog += progIncrement;
   }
-
-  m_Mutex.unlock();
 }
 
 // -----------------------------------------------------------------------------
@@ -214,3 +212,70 @@ AttributeMatrix::Pointer IGeometry::removeAttributeMatrix(const QString& name)
   m_AttributeMatrices.erase(it);
   return p;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IGeometry::updateElementCentroidsAndSizes(bool centroids, bool sizes)
+{
+  size_t numElems = getNumberOfElements();
+  FloatArrayType::Pointer cachedCentroids = getElementCentroids();
+  FloatArrayType::Pointer cachedSizes = getElementSizes();
+  bool centroidsCurrent = (cachedCentroids.get() != nullptr && cachedCentroids == m_CachedCentroids.lock() && m_CachedCentroidsRevision == m_ElementGeometryRevision &&
+                           cachedCentroids->getNumberOfTuples() == numElems);
+  bool sizesCurrent =
+      (cachedSizes.get() != nullptr && cachedSizes == m_CachedSizes.lock() && m_CachedSizesRevision == m_ElementGeometryRevision && cachedSizes->getNumberOfTuples() == numElems);
+
+  bool findCentroids = centroids && !centroidsCurrent;
+  bool findSizes = sizes && !sizesCurrent;
+  if(!findCentroids && !findSizes)
+  {
+    return 1;
+  }
+
+  int err = findElementMeasures(findCentroids, findSizes);
+  if(err < 0)
+  {
+    return err;
+  }
+  if(findCentroids)
+  {
+    m_CachedCentroids = getElementCentroids();
+    m_CachedCentroidsRevision = m_ElementGeometryRevision;
+  }
+  if(findSizes)
+  {
+    m_CachedSizes = getElementSizes();
+    m_CachedSizesRevision = m_ElementGeometryRevision;
+  }
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::elementGeometryModified()
+{
+  m_ElementGeometryRevision++;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IGeometry::findElementMeasures(bool centroids, bool sizes)
+{
+  int err = 1;
+  if(centroids)
+  {
+    err = findElementCentroids();
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+  if(sizes)
+  {
+    err = findElementSizes();
+  }
+  return err;
+}
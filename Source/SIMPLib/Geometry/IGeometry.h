@@ -36,9 +36,11 @@
 #ifndef _igeometry_h_
 #define _igeometry_h_
 
+#include <atomic>
+#include <memory>
+
 #include <QtCore/QString>
 #include <QtCore/QMap>
-#include <QMutex>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -200,6 +202,25 @@ class SIMPLib_EXPORT IGeometry : public Observable
      */
     virtual void deleteElementCentroids() = 0;
 
+    /**
+     * @brief updateElementCentroidsAndSizes Makes the requested element centroids and sizes available, reusing
+     * the arrays computed by an earlier call while the vertex and element lists have not been modified. Missing
+     * or stale arrays are computed together in a single sweep over the elements
+     * @param centroids
+     * @param sizes
+     * @return
+     */
+    virtual int updateElementCentroidsAndSizes(bool centroids = true, bool sizes = true) final;
+
+    /**
+     * @brief elementGeometryModified Marks the element centroids and sizes cached by updateElementCentroidsAndSizes
+     * as stale. The geometry's vertex and element list setters call this, and so do the non-const getters that hand
+     * out those lists or pointers into them; readers should use the const pointer overloads, which leave the cache
+     * valid. Code that keeps such a list, e.g. a vertex list shared with another geometry, and writes through it
+     * later must call it too
+     */
+    virtual void elementGeometryModified() final;
+
     /**
      * @brief getParametricCenter
      * @param pCoords
@@ -383,11 +404,12 @@ class SIMPLib_EXPORT IGeometry : public Observable
 
     AttributeMatrixMap_t m_AttributeMatrices;
 
-    QMutex m_Mutex;
-    int64_t m_ProgressCounter;
+    std::atomic<int64_t> m_ProgressCounter;
 
     /**
-     * @brief sendThreadSafeProgressMessage
+     * @brief sendThreadSafeProgressMessage Adds counter to the progress without taking a lock. Only the call
+     * that moves the progress to a new percentage emits a message. Parallel algorithms should prefer a
+     * ParallelProgress, which emits from a single reporter thread
      * @param counter
      * @param max
      */
@@ -417,7 +439,23 @@ class SIMPLib_EXPORT IGeometry : public Observable
      */
     virtual void setElementSizes(FloatArrayType::Pointer elementSizes) = 0;
 
+    /**
+     * @brief findElementMeasures Computes the requested element centroids and sizes. The default calls
+     * findElementCentroids and findElementSizes; geometries that can compute both in one pass override it and
+     * route their findElementCentroids and findElementSizes through updateElementCentroidsAndSizes instead
+     * @param centroids
+     * @param sizes
+     * @return
+     */
+    virtual int findElementMeasures(bool centroids, bool sizes);
+
   private:
+    uint64_t m_ElementGeometryRevision = 1;
+    std::weak_ptr<FloatArrayType> m_CachedCentroids;
+    uint64_t m_CachedCentroidsRevision = 0;
+    std::weak_ptr<FloatArrayType> m_CachedSizes;
+    uint64_t m_CachedSizesRevision = 0;
+
     IGeometry(const IGeometry&) = delete;      // Copy Constructor Not Implemented
     void operator=(const IGeometry&) = delete; // Move assignment Not Implemented
 };
@@ -96,6 +96,13 @@ class SIMPLib_EXPORT IGeometry3D : public IGeometry
      */
     virtual float* getVertexPointer(int64_t i) = 0;
 
+    /**
+     * @brief getVertexPointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    virtual const float* getVertexPointer(int64_t i) const = 0;
+
     /**
      * @brief getNumberOfVertices
      * @return
@@ -147,6 +154,13 @@ class SIMPLib_EXPORT IGeometry3D : public IGeometry
      */
     virtual int64_t* getEdgePointer(int64_t i) = 0;
 
+    /**
+     * @brief getEdgePointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    virtual const int64_t* getEdgePointer(int64_t i) const = 0;
+
     /**
      * @brief getNumberOfEdges
      * @return
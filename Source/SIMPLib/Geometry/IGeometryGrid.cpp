@@ -35,6 +35,110 @@
 
 #include "SIMPLib/Geometry/IGeometryGrid.h"
 
+#include <algorithm>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+/**
+ * @brief The GridCoordsImpl class fills the cell center coordinates of a range of grid cells from the
+ * cell centers along each axis. Only the first cell of a range is converted to (x, y, z); the rest of the
+ * range is walked by incrementing x and wrapping into the next row and plane.
+ */
+template <typename T> class GridCoordsImpl
+{
+public:
+  GridCoordsImpl(const std::vector<float>* centers, size_t startIdx, T* coords)
+  : m_Centers(centers)
+  , m_StartIdx(startIdx)
+  , m_Coords(coords)
+  {
+  }
+  virtual ~GridCoordsImpl()
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    if(start >= end)
+    {
+      return;
+    }
+    const float* xCenters = m_Centers[0].data();
+    const float* yCenters = m_Centers[1].data();
+    const float* zCenters = m_Centers[2].data();
+    size_t xDim = m_Centers[0].size();
+    size_t yDim = m_Centers[1].size();
+
+    size_t x = start % xDim;
+    size_t y = (start / xDim) % yDim;
+    size_t z = start / (xDim * yDim);
+    T* coords = m_Coords + 3 * (start - m_StartIdx);
+    for(size_t i = start; i < end; i++)
+    {
+      coords[0] = static_cast<T>(xCenters[x]);
+      coords[1] = static_cast<T>(yCenters[y]);
+      coords[2] = static_cast<T>(zCenters[z]);
+      coords += 3;
+      if(++x == xDim)
+      {
+        x = 0;
+        if(++y == yDim)
+        {
+          y = 0;
+          z++;
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const std::vector<float>* m_Centers;
+  size_t m_StartIdx;
+  T* m_Coords;
+};
+
+namespace
+{
+template <typename T> void GetGridCoordsRange(const std::vector<float> centers[3], size_t startIdx, size_t endIdx, T* coords)
+{
+  size_t numCells = centers[0].size() * centers[1].size() * centers[2].size();
+  endIdx = std::min(endIdx, numCells);
+  if(startIdx >= endIdx)
+  {
+    return;
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(startIdx, endIdx, 4096), GridCoordsImpl<T>(centers, startIdx, coords), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    GridCoordsImpl<T> serial(centers, startIdx, coords);
+    serial.compute(startIdx, endIdx);
+  }
+}
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -47,3 +151,29 @@ IGeometryGrid::IGeometryGrid()
 //
 // -----------------------------------------------------------------------------
 IGeometryGrid::~IGeometryGrid() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometryGrid::getCoordsRange(size_t startIdx, size_t endIdx, float* coords)
+{
+  std::vector<float> centers[3];
+  for(size_t axis = 0; axis < 3; axis++)
+  {
+    getCellCenters(axis, centers[axis]);
+  }
+  GetGridCoordsRange<float>(centers, startIdx, endIdx, coords);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometryGrid::getCoordsRange(size_t startIdx, size_t endIdx, double* coords)
+{
+  std::vector<float> centers[3];
+  for(size_t axis = 0; axis < 3; axis++)
+  {
+    getCellCenters(axis, centers[axis]);
+  }
+  GetGridCoordsRange<double>(centers, startIdx, endIdx, coords);
+}
@@ -37,6 +37,7 @@
 #define _igeometrygrid_h_
 
 #include <tuple>
+#include <vector>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Geometry/IGeometry.h"
@@ -86,6 +87,35 @@ class SIMPLib_EXPORT IGeometryGrid : public IGeometry
     virtual void getCoords(size_t x, size_t y, size_t z, double coords[3]) = 0;
     virtual void getCoords(size_t idx, double coords[3]) = 0;
 
+    /**
+     * @brief getCoordsRange Writes the cell center coordinates of cells [startIdx, endIdx) to coords, which
+     * must hold 3 * (endIdx - startIdx) values. The cells are walked row by row from per axis tables of
+     * cell centers, so no division or modulo is done per cell, and large ranges are split across threads
+     * @param startIdx
+     * @param endIdx
+     * @param coords
+     */
+    void getCoordsRange(size_t startIdx, size_t endIdx, float* coords);
+    void getCoordsRange(size_t startIdx, size_t endIdx, double* coords);
+
+    /**
+     * @brief computeCellIndices Finds the cell that contains each of numPoints points. A point on the
+     * upper boundary of the grid belongs to the last cell.
+     * @param coords The point coordinates, 3 values per point
+     * @param numPoints
+     * @param indices The returned index into a cell array for each point, or -1 if the point is outside the grid
+     * @return The number of points inside the grid
+     */
+    virtual size_t computeCellIndices(const float* coords, size_t numPoints, int64_t* indices) = 0;
+
+  protected:
+    /**
+     * @brief getCellCenters Returns the coordinates of the cell centers along one axis
+     * @param axis 0, 1 or 2
+     * @param centers
+     */
+    virtual void getCellCenters(size_t axis, std::vector<float>& centers) = 0;
+
   private:
     IGeometryGrid(const IGeometryGrid&) = delete;  // Copy Constructor Not Implemented
     void operator=(const IGeometryGrid&) = delete; // Move assignment Not Implemented
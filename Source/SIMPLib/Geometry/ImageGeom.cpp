@@ -45,7 +45,10 @@
 
 #include "SIMPLib/Geometry/ImageGeom.h"
 
+#include <algorithm>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
 #include <tbb/blocked_range3d.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
@@ -53,21 +56,43 @@
 #endif
 
 #include "H5Support/H5Lite.h"
+#include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
+#include "SIMPLib/Utilities/ParallelProgress.h"
 
 /**
  * @brief The FindImageDerivativesImpl class implements a threaded algorithm that computes the
- * derivative of an arbitrary dimensional field on the underlying image
+ * derivative of an arbitrary dimensional field on the underlying image. The image is axis aligned
+ * with uniform spacing, so the Jacobian is diagonal and each derivative reduces to a scaled finite
+ * difference. The two boundary voxels of each row use one sided differences, while the interior of
+ * the row uses a fixed centered stencil that the compiler can vectorize. The field is read in its
+ * native type and the derivatives are written as float or double.
  */
-class FindImageDerivativesImpl
+template <typename T, typename K> class FindImageDerivativesImpl
 {
 public:
-  FindImageDerivativesImpl(ImageGeom* image, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs)
+  FindImageDerivativesImpl(ImageGeom* image, typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivs, ParallelProgress* progress)
   : m_Image(image)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_Progress(progress)
   {
+    std::tie(m_Dims[0], m_Dims[1], m_Dims[2]) = m_Image->getDimensions();
+    float res[3] = {0.0f, 0.0f, 0.0f};
+    std::tie(res[0], res[1], res[2]) = m_Image->getResolution();
+
+    // A flat direction contributes a unit Jacobian entry. A singular Jacobian yields a zero derivative
+    double jacobian[3] = {0.0, 0.0, 0.0};
+    for(size_t i = 0; i < 3; i++)
+    {
+      jacobian[i] = (m_Dims[i] == 1) ? 1.0 : static_cast<double>(res[i]);
+    }
+    bool singular = (jacobian[0] * jacobian[1] * jacobian[2] == 0.0);
+    for(size_t i = 0; i < 3; i++)
+    {
+      m_InvSpacing[i] = singular ? 0.0 : 1.0 / jacobian[i];
+    }
   }
   virtual ~FindImageDerivativesImpl()
   {
@@ -75,158 +100,17 @@ public:
 
   void compute(size_t zStart, size_t zEnd, size_t yStart, size_t yEnd, size_t xStart, size_t xEnd) const
   {
-    double xp[3] = {0.0, 0.0, 0.0};
-    double xm[3] = {0.0, 0.0, 0.0};
-    double factor = 0.0;
-    double xxi, yxi, zxi, xeta, yeta, zeta, xzeta, yzeta, zzeta;
-    xxi = yxi = zxi = xeta = yeta = zeta = xzeta = yzeta = zzeta = 0;
-    double aj, xix, xiy, xiz, etax, etay, etaz, zetax, zetay, zetaz;
-    aj = xix = xiy = xiz = etax = etay = etaz = zetax = zetay = zetaz = 0;
-    size_t index = 0;
-    int32_t numComps = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
-    std::vector<double> plusValues(numComps);
-    std::vector<double> minusValues(numComps);
-    std::vector<double> dValuesdXi(numComps);
-    std::vector<double> dValuesdEta(numComps);
-    std::vector<double> dValuesdZeta(numComps);
-
-    size_t dims[3] = {0, 0, 0};
-    std::tie(dims[0], dims[1], dims[2]) = m_Image->getDimensions();
-
-    int64_t counter = 0;
-    size_t totalElements = m_Image->getNumberOfElements();
-    int64_t progIncrement = static_cast<int64_t>(totalElements / 100);
-
-    for(size_t z = zStart; z < zEnd; z++)
+    switch(m_Field->getNumberOfComponents())
     {
-      for(size_t y = yStart; y < yEnd; y++)
-      {
-        for(size_t x = xStart; x < xEnd; x++)
-        {
-          //  Xi derivatives (X)
-          if(dims[0] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(x == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(x == (dims[0] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, XDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xxi = factor * (xp[0] - xm[0]);
-          yxi = factor * (xp[1] - xm[1]);
-          zxi = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdXi[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          //  Eta derivatives (Y)
-          if(dims[1] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(y == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(y == (dims[1] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, YDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xeta = factor * (xp[0] - xm[0]);
-          yeta = factor * (xp[1] - xm[1]);
-          zeta = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdEta[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          //  Zeta derivatives (Z)
-          if(dims[2] == 1)
-          {
-            findValuesForFiniteDifference(TwoDimensional, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(z == 0)
-          {
-            findValuesForFiniteDifference(LeftSide, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else if(z == (dims[2] - 1))
-          {
-            findValuesForFiniteDifference(RightSide, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-          else
-          {
-            findValuesForFiniteDifference(Centered, ZDirection, x, y, z, dims, xp, xm, factor, numComps, plusValues, minusValues, fieldPtr);
-          }
-
-          xzeta = factor * (xp[0] - xm[0]);
-          yzeta = factor * (xp[1] - xm[1]);
-          zzeta = factor * (xp[2] - xm[2]);
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            dValuesdZeta[i] = factor * (plusValues[i] - minusValues[i]);
-          }
-
-          // Now calculate the Jacobian.  Grids occasionally have
-          // singularities, or points where the Jacobian is infinite (the
-          // inverse is zero).  For these cases, we'll set the Jacobian to
-          // zero, which will result in a zero derivative.
-          aj = xxi * yeta * zzeta + yxi * zeta * xzeta + zxi * xeta * yzeta - zxi * yeta * xzeta - yxi * xeta * zzeta - xxi * zeta * yzeta;
-          if(aj != 0.0)
-          {
-            aj = 1.0 / aj;
-          }
-
-          //  Xi metrics
-          xix = aj * (yeta * zzeta - zeta * yzeta);
-          xiy = -aj * (xeta * zzeta - zeta * xzeta);
-          xiz = aj * (xeta * yzeta - yeta * xzeta);
-
-          //  Eta metrics
-          etax = -aj * (yxi * zzeta - zxi * yzeta);
-          etay = aj * (xxi * zzeta - zxi * xzeta);
-          etaz = -aj * (xxi * yzeta - yxi * xzeta);
-
-          //  Zeta metrics
-          zetax = aj * (yxi * zeta - zxi * yeta);
-          zetay = -aj * (xxi * zeta - zxi * xeta);
-          zetaz = aj * (xxi * yeta - yxi * xeta);
-
-          // Compute the actual derivatives
-          index = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-          for(int32_t i = 0; i < numComps; i++)
-          {
-            derivsPtr[index * numComps * 3 + i * 3] = xix * dValuesdXi[i] + etax * dValuesdEta[i] + zetax * dValuesdZeta[i];
-
-            derivsPtr[index * numComps * 3 + i * 3 + 1] = xiy * dValuesdXi[i] + etay * dValuesdEta[i] + zetay * dValuesdZeta[i];
-
-            derivsPtr[index * numComps * 3 + i * 3 + 2] = xiz * dValuesdXi[i] + etaz * dValuesdEta[i] + zetaz * dValuesdZeta[i];
-          }
-
-          if(counter > progIncrement)
-          {
-            m_Image->sendThreadSafeProgressMessage(counter, totalElements);
-            counter = 0;
-          }
-          counter++;
-        }
-      }
+    case 1:
+      computeRange<1>(zStart, zEnd, yStart, yEnd, xStart, xEnd);
+      break;
+    case 3:
+      computeRange<3>(zStart, zEnd, yStart, yEnd, xStart, xEnd);
+      break;
+    default:
+      computeRange<0>(zStart, zEnd, yStart, yEnd, xStart, xEnd);
+      break;
     }
   }
 
@@ -237,163 +121,175 @@ public:
   }
 #endif
 
-  void computeIndices(int32_t differenceType, int32_t directionType, size_t& index1, size_t& index2, size_t dims[3], size_t x, size_t y, size_t z, double xp[3], double xm[3]) const
-
+private:
+  ImageGeom* m_Image;
+  typename DataArray<T>::Pointer m_Field;
+  typename DataArray<K>::Pointer m_Derivatives;
+  ParallelProgress* m_Progress;
+  size_t m_Dims[3] = {0, 0, 0};
+  double m_InvSpacing[3] = {0.0, 0.0, 0.0};
+
+  /**
+   * @brief The Stencil struct holds the voxel offsets of the plus and minus neighbors in one
+   * direction together with the finite difference scale
+   */
+  struct Stencil
   {
-    size_t tmpIndex1 = 0;
-    size_t tmpIndex2 = 0;
+    size_t plus;
+    size_t minus;
+    double scale;
+  };
 
-    switch(directionType)
+  Stencil stencilAt(size_t direction, size_t position) const
+  {
+    size_t stride = 1;
+    for(size_t i = 0; i < direction; i++)
     {
-    case XDirection:
+      stride *= m_Dims[i];
+    }
+
+    Stencil stencil = {0, 0, 0.0};
+    if(m_Dims[direction] == 1)
     {
-      if(differenceType == LeftSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x + 1);
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = x + 1;
-        m_Image->getCoords(tmpIndex1, y, z, xp);
-        m_Image->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x - 1);
-        tmpIndex1 = x - 1;
-        m_Image->getCoords(x, y, z, xp);
-        m_Image->getCoords(tmpIndex1, y, z, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x + 1);
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + (x - 1);
-        tmpIndex1 = x + 1;
-        tmpIndex2 = x - 1;
-        m_Image->getCoords(tmpIndex1, y, z, xp);
-        m_Image->getCoords(tmpIndex2, y, z, xm);
-      }
-      break;
+      return stencil;
     }
-    case YDirection:
+    if(position == 0)
     {
-      if(differenceType == LeftSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + ((y + 1) * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = y + 1;
-        m_Image->getCoords(x, tmpIndex1, z, xp);
-        m_Image->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + ((y - 1) * dims[0]) + x;
-        tmpIndex1 = y - 1;
-        m_Image->getCoords(x, y, z, xp);
-        m_Image->getCoords(x, tmpIndex1, z, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = (z * dims[1] * dims[0]) + ((y + 1) * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + ((y - 1) * dims[0]) + x;
-        tmpIndex1 = y + 1;
-        tmpIndex2 = y - 1;
-        m_Image->getCoords(x, tmpIndex1, z, xp);
-        m_Image->getCoords(x, tmpIndex2, z, xm);
-      }
-      break;
+      stencil.plus = stride;
+      stencil.scale = m_InvSpacing[direction];
     }
-    case ZDirection:
+    else if(position == m_Dims[direction] - 1)
     {
-      if(differenceType == LeftSide)
-      {
-        index1 = ((z + 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z + 1;
-        m_Image->getCoords(x, y, tmpIndex1, xp);
-        m_Image->getCoords(x, y, z, xm);
-      }
-      else if(differenceType == RightSide)
-      {
-        index1 = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = ((z - 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z - 1;
-        m_Image->getCoords(x, y, z, xp);
-        m_Image->getCoords(x, y, tmpIndex1, xm);
-      }
-      else if(differenceType == Centered)
-      {
-        index1 = ((z + 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        index2 = ((z - 1) * dims[1] * dims[0]) + (y * dims[0]) + x;
-        tmpIndex1 = z + 1;
-        tmpIndex2 = z - 1;
-        m_Image->getCoords(x, y, tmpIndex1, xp);
-        m_Image->getCoords(x, y, tmpIndex2, xm);
-      }
-      break;
+      stencil.minus = stride;
+      stencil.scale = m_InvSpacing[direction];
     }
-    default:
+    else
     {
-      break;
+      stencil.plus = stride;
+      stencil.minus = stride;
+      stencil.scale = 0.5 * m_InvSpacing[direction];
     }
+    return stencil;
+  }
+
+  template <int32_t NumComps>
+  inline void computeVoxel(const T* fieldPtr, K* derivsPtr, int32_t numComps, size_t index, const Stencil& xs, const Stencil& ys, const Stencil& zs) const
+  {
+    const size_t comps = NumComps > 0 ? static_cast<size_t>(NumComps) : static_cast<size_t>(numComps);
+    K* out = derivsPtr + index * comps * 3;
+    for(size_t i = 0; i < comps; i++)
+    {
+      out[i * 3] = static_cast<K>(xs.scale * (static_cast<double>(fieldPtr[(index + xs.plus) * comps + i]) - static_cast<double>(fieldPtr[(index - xs.minus) * comps + i])));
+      out[i * 3 + 1] = static_cast<K>(ys.scale * (static_cast<double>(fieldPtr[(index + ys.plus) * comps + i]) - static_cast<double>(fieldPtr[(index - ys.minus) * comps + i])));
+      out[i * 3 + 2] = static_cast<K>(zs.scale * (static_cast<double>(fieldPtr[(index + zs.plus) * comps + i]) - static_cast<double>(fieldPtr[(index - zs.minus) * comps + i])));
     }
   }
 
-  void findValuesForFiniteDifference(int32_t differenceType, int32_t directionType, size_t x, size_t y, size_t z, size_t dims[3], double xp[3], double xm[3], double& factor, int32_t numComps,
-                                     std::vector<double>& plusValues, std::vector<double>& minusValues, double* field) const
+  template <int32_t NumComps> void computeRange(size_t zStart, size_t zEnd, size_t yStart, size_t yEnd, size_t xStart, size_t xEnd) const
   {
-    size_t index1 = 0;
-    size_t index2 = 0;
+    int32_t numComps = m_Field->getNumberOfComponents();
+    const T* fieldPtr = m_Field->getPointer(0);
+    K* derivsPtr = m_Derivatives->getPointer(0);
 
-    factor = 1.0;
+    // Interior voxels of a row always use the centered stencil in X
+    const Stencil interiorX = {1, 1, 0.5 * m_InvSpacing[0]};
+    const size_t interiorEnd = (m_Dims[0] > 1) ? std::min(xEnd, m_Dims[0] - 1) : 0;
 
-    if(differenceType == TwoDimensional)
+    int64_t counter = 0;
+    int64_t totalElements = static_cast<int64_t>(m_Image->getNumberOfElements());
+    int64_t progIncrement = totalElements / 100;
+
+    for(size_t z = zStart; z < zEnd; z++)
     {
-      for(size_t i = 0; i < 3; i++)
-      {
-        xp[i] = xm[i] = 0.0;
-      }
-      xp[directionType] = 1.0;
-      for(int32_t i = 0; i < numComps; i++)
+      const Stencil zs = stencilAt(2, z);
+      for(size_t y = yStart; y < yEnd; y++)
       {
-        plusValues[i] = minusValues[i] = 0.0;
+        const Stencil ys = stencilAt(1, y);
+        const size_t rowStart = (z * m_Dims[1] + y) * m_Dims[0];
+
+        size_t x = xStart;
+        for(; x < xEnd && x < 1; x++)
+        {
+          computeVoxel<NumComps>(fieldPtr, derivsPtr, numComps, rowStart + x, stencilAt(0, x), ys, zs);
+        }
+        for(; x < interiorEnd; x++)
+        {
+          computeVoxel<NumComps>(fieldPtr, derivsPtr, numComps, rowStart + x, interiorX, ys, zs);
+        }
+        for(; x < xEnd; x++)
+        {
+          computeVoxel<NumComps>(fieldPtr, derivsPtr, numComps, rowStart + x, stencilAt(0, x), ys, zs);
+        }
+
+        counter += static_cast<int64_t>(xEnd - xStart);
+        if(counter > progIncrement)
+        {
+          m_Progress->increment(counter);
+          counter = 0;
+          if(m_Progress->wasCanceled())
+          {
+            return;
+          }
+        }
       }
     }
-    else
+    m_Progress->increment(counter);
+  }
+};
+
+/**
+ * @brief The ComputeImageCellIndicesImpl class finds the voxels that contain a list of points
+ */
+class ComputeImageCellIndicesImpl
+{
+public:
+  ComputeImageCellIndicesImpl(ImageGeom* image, const float* coords, int64_t* indices)
+  : m_Coords(coords)
+  , m_Indices(indices)
+  {
+    std::tie(m_Dims[0], m_Dims[1], m_Dims[2]) = image->getDimensions();
+    std::tie(m_Resolution[0], m_Resolution[1], m_Resolution[2]) = image->getResolution();
+    std::tie(m_Origin[0], m_Origin[1], m_Origin[2]) = image->getOrigin();
+  }
+  virtual ~ComputeImageCellIndicesImpl()
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t p = start; p < end; p++)
     {
-      computeIndices(differenceType, directionType, index1, index2, dims, x, y, z, xp, xm);
-      for(int32_t i = 0; i < numComps; i++)
+      const float* coords = m_Coords + 3 * p;
+      int64_t cell[3] = {0, 0, 0};
+      bool inside = true;
+      for(size_t i = 0; i < 3; i++)
       {
-        plusValues[i] = field[index1 * numComps + i];
-        minusValues[i] = field[index2 * numComps + i];
+        // Written so that NaN coordinates are outside
+        if(!(coords[i] >= m_Origin[i] && coords[i] <= (m_Origin[i] + m_Dims[i] * m_Resolution[i])) || m_Dims[i] == 0)
+        {
+          inside = false;
+          break;
+        }
+        size_t index = static_cast<size_t>((coords[i] - m_Origin[i]) / m_Resolution[i]);
+        cell[i] = static_cast<int64_t>(std::min(index, m_Dims[i] - 1));
       }
-    }
-
-    if(differenceType == Centered)
-    {
-      factor = 0.5;
+      m_Indices[p] = inside ? (cell[2] * static_cast<int64_t>(m_Dims[1]) + cell[1]) * static_cast<int64_t>(m_Dims[0]) + cell[0] : -1;
     }
   }
 
-private:
-  ImageGeom* m_Image;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
-
-  enum FiniteDifferenceType_t
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
   {
-    TwoDimensional = 0,
-    LeftSide,
-    RightSide,
-    Centered
-  };
+    compute(r.begin(), r.end());
+  }
+#endif
 
-  enum DirectionType_t
-  {
-    XDirection = 0,
-    YDirection,
-    ZDirection
-  };
+private:
+  const float* m_Coords;
+  int64_t* m_Indices;
+  size_t m_Dims[3];
+  float m_Resolution[3];
+  float m_Origin[3];
 };
 
 // -----------------------------------------------------------------------------
@@ -419,6 +315,8 @@ ImageGeom::ImageGeom()
   m_Origin[1] = 0.0f;
   m_Origin[2] = 0.0f;
   m_VoxelSizes = FloatArrayType::NullPointer();
+  m_VoxelCentroids = FloatArrayType::NullPointer();
+  m_VoxelNeighbors = ElementDynamicList::NullPointer();
   m_ProgressCounter = 0;
 }
 
@@ -629,6 +527,140 @@ void ImageGeom::getCoords(size_t idx, double coords[3])
   coords[2] = static_cast<double>(plane * m_Resolution[2] + m_Origin[2] + (0.5f * m_Resolution[2]));
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ImageGeom::computeCellIndices(const float* coords, size_t numPoints, int64_t* indices)
+{
+  if(numPoints == 0)
+  {
+    return 0;
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints, 4096), ComputeImageCellIndicesImpl(this, coords, indices), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ComputeImageCellIndicesImpl serial(this, coords, indices);
+    serial.compute(0, numPoints);
+  }
+
+  return static_cast<size_t>(std::count_if(indices, indices + numPoints, [](int64_t index) { return index >= 0; }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::getCellCenters(size_t axis, std::vector<float>& centers)
+{
+  centers.resize(m_Dimensions[axis]);
+  for(size_t i = 0; i < m_Dimensions[axis]; i++)
+  {
+    centers[i] = i * m_Resolution[axis] + m_Origin[axis] + (0.5f * m_Resolution[axis]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::setDimensions(size_t value[3])
+{
+  setDimensions(value[0], value[1], value[2]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::setDimensions(size_t value_0, size_t value_1, size_t value_2)
+{
+  m_Dimensions[0] = value_0;
+  m_Dimensions[1] = value_1;
+  m_Dimensions[2] = value_2;
+  gridModified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::setDimensions(const std::tuple<size_t, size_t, size_t>& var)
+{
+  setDimensions(std::get<0>(var), std::get<1>(var), std::get<2>(var));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::setResolution(float value[3])
+{
+  setResolution(value[0], value[1], value[2]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::setResolution(float value_0, float value_1, float value_2)
+{
+  m_Resolution[0] = value_0;
+  m_Resolution[1] = value_1;
+  m_Resolution[2] = value_2;
+  gridModified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::setResolution(const std::tuple<float, float, float>& var)
+{
+  setResolution(std::get<0>(var), std::get<1>(var), std::get<2>(var));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::setOrigin(float value[3])
+{
+  setOrigin(value[0], value[1], value[2]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::setOrigin(float value_0, float value_1, float value_2)
+{
+  m_Origin[0] = value_0;
+  m_Origin[1] = value_1;
+  m_Origin[2] = value_2;
+  gridModified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::setOrigin(const std::tuple<float, float, float>& var)
+{
+  setOrigin(std::get<0>(var), std::get<1>(var), std::get<2>(var));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeom::gridModified()
+{
+  m_VoxelSizes = FloatArrayType::NullPointer();
+  m_VoxelCentroids = FloatArrayType::NullPointer();
+  m_VoxelNeighbors = ElementDynamicList::NullPointer();
+  elementGeometryModified();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -640,6 +672,7 @@ void ImageGeom::initializeWithZeros()
     m_Resolution[i] = 1.0f;
     m_Origin[i] = 0.0f;
   }
+  gridModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -708,7 +741,15 @@ void ImageGeom::deleteElementsContainingVert()
 // -----------------------------------------------------------------------------
 int ImageGeom::findElementNeighbors()
 {
-  return -1;
+  size_t dims[3] = {0, 0, 0};
+  std::tie(dims[0], dims[1], dims[2]) = getDimensions();
+  m_VoxelNeighbors = ElementDynamicList::New();
+  int err = GeometryHelpers::Connectivity::FindGridElementNeighbors<uint16_t, int64_t>(dims, m_VoxelNeighbors);
+  if(err < 0)
+  {
+    m_VoxelNeighbors = ElementDynamicList::NullPointer();
+  }
+  return err;
 }
 
 // -----------------------------------------------------------------------------
@@ -716,15 +757,15 @@ int ImageGeom::findElementNeighbors()
 // -----------------------------------------------------------------------------
 ElementDynamicList::Pointer ImageGeom::getElementNeighbors()
 {
-  return ElementDynamicList::NullPointer();
+  return m_VoxelNeighbors;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ImageGeom::setElementNeighbors(ElementDynamicList::Pointer SIMPL_NOT_USED(elementNeighbors))
+void ImageGeom::setElementNeighbors(ElementDynamicList::Pointer elementNeighbors)
 {
-  return;
+  m_VoxelNeighbors = elementNeighbors;
 }
 
 // -----------------------------------------------------------------------------
@@ -732,7 +773,7 @@ void ImageGeom::setElementNeighbors(ElementDynamicList::Pointer SIMPL_NOT_USED(e
 // -----------------------------------------------------------------------------
 void ImageGeom::deleteElementNeighbors()
 {
-  return;
+  m_VoxelNeighbors = ElementDynamicList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -740,7 +781,15 @@ void ImageGeom::deleteElementNeighbors()
 // -----------------------------------------------------------------------------
 int ImageGeom::findElementCentroids()
 {
-  return -1;
+  size_t numElems = getNumberOfElements();
+  if(numElems == 0)
+  {
+    return -1;
+  }
+  QVector<size_t> cDims(1, 3);
+  m_VoxelCentroids = FloatArrayType::CreateArray(numElems, cDims, SIMPL::StringConstants::VoxelCentroids);
+  getCoordsRange(0, numElems, m_VoxelCentroids->getPointer(0));
+  return 1;
 }
 
 // -----------------------------------------------------------------------------
@@ -748,15 +797,15 @@ int ImageGeom::findElementCentroids()
 // -----------------------------------------------------------------------------
 FloatArrayType::Pointer ImageGeom::getElementCentroids()
 {
-  return FloatArrayType::NullPointer();
+  return m_VoxelCentroids;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ImageGeom::setElementCentroids(FloatArrayType::Pointer SIMPL_NOT_USED(elementsCentroids))
+void ImageGeom::setElementCentroids(FloatArrayType::Pointer elementCentroids)
 {
-  return;
+  m_VoxelCentroids = elementCentroids;
 }
 
 // -----------------------------------------------------------------------------
@@ -764,7 +813,7 @@ void ImageGeom::setElementCentroids(FloatArrayType::Pointer SIMPL_NOT_USED(eleme
 // -----------------------------------------------------------------------------
 void ImageGeom::deleteElementCentroids()
 {
-  return;
+  m_VoxelCentroids = FloatArrayType::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -866,6 +915,14 @@ void ImageGeom::getShapeFunctions(double pCoords[3], double* shape)
 //
 // -----------------------------------------------------------------------------
 void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives<double, double>(field, derivatives, observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void ImageGeom::findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   size_t dims[3] = {0, 0, 0};
@@ -876,6 +933,8 @@ void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType:
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
 
+  ParallelProgress progress(this, static_cast<int64_t>(getNumberOfElements()), m_MessagePrefix, m_MessageLabel, m_MessageTitle, observable);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
   bool doParallel = true;
@@ -893,16 +952,18 @@ void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType:
   if(doParallel == true)
   {
     tbb::parallel_for(tbb::blocked_range3d<size_t, size_t, size_t>(0, dims[2], grain, 0, dims[1], dims[1], 0, dims[0], dims[0]),
-                      FindImageDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+                      FindImageDerivativesImpl<T, K>(this, field, derivatives, &progress), tbb::auto_partitioner());
   }
   else
 #endif
   {
-    FindImageDerivativesImpl serial(this, field, derivatives);
+    FindImageDerivativesImpl<T, K> serial(this, field, derivatives, &progress);
     serial.compute(0, dims[2], 0, dims[1], 0, dims[0]);
   }
 }
 
+SIMPL_INSTANTIATE_DERIVATIVES(ImageGeom, findDerivatives)
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1067,6 +1128,10 @@ IGeometry::Pointer ImageGeom::deepCopy(bool forceNoAllocate)
   imageCopy->setOrigin(origin);
   FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
   imageCopy->setElementSizes(elementSizes);
+  FloatArrayType::Pointer elementCentroids = std::dynamic_pointer_cast<FloatArrayType>((getElementCentroids().get() == nullptr) ? nullptr : getElementCentroids()->deepCopy(forceNoAllocate));
+  imageCopy->setElementCentroids(elementCentroids);
+  ElementDynamicList::Pointer elementNeighbors = std::dynamic_pointer_cast<ElementDynamicList>((getElementNeighbors().get() == nullptr) ? nullptr : getElementNeighbors()->deepCopy(forceNoAllocate));
+  imageCopy->setElementNeighbors(elementNeighbors);
   imageCopy->setSpatialDimensionality(getSpatialDimensionality());
 
   return imageCopy;
@@ -75,12 +75,18 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
     /**
     * @brief Sets/Gets the Resolution property
     */
-    SIMPL_INSTANCE_VEC3_PROPERTY(float, Resolution)
+    void setResolution(float value[3]);
+    void setResolution(float value_0, float value_1, float value_2);
+    void setResolution(const std::tuple<float, float, float>& var);
+    SIMPL_GET_VEC3_PROPERTY(float, Resolution, m_Resolution)
 
     /**
     * @brief Sets/Gets the Origin property
     */
-    SIMPL_INSTANCE_VEC3_PROPERTY(float, Origin)
+    void setOrigin(float value[3]);
+    void setOrigin(float value_0, float value_1, float value_2);
+    void setOrigin(const std::tuple<float, float, float>& var);
+    SIMPL_GET_VEC3_PROPERTY(float, Origin, m_Origin)
 
     /**
      * @brief Returns the bounding box for this geometry
@@ -151,7 +157,8 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
     virtual void deleteElementsContainingVert() override;
 
     /**
-     * @brief findElementNeighbors
+     * @brief findElementNeighbors Lists the face neighbors of every voxel. Filters that only walk the
+     * neighbors should use a GridNeighborhood instead, which needs no storage
      * @return
      */
     virtual int findElementNeighbors() override;
@@ -168,7 +175,7 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
     virtual void deleteElementNeighbors() override;
 
     /**
-     * @brief findElementCentroids
+     * @brief findElementCentroids Computes and caches the voxel centers, in parallel
      * @return
      */
     virtual int findElementCentroids() override;
@@ -204,6 +211,14 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
      */
     virtual void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr) override;
 
+    /**
+     * @brief findDerivatives Computes the derivatives of a cell field in its native type
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -251,7 +266,10 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
 // Inherited from IGeometryGrid
 // -----------------------------------------------------------------------------
     
-    SIMPL_INSTANCE_VEC3_PROPERTY_VO(size_t, Dimensions)
+    void setDimensions(size_t value[3]) override;
+    void setDimensions(size_t value_0, size_t value_1, size_t value_2) override;
+    void setDimensions(const std::tuple<size_t, size_t, size_t>& var) override;
+    SIMPL_GET_VEC3_PROPERTY_VO(size_t, Dimensions, m_Dimensions)
 
     size_t getXPoints() override;
     size_t getYPoints() override;
@@ -273,6 +291,16 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
     virtual void getCoords(size_t x, size_t y, size_t z, double coords[3]) override;
     virtual void getCoords(size_t idx, double coords[3]) override;
 
+    /**
+     * @brief computeCellIndices Finds the cell that contains each of numPoints points, following the
+     * bounds checks of computeCellIndex. The points are processed in parallel
+     * @param coords The point coordinates, 3 values per point
+     * @param numPoints
+     * @param indices The returned index into a cell array for each point, or -1 if the point is outside the image
+     * @return The number of points inside the image
+     */
+    virtual size_t computeCellIndices(const float* coords, size_t numPoints, int64_t* indices) override;
+
     // -----------------------------------------------------------------------------
     // Misc. ImageGeometry Methods
     // -----------------------------------------------------------------------------
@@ -365,10 +393,28 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
      */
     virtual void setElementSizes(FloatArrayType::Pointer elementSizes) override;
 
+    /**
+     * @brief getCellCenters
+     * @param axis
+     * @param centers
+     */
+    virtual void getCellCenters(size_t axis, std::vector<float>& centers) override;
+
   private:
+    size_t m_Dimensions[3];
+    float m_Resolution[3];
+    float m_Origin[3];
     FloatArrayType::Pointer m_VoxelSizes;
+    FloatArrayType::Pointer m_VoxelCentroids;
+    ElementDynamicList::Pointer m_VoxelNeighbors;
+
+    /**
+     * @brief gridModified Drops the voxel sizes, centroids and neighbors computed for the old dimensions,
+     * resolution or origin
+     */
+    void gridModified();
 
-    friend class FindImageDerivativesImpl;
+    template <typename T, typename K> friend class FindImageDerivativesImpl;
 
     ImageGeom(const ImageGeom&) = delete;      // Copy Constructor Not Implemented
     void operator=(const ImageGeom&) = delete; // Move assignment Not Implemented
@@ -0,0 +1,449 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/Geometry/MeshReorderer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+namespace
+{
+const uint32_t k_CurveBits = 21;
+
+// -----------------------------------------------------------------------------
+// Spreads the low 21 bits of a value so that two zero bits follow each of them
+// -----------------------------------------------------------------------------
+uint64_t SpreadBits(uint32_t value)
+{
+  uint64_t x = value & 0x1fffff;
+  x = (x | x << 32) & 0x1f00000000ffffULL;
+  x = (x | x << 16) & 0x1f0000ff0000ffULL;
+  x = (x | x << 8) & 0x100f00f00f00f00fULL;
+  x = (x | x << 4) & 0x10c30c30c30c30c3ULL;
+  x = (x | x << 2) & 0x1249249249249249ULL;
+  return x;
+}
+
+// -----------------------------------------------------------------------------
+// Interleaves the bits of three coordinates, the first one being the most significant
+// -----------------------------------------------------------------------------
+uint64_t InterleaveBits(const uint32_t coords[3])
+{
+  return (SpreadBits(coords[0]) << 2) | (SpreadBits(coords[1]) << 1) | SpreadBits(coords[2]);
+}
+
+// -----------------------------------------------------------------------------
+// Turns grid coordinates into the transposed Hilbert index (J. Skilling, "Programming the Hilbert curve", 2004)
+// -----------------------------------------------------------------------------
+void AxesToTranspose(uint32_t coords[3])
+{
+  const uint32_t highBit = 1u << (k_CurveBits - 1);
+  for(uint32_t q = highBit; q > 1; q >>= 1)
+  {
+    uint32_t p = q - 1;
+    for(size_t i = 0; i < 3; i++)
+    {
+      if(coords[i] & q)
+      {
+        coords[0] ^= p;
+      }
+      else
+      {
+        uint32_t t = (coords[0] ^ coords[i]) & p;
+        coords[0] ^= t;
+        coords[i] ^= t;
+      }
+    }
+  }
+  coords[1] ^= coords[0];
+  coords[2] ^= coords[1];
+  uint32_t t = 0;
+  for(uint32_t q = highBit; q > 1; q >>= 1)
+  {
+    if(coords[2] & q)
+    {
+      t ^= q - 1;
+    }
+  }
+  for(size_t i = 0; i < 3; i++)
+  {
+    coords[i] ^= t;
+  }
+}
+
+/**
+ * @brief The CurveKeysImpl class computes the position of every point along the curve
+ */
+class CurveKeysImpl
+{
+public:
+  CurveKeysImpl(const float* points, const double origin[3], double scale, MeshReorderer::Method method, std::vector<std::pair<uint64_t, size_t>>& keys)
+  : m_Points(points)
+  , m_Scale(scale)
+  , m_Method(method)
+  , m_Keys(keys)
+  {
+    std::copy(origin, origin + 3, m_Origin);
+  }
+  virtual ~CurveKeysImpl()
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    const double maxCell = static_cast<double>((1u << k_CurveBits) - 1);
+    for(size_t i = start; i < end; i++)
+    {
+      uint32_t coords[3] = {0, 0, 0};
+      for(size_t j = 0; j < 3; j++)
+      {
+        double cell = (static_cast<double>(m_Points[3 * i + j]) - m_Origin[j]) * m_Scale;
+        // Written so that NaN lands in the first cell as well
+        if(!(cell > 0.0))
+        {
+          cell = 0.0;
+        }
+        coords[j] = static_cast<uint32_t>(std::min(cell, maxCell));
+      }
+      if(m_Method == MeshReorderer::Method::Hilbert)
+      {
+        AxesToTranspose(coords);
+      }
+      m_Keys[i] = std::make_pair(InterleaveBits(coords), i);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const float* m_Points;
+  double m_Origin[3];
+  double m_Scale;
+  MeshReorderer::Method m_Method;
+  std::vector<std::pair<uint64_t, size_t>>& m_Keys;
+};
+
+/**
+ * @brief The RenumberVerticesImpl class replaces the vertex ids of a connectivity list with their new ids
+ */
+class RenumberVerticesImpl
+{
+public:
+  RenumberVerticesImpl(int64_t* list, const std::vector<int64_t>& newVertexIds)
+  : m_List(list)
+  , m_NewVertexIds(newVertexIds)
+  {
+  }
+  virtual ~RenumberVerticesImpl()
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    int64_t numVertices = static_cast<int64_t>(m_NewVertexIds.size());
+    for(size_t i = start; i < end; i++)
+    {
+      int64_t id = m_List[i];
+      if(id >= 0 && id < numVertices)
+      {
+        m_List[i] = m_NewVertexIds[static_cast<size_t>(id)];
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  int64_t* m_List;
+  const std::vector<int64_t>& m_NewVertexIds;
+};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshReorderer::MeshReorderer() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshReorderer::~MeshReorderer() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> MeshReorderer::SpaceFillingCurveOrder(const float* points, size_t numPoints, Method method)
+{
+  std::vector<size_t> order(numPoints);
+  if(numPoints == 0)
+  {
+    return order;
+  }
+
+  double lower[3] = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  double upper[3] = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    for(size_t j = 0; j < 3; j++)
+    {
+      double value = static_cast<double>(points[3 * i + j]);
+      if(std::isfinite(value))
+      {
+        lower[j] = std::min(lower[j], value);
+        upper[j] = std::max(upper[j], value);
+      }
+    }
+  }
+  // One scale for every axis keeps the cells cubic
+  double extent = 0.0;
+  for(size_t j = 0; j < 3; j++)
+  {
+    if(lower[j] > upper[j])
+    {
+      lower[j] = upper[j] = 0.0;
+    }
+    extent = std::max(extent, upper[j] - lower[j]);
+  }
+  double scale = (extent > 0.0) ? static_cast<double>(1u << k_CurveBits) / extent : 0.0;
+
+  std::vector<std::pair<uint64_t, size_t>> keys(numPoints);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), CurveKeysImpl(points, lower, scale, method, keys), tbb::auto_partitioner());
+    tbb::parallel_sort(keys.begin(), keys.end());
+  }
+  else
+#endif
+  {
+    CurveKeysImpl serial(points, lower, scale, method, keys);
+    serial.compute(0, numPoints);
+    std::sort(keys.begin(), keys.end());
+  }
+
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    order[i] = keys[i].second;
+  }
+  return order;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> MeshReorderer::ReverseCuthillMcKeeOrder(ElementDynamicList::Pointer elementNeighbors, size_t numElements)
+{
+  std::vector<size_t> order;
+  if(nullptr == elementNeighbors.get() || elementNeighbors->size() != numElements)
+  {
+    return order;
+  }
+
+  std::vector<size_t> degrees(numElements);
+  for(size_t i = 0; i < numElements; i++)
+  {
+    degrees[i] = static_cast<size_t>(elementNeighbors->getNumberOfElements(i));
+  }
+  std::vector<size_t> byDegree(numElements);
+  std::iota(byDegree.begin(), byDegree.end(), 0);
+  std::stable_sort(byDegree.begin(), byDegree.end(), [&degrees](size_t a, size_t b) { return degrees[a] < degrees[b]; });
+
+  // The order itself is the breadth first queue
+  order.reserve(numElements);
+  std::vector<uint8_t> visited(numElements, 0);
+  std::vector<size_t> next;
+  for(size_t s = 0; s < numElements; s++)
+  {
+    size_t seed = byDegree[s];
+    if(visited[seed] != 0)
+    {
+      continue;
+    }
+    visited[seed] = 1;
+    order.push_back(seed);
+    for(size_t head = order.size() - 1; head < order.size(); head++)
+    {
+      size_t elem = order[head];
+      const int64_t* neighbors = elementNeighbors->getElementListPointer(elem);
+      size_t numNeighbors = degrees[elem];
+      next.clear();
+      for(size_t k = 0; k < numNeighbors; k++)
+      {
+        int64_t neighbor = neighbors[k];
+        if(neighbor >= 0 && static_cast<size_t>(neighbor) < numElements && visited[neighbor] == 0)
+        {
+          visited[neighbor] = 1;
+          next.push_back(static_cast<size_t>(neighbor));
+        }
+      }
+      std::sort(next.begin(), next.end(), [&degrees](size_t a, size_t b) { return (degrees[a] == degrees[b]) ? (a < b) : (degrees[a] < degrees[b]); });
+      order.insert(order.end(), next.begin(), next.end());
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+MeshReorderer::Pointer MeshReorderer::Create(Int64ArrayType::Pointer elements, size_t numVertices, const std::vector<size_t>& elementOrder)
+{
+  if(nullptr == elements.get())
+  {
+    return NullPointer();
+  }
+  size_t numElements = elements->getNumberOfTuples();
+  size_t numVertsPerElem = static_cast<size_t>(elements->getNumberOfComponents());
+  if(elementOrder.size() != numElements)
+  {
+    return NullPointer();
+  }
+  std::vector<uint8_t> seen(numElements, 0);
+  for(size_t i = 0; i < numElements; i++)
+  {
+    if(elementOrder[i] >= numElements || seen[elementOrder[i]] != 0)
+    {
+      return NullPointer();
+    }
+    seen[elementOrder[i]] = 1;
+  }
+
+  Pointer reorderer(new MeshReorderer());
+  reorderer->m_ElementOrder = elementOrder;
+  reorderer->m_NewVertexIds.assign(numVertices, -1);
+  reorderer->m_VertexOrder.reserve(numVertices);
+  const int64_t* elems = elements->getPointer(0);
+  for(size_t i = 0; i < numElements; i++)
+  {
+    const int64_t* elem = elems + numVertsPerElem * elementOrder[i];
+    for(size_t k = 0; k < numVertsPerElem; k++)
+    {
+      if(elem[k] < 0 || static_cast<size_t>(elem[k]) >= numVertices)
+      {
+        return NullPointer();
+      }
+      if(reorderer->m_NewVertexIds[elem[k]] < 0)
+      {
+        reorderer->m_NewVertexIds[elem[k]] = static_cast<int64_t>(reorderer->m_VertexOrder.size());
+        reorderer->m_VertexOrder.push_back(static_cast<size_t>(elem[k]));
+      }
+    }
+  }
+  for(size_t i = 0; i < numVertices; i++)
+  {
+    if(reorderer->m_NewVertexIds[i] < 0)
+    {
+      reorderer->m_NewVertexIds[i] = static_cast<int64_t>(reorderer->m_VertexOrder.size());
+      reorderer->m_VertexOrder.push_back(i);
+    }
+  }
+  return reorderer;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& MeshReorderer::getElementOrder() const
+{
+  return m_ElementOrder;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& MeshReorderer::getVertexOrder() const
+{
+  return m_VertexOrder;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int64_t>& MeshReorderer::getNewVertexIds() const
+{
+  return m_NewVertexIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void MeshReorderer::renumberVertices(Int64ArrayType::Pointer list) const
+{
+  if(nullptr == list.get() || list->getSize() == 0)
+  {
+    return;
+  }
+  size_t numIds = list->getSize();
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numIds), RenumberVerticesImpl(list->getPointer(0), m_NewVertexIds), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    RenumberVerticesImpl serial(list->getPointer(0), m_NewVertexIds);
+    serial.compute(0, numIds);
+  }
+}
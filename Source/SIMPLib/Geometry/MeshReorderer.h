@@ -0,0 +1,144 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _meshreorderer_h_
+#define _meshreorderer_h_
+
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Geometry/IGeometry.h"
+
+/**
+ * @brief The MeshReorderer class computes a new order for the elements and the vertices of an unstructured mesh
+ * so that elements that are close in space, or in the element graph, are also close in memory. The elements are
+ * ordered first, either along a space filling curve through their centroids or with the reverse Cuthill-McKee
+ * ordering of the element neighbor graph. The vertices then follow the order in which the reordered elements first
+ * use them; vertices that no element uses are moved to the end.
+ *
+ * The orders are permutations in gather form: position i of the reordered list holds the old item order[i]. They
+ * can be handed directly to IDataArray::permuteTuples and AttributeMatrix::permuteTuples.
+ */
+class SIMPLib_EXPORT MeshReorderer
+{
+  public:
+    SIMPL_SHARED_POINTERS(MeshReorderer)
+    SIMPL_TYPE_MACRO(MeshReorderer)
+
+    /**
+     * @brief The Method enum selects how the elements are ordered
+     */
+    enum class Method : int32_t
+    {
+      Morton = 0,             //!< Z-order curve through the element centroids
+      Hilbert = 1,            //!< Hilbert curve through the element centroids
+      ReverseCuthillMcKee = 2 //!< Breadth first ordering of the element neighbor graph, reversed
+    };
+
+    /**
+     * @brief SpaceFillingCurveOrder Sorts points along a Morton or Hilbert curve. The points are quantized to 21 bits
+     * per axis inside their common bounding cube; ties keep the original order.
+     * @param points Packed xyz coordinates
+     * @param numPoints
+     * @param method Morton or Hilbert
+     * @return The gather order of the points
+     */
+    static std::vector<size_t> SpaceFillingCurveOrder(const float* points, size_t numPoints, Method method);
+
+    /**
+     * @brief ReverseCuthillMcKeeOrder Orders the elements breadth first through the neighbor graph, starting each
+     * connected component at an element of smallest degree and visiting neighbors by increasing degree, then
+     * reverses the order
+     * @param elementNeighbors The neighbors of every element, as built by findElementNeighbors()
+     * @param numElements
+     * @return The gather order of the elements, or an empty vector if the neighbor lists do not match the elements
+     */
+    static std::vector<size_t> ReverseCuthillMcKeeOrder(ElementDynamicList::Pointer elementNeighbors, size_t numElements);
+
+    /**
+     * @brief Create Derives the vertex order from an element order
+     * @param elements Element connectivity; every tuple lists the vertex ids of one element
+     * @param numVertices
+     * @param elementOrder A permutation of the elements in gather form
+     * @return A null pointer if elementOrder is not a permutation of the elements or an element references a vertex
+     * that does not exist
+     */
+    static Pointer Create(Int64ArrayType::Pointer elements, size_t numVertices, const std::vector<size_t>& elementOrder);
+
+    virtual ~MeshReorderer();
+
+    /**
+     * @brief getElementOrder Returns the gather order of the elements
+     * @return
+     */
+    const std::vector<size_t>& getElementOrder() const;
+
+    /**
+     * @brief getVertexOrder Returns the gather order of the vertices
+     * @return
+     */
+    const std::vector<size_t>& getVertexOrder() const;
+
+    /**
+     * @brief getNewVertexIds Returns the new id of every old vertex
+     * @return
+     */
+    const std::vector<int64_t>& getNewVertexIds() const;
+
+    /**
+     * @brief renumberVertices Replaces every vertex id of a connectivity list, such as the elements, edges or faces,
+     * with its new id. Ids that are not vertices of the mesh are left as they are.
+     * @param list
+     */
+    void renumberVertices(Int64ArrayType::Pointer list) const;
+
+  protected:
+    MeshReorderer();
+
+  private:
+    std::vector<size_t> m_ElementOrder;
+    std::vector<size_t> m_VertexOrder;
+    std::vector<int64_t> m_NewVertexIds;
+
+  public:
+    MeshReorderer(const MeshReorderer&) = delete;            // Copy Constructor Not Implemented
+    MeshReorderer(MeshReorderer&&) = delete;                 // Move Constructor Not Implemented
+    MeshReorderer& operator=(const MeshReorderer&) = delete; // Copy Assignment Not Implemented
+    MeshReorderer& operator=(MeshReorderer&&) = delete;      // Move Assignment Not Implemented
+};
+
+#endif /* _meshreorderer_h_ */
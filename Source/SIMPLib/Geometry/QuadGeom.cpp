@@ -57,18 +57,25 @@
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #endif
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/MeshReorderer.h"
+#include "SIMPLib/Geometry/VertexWelder.h"
+#include "SIMPLib/Utilities/ParallelProgress.h"
 
 /**
  * @brief The FindQuadDerivativesImpl class implements a threaded algorithm that computes the
- * derivative of an arbitrary dimensional field on the underlying quadrilaterals
+ * derivative of an arbitrary dimensional field on the underlying quadrilaterals. The field is read in its
+ * native type; if a list of elements containing each vertex is supplied the field is element centered
+ * and is averaged onto the vertices as it is read.
  */
-class FindQuadDerivativesImpl
+template <typename T, typename K> class FindQuadDerivativesImpl
 {
 public:
-  FindQuadDerivativesImpl(QuadGeom* quads, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs)
+  FindQuadDerivativesImpl(QuadGeom* quads, typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivs, ElementDynamicList::Pointer elemsContainingVert, ParallelProgress* progress)
   : m_Quads(quads)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_ElemsContainingVert(elemsContainingVert)
+  , m_Progress(progress)
   {
   }
   virtual ~FindQuadDerivativesImpl()
@@ -78,8 +85,9 @@ public:
   void compute(int64_t start, int64_t end) const
   {
     int32_t cDims = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    T* fieldPtr = m_Field->getPointer(0);
+    K* derivsPtr = m_Derivatives->getPointer(0);
+    std::vector<double> vertValues(4 * cDims, 0.0);
     double values[4] = {0.0, 0.0, 0.0, 0.0};
     double derivs[3] = {0.0, 0.0, 0.0};
     int64_t verts[4] = {0, 0, 0, 0};
@@ -91,25 +99,31 @@ public:
     for(int64_t i = start; i < end; i++)
     {
       m_Quads->getVertsAtQuad(i, verts);
+      DerivativeHelpers::GatherVertexValues<T>(fieldPtr, cDims, verts, 4, m_ElemsContainingVert.get(), vertValues.data());
       for(int32_t j = 0; j < cDims; j++)
       {
         for(size_t k = 0; k < 4; k++)
         {
-          values[k] = fieldPtr[cDims * verts[k] + j];
+          values[k] = vertValues[k * cDims + j];
         }
         DerivativeHelpers::QuadDeriv()(m_Quads, i, values, derivs);
-        derivsPtr[i * 3 * cDims + j * 3] = derivs[0];
-        derivsPtr[i * 3 * cDims + j * 3 + 1] = derivs[1];
-        derivsPtr[i * 3 * cDims + j * 3 + 2] = derivs[2];
+        derivsPtr[i * 3 * cDims + j * 3] = static_cast<K>(derivs[0]);
+        derivsPtr[i * 3 * cDims + j * 3 + 1] = static_cast<K>(derivs[1]);
+        derivsPtr[i * 3 * cDims + j * 3 + 2] = static_cast<K>(derivs[2]);
       }
 
       if(counter > progIncrement)
       {
-        m_Quads->sendThreadSafeProgressMessage(counter, totalElements);
+        m_Progress->increment(counter);
         counter = 0;
+        if(m_Progress->wasCanceled())
+        {
+          return;
+        }
       }
       counter++;
     }
+    m_Progress->increment(counter);
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -120,8 +134,10 @@ public:
 #endif
 private:
   QuadGeom* m_Quads;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  typename DataArray<T>::Pointer m_Field;
+  typename DataArray<K>::Pointer m_Derivatives;
+  ElementDynamicList::Pointer m_ElemsContainingVert;
+  ParallelProgress* m_Progress;
 };
 
 // -----------------------------------------------------------------------------
@@ -354,14 +370,7 @@ void QuadGeom::deleteElementNeighbors()
 // -----------------------------------------------------------------------------
 int QuadGeom::findElementCentroids()
 {
-  QVector<size_t> cDims(1, 3);
-  m_QuadCentroids = FloatArrayType::CreateArray(getNumberOfQuads(), cDims, SIMPL::StringConstants::QuadCentroids);
-  GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_QuadList, m_VertexList, m_QuadCentroids);
-  if(m_QuadCentroids.get() == nullptr)
-  {
-    return -1;
-  }
-  return 1;
+  return updateElementCentroidsAndSizes(true, false);
 }
 
 // -----------------------------------------------------------------------------
@@ -393,12 +402,38 @@ void QuadGeom::deleteElementCentroids()
 // -----------------------------------------------------------------------------
 int QuadGeom::findElementSizes()
 {
-  QVector<size_t> cDims(1, 1);
-  m_QuadSizes = FloatArrayType::CreateArray(getNumberOfQuads(), cDims, SIMPL::StringConstants::QuadAreas);
-  GeometryHelpers::Topology::Find2DElementAreas<int64_t>(m_QuadList, m_VertexList, m_QuadSizes);
-  if(m_QuadSizes.get() == nullptr)
+  return updateElementCentroidsAndSizes(false, true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int QuadGeom::findElementMeasures(bool centroids, bool sizes)
+{
+  FloatArrayType::Pointer elemCentroids = FloatArrayType::NullPointer();
+  FloatArrayType::Pointer elemSizes = FloatArrayType::NullPointer();
+  if(centroids)
   {
-    return -1;
+    QVector<size_t> cDims(1, 3);
+    elemCentroids = FloatArrayType::CreateArray(getNumberOfQuads(), cDims, SIMPL::StringConstants::QuadCentroids);
+  }
+  if(sizes)
+  {
+    QVector<size_t> cDims(1, 1);
+    elemSizes = FloatArrayType::CreateArray(getNumberOfQuads(), cDims, SIMPL::StringConstants::QuadAreas);
+  }
+  int err = GeometryHelpers::Topology::FindElementCentroidsAndSizes<int64_t>(m_QuadList, m_VertexList, elemCentroids, elemSizes, IGeometry::Type::Quad);
+  if(err < 0)
+  {
+    return err;
+  }
+  if(centroids)
+  {
+    m_QuadCentroids = elemCentroids;
+  }
+  if(sizes)
+  {
+    m_QuadSizes = elemSizes;
   }
   return 1;
 }
@@ -466,6 +501,151 @@ void QuadGeom::deleteUnsharedEdges()
   m_UnsharedEdgeList = SharedEdgeList::NullPointer();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int QuadGeom::weldVertices(float tolerance, bool removeUnreferenced, bool removeDegenerate, const QVector<AttributeMatrix::Pointer>& vertexAttributeMatrices,
+                          const QVector<AttributeMatrix::Pointer>& elementAttributeMatrices)
+{
+  VertexWelder::Pointer welder = VertexWelder::Create(m_VertexList, m_QuadList, tolerance, removeUnreferenced, removeDegenerate);
+  if(nullptr == welder.get())
+  {
+    return -1;
+  }
+  const TupleCompactionMap& compactionMap = welder->getCompactionMap();
+  const TupleCompactionMap& elementCompactionMap = welder->getElementCompactionMap();
+  for(const AttributeMatrix::Pointer& attrMat : vertexAttributeMatrices)
+  {
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != compactionMap.getOldNumberOfTuples())
+    {
+      return -2;
+    }
+  }
+  for(const AttributeMatrix::Pointer& attrMat : elementAttributeMatrices)
+  {
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != elementCompactionMap.getOldNumberOfTuples())
+    {
+      return -2;
+    }
+  }
+  if(compactionMap.getNewNumberOfTuples() == compactionMap.getOldNumberOfTuples() &&
+     elementCompactionMap.getNewNumberOfTuples() == elementCompactionMap.getOldNumberOfTuples())
+  {
+    return 1;
+  }
+
+  for(const AttributeMatrix::Pointer& attrMat : vertexAttributeMatrices)
+  {
+    attrMat->compactTuples(compactionMap);
+  }
+  for(const AttributeMatrix::Pointer& attrMat : elementAttributeMatrices)
+  {
+    attrMat->compactTuples(elementCompactionMap);
+  }
+  welder->remapElements(m_QuadList);
+  m_QuadList->compactTuples(elementCompactionMap);
+  m_VertexList->compactTuples(compactionMap);
+
+  // Everything derived from the old vertex ids is stale
+  deleteElementCentroids();
+  deleteElementSizes();
+  deleteEdges();
+  deleteUnsharedEdges();
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  elementGeometryModified();
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int QuadGeom::reorder(MeshReorderer::Method method, const QVector<AttributeMatrix::Pointer>& vertexAttributeMatrices, const QVector<AttributeMatrix::Pointer>& elementAttributeMatrices)
+{
+  size_t numElems = static_cast<size_t>(getNumberOfQuads());
+  size_t numVerts = static_cast<size_t>(getNumberOfVertices());
+  for(const AttributeMatrix::Pointer& attrMat : vertexAttributeMatrices)
+  {
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != numVerts)
+    {
+      return -2;
+    }
+  }
+  for(const AttributeMatrix::Pointer& attrMat : elementAttributeMatrices)
+  {
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != numElems)
+    {
+      return -2;
+    }
+  }
+
+  std::vector<size_t> elementOrder;
+  if(method == MeshReorderer::Method::ReverseCuthillMcKee)
+  {
+    // The cached connectivity may predate edits made through the element list, so it is rebuilt here
+    int err = findElementsContainingVert();
+    if(err < 0)
+    {
+      return err;
+    }
+    err = findElementNeighbors();
+    if(err < 0)
+    {
+      return err;
+    }
+    elementOrder = MeshReorderer::ReverseCuthillMcKeeOrder(m_QuadNeighbors, numElems);
+  }
+  else
+  {
+    int err = updateElementCentroidsAndSizes(true, false);
+    if(err < 0)
+    {
+      return err;
+    }
+    elementOrder = MeshReorderer::SpaceFillingCurveOrder(m_QuadCentroids->getPointer(0), numElems, method);
+  }
+  MeshReorderer::Pointer reorderer = MeshReorderer::Create(m_QuadList, numVerts, elementOrder);
+  if(nullptr == reorderer.get())
+  {
+    return -1;
+  }
+
+  for(const AttributeMatrix::Pointer& attrMat : vertexAttributeMatrices)
+  {
+    int err = attrMat->permuteTuples(reorderer->getVertexOrder());
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+  for(const AttributeMatrix::Pointer& attrMat : elementAttributeMatrices)
+  {
+    int err = attrMat->permuteTuples(elementOrder);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+  m_QuadList->permuteTuples(elementOrder);
+  reorderer->renumberVertices(m_QuadList);
+  reorderer->renumberVertices(m_EdgeList);
+  reorderer->renumberVertices(m_UnsharedEdgeList);
+  m_VertexList->permuteTuples(reorderer->getVertexOrder());
+
+  // The centroids and sizes move with their elements, so they stay current
+  if(m_QuadCentroids.get() != nullptr)
+  {
+    m_QuadCentroids->permuteTuples(elementOrder);
+  }
+  if(m_QuadSizes.get() != nullptr)
+  {
+    m_QuadSizes->permuteTuples(elementOrder);
+  }
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  return 1;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -501,6 +681,14 @@ void QuadGeom::getShapeFunctions(double pCoords[3], double* shape)
 //
 // -----------------------------------------------------------------------------
 void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives<double, double>(field, derivatives, observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void QuadGeom::findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   int64_t numQuads = getNumberOfQuads();
@@ -510,6 +698,50 @@ void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
 
+  ParallelProgress progress(this, numQuads, m_MessagePrefix, m_MessageLabel, m_MessageTitle, observable);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numQuads), FindQuadDerivativesImpl<T, K>(this, field, derivatives, ElementDynamicList::NullPointer(), &progress), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    FindQuadDerivativesImpl<T, K> serial(this, field, derivatives, ElementDynamicList::NullPointer(), &progress);
+    serial.compute(0, numQuads);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void QuadGeom::findDerivativesFromElementValues(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
+{
+  m_ProgressCounter = 0;
+  int64_t numQuads = getNumberOfQuads();
+
+  if(getElementsContainingVert().get() == nullptr)
+  {
+    if(findElementsContainingVert() < 0)
+    {
+      return;
+    }
+  }
+  ElementDynamicList::Pointer elemsContainingVert = getElementsContainingVert();
+
+  if(observable)
+  {
+    connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
+  }
+
+  ParallelProgress progress(this, numQuads, m_MessagePrefix, m_MessageLabel, m_MessageTitle, observable);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
   bool doParallel = true;
@@ -518,16 +750,19 @@ void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numQuads), FindQuadDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numQuads), FindQuadDerivativesImpl<T, K>(this, field, derivatives, elemsContainingVert, &progress), tbb::auto_partitioner());
   }
   else
 #endif
   {
-    FindQuadDerivativesImpl serial(this, field, derivatives);
+    FindQuadDerivativesImpl<T, K> serial(this, field, derivatives, elemsContainingVert, &progress);
     serial.compute(0, numQuads);
   }
 }
 
+SIMPL_INSTANTIATE_DERIVATIVES(QuadGeom, findDerivatives)
+SIMPL_INSTANTIATE_DERIVATIVES(QuadGeom, findDerivativesFromElementValues)
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -749,9 +984,9 @@ int QuadGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 // -----------------------------------------------------------------------------
 IGeometry::Pointer QuadGeom::deepCopy(bool forceNoAllocate)
 {
-  SharedQuadList::Pointer quads = std::dynamic_pointer_cast<SharedQuadList>((getQuads().get() == nullptr) ? nullptr : getQuads()->deepCopy(forceNoAllocate));
-  SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
-  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((getEdges().get() == nullptr) ? nullptr : getEdges()->deepCopy(forceNoAllocate));
+  SharedQuadList::Pointer quads = std::dynamic_pointer_cast<SharedQuadList>((m_QuadList.get() == nullptr) ? nullptr : m_QuadList->deepCopy(forceNoAllocate));
+  SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((m_VertexList.get() == nullptr) ? nullptr : m_VertexList->deepCopy(forceNoAllocate));
+  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((m_EdgeList.get() == nullptr) ? nullptr : m_EdgeList->deepCopy(forceNoAllocate));
   SharedEdgeList::Pointer unsharedEdges = std::dynamic_pointer_cast<SharedEdgeList>((getUnsharedEdges().get() == nullptr) ? nullptr : getUnsharedEdges()->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementsContainingVert =
       std::dynamic_pointer_cast<ElementDynamicList>((getElementsContainingVert().get() == nullptr) ? nullptr : getElementsContainingVert()->deepCopy(forceNoAllocate));
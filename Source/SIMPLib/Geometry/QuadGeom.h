@@ -38,6 +38,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Geometry/IGeometry2D.h"
+#include "SIMPLib/Geometry/MeshReorderer.h"
 
 /**
  * @brief The QuadGeom class represents a collection of quadrilaterals
@@ -152,6 +153,13 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
      */
     int64_t* getQuadPointer(int64_t i);
 
+    /**
+     * @brief getQuadPointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    const int64_t* getQuadPointer(int64_t i) const;
+
     /**
      * @brief getNumberOfQuads
      * @return
@@ -261,6 +269,22 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
      */
     virtual void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr);
 
+    /**
+     * @brief findDerivatives Computes the derivatives of a vertex field in its native type
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
+    /**
+     * @brief findDerivativesFromElementValues Computes the derivatives of an element centered field
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivativesFromElementValues(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -347,6 +371,13 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
      */
     virtual float* getVertexPointer(int64_t i);
 
+    /**
+     * @brief getVertexPointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    virtual const float* getVertexPointer(int64_t i) const;
+
     /**
      * @brief getNumberOfVertices
      * @return
@@ -394,6 +425,13 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
      */
     virtual int64_t* getEdgePointer(int64_t i);
 
+    /**
+     * @brief getEdgePointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    virtual const int64_t* getEdgePointer(int64_t i) const;
+
     /**
      * @brief getNumberOfEdges
      * @return
@@ -427,6 +465,52 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
      */
     virtual void deleteUnsharedEdges();
 
+// -----------------------------------------------------------------------------
+// Mesh cleanup
+// -----------------------------------------------------------------------------
+
+    /**
+     * @brief weldVertices Merges the vertices that are closer than the tolerance and removes the vertices that no
+     * quadrilateral uses. Each group of merged vertices keeps the coordinates and attribute values of its vertex with
+     * the smallest id. The quadrilateral list is remapped, and the vertex list and the arrays of the given vertex
+     * attribute matrices are compacted in place. The vertex list is changed in place, so other geometries that
+     * share it are affected as well. Edges, unshared edges, the element centroids and sizes and the vertex and
+     * element connectivity are deleted.
+     * @param tolerance Vertices closer than this distance are merged; 0 merges vertices with identical coordinates
+     * @param removeUnreferenced Whether vertices that no quadrilateral uses are removed
+     * @param removeDegenerate Whether quadrilaterals that use a vertex more than once after the merge are removed
+     * @param vertexAttributeMatrices Attribute matrices with one tuple per vertex
+     * @param elementAttributeMatrices Attribute matrices with one tuple per quadrilateral, compacted like the
+     * quadrilateral list when degenerate quadrilaterals are removed
+     * @return 1 on success, -1 if a quadrilateral references a vertex that does not exist, -2 if an attribute matrix does
+     * not have one tuple per vertex or per quadrilateral. Nothing is changed on failure.
+     */
+    int weldVertices(float tolerance, bool removeUnreferenced = true, bool removeDegenerate = false,
+                     const QVector<AttributeMatrix::Pointer>& vertexAttributeMatrices = QVector<AttributeMatrix::Pointer>(),
+                     const QVector<AttributeMatrix::Pointer>& elementAttributeMatrices = QVector<AttributeMatrix::Pointer>());
+
+// -----------------------------------------------------------------------------
+// Reordering
+// -----------------------------------------------------------------------------
+
+    /**
+     * @brief reorder Renumbers the quadrilaterals and the vertices so that neighbors are close in memory. The
+     * quadrilaterals are sorted along a space filling curve through their centroids, or with reverse Cuthill-McKee on
+     * the quadrilateral neighbor graph, and the vertices follow the order in which the reordered quadrilaterals first
+     * use them. The vertex list, the quadrilateral list, the element centroids and sizes and the arrays of the given
+     * attribute matrices are permuted in place and the edge lists are renumbered. The vertex and element connectivity
+     * is rebuilt for reverse Cuthill-McKee and deleted afterwards. Other geometries that share the vertex list are not
+     * renumbered.
+     * @param method
+     * @param vertexAttributeMatrices Attribute matrices with one tuple per vertex
+     * @param elementAttributeMatrices Attribute matrices with one tuple per quadrilateral
+     * @return 1 on success, -1 if the order could not be computed, -2 if an attribute matrix does not have one
+     * tuple per vertex or quadrilateral, or the error of AttributeMatrix::permuteTuples if an attribute array could
+     * not be permuted
+     */
+    int reorder(MeshReorderer::Method method, const QVector<AttributeMatrix::Pointer>& vertexAttributeMatrices = QVector<AttributeMatrix::Pointer>(),
+                const QVector<AttributeMatrix::Pointer>& elementAttributeMatrices = QVector<AttributeMatrix::Pointer>());
+
   protected:
 
     QuadGeom();
@@ -455,6 +539,14 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
      */
     virtual void setElementSizes(FloatArrayType::Pointer elementSizes);
 
+    /**
+     * @brief findElementMeasures Computes the requested element centroids and sizes in one parallel sweep
+     * @param centroids
+     * @param sizes
+     * @return
+     */
+    virtual int findElementMeasures(bool centroids, bool sizes);
+
     /**
      * @brief setEdges
      * @param edges
@@ -477,7 +569,7 @@ class SIMPLib_EXPORT QuadGeom : public IGeometry2D
     FloatArrayType::Pointer m_QuadCentroids;
     FloatArrayType::Pointer m_QuadSizes;
 
-    friend class FindQuadDerivativesImpl;
+    template <typename T, typename K> friend class FindQuadDerivativesImpl;
 
     QuadGeom(const QuadGeom&) = delete;       // Copy Constructor Not Implemented
     void operator=(const QuadGeom&) = delete; // Move assignment Not Implemented
@@ -45,7 +45,10 @@
 
 #include "SIMPLib/Geometry/RectGridGeom.h"
 
+#include <algorithm>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
 #include <tbb/blocked_range3d.h>
 #include <tbb/parallel_for.h>
 #include <tbb/partitioner.h>
@@ -53,20 +56,24 @@
 #endif
 
 #include "H5Support/H5Lite.h"
+#include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
+#include "SIMPLib/Utilities/ParallelProgress.h"
 
 /**
- * @brief The FindImageDerivativesImpl class implements a threaded algorithm that computes the
- * derivative of an arbitrary dimensional field on the underlying rectilinear grid
+ * @brief The FindRectGridDerivativesImpl class implements a threaded algorithm that computes the
+ * derivative of an arbitrary dimensional field on the underlying rectilinear grid. The field is
+ * read in its native type and the derivatives are written as float or double.
  */
-class FindRectGridDerivativesImpl
+template <typename T, typename K> class FindRectGridDerivativesImpl
 {
 public:
-  FindRectGridDerivativesImpl(RectGridGeom* image, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs)
+  FindRectGridDerivativesImpl(RectGridGeom* image, typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivs, ParallelProgress* progress)
   : m_RectGrid(image)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_Progress(progress)
   {
   }
   virtual ~FindRectGridDerivativesImpl()
@@ -84,8 +91,8 @@ public:
     aj = xix = xiy = xiz = etax = etay = etaz = zetax = zetay = zetaz = 0;
     size_t index = 0;
     int32_t numComps = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    T* fieldPtr = m_Field->getPointer(0);
+    K* derivsPtr = m_Derivatives->getPointer(0);
     std::vector<double> plusValues(numComps);
     std::vector<double> minusValues(numComps);
     std::vector<double> dValuesdXi(numComps);
@@ -212,22 +219,27 @@ public:
           index = (z * dims[1] * dims[0]) + (y * dims[0]) + x;
           for(int32_t i = 0; i < numComps; i++)
           {
-            derivsPtr[index * numComps * 3 + i * 3] = xix * dValuesdXi[i] + etax * dValuesdEta[i] + zetax * dValuesdZeta[i];
+            derivsPtr[index * numComps * 3 + i * 3] = static_cast<K>(xix * dValuesdXi[i] + etax * dValuesdEta[i] + zetax * dValuesdZeta[i]);
 
-            derivsPtr[index * numComps * 3 + i * 3 + 1] = xiy * dValuesdXi[i] + etay * dValuesdEta[i] + zetay * dValuesdZeta[i];
+            derivsPtr[index * numComps * 3 + i * 3 + 1] = static_cast<K>(xiy * dValuesdXi[i] + etay * dValuesdEta[i] + zetay * dValuesdZeta[i]);
 
-            derivsPtr[index * numComps * 3 + i * 3 + 2] = xiz * dValuesdXi[i] + etaz * dValuesdEta[i] + zetaz * dValuesdZeta[i];
+            derivsPtr[index * numComps * 3 + i * 3 + 2] = static_cast<K>(xiz * dValuesdXi[i] + etaz * dValuesdEta[i] + zetaz * dValuesdZeta[i]);
           }
 
           if(counter > progIncrement)
           {
-            m_RectGrid->sendThreadSafeProgressMessage(counter, totalElements);
+            m_Progress->increment(counter);
             counter = 0;
+            if(m_Progress->wasCanceled())
+            {
+              return;
+            }
           }
           counter++;
         }
       }
     }
+    m_Progress->increment(counter);
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -340,7 +352,7 @@ public:
   }
 
   void findValuesForFiniteDifference(int32_t differenceType, int32_t directionType, size_t x, size_t y, size_t z, size_t dims[3], double xp[3], double xm[3], double& factor, int32_t numComps,
-                                     std::vector<double>& plusValues, std::vector<double>& minusValues, double* field) const
+                                     std::vector<double>& plusValues, std::vector<double>& minusValues, T* field) const
   {
     size_t index1 = 0;
     size_t index2 = 0;
@@ -364,8 +376,8 @@ public:
       computeIndices(differenceType, directionType, index1, index2, dims, x, y, z, xp, xm);
       for(int32_t i = 0; i < numComps; i++)
       {
-        plusValues[i] = field[index1 * numComps + i];
-        minusValues[i] = field[index2 * numComps + i];
+        plusValues[i] = static_cast<double>(field[index1 * numComps + i]);
+        minusValues[i] = static_cast<double>(field[index2 * numComps + i]);
       }
     }
 
@@ -377,8 +389,9 @@ public:
 
 private:
   RectGridGeom* m_RectGrid;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  typename DataArray<T>::Pointer m_Field;
+  typename DataArray<K>::Pointer m_Derivatives;
+  ParallelProgress* m_Progress;
 
   enum FiniteDifferenceType_t
   {
@@ -396,6 +409,63 @@ private:
   };
 };
 
+/**
+ * @brief The ComputeRectGridCellIndicesImpl class finds the cells that contain a list of points by a
+ * binary search of the cell bounds along each axis
+ */
+class ComputeRectGridCellIndicesImpl
+{
+public:
+  ComputeRectGridCellIndicesImpl(RectGridGeom* rectGrid, const float* coords, int64_t* indices)
+  : m_Coords(coords)
+  , m_Indices(indices)
+  {
+    std::tie(m_Dims[0], m_Dims[1], m_Dims[2]) = rectGrid->getDimensions();
+    m_Bounds[0] = rectGrid->getXBounds()->getPointer(0);
+    m_Bounds[1] = rectGrid->getYBounds()->getPointer(0);
+    m_Bounds[2] = rectGrid->getZBounds()->getPointer(0);
+  }
+  virtual ~ComputeRectGridCellIndicesImpl()
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t p = start; p < end; p++)
+    {
+      const float* coords = m_Coords + 3 * p;
+      int64_t cell[3] = {0, 0, 0};
+      bool inside = true;
+      for(size_t i = 0; i < 3; i++)
+      {
+        const float* bounds = m_Bounds[i];
+        // Written so that NaN coordinates are outside
+        if(m_Dims[i] == 0 || !(coords[i] >= bounds[0] && coords[i] <= bounds[m_Dims[i]]))
+        {
+          inside = false;
+          break;
+        }
+        size_t index = static_cast<size_t>(std::upper_bound(bounds, bounds + m_Dims[i] + 1, coords[i]) - bounds) - 1;
+        cell[i] = static_cast<int64_t>(std::min(index, m_Dims[i] - 1));
+      }
+      m_Indices[p] = inside ? (cell[2] * static_cast<int64_t>(m_Dims[1]) + cell[1]) * static_cast<int64_t>(m_Dims[0]) + cell[0] : -1;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const float* m_Coords;
+  int64_t* m_Indices;
+  size_t m_Dims[3];
+  const float* m_Bounds[3];
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -417,6 +487,8 @@ RectGridGeom::RectGridGeom()
   m_yBounds = FloatArrayType::NullPointer();
   m_zBounds = FloatArrayType::NullPointer();
   m_VoxelSizes = FloatArrayType::NullPointer();
+  m_VoxelCentroids = FloatArrayType::NullPointer();
+  m_VoxelNeighbors = ElementDynamicList::NullPointer();
   m_ProgressCounter = 0;
 }
 
@@ -440,6 +512,33 @@ RectGridGeom::Pointer RectGridGeom::CreateGeometry(const QString& name)
   return ptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RectGridGeom::setDimensions(size_t value[3])
+{
+  setDimensions(value[0], value[1], value[2]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RectGridGeom::setDimensions(size_t value_0, size_t value_1, size_t value_2)
+{
+  m_Dimensions[0] = value_0;
+  m_Dimensions[1] = value_1;
+  m_Dimensions[2] = value_2;
+  gridModified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RectGridGeom::setDimensions(const std::tuple<size_t, size_t, size_t>& var)
+{
+  setDimensions(std::get<0>(var), std::get<1>(var), std::get<2>(var));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -453,6 +552,7 @@ void RectGridGeom::setXBounds(FloatArrayType::Pointer xBnds)
     }
   }
   m_xBounds = xBnds;
+  gridModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -468,6 +568,7 @@ void RectGridGeom::setYBounds(FloatArrayType::Pointer yBnds)
     }
   }
   m_yBounds = yBnds;
+  gridModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -483,6 +584,18 @@ void RectGridGeom::setZBounds(FloatArrayType::Pointer zBnds)
     }
   }
   m_zBounds = zBnds;
+  gridModified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RectGridGeom::gridModified()
+{
+  m_VoxelSizes = FloatArrayType::NullPointer();
+  m_VoxelCentroids = FloatArrayType::NullPointer();
+  m_VoxelNeighbors = ElementDynamicList::NullPointer();
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -669,6 +782,60 @@ void RectGridGeom::getCoords(size_t idx, double coords[3])
   coords[2] = static_cast<double>(0.5f * (zBnds[plane] + zBnds[plane + 1]));
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t RectGridGeom::computeCellIndices(const float* coords, size_t numPoints, int64_t* indices)
+{
+  if(numPoints == 0)
+  {
+    return 0;
+  }
+  if(m_xBounds.get() == nullptr || m_yBounds.get() == nullptr || m_zBounds.get() == nullptr)
+  {
+    std::fill(indices, indices + numPoints, -1);
+    return 0;
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints, 4096), ComputeRectGridCellIndicesImpl(this, coords, indices), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ComputeRectGridCellIndicesImpl serial(this, coords, indices);
+    serial.compute(0, numPoints);
+  }
+
+  return static_cast<size_t>(std::count_if(indices, indices + numPoints, [](int64_t index) { return index >= 0; }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RectGridGeom::getCellCenters(size_t axis, std::vector<float>& centers)
+{
+  FloatArrayType::Pointer boundsPtr = (axis == 0) ? m_xBounds : ((axis == 1) ? m_yBounds : m_zBounds);
+  if(boundsPtr.get() == nullptr)
+  {
+    centers.clear();
+    return;
+  }
+  float* bounds = boundsPtr->getPointer(0);
+  centers.resize(m_Dimensions[axis]);
+  for(size_t i = 0; i < m_Dimensions[axis]; i++)
+  {
+    centers[i] = 0.5f * (bounds[i] + bounds[i + 1]);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -749,7 +916,13 @@ void RectGridGeom::deleteElementsContainingVert()
 // -----------------------------------------------------------------------------
 int RectGridGeom::findElementNeighbors()
 {
-  return -1;
+  m_VoxelNeighbors = ElementDynamicList::New();
+  int err = GeometryHelpers::Connectivity::FindGridElementNeighbors<uint16_t, int64_t>(m_Dimensions, m_VoxelNeighbors);
+  if(err < 0)
+  {
+    m_VoxelNeighbors = ElementDynamicList::NullPointer();
+  }
+  return err;
 }
 
 // -----------------------------------------------------------------------------
@@ -757,15 +930,15 @@ int RectGridGeom::findElementNeighbors()
 // -----------------------------------------------------------------------------
 ElementDynamicList::Pointer RectGridGeom::getElementNeighbors()
 {
-  return ElementDynamicList::NullPointer();
+  return m_VoxelNeighbors;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void RectGridGeom::setElementNeighbors(ElementDynamicList::Pointer SIMPL_NOT_USED(elementNeighbors))
+void RectGridGeom::setElementNeighbors(ElementDynamicList::Pointer elementNeighbors)
 {
-  return;
+  m_VoxelNeighbors = elementNeighbors;
 }
 
 // -----------------------------------------------------------------------------
@@ -773,7 +946,7 @@ void RectGridGeom::setElementNeighbors(ElementDynamicList::Pointer SIMPL_NOT_USE
 // -----------------------------------------------------------------------------
 void RectGridGeom::deleteElementNeighbors()
 {
-  return;
+  m_VoxelNeighbors = ElementDynamicList::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -781,7 +954,15 @@ void RectGridGeom::deleteElementNeighbors()
 // -----------------------------------------------------------------------------
 int RectGridGeom::findElementCentroids()
 {
-  return -1;
+  size_t numElems = getNumberOfElements();
+  if(numElems == 0 || m_xBounds.get() == nullptr || m_yBounds.get() == nullptr || m_zBounds.get() == nullptr)
+  {
+    return -1;
+  }
+  QVector<size_t> cDims(1, 3);
+  m_VoxelCentroids = FloatArrayType::CreateArray(numElems, cDims, SIMPL::StringConstants::VoxelCentroids);
+  getCoordsRange(0, numElems, m_VoxelCentroids->getPointer(0));
+  return 1;
 }
 
 // -----------------------------------------------------------------------------
@@ -789,15 +970,15 @@ int RectGridGeom::findElementCentroids()
 // -----------------------------------------------------------------------------
 FloatArrayType::Pointer RectGridGeom::getElementCentroids()
 {
-  return FloatArrayType::NullPointer();
+  return m_VoxelCentroids;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void RectGridGeom::setElementCentroids(FloatArrayType::Pointer SIMPL_NOT_USED(elementsCentroids))
+void RectGridGeom::setElementCentroids(FloatArrayType::Pointer elementCentroids)
 {
-  return;
+  m_VoxelCentroids = elementCentroids;
 }
 
 // -----------------------------------------------------------------------------
@@ -805,7 +986,7 @@ void RectGridGeom::setElementCentroids(FloatArrayType::Pointer SIMPL_NOT_USED(el
 // -----------------------------------------------------------------------------
 void RectGridGeom::deleteElementCentroids()
 {
-  return;
+  m_VoxelCentroids = FloatArrayType::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -927,6 +1108,14 @@ void RectGridGeom::getShapeFunctions(double pCoords[3], double* shape)
 //
 // -----------------------------------------------------------------------------
 void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives<double, double>(field, derivatives, observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void RectGridGeom::findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   size_t dims[3] = {0, 0, 0};
@@ -937,6 +1126,8 @@ void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
 
+  ParallelProgress progress(this, static_cast<int64_t>(getNumberOfElements()), m_MessagePrefix, m_MessageLabel, m_MessageTitle, observable);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
   bool doParallel = true;
@@ -951,16 +1142,18 @@ void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
   if(doParallel == true)
   {
     tbb::parallel_for(tbb::blocked_range3d<size_t, size_t, size_t>(0, dims[2], grain, 0, dims[1], dims[1], 0, dims[0], dims[0]),
-                      FindRectGridDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+                      FindRectGridDerivativesImpl<T, K>(this, field, derivatives, &progress), tbb::auto_partitioner());
   }
   else
 #endif
   {
-    FindRectGridDerivativesImpl serial(this, field, derivatives);
+    FindRectGridDerivativesImpl<T, K> serial(this, field, derivatives, &progress);
     serial.compute(0, dims[2], 0, dims[1], 0, dims[0]);
   }
 }
 
+SIMPL_INSTANTIATE_DERIVATIVES(RectGridGeom, findDerivatives)
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1107,6 +1300,8 @@ IGeometry::Pointer RectGridGeom::deepCopy(bool forceNoAllocate)
   FloatArrayType::Pointer yBounds = std::dynamic_pointer_cast<FloatArrayType>((getYBounds().get() == nullptr) ? nullptr : getYBounds()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer zBounds = std::dynamic_pointer_cast<FloatArrayType>((getZBounds().get() == nullptr) ? nullptr : getZBounds()->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
+  FloatArrayType::Pointer elementCentroids = std::dynamic_pointer_cast<FloatArrayType>((getElementCentroids().get() == nullptr) ? nullptr : getElementCentroids()->deepCopy(forceNoAllocate));
+  ElementDynamicList::Pointer elementNeighbors = std::dynamic_pointer_cast<ElementDynamicList>((getElementNeighbors().get() == nullptr) ? nullptr : getElementNeighbors()->deepCopy(forceNoAllocate));
 
   RectGridGeom::Pointer copy = RectGridGeom::CreateGeometry(getName());
 
@@ -1117,6 +1312,8 @@ IGeometry::Pointer RectGridGeom::deepCopy(bool forceNoAllocate)
   copy->setYBounds(yBounds);
   copy->setZBounds(zBounds);
   copy->setElementSizes(elementSizes);
+  copy->setElementCentroids(elementCentroids);
+  copy->setElementNeighbors(elementNeighbors);
   copy->setSpatialDimensionality(getSpatialDimensionality());
 
   return copy;
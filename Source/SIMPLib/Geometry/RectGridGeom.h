@@ -169,6 +169,14 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
      */
     virtual void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr);
 
+    /**
+     * @brief findDerivatives Computes the derivatives of a cell field in its native type
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -216,7 +224,10 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
 // Inherited from IGeometryGrid
 // -----------------------------------------------------------------------------
 
-    SIMPL_INSTANCE_VEC3_PROPERTY_VO(size_t, Dimensions)
+    void setDimensions(size_t value[3]) override;
+    void setDimensions(size_t value_0, size_t value_1, size_t value_2) override;
+    void setDimensions(const std::tuple<size_t, size_t, size_t>& var) override;
+    SIMPL_GET_VEC3_PROPERTY_VO(size_t, Dimensions, m_Dimensions)
 
     
     virtual size_t getXPoints() { return m_Dimensions[0]; }
@@ -237,6 +248,16 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
     virtual void getCoords(size_t x, size_t y, size_t z, double coords[3]);
     virtual void getCoords(size_t idx, double coords[3]);
 
+    /**
+     * @brief computeCellIndices Finds the cell that contains each of numPoints points by a binary search
+     * of the bounds along each axis. The points are processed in parallel
+     * @param coords The point coordinates, 3 values per point
+     * @param numPoints
+     * @param indices The returned index into a cell array for each point, or -1 if the point is outside the grid
+     * @return The number of points inside the grid
+     */
+    virtual size_t computeCellIndices(const float* coords, size_t numPoints, int64_t* indices);
+
   protected:
 
     RectGridGeom();
@@ -275,13 +296,28 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
      */
     virtual void setElementSizes(FloatArrayType::Pointer elementSizes);
 
+    /**
+     * @brief getCellCenters
+     * @param axis
+     * @param centers
+     */
+    virtual void getCellCenters(size_t axis, std::vector<float>& centers);
+
   private:
+    size_t m_Dimensions[3];
     FloatArrayType::Pointer m_xBounds;
     FloatArrayType::Pointer m_yBounds;
     FloatArrayType::Pointer m_zBounds;
     FloatArrayType::Pointer m_VoxelSizes;
+    FloatArrayType::Pointer m_VoxelCentroids;
+    ElementDynamicList::Pointer m_VoxelNeighbors;
+
+    /**
+     * @brief gridModified Drops the voxel sizes, centroids and neighbors computed for the old dimensions or bounds
+     */
+    void gridModified();
 
-    friend class FindRectGridDerivativesImpl;
+    template <typename T, typename K> friend class FindRectGridDerivativesImpl;
 
     RectGridGeom(const RectGridGeom&) = delete;   // Copy Constructor Not Implemented
     void operator=(const RectGridGeom&) = delete; // Move assignment Not Implemented
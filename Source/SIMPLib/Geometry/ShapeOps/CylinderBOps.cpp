@@ -52,20 +52,17 @@ CylinderBOps::~CylinderBOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CylinderBOps::radcur1(QMap<ArgName, float> args)
+void CylinderBOps::init()
 {
-  float radcur1 = 0.0f;
-
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  m_Kernel.init();
+}
 
-  // the equation for volume for a B cylinder is pi*a*c*h where a and c are semi axis lengths, but
-  // h is a full axis length - meaning h = 2b.  However, since our aspect ratios relate semi axis lengths, the 2.0
-  // factor can be ingored in this part
-  radcur1 = static_cast<float>((volcur * SIMPLib::Constants::k_1OverPi * (1.0f / bovera) * (1.0f / covera)));
-  radcur1 = powf(radcur1, 0.333333333333f);
-  return radcur1;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float CylinderBOps::radcur1(const ShapeParameters& params)
+{
+  return m_Kernel.radcur1(params);
 }
 
 // -----------------------------------------------------------------------------
@@ -73,15 +70,21 @@ float CylinderBOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float CylinderBOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = -1.0;
-  if(fabs(axis2comp) <= 1.0)
-  {
-    // inside = 1.0;
-    axis1comp = fabs(axis1comp);
-    axis3comp = fabs(axis3comp);
-    axis1comp = axis1comp * axis1comp;
-    axis3comp = axis3comp * axis3comp;
-    inside = static_cast<float>(1.0 - axis1comp - axis3comp);
-  }
-  return inside;
+  return m_Kernel.inside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderBOps::insideRow(const float start[3], const float step[3], size_t count, float* inside)
+{
+  m_Kernel.insideRow(start, step, count, inside);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderBOps::insideBox(const float origin[3], const float stepX[3], const float stepY[3], const float stepZ[3], const size_t dims[3], float* inside)
+{
+  m_Kernel.insideBox(origin, stepX, stepY, stepZ, dims, inside);
 }
@@ -52,20 +52,17 @@ CylinderCOps::~CylinderCOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CylinderCOps::radcur1(QMap<ArgName, float> args)
+void CylinderCOps::init()
 {
-  float radcur1 = 0.0f;
-
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  m_Kernel.init();
+}
 
-  // the equation for volume for a C cylinder is pi*a*b*h where a and b are semi axis lengths, but
-  // h is a full axis length - meaning h = 2c.  However, since our aspect ratios relate semi axis lengths, the 2.0
-  // factor can be ingored in this part
-  radcur1 = static_cast<float>((volcur * SIMPLib::Constants::k_1OverPi * (1.0f / bovera) * (1.0f / covera)));
-  radcur1 = powf(radcur1, 0.333333333333f);
-  return radcur1;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float CylinderCOps::radcur1(const ShapeParameters& params)
+{
+  return m_Kernel.radcur1(params);
 }
 
 // -----------------------------------------------------------------------------
@@ -73,15 +70,21 @@ float CylinderCOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float CylinderCOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = -1.0;
-  if(fabs(axis3comp) <= 1.0)
-  {
-    // inside = 1.0;
-    axis1comp = fabs(axis1comp);
-    axis2comp = fabs(axis2comp);
-    axis1comp = axis1comp * axis1comp;
-    axis2comp = axis2comp * axis2comp;
-    inside = static_cast<float>(1.0 - axis1comp - axis2comp);
-  }
-  return inside;
+  return m_Kernel.inside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderCOps::insideRow(const float start[3], const float step[3], size_t count, float* inside)
+{
+  m_Kernel.insideRow(start, step, count, inside);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderCOps::insideBox(const float origin[3], const float stepX[3], const float stepY[3], const float stepZ[3], const size_t dims[3], float* inside)
+{
+  m_Kernel.insideBox(origin, stepX, stepY, stepZ, dims, inside);
 }
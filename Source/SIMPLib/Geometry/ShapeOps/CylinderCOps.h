@@ -54,13 +54,19 @@ class SIMPLib_EXPORT CylinderCOps : public ShapeOps
 
     virtual ~CylinderCOps();
 
-    virtual float radcur1(QMap<ArgName, float> args);
-    virtual float inside(float axis1comp, float axis2comp, float axis3comp);
-    virtual void init() {  }
+    using ShapeOps::radcur1;
+    virtual float radcur1(const ShapeParameters& params) override;
+
+    virtual float inside(float axis1comp, float axis2comp, float axis3comp) override;
+    virtual void insideRow(const float start[3], const float step[3], size_t count, float* inside) override;
+    virtual void insideBox(const float origin[3], const float stepX[3], const float stepY[3], const float stepZ[3], const size_t dims[3], float* inside) override;
+    virtual void init() override;
 
   protected:
     CylinderCOps();
   private:
+    CylinderCKernel m_Kernel;
+
     CylinderCOps(const CylinderCOps&) = delete;   // Copy Constructor Not Implemented
     void operator=(const CylinderCOps&) = delete; // Move assignment Not Implemented
 };
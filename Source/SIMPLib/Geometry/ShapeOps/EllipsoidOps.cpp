@@ -52,17 +52,17 @@ EllipsoidOps::~EllipsoidOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float EllipsoidOps::radcur1(QMap<ArgName, float> args)
+void EllipsoidOps::init()
 {
-  float radcur1 = 0.0f;
-
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  m_Kernel.init();
+}
 
-  radcur1 = (volcur * 0.75f * (SIMPLib::Constants::k_1OverPi) * (1.0f / bovera) * (1.0f / covera));
-  radcur1 = powf(radcur1, 0.333333333333f);
-  return radcur1;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float EllipsoidOps::radcur1(const ShapeParameters& params)
+{
+  return m_Kernel.radcur1(params);
 }
 
 // -----------------------------------------------------------------------------
@@ -70,13 +70,21 @@ float EllipsoidOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float EllipsoidOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = 1;
-  axis1comp = fabs(axis1comp);
-  axis2comp = fabs(axis2comp);
-  axis3comp = fabs(axis3comp);
-  axis1comp = axis1comp * axis1comp;
-  axis2comp = axis2comp * axis2comp;
-  axis3comp = axis3comp * axis3comp;
-  inside = 1.0f - axis1comp - axis2comp - axis3comp;
-  return inside;
+  return m_Kernel.inside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EllipsoidOps::insideRow(const float start[3], const float step[3], size_t count, float* inside)
+{
+  m_Kernel.insideRow(start, step, count, inside);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EllipsoidOps::insideBox(const float origin[3], const float stepX[3], const float stepY[3], const float stepZ[3], const size_t dims[3], float* inside)
+{
+  m_Kernel.insideBox(origin, stepX, stepY, stepZ, dims, inside);
 }
@@ -0,0 +1,389 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _shapekernels_h_
+#define _shapekernels_h_
+
+#include <cmath>
+#include <cstddef>
+
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+/**
+ * The kernels in this file hold the shape math used by the ShapeOps classes. Every kernel derives
+ * from ShapeKernel<Derived> and provides
+ *
+ *   float radcur1(const ShapeParameters& params);           // sets up the kernel, returns the radius
+ *   float inside(float axis1, float axis2, float axis3) const; // > 0 inside, 0 on the surface, < 0 outside
+ *   void init();                                              // resets any shape constants
+ *
+ * The CRTP base then supplies the batch evaluations over whole voxel rows and bounding boxes. Because
+ * inside() is resolved at compile time those loops inline it and are written so that the compiler can
+ * vectorize them; the ShapeOps wrappers pay a single virtual call per row or box instead of one per voxel.
+ */
+
+/**
+ * @brief The ShapeParameters struct holds the per feature values that size a shape.
+ */
+struct ShapeParameters
+{
+  ShapeParameters()
+  : omega3(0.0f)
+  , bOverA(0.0f)
+  , cOverA(0.0f)
+  , volCur(0.0f)
+  {
+  }
+
+  ShapeParameters(float omega3Value, float bOverAValue, float cOverAValue, float volCurValue)
+  : omega3(omega3Value)
+  , bOverA(bOverAValue)
+  , cOverA(cOverAValue)
+  , volCur(volCurValue)
+  {
+  }
+
+  float omega3;
+  float bOverA;
+  float cOverA;
+  float volCur;
+};
+
+/**
+ * @brief The ShapeKernel class is the CRTP base of the shape kernels.
+ */
+template <typename Derived> class ShapeKernel
+{
+public:
+  void init()
+  {
+  }
+
+  /**
+   * @brief insidePoints Evaluates inside() for count points given as separate coordinate arrays.
+   */
+  void insidePoints(const float* axis1, const float* axis2, const float* axis3, size_t count, float* inside) const
+  {
+    // Work on a local copy so the shape constants can live in registers; the output can not alias them
+    const Derived shape = static_cast<const Derived&>(*this);
+    for(size_t i = 0; i < count; i++)
+    {
+      inside[i] = shape.inside(axis1[i], axis2[i], axis3[i]);
+    }
+  }
+
+  /**
+   * @brief insideRow Evaluates inside() for a row of count voxels. The shape frame coordinates of voxel i
+   * are start + i * step, which is how a row of an axis aligned grid looks after the rotation and scaling
+   * into the frame of the shape.
+   */
+  void insideRow(const float start[3], const float step[3], size_t count, float* inside) const
+  {
+    const Derived shape = static_cast<const Derived&>(*this);
+    const float start0 = start[0];
+    const float start1 = start[1];
+    const float start2 = start[2];
+    const float step0 = step[0];
+    const float step1 = step[1];
+    const float step2 = step[2];
+    for(size_t i = 0; i < count; i++)
+    {
+      const float t = static_cast<float>(i);
+      inside[i] = shape.inside(start0 + t * step0, start1 + t * step1, start2 + t * step2);
+    }
+  }
+
+  /**
+   * @brief insideBox Evaluates inside() for a box of dims[0] x dims[1] x dims[2] voxels whose first voxel sits at
+   * origin in the shape frame. stepX, stepY and stepZ are the shape frame offsets between neighboring voxels
+   * along each grid axis. The output is written X fastest, like the voxels of an ImageGeom.
+   */
+  void insideBox(const float origin[3], const float stepX[3], const float stepY[3], const float stepZ[3], const size_t dims[3], float* inside) const
+  {
+    float rowStart[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      const float tz = static_cast<float>(z);
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        const float ty = static_cast<float>(y);
+        for(size_t c = 0; c < 3; c++)
+        {
+          rowStart[c] = origin[c] + ty * stepY[c] + tz * stepZ[c];
+        }
+        insideRow(rowStart, stepX, dims[0], inside + (z * dims[1] + y) * dims[0]);
+      }
+    }
+  }
+};
+
+/**
+ * @brief The EllipsoidKernel class
+ */
+class EllipsoidKernel : public ShapeKernel<EllipsoidKernel>
+{
+public:
+  float radcur1(const ShapeParameters& params)
+  {
+    float radcur1 = (params.volCur * 0.75f * (SIMPLib::Constants::k_1OverPi) * (1.0f / params.bOverA) * (1.0f / params.cOverA));
+    return powf(radcur1, 0.333333333333f);
+  }
+
+  inline float inside(float axis1comp, float axis2comp, float axis3comp) const
+  {
+    return 1.0f - axis1comp * axis1comp - axis2comp * axis2comp - axis3comp * axis3comp;
+  }
+};
+
+/**
+ * @brief The SuperEllipsoidKernel class. radcur1 picks the exponent N whose shape matches omega3 best.
+ */
+class SuperEllipsoidKernel : public ShapeKernel<SuperEllipsoidKernel>
+{
+public:
+  SuperEllipsoidKernel()
+  : m_Nvalue(0.0f)
+  {
+  }
+
+  void init()
+  {
+    m_Nvalue = 0.0f;
+  }
+
+  float getNvalue() const
+  {
+    return m_Nvalue;
+  }
+
+  float radcur1(const ShapeParameters& params)
+  {
+    const OmegaTable& table = GetOmegaTable();
+    float bestNvaluedist = 1000000.0f;
+    for(int i = 0; i < k_TableSize; i++)
+    {
+      float Nvaluedist = fabsf(params.omega3 - table.omega3[i]);
+      if(Nvaluedist < bestNvaluedist)
+      {
+        bestNvaluedist = Nvaluedist;
+        m_Nvalue = table.nValue[i];
+      }
+    }
+    float beta1 = (SIMPLibMath::Gamma((1.0f / m_Nvalue)) * SIMPLibMath::Gamma((1.0f / m_Nvalue))) / SIMPLibMath::Gamma((2.0f / m_Nvalue));
+    float beta2 = (SIMPLibMath::Gamma((2.0f / m_Nvalue)) * SIMPLibMath::Gamma((1.0f / m_Nvalue))) / SIMPLibMath::Gamma((3.0f / m_Nvalue));
+    float radcur1 = (params.volCur * (3.0f / 2.0f) * (1.0f / params.bOverA) * (1.0f / params.cOverA) * ((m_Nvalue * m_Nvalue) / 4.0f) * (1.0f / beta1) * (1.0f / beta2));
+    return powf(radcur1, 0.333333333333f);
+  }
+
+  inline float inside(float axis1comp, float axis2comp, float axis3comp) const
+  {
+    return 1.0f - powf(fabsf(axis1comp), m_Nvalue) - powf(fabsf(axis2comp), m_Nvalue) - powf(fabsf(axis3comp), m_Nvalue);
+  }
+
+private:
+  static const int k_TableSize = 41;
+
+  struct OmegaTable
+  {
+    float omega3[k_TableSize];
+    float nValue[k_TableSize];
+  };
+
+  /**
+   * @brief GetOmegaTable Returns the omega3 value of every tabulated exponent N = 0, 0.25, ..., 10. The
+   * table only depends on N so it is built once instead of on every radcur1 call.
+   */
+  static const OmegaTable& GetOmegaTable()
+  {
+    static const OmegaTable table = BuildOmegaTable();
+    return table;
+  }
+
+  static OmegaTable BuildOmegaTable()
+  {
+    OmegaTable table;
+    for(int i = 0; i < k_TableSize; i++)
+    {
+      float n = 0.25f * static_cast<float>(i);
+      float a = SIMPLibMath::Gamma(1.0f + 1.0f / n);
+      float b = SIMPLibMath::Gamma(5.0f / n);
+      float c = SIMPLibMath::Gamma(3.0f / n);
+      float d = SIMPLibMath::Gamma(1.0f + 3.0f / n);
+      table.omega3[i] = static_cast<float>(powf(20.0f * ((a * a * a) * b) / (c * powf(d, 5.0f / 3.0f)), 3.0f) / (2000.0f * M_PI * M_PI / 9.0f));
+      table.nValue[i] = n;
+    }
+    return table;
+  }
+
+  float m_Nvalue;
+};
+
+/**
+ * @brief The CubeOctohedronKernel class. radcur1 picks the truncation G whose shape matches omega3 best and
+ * caches the offsets and normalizations of the eight octahedral planes, which only depend on G.
+ */
+class CubeOctohedronKernel : public ShapeKernel<CubeOctohedronKernel>
+{
+public:
+  CubeOctohedronKernel()
+  {
+    setGvalue(0.0f);
+  }
+
+  void init()
+  {
+    setGvalue(0.0f);
+  }
+
+  float getGvalue() const
+  {
+    return m_Gvalue;
+  }
+
+  float radcur1(const ShapeParameters& params)
+  {
+    static const float shapeClass3Omega3[41][2] = {{0.787873524f, 0.0f},  {0.78793553f, 0.05f},  {0.788341216f, 0.1f},  {0.789359741f, 0.15f}, {0.791186818f, 0.2f},  {0.793953966f, 0.25f}, {0.797737494f, 0.3f},
+                                                   {0.802566619f, 0.35f}, {0.808430467f, 0.4f},  {0.815283954f, 0.45f}, {0.823052718f, 0.5f},  {0.831637359f, 0.55f}, {0.840917349f, 0.6f},  {0.850755028f, 0.65f},
+                                                   {0.86100021f, 0.7f},   {0.871496036f, 0.75f}, {0.882086906f, 0.8f},  {0.892629636f, 0.85f}, {0.903009489f, 0.9f},  {0.913163591f, 0.95f}, {0.92311574f, 1.00f},
+                                                   {0.932874613f, 1.05f}, {0.941981628f, 1.1f},  {0.949904418f, 1.15f}, {0.956171947f, 1.2f},  {0.96037277f, 1.25f},  {0.962158855f, 1.3f},  {0.961254001f, 1.35f},
+                                                   {0.957466141f, 1.4f},  {0.950703099f, 1.45f}, {0.940991385f, 1.5f},  {0.92849772f, 1.55f},  {0.913552923f, 1.6f},  {0.89667764f, 1.65f},  {0.878608694f, 1.7f},
+                                                   {0.860322715f, 1.75f}, {0.843047317f, 1.8f},  {0.828232275f, 1.85f}, {0.81740437f, 1.9f},   {0.811701359f, 1.95f}, {0.810569469f, 2.0f}};
+    float radcur1 = 0.0f;
+    float bestGvaluedist = 1000000.0f;
+    float gValue = m_Gvalue;
+    for(int i = 0; i < 41; i++)
+    {
+      float Gvaluedist = fabsf(params.omega3 - shapeClass3Omega3[i][0]);
+      if(Gvaluedist < bestGvaluedist)
+      {
+        bestGvaluedist = Gvaluedist;
+        gValue = shapeClass3Omega3[i][1];
+      }
+    }
+    setGvalue(gValue);
+    if(m_Gvalue >= 0 && m_Gvalue <= 1)
+    {
+      radcur1 = static_cast<float>((params.volCur * 6.0) / (6 - (m_Gvalue * m_Gvalue * m_Gvalue)));
+    }
+    if(m_Gvalue > 1 && m_Gvalue <= 2)
+    {
+      radcur1 = static_cast<float>((params.volCur * 6.0) / (3 + (9 * m_Gvalue) - (9 * m_Gvalue * m_Gvalue) + (2 * m_Gvalue * m_Gvalue * m_Gvalue)));
+    }
+    radcur1 = powf(radcur1, 0.333333333333f);
+    return radcur1 * 0.5f;
+  }
+
+  inline float inside(float axis1comp, float axis2comp, float axis3comp) const
+  {
+    float inside = 1 - fabsf(axis1comp);
+    inside = Min(1 - fabsf(axis2comp), inside);
+    inside = Min(1 - fabsf(axis3comp), inside);
+
+    const float a1 = static_cast<float>(axis1comp + 1.0);
+    const float a2 = static_cast<float>(axis2comp + 1.0);
+    const float a3 = static_cast<float>(axis3comp + 1.0);
+    // Planes 4 and 7 mix in double precision terms, the rest are plain float arithmetic
+    inside = Min(((-a1) + (-a2) + (a3) - m_PlaneOffset[0]) / m_PlaneNormalization[0], inside);
+    inside = Min(((a1) + (-a2) + (a3) - m_PlaneOffset[1]) / m_PlaneNormalization[1], inside);
+    inside = Min(((a1) + (a2) + (a3) - m_PlaneOffset[2]) / m_PlaneNormalization[2], inside);
+    inside = Min(static_cast<float>((-a1) + (a2) + (a3) - m_Plane4Offset) / m_PlaneNormalization[3], inside);
+    inside = Min(((-a1) + (-a2) + (-a3) - m_PlaneOffset[4]) / m_PlaneNormalization[4], inside);
+    inside = Min(((a1) + (-a2) + (-a3) - m_PlaneOffset[5]) / m_PlaneNormalization[5], inside);
+    inside = Min(static_cast<float>(((a1) + (a2) + (-a3) - m_PlaneOffset[6]) / m_Plane7Normalization), inside);
+    inside = Min(((-a1) + (a2) + (-a3) - m_PlaneOffset[7]) / m_PlaneNormalization[7], inside);
+    return inside;
+  }
+
+private:
+  static const int k_NumPlanes = 8;
+
+  static inline float Min(float value, float current)
+  {
+    return (value < current) ? value : current;
+  }
+
+  void setGvalue(float gValue)
+  {
+    m_Gvalue = gValue;
+    const float h = 0.5f * gValue;
+    const double hd = 0.5 * gValue;
+    const float offsets[k_NumPlanes] = {(-h) + (-h) + 2.0f, (2.0f - h) + (-h) + 2.0f, (2.0f - h) + (2.0f - h) + 2.0f, (-h) + (2.0f - h) + 2.0f, (-h) + (-h), (2.0f - h) + (-h), (2.0f - h) + (2.0f - h), (-h) + (2.0f - h)};
+    const float normalSums[k_NumPlanes] = {-1.0f, 1.0f, 3.0f, 1.0f, -3.0f, -1.0f, 1.0f, -1.0f};
+    for(int i = 0; i < k_NumPlanes; i++)
+    {
+      m_PlaneOffset[i] = offsets[i];
+      m_PlaneNormalization[i] = normalSums[i] - offsets[i];
+    }
+    m_Plane4Offset = (-h) + (2.0f - hd) + 2.0f;
+    m_Plane7Normalization = 1.0f - ((2.0f - h) + (2.0f - hd));
+  }
+
+  float m_Gvalue;
+  float m_PlaneOffset[k_NumPlanes];
+  float m_PlaneNormalization[k_NumPlanes];
+  double m_Plane4Offset;
+  double m_Plane7Normalization;
+};
+
+/**
+ * @brief The CylinderKernel class. Axis selects the cylinder axis: 0 for CylinderA, 1 for CylinderB and 2 for CylinderC.
+ */
+template <int Axis> class CylinderKernel : public ShapeKernel<CylinderKernel<Axis>>
+{
+public:
+  float radcur1(const ShapeParameters& params)
+  {
+    // the equation for volume for a cylinder is pi*r1*r2*h where r1 and r2 are semi axis lengths, but
+    // h is a full axis length. However, since our aspect ratios relate semi axis lengths, the 2.0
+    // factor can be ignored in this part
+    float radcur1 = static_cast<float>((params.volCur * SIMPLib::Constants::k_1OverPi * (1.0f / params.bOverA) * (1.0f / params.cOverA)));
+    return powf(radcur1, 0.333333333333f);
+  }
+
+  inline float inside(float axis1comp, float axis2comp, float axis3comp) const
+  {
+    const float axial = (Axis == 0) ? axis1comp : ((Axis == 1) ? axis2comp : axis3comp);
+    const float radial1 = (Axis == 0) ? axis2comp : axis1comp;
+    const float radial2 = (Axis == 2) ? axis2comp : axis3comp;
+    const float inside = static_cast<float>(1.0 - radial1 * radial1 - radial2 * radial2);
+    return (fabsf(axial) <= 1.0f) ? inside : -1.0f;
+  }
+};
+
+typedef CylinderKernel<0> CylinderAKernel;
+typedef CylinderKernel<1> CylinderBKernel;
+typedef CylinderKernel<2> CylinderCKernel;
+
+#endif /* _shapekernels_h_ */
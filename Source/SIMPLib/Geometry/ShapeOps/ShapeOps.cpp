@@ -90,10 +90,26 @@ std::vector<ShapeOps::Pointer> ShapeOps::getShapeOpsVector()
   return m_ShapeOps;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ShapeParameters ShapeOps::ToShapeParameters(const QMap<ArgName, float>& args)
+{
+  return ShapeParameters(args.value(Omega3, 0.0f), args.value(B_OverA, 0.0f), args.value(C_OverA, 0.0f), args.value(VolCur, 0.0f));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 float ShapeOps::radcur1(QMap<ArgName, float> args)
+{
+  return radcur1(ToShapeParameters(args));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float ShapeOps::radcur1(const ShapeParameters& params)
 {
   return cube_root_of_one;
 }
@@ -106,6 +122,37 @@ float ShapeOps::inside(float axis1comp, float axis2comp, float axis3comp)
   return -1.0;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ShapeOps::insideRow(const float start[3], const float step[3], size_t count, float* inside)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    const float t = static_cast<float>(i);
+    inside[i] = this->inside(start[0] + t * step[0], start[1] + t * step[1], start[2] + t * step[2]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ShapeOps::insideBox(const float origin[3], const float stepX[3], const float stepY[3], const float stepZ[3], const size_t dims[3], float* inside)
+{
+  float rowStart[3] = {0.0f, 0.0f, 0.0f};
+  for(size_t z = 0; z < dims[2]; z++)
+  {
+    for(size_t y = 0; y < dims[1]; y++)
+    {
+      for(size_t c = 0; c < 3; c++)
+      {
+        rowStart[c] = origin[c] + static_cast<float>(y) * stepY[c] + static_cast<float>(z) * stepZ[c];
+      }
+      insideRow(rowStart, stepX, dims[0], inside + (z * dims[1] + y) * dims[0]);
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
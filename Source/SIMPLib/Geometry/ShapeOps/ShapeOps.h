@@ -44,6 +44,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Geometry/ShapeOps/ShapeKernels.hpp"
 
 /**
  * @brief The ShapeOps class
@@ -81,10 +82,50 @@ class SIMPLib_EXPORT ShapeOps
     */
     static std::vector<ShapeOps::Pointer> getShapeOpsVector();
 
+    /**
+    * @brief ToShapeParameters Converts the legacy argument map into a ShapeParameters struct
+    * @param args
+    * @return
+    */
+    static ShapeParameters ToShapeParameters(const QMap<ArgName, float>& args);
+
+    /**
+    * @brief radcur1 Legacy entry point; converts the arguments and forwards to radcur1(const ShapeParameters&)
+    * @param args
+    * @return
+    */
     virtual float radcur1(QMap<ArgName, float> args);
 
+    /**
+    * @brief radcur1 Sets up the shape for the given parameters and returns its radius
+    * @param params
+    * @return
+    */
+    virtual float radcur1(const ShapeParameters& params);
+
     virtual float inside(float axis1comp, float axis2comp, float axis3comp);
 
+    /**
+    * @brief insideRow Evaluates inside() for count voxels whose shape frame coordinates are start + i * step
+    * @param start
+    * @param step
+    * @param count
+    * @param inside Output array of count values
+    */
+    virtual void insideRow(const float start[3], const float step[3], size_t count, float* inside);
+
+    /**
+    * @brief insideBox Evaluates inside() for a dims[0] x dims[1] x dims[2] box of voxels, X fastest. origin is the
+    * shape frame position of the first voxel and stepX, stepY, stepZ the shape frame offsets along each grid axis.
+    * @param origin
+    * @param stepX
+    * @param stepY
+    * @param stepZ
+    * @param dims
+    * @param inside Output array of dims[0] * dims[1] * dims[2] values
+    */
+    virtual void insideBox(const float origin[3], const float stepX[3], const float stepY[3], const float stepZ[3], const size_t dims[3], float* inside);
+
     virtual void init();
 
   protected:
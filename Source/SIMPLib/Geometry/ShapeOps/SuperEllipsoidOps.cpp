@@ -37,16 +37,10 @@
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 
-float ShapeClass2Omega3[41][2] = {{0.0f, 0.0f},  {0.0f, 0.25f}, {0.0f, 0.5f},  {0.0f, 0.75f}, {0.0f, 1.0f},  {0.0f, 1.25f}, {0.0f, 1.5f},  {0.0f, 1.75f}, {0.0f, 2.0f},  {0.0f, 2.25f}, {0.0f, 2.5f},
-                                  {0.0f, 2.75f}, {0.0f, 3.0f},  {0.0f, 3.25f}, {0.0f, 3.5f},  {0.0f, 3.75f}, {0.0f, 4.0f},  {0.0f, 4.25f}, {0.0f, 4.5f},  {0.0f, 4.75f}, {0.0f, 5.0f},  {0.0f, 5.25f},
-                                  {0.0f, 5.5f},  {0.0f, 5.75f}, {0.0f, 6.0f},  {0.0f, 6.25f}, {0.0f, 6.5f},  {0.0f, 6.75f}, {0.0f, 7.0f},  {0.0f, 7.25f}, {0.0f, 7.5f},  {0.0f, 7.75f}, {0.0f, 8.0f},
-                                  {0.0f, 8.25f}, {0.0f, 8.5f},  {0.0f, 8.75f}, {0.0f, 9.0f},  {0.0f, 9.25f}, {0.0f, 9.5f},  {0.0f, 9.75f}, {0.0f, 10.0f}};
-
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 SuperEllipsoidOps::SuperEllipsoidOps()
-: Nvalue(0.0f)
 {
 }
 
@@ -60,56 +54,37 @@ SuperEllipsoidOps::~SuperEllipsoidOps() = default;
 // -----------------------------------------------------------------------------
 void SuperEllipsoidOps::init()
 {
-  Nvalue = 0.0f;
+  m_Kernel.init();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float SuperEllipsoidOps::radcur1(QMap<ArgName, float> args)
+float SuperEllipsoidOps::radcur1(const ShapeParameters& params)
 {
-  float radcur1 = 0.0f;
-  float Nvaluedist = 0.0f;
-  float bestNvaluedist = 1000000.0f;
+  return m_Kernel.radcur1(params);
+}
 
-  float omega3 = args[Omega3];
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float SuperEllipsoidOps::inside(float axis1comp, float axis2comp, float axis3comp)
+{
+  return m_Kernel.inside(axis1comp, axis2comp, axis3comp);
+}
 
-  for(int i = 0; i < 41; i++)
-  {
-    float a = SIMPLibMath::Gamma(1.0f + 1.0f / ShapeClass2Omega3[i][1]);
-    float b = SIMPLibMath::Gamma(5.0f / ShapeClass2Omega3[i][1]);
-    float c = SIMPLibMath::Gamma(3.0f / ShapeClass2Omega3[i][1]);
-    float d = SIMPLibMath::Gamma(1.0f + 3.0f / ShapeClass2Omega3[i][1]);
-    ShapeClass2Omega3[i][0] = static_cast<float>(powf(20.0f * ((a * a * a) * b) / (c * powf(d, 5.0f / 3.0f)), 3.0f) / (2000.0f * M_PI * M_PI / 9.0f));
-    Nvaluedist = fabsf(omega3 - ShapeClass2Omega3[i][0]);
-    if(Nvaluedist < bestNvaluedist)
-    {
-      bestNvaluedist = Nvaluedist;
-      Nvalue = ShapeClass2Omega3[i][1];
-    }
-  }
-  float beta1 = (SIMPLibMath::Gamma((1.0f / Nvalue)) * SIMPLibMath::Gamma((1.0f / Nvalue))) / SIMPLibMath::Gamma((2.0f / Nvalue));
-  float beta2 = (SIMPLibMath::Gamma((2.0f / Nvalue)) * SIMPLibMath::Gamma((1.0f / Nvalue))) / SIMPLibMath::Gamma((3.0f / Nvalue));
-  radcur1 = (volcur * (3.0f / 2.0f) * (1.0f / bovera) * (1.0f / covera) * ((Nvalue * Nvalue) / 4.0f) * (1.0f / beta1) * (1.0f / beta2));
-  radcur1 = powf(radcur1, 0.333333333333f);
-  return radcur1;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SuperEllipsoidOps::insideRow(const float start[3], const float step[3], size_t count, float* inside)
+{
+  m_Kernel.insideRow(start, step, count, inside);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float SuperEllipsoidOps::inside(float axis1comp, float axis2comp, float axis3comp)
+void SuperEllipsoidOps::insideBox(const float origin[3], const float stepX[3], const float stepY[3], const float stepZ[3], const size_t dims[3], float* inside)
 {
-  float inside = 1.0f;
-  axis1comp = fabs(axis1comp);
-  axis2comp = fabs(axis2comp);
-  axis3comp = fabs(axis3comp);
-  axis1comp = powf(axis1comp, Nvalue);
-  axis2comp = powf(axis2comp, Nvalue);
-  axis3comp = powf(axis3comp, Nvalue);
-  inside = 1.0f - axis1comp - axis2comp - axis3comp;
-  return inside;
+  m_Kernel.insideBox(origin, stepX, stepY, stepZ, dims, inside);
 }
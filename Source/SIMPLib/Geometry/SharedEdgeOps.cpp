@@ -50,6 +50,7 @@ SharedEdgeList::Pointer GEOM_CLASS_NAME::CreateSharedEdgeList(int64_t numEdges,
 void GEOM_CLASS_NAME::resizeEdgeList(int64_t newNumEdges)
 {
   m_EdgeList->resize(newNumEdges);
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -65,6 +66,7 @@ void GEOM_CLASS_NAME::setEdges(SharedEdgeList::Pointer edges)
     }
   }
   m_EdgeList = edges;
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -72,6 +74,8 @@ void GEOM_CLASS_NAME::setEdges(SharedEdgeList::Pointer edges)
 // -----------------------------------------------------------------------------
 SharedEdgeList::Pointer GEOM_CLASS_NAME::getEdges()
 {
+  // The caller may write through what is returned
+  elementGeometryModified();
   return m_EdgeList;
 }
 
@@ -83,6 +87,7 @@ void GEOM_CLASS_NAME::setVertsAtEdge(int64_t edgeId, int64_t verts[2])
   int64_t* Edge = m_EdgeList->getTuplePointer(edgeId);
   Edge[0] = verts[0];
   Edge[1] = verts[1];
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -115,6 +120,16 @@ void GEOM_CLASS_NAME::getVertCoordsAtEdge(int64_t edgeId, float vert1[3], float
 //
 // -----------------------------------------------------------------------------
 int64_t* GEOM_CLASS_NAME::getEdgePointer(int64_t i)
+{
+  // The caller may write through what is returned
+  elementGeometryModified();
+  return m_EdgeList->getTuplePointer(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const int64_t* GEOM_CLASS_NAME::getEdgePointer(int64_t i) const
 {
   return m_EdgeList->getTuplePointer(i);
 }
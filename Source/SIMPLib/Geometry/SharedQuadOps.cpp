@@ -50,6 +50,7 @@ SharedQuadList::Pointer GEOM_CLASS_NAME::CreateSharedQuadList(int64_t numQuads,
 void GEOM_CLASS_NAME::resizeQuadList(int64_t newNumQuads)
 {
   m_QuadList->resize(newNumQuads);
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -65,6 +66,7 @@ void GEOM_CLASS_NAME::setQuads(SharedQuadList::Pointer quads)
     }
   }
   m_QuadList = quads;
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -72,6 +74,8 @@ void GEOM_CLASS_NAME::setQuads(SharedQuadList::Pointer quads)
 // -----------------------------------------------------------------------------
 SharedQuadList::Pointer GEOM_CLASS_NAME::getQuads()
 {
+  // The caller may write through what is returned
+  elementGeometryModified();
   return m_QuadList;
 }
 
@@ -85,6 +89,7 @@ void GEOM_CLASS_NAME::setVertsAtQuad(int64_t quadId, int64_t verts[4])
   Quad[1] = verts[1];
   Quad[2] = verts[2];
   Quad[3] = verts[3];
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -127,6 +132,16 @@ void GEOM_CLASS_NAME::getVertCoordsAtQuad(int64_t quadId, float vert1[3], float
 //
 // -----------------------------------------------------------------------------
 int64_t* GEOM_CLASS_NAME::getQuadPointer(int64_t i)
+{
+  // The caller may write through what is returned
+  elementGeometryModified();
+  return m_QuadList->getTuplePointer(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const int64_t* GEOM_CLASS_NAME::getQuadPointer(int64_t i) const
 {
   return m_QuadList->getTuplePointer(i);
 }
@@ -50,6 +50,7 @@ SharedTetList::Pointer GEOM_CLASS_NAME::CreateSharedTetList(int64_t numTets, boo
 void GEOM_CLASS_NAME::resizeTetList(int64_t newNumTets)
 {
   m_TetList->resize(newNumTets);
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -65,6 +66,7 @@ void GEOM_CLASS_NAME::setTetrahedra(SharedTetList::Pointer tets)
     }
   }
   m_TetList = tets;
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -72,6 +74,8 @@ void GEOM_CLASS_NAME::setTetrahedra(SharedTetList::Pointer tets)
 // -----------------------------------------------------------------------------
 SharedTetList::Pointer GEOM_CLASS_NAME::getTetrahedra()
 {
+  // The caller may write through what is returned
+  elementGeometryModified();
   return m_TetList;
 }
 
@@ -85,6 +89,7 @@ void GEOM_CLASS_NAME::setVertsAtTet(int64_t tetId, int64_t verts[4])
   tet[1] = verts[1];
   tet[2] = verts[2];
   tet[3] = verts[3];
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -127,6 +132,16 @@ void GEOM_CLASS_NAME::getVertCoordsAtTet(int64_t tetId, float vert1[3], float ve
 //
 // -----------------------------------------------------------------------------
 int64_t* GEOM_CLASS_NAME::getTetPointer(int64_t i)
+{
+  // The caller may write through what is returned
+  elementGeometryModified();
+  return m_TetList->getTuplePointer(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const int64_t* GEOM_CLASS_NAME::getTetPointer(int64_t i) const
 {
   return m_TetList->getTuplePointer(i);
 }
@@ -50,6 +50,7 @@ SharedTriList::Pointer GEOM_CLASS_NAME::CreateSharedTriList(int64_t numTris, boo
 void GEOM_CLASS_NAME::resizeTriList(int64_t newNumTris)
 {
   m_TriList->resize(newNumTris);
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -65,6 +66,7 @@ void GEOM_CLASS_NAME::setTriangles(SharedTriList::Pointer triangles)
     }
   }
   m_TriList = triangles;
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -72,6 +74,8 @@ void GEOM_CLASS_NAME::setTriangles(SharedTriList::Pointer triangles)
 // -----------------------------------------------------------------------------
 SharedTriList::Pointer GEOM_CLASS_NAME::getTriangles()
 {
+  // The caller may write through what is returned
+  elementGeometryModified();
   return m_TriList;
 }
 
@@ -84,6 +88,7 @@ void GEOM_CLASS_NAME::setVertsAtTri(int64_t triId, int64_t verts[3])
   Tri[0] = verts[0];
   Tri[1] = verts[1];
   Tri[2] = verts[2];
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -121,6 +126,16 @@ void GEOM_CLASS_NAME::getVertCoordsAtTri(int64_t triId, float vert1[3], float ve
 //
 // -----------------------------------------------------------------------------
 int64_t* GEOM_CLASS_NAME::getTriPointer(int64_t i)
+{
+  // The caller may write through what is returned
+  elementGeometryModified();
+  return m_TriList->getTuplePointer(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const int64_t* GEOM_CLASS_NAME::getTriPointer(int64_t i) const
 {
   return m_TriList->getTuplePointer(i);
 }
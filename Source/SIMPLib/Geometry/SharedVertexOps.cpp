@@ -50,6 +50,7 @@ SharedVertexList::Pointer GEOM_CLASS_NAME::CreateSharedVertexList(int64_t numVer
 void GEOM_CLASS_NAME::resizeVertexList(int64_t newNumVertices)
 {
   m_VertexList->resize(newNumVertices);
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -65,6 +66,7 @@ void GEOM_CLASS_NAME::setVertices(SharedVertexList::Pointer vertices)
     }
   }
   m_VertexList = vertices;
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -72,6 +74,8 @@ void GEOM_CLASS_NAME::setVertices(SharedVertexList::Pointer vertices)
 // -----------------------------------------------------------------------------
 SharedVertexList::Pointer GEOM_CLASS_NAME::getVertices()
 {
+  // The caller may write through what is returned
+  elementGeometryModified();
   return m_VertexList;
 }
 
@@ -84,6 +88,7 @@ void GEOM_CLASS_NAME::setCoords(int64_t vertId, float coords[3])
   Vert[0] = coords[0];
   Vert[1] = coords[1];
   Vert[2] = coords[2];
+  elementGeometryModified();
 }
 
 // -----------------------------------------------------------------------------
@@ -101,6 +106,16 @@ void GEOM_CLASS_NAME::getCoords(int64_t vertId, float coords[3])
 //
 // -----------------------------------------------------------------------------
 float* GEOM_CLASS_NAME::getVertexPointer(int64_t i)
+{
+  // The caller may write through what is returned
+  elementGeometryModified();
+  return m_VertexList->getTuplePointer(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const float* GEOM_CLASS_NAME::getVertexPointer(int64_t i) const
 {
   return m_VertexList->getTuplePointer(i);
 }
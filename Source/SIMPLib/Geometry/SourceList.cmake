@@ -5,11 +5,13 @@ set(SUBDIR_NAME Geometry)
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/EdgeGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/GeometryHelpers.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/GridNeighborhood.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry2D.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry3D.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometryGrid.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/MeshReorderer.h
   ${SIMPLib_SOURCE_DIR}/Geometry/MeshStructs.h
   ${SIMPLib_SOURCE_DIR}/Geometry/QuadGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/RectGridGeom.h
@@ -18,11 +20,14 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CylinderBOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CylinderCOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/EllipsoidOps.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/ShapeKernels.hpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/ShapeOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/TriangleBVH.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexWelder.h
 )
 
 set(SIMPLib_${SUBDIR_NAME}_SRCS
@@ -33,6 +38,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry3D.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometryGrid.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/MeshReorderer.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/QuadGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/RectGridGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CubeOctohedronOps.cpp
@@ -43,8 +49,10 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/ShapeOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/TriangleBVH.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/VertexWelder.cpp
 )
 
 if(SIMPL_USE_EIGEN)
@@ -1,10 +1,13 @@
 
 #include <stdlib.h>
 
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 #include <QtCore/QFile>
 
+#include "SIMPLib/Geometry/GridNeighborhood.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
@@ -91,6 +94,225 @@ public:
     DREAM3D_REQUIRE(err == ImageGeom::ErrorType::ZOutOfBoundsHigh)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNativeDerivatives()
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    size_t dims[3] = {7, 5, 4};
+    float res[3] = {0.5f, 0.25f, 2.0f};
+    geom->setDimensions(dims);
+    geom->setResolution(res);
+
+    // A linear field has the same derivative at interior and boundary voxels
+    size_t numVoxels = dims[0] * dims[1] * dims[2];
+    Int32ArrayType::Pointer field = Int32ArrayType::CreateArray(numVoxels, "Field", true);
+    DoubleArrayType::Pointer dblField = DoubleArrayType::CreateArray(numVoxels, "DoubleField", true);
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          size_t index = (z * dims[1] + y) * dims[0] + x;
+          int32_t value = static_cast<int32_t>(2 * x + 3 * y) - static_cast<int32_t>(z);
+          field->setValue(index, value);
+          dblField->setValue(index, static_cast<double>(value));
+        }
+      }
+    }
+
+    QVector<size_t> cDims(1, 3);
+    DoubleArrayType::Pointer dblDerivs = DoubleArrayType::CreateArray(numVoxels, cDims, "DoubleDerivatives", true);
+    FloatArrayType::Pointer fltDerivs = FloatArrayType::CreateArray(numVoxels, cDims, "FloatDerivatives", true);
+    DoubleArrayType::Pointer refDerivs = DoubleArrayType::CreateArray(numVoxels, cDims, "ReferenceDerivatives", true);
+    geom->findDerivatives<int32_t, double>(field, dblDerivs);
+    geom->findDerivatives<int32_t, float>(field, fltDerivs);
+    geom->findDerivatives(dblField, refDerivs);
+
+    double expected[3] = {4.0, 12.0, -0.5};
+    for(size_t i = 0; i < numVoxels; i++)
+    {
+      for(size_t j = 0; j < 3; j++)
+      {
+        double dblError = std::fabs(dblDerivs->getComponent(i, j) - expected[j]);
+        double fltError = std::fabs(static_cast<double>(fltDerivs->getComponent(i, j)) - expected[j]);
+        double refError = std::fabs(refDerivs->getComponent(i, j) - expected[j]);
+        DREAM3D_REQUIRED(dblError, <, 1.0E-9)
+        DREAM3D_REQUIRED(fltError, <, 1.0E-5)
+        DREAM3D_REQUIRED(refError, <, 1.0E-9)
+      }
+    }
+
+    // A flat direction has a zero derivative
+    dims[2] = 1;
+    geom->setDimensions(dims);
+    numVoxels = dims[0] * dims[1];
+    dblDerivs->resize(numVoxels);
+    geom->findDerivatives<int32_t, double>(field, dblDerivs);
+    for(size_t i = 0; i < numVoxels; i++)
+    {
+      double dx = dblDerivs->getComponent(i, 0);
+      double dz = dblDerivs->getComponent(i, 2);
+      DREAM3D_REQUIRE_EQUAL(dx, 4.0)
+      DREAM3D_REQUIRE_EQUAL(dz, 0.0)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBulkCoords()
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    size_t dims[3] = {9, 7, 5};
+    float res[3] = {0.4f, 2.3f, 5.0f};
+    float origin[3] = {-1.0f, 6.0f, 10.0f};
+    geom->setDimensions(dims);
+    geom->setResolution(res);
+    geom->setOrigin(origin);
+    size_t numVoxels = geom->getNumberOfElements();
+
+    // A range that starts and ends in the middle of a row
+    size_t start = 5;
+    size_t end = numVoxels - 3;
+    std::vector<float> coords(3 * (end - start));
+    geom->getCoordsRange(start, end, coords.data());
+    std::vector<double> dblCoords(3 * (end - start));
+    geom->getCoordsRange(start, end, dblCoords.data());
+    for(size_t i = start; i < end; i++)
+    {
+      float expected[3] = {0.0f, 0.0f, 0.0f};
+      geom->getCoords(i, expected);
+      for(size_t j = 0; j < 3; j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(coords[3 * (i - start) + j], expected[j])
+        DREAM3D_REQUIRE_EQUAL(dblCoords[3 * (i - start) + j], static_cast<double>(expected[j]))
+      }
+    }
+
+    int err = geom->findElementCentroids();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    FloatArrayType::Pointer centroids = geom->getElementCentroids();
+    DREAM3D_REQUIRE_VALID_POINTER(centroids.get())
+    DREAM3D_REQUIRE_EQUAL(centroids->getNumberOfTuples(), numVoxels)
+    for(size_t i = 0; i < numVoxels; i++)
+    {
+      float expected[3] = {0.0f, 0.0f, 0.0f};
+      geom->getCoords(i, expected);
+      DREAM3D_REQUIRE_EQUAL(centroids->getComponent(i, 0), expected[0])
+      DREAM3D_REQUIRE_EQUAL(centroids->getComponent(i, 1), expected[1])
+      DREAM3D_REQUIRE_EQUAL(centroids->getComponent(i, 2), expected[2])
+    }
+
+    // The voxel centers map back to their own voxels
+    std::vector<int64_t> indices(numVoxels, -2);
+    size_t numInside = geom->computeCellIndices(centroids->getPointer(0), numVoxels, indices.data());
+    DREAM3D_REQUIRE_EQUAL(numInside, numVoxels)
+    for(size_t i = 0; i < numVoxels; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(indices[i], static_cast<int64_t>(i))
+    }
+
+    // Outside points, the upper corner and a NaN
+    float points[12] = {-5.0f, 9.0f, 12.0f, origin[0] + dims[0] * res[0], origin[1] + dims[1] * res[1], origin[2] + dims[2] * res[2], 0.0f, 200.0f, 12.0f, std::nanf(""), 9.0f, 12.0f};
+    int64_t pointIndices[4] = {0, 0, 0, 0};
+    numInside = geom->computeCellIndices(points, 4, pointIndices);
+    DREAM3D_REQUIRE_EQUAL(numInside, 1)
+    DREAM3D_REQUIRE_EQUAL(pointIndices[0], -1)
+    DREAM3D_REQUIRE_EQUAL(pointIndices[1], static_cast<int64_t>(numVoxels - 1))
+    DREAM3D_REQUIRE_EQUAL(pointIndices[2], -1)
+    DREAM3D_REQUIRE_EQUAL(pointIndices[3], -1)
+
+    // Changing the grid drops the centroids and neighbors computed for the old one
+    err = geom->findElementNeighbors();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    geom->setOrigin(0.0f, 0.0f, 0.0f);
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getElementCentroids().get())
+    geom->findElementCentroids();
+    geom->setResolution(1.0f, 1.0f, 1.0f);
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getElementCentroids().get())
+    err = geom->findElementNeighbors();
+    geom->setDimensions(dims[0] + 1, dims[1], dims[2]);
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getElementNeighbors().get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNeighborhood()
+  {
+    size_t dims[3] = {4, 3, 5};
+    GridNeighborhood faces(dims, GridNeighborhood::Connectivity::Face);
+    GridNeighborhood edges(dims, GridNeighborhood::Connectivity::FaceEdge);
+    GridNeighborhood corners(dims, GridNeighborhood::Connectivity::FaceEdgeCorner);
+    DREAM3D_REQUIRE_EQUAL(faces.size(), 6)
+    DREAM3D_REQUIRE_EQUAL(edges.size(), 18)
+    DREAM3D_REQUIRE_EQUAL(corners.size(), 26)
+
+    // The face neighbors keep the order the filters use
+    int64_t xy = static_cast<int64_t>(dims[0] * dims[1]);
+    int64_t x = static_cast<int64_t>(dims[0]);
+    DREAM3D_REQUIRE_EQUAL(faces.offset(0), -xy)
+    DREAM3D_REQUIRE_EQUAL(faces.offset(1), -x)
+    DREAM3D_REQUIRE_EQUAL(faces.offset(2), -1)
+    DREAM3D_REQUIRE_EQUAL(faces.offset(3), 1)
+    DREAM3D_REQUIRE_EQUAL(faces.offset(4), x)
+    DREAM3D_REQUIRE_EQUAL(faces.offset(5), xy)
+    DREAM3D_REQUIRE_EQUAL(corners.offset(25), xy + x + 1)
+
+    // Interior, face, edge and corner cells
+    DREAM3D_REQUIRE_EQUAL(GridNeighborhood::CountNeighbors(corners.getMask(1, 1, 2)), 26)
+    DREAM3D_REQUIRE_EQUAL(GridNeighborhood::CountNeighbors(corners.getMask(0, 1, 2)), 17)
+    DREAM3D_REQUIRE_EQUAL(GridNeighborhood::CountNeighbors(corners.getMask(0, 0, 2)), 11)
+    DREAM3D_REQUIRE_EQUAL(GridNeighborhood::CountNeighbors(corners.getMask(0, 0, 0)), 7)
+    DREAM3D_REQUIRE_EQUAL(GridNeighborhood::CountNeighbors(edges.getMask(3, 2, 4)), 6)
+    DREAM3D_REQUIRE_EQUAL(GridNeighborhood::CountNeighbors(faces.getMask(3, 2, 4)), 3)
+    DREAM3D_REQUIRE_EQUAL(faces.getMask(1, 1, 1), faces.getFullMask())
+
+    uint32_t first = 0;
+    uint32_t interior = 0;
+    uint32_t last = 0;
+    corners.getRowMasks(1, 0, first, interior, last);
+    DREAM3D_REQUIRE_EQUAL(first, corners.getMask(0, 1, 0))
+    DREAM3D_REQUIRE_EQUAL(interior, corners.getMask(1, 1, 0))
+    DREAM3D_REQUIRE_EQUAL(last, corners.getMask(3, 1, 0))
+
+    // Every neighbor in the mask is inside the grid, and the neighbor lists of the geometry match
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(dims);
+    int err = geom->findElementNeighbors();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    ElementDynamicList::Pointer neighbors = geom->getElementNeighbors();
+    DREAM3D_REQUIRE_VALID_POINTER(neighbors.get())
+    int64_t numVoxels = static_cast<int64_t>(geom->getNumberOfElements());
+    for(size_t k = 0; k < dims[2]; k++)
+    {
+      for(size_t j = 0; j < dims[1]; j++)
+      {
+        for(size_t i = 0; i < dims[0]; i++)
+        {
+          int64_t index = static_cast<int64_t>((k * dims[1] + j) * dims[0] + i);
+          std::vector<int64_t> expected;
+          corners.forEachNeighbor(index, corners.getMask(i, j, k), [&](size_t n, int64_t neighbor) {
+            DREAM3D_REQUIRE(neighbor >= 0 && neighbor < numVoxels)
+            if(n < 6)
+            {
+              expected.push_back(neighbor);
+            }
+          });
+          DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(index), expected.size())
+          int64_t* list = neighbors->getElementListPointer(index);
+          for(size_t n = 0; n < expected.size(); n++)
+          {
+            DREAM3D_REQUIRE_EQUAL(list[n], expected[n])
+          }
+        }
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -101,6 +323,9 @@ public:
 
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestIndexCalculation());
+    DREAM3D_REGISTER_TEST(TestNativeDerivatives());
+    DREAM3D_REGISTER_TEST(TestBulkCoords());
+    DREAM3D_REGISTER_TEST(TestNeighborhood());
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
@@ -0,0 +1,246 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class MeshGeometryMeasuresTest
+{
+public:
+  MeshGeometryMeasuresTest() = default;
+  virtual ~MeshGeometryMeasuresTest() = default;
+
+  const int64_t k_GridSize = 40;
+
+  // -----------------------------------------------------------------------------
+  // Vertices of a k_GridSize x k_GridSize grid on a tilted, stretched plane
+  // -----------------------------------------------------------------------------
+  SharedVertexList::Pointer CreateGridVertices()
+  {
+    SharedVertexList::Pointer vertices = QuadGeom::CreateSharedVertexList(k_GridSize * k_GridSize);
+    for(int64_t j = 0; j < k_GridSize; j++)
+    {
+      for(int64_t i = 0; i < k_GridSize; i++)
+      {
+        float* v = vertices->getTuplePointer(j * k_GridSize + i);
+        v[0] = 0.5f * static_cast<float>(i) + 0.01f * static_cast<float>(j * j);
+        v[1] = 0.75f * static_cast<float>(j);
+        v[2] = 0.3f * v[0] - 0.2f * v[1];
+      }
+    }
+    return vertices;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RequireClose(FloatArrayType::Pointer actual, FloatArrayType::Pointer expected, float relativeTolerance)
+  {
+    DREAM3D_REQUIRE_VALID_POINTER(actual.get())
+    DREAM3D_REQUIRE_EQUAL(actual->getSize(), expected->getSize())
+    for(size_t i = 0; i < actual->getSize(); i++)
+    {
+      float a = actual->getValue(i);
+      float e = expected->getValue(i);
+      float tolerance = relativeTolerance * std::max(1.0f, std::fabs(e));
+      DREAM3D_REQUIRED(std::fabs(a - e), <=, tolerance)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSurfaceMeasures()
+  {
+    SharedVertexList::Pointer vertices = CreateGridVertices();
+    int64_t numCells = (k_GridSize - 1) * (k_GridSize - 1);
+    QuadGeom::Pointer quads = QuadGeom::CreateGeometry(numCells, vertices, "Quads");
+    TriangleGeom::Pointer tris = TriangleGeom::CreateGeometry(2 * numCells, vertices, "Triangles");
+    for(int64_t j = 0; j < k_GridSize - 1; j++)
+    {
+      for(int64_t i = 0; i < k_GridSize - 1; i++)
+      {
+        int64_t cell = j * (k_GridSize - 1) + i;
+        int64_t v0 = j * k_GridSize + i;
+        int64_t verts[4] = {v0, v0 + 1, v0 + k_GridSize + 1, v0 + k_GridSize};
+        quads->setVertsAtQuad(cell, verts);
+        int64_t tri0[3] = {verts[0], verts[1], verts[2]};
+        int64_t tri1[3] = {verts[0], verts[2], verts[3]};
+        tris->setVertsAtTri(2 * cell, tri0);
+        tris->setVertsAtTri(2 * cell + 1, tri1);
+      }
+    }
+
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer expectedCentroids = FloatArrayType::CreateArray(numCells, cDims, "Centroids");
+    FloatArrayType::Pointer expectedAreas = FloatArrayType::CreateArray(numCells, "Areas");
+    GeometryHelpers::Topology::FindElementCentroids<int64_t>(quads->getQuads(), vertices, expectedCentroids);
+    GeometryHelpers::Topology::Find2DElementAreas<int64_t>(quads->getQuads(), vertices, expectedAreas);
+
+    int err = quads->updateElementCentroidsAndSizes();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    RequireClose(quads->getElementCentroids(), expectedCentroids, 1.0E-5f);
+    // The areas use the same projected formula as the serial helper
+    RequireClose(quads->getElementSizes(), expectedAreas, 1.0E-6f);
+
+    // The two triangles of each quad cover it
+    err = tris->findElementSizes();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    FloatArrayType::Pointer triAreas = tris->getElementSizes();
+    DREAM3D_REQUIRE_VALID_POINTER(triAreas.get())
+    for(int64_t i = 0; i < numCells; i++)
+    {
+      float sum = triAreas->getValue(2 * i) + triAreas->getValue(2 * i + 1);
+      DREAM3D_REQUIRED(std::fabs(sum - expectedAreas->getValue(i)), <=, 1.0E-3f * expectedAreas->getValue(i))
+    }
+    DREAM3D_REQUIRE_NULL_POINTER(tris->getElementCentroids().get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestVolumeAndEdgeMeasures()
+  {
+    SharedVertexList::Pointer vertices = CreateGridVertices();
+    for(int64_t i = 0; i < vertices->getNumberOfTuples(); i++)
+    {
+      // Lift the grid off its plane so the tetrahedra have volume
+      float* v = vertices->getTuplePointer(i);
+      v[2] += 0.05f * static_cast<float>((i * 7) % 11);
+    }
+
+    int64_t numTets = k_GridSize * k_GridSize - 2 * k_GridSize - 1;
+    TetrahedralGeom::Pointer tets = TetrahedralGeom::CreateGeometry(numTets, vertices, "Tets");
+    EdgeGeom::Pointer edges = EdgeGeom::CreateGeometry(numTets, vertices, "Edges");
+    for(int64_t i = 0; i < numTets; i++)
+    {
+      int64_t verts[4] = {i, i + 1, i + k_GridSize, i + k_GridSize + 1};
+      tets->setVertsAtTet(i, verts);
+      int64_t edge[2] = {i, i + k_GridSize + 1};
+      edges->setVertsAtEdge(i, edge);
+    }
+
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer expectedCentroids = FloatArrayType::CreateArray(numTets, cDims, "Centroids");
+    FloatArrayType::Pointer expectedVolumes = FloatArrayType::CreateArray(numTets, "Volumes");
+    GeometryHelpers::Topology::FindElementCentroids<int64_t>(tets->getTetrahedra(), vertices, expectedCentroids);
+    GeometryHelpers::Topology::FindTetVolumes<int64_t>(tets->getTetrahedra(), vertices, expectedVolumes);
+
+    int err = tets->updateElementCentroidsAndSizes();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    RequireClose(tets->getElementCentroids(), expectedCentroids, 1.0E-5f);
+    RequireClose(tets->getElementSizes(), expectedVolumes, 1.0E-4f);
+
+    err = edges->updateElementCentroidsAndSizes(false, true);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    FloatArrayType::Pointer lengths = edges->getElementSizes();
+    DREAM3D_REQUIRE_VALID_POINTER(lengths.get())
+    for(int64_t i = 0; i < numTets; i++)
+    {
+      float* v0 = vertices->getTuplePointer(i);
+      float* v1 = vertices->getTuplePointer(i + k_GridSize + 1);
+      float length = sqrtf((v0[0] - v1[0]) * (v0[0] - v1[0]) + (v0[1] - v1[1]) * (v0[1] - v1[1]) + (v0[2] - v1[2]) * (v0[2] - v1[2]));
+      DREAM3D_REQUIRE_EQUAL(lengths->getValue(i), length)
+    }
+    DREAM3D_REQUIRE_NULL_POINTER(edges->getElementCentroids().get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCache()
+  {
+    SharedVertexList::Pointer vertices = CreateGridVertices();
+    int64_t numTris = k_GridSize - 2;
+    TriangleGeom::Pointer tris = TriangleGeom::CreateGeometry(numTris, vertices, "Triangles");
+    for(int64_t i = 0; i < numTris; i++)
+    {
+      int64_t verts[3] = {i, i + 1, i + k_GridSize};
+      tris->setVertsAtTri(i, verts);
+    }
+
+    int err = tris->updateElementCentroidsAndSizes();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    FloatArrayType::Pointer centroids = tris->getElementCentroids();
+    FloatArrayType::Pointer areas = tris->getElementSizes();
+
+    // Nothing changed, the cached arrays are reused
+    err = tris->updateElementCentroidsAndSizes();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE(tris->getElementCentroids() == centroids)
+    DREAM3D_REQUIRE(tris->getElementSizes() == areas)
+
+    // Moving a vertex through the geometry invalidates both
+    float coords[3] = {100.0f, 0.0f, 0.0f};
+    tris->setCoords(0, coords);
+    err = tris->updateElementCentroidsAndSizes();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE(tris->getElementCentroids() != centroids)
+    DREAM3D_REQUIRE(tris->getElementSizes() != areas)
+    DREAM3D_REQUIRE_EQUAL(tris->getElementCentroids()->getComponent(0, 0), (100.0f + vertices->getComponent(1, 0) + vertices->getComponent(k_GridSize, 0)) / 3.0f)
+
+    // Writing through a raw pointer needs an explicit notification
+    centroids = tris->getElementCentroids();
+    vertices->getTuplePointer(1)[0] = 50.0f;
+    err = tris->updateElementCentroidsAndSizes(true, false);
+    DREAM3D_REQUIRE(tris->getElementCentroids() == centroids)
+    tris->elementGeometryModified();
+    err = tris->updateElementCentroidsAndSizes(true, false);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE(tris->getElementCentroids() != centroids)
+
+    // Pointers handed out by the geometry may be written through, so they invalidate the cache
+    centroids = tris->getElementCentroids();
+    tris->getVertexPointer(2)[0] = 25.0f;
+    err = tris->updateElementCentroidsAndSizes(true, false);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE(tris->getElementCentroids() != centroids)
+    DREAM3D_REQUIRE_EQUAL(tris->getElementCentroids()->getComponent(1, 0), (50.0f + 25.0f + vertices->getComponent(k_GridSize + 1, 0)) / 3.0f)
+
+    // Reading through the const overloads leaves the cache valid, and so does findElementCentroids
+    centroids = tris->getElementCentroids();
+    const TriangleGeom* constTris = tris.get();
+    DREAM3D_REQUIRE_EQUAL(constTris->getVertexPointer(2)[0], 25.0f)
+    DREAM3D_REQUIRE_EQUAL(constTris->getTriPointer(1)[0], 1)
+    err = tris->updateElementCentroidsAndSizes(true, false);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE(tris->getElementCentroids() == centroids)
+    err = tris->findElementCentroids();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE(tris->getElementCentroids() == centroids)
+
+    // A deleted or replaced array is recomputed
+    areas = tris->getElementSizes();
+    tris->deleteElementSizes();
+    err = tris->updateElementCentroidsAndSizes(false, true);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_VALID_POINTER(tris->getElementSizes().get())
+    DREAM3D_REQUIRE(tris->getElementSizes() != areas)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### MeshGeometryMeasuresTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestSurfaceMeasures())
+    DREAM3D_REGISTER_TEST(TestVolumeAndEdgeMeasures())
+    DREAM3D_REGISTER_TEST(TestCache())
+  }
+
+private:
+  MeshGeometryMeasuresTest(const MeshGeometryMeasuresTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const MeshGeometryMeasuresTest&) = delete;           // Move assignment Not Implemented
+};
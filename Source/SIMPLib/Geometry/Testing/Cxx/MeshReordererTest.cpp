@@ -0,0 +1,284 @@
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Geometry/MeshReorderer.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class MeshReordererTest
+{
+public:
+  MeshReordererTest() = default;
+  virtual ~MeshReordererTest() = default;
+
+  const int64_t k_GridSize = 30;
+
+  // -----------------------------------------------------------------------------
+  // A triangulated k_GridSize x k_GridSize grid whose vertices and triangles are stored in random order
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer CreateShuffledGrid()
+  {
+    int64_t numVerts = k_GridSize * k_GridSize;
+    int64_t numTris = 2 * (k_GridSize - 1) * (k_GridSize - 1);
+    std::mt19937_64 generator(12345);
+    std::vector<int64_t> vertexIds(numVerts);
+    std::iota(vertexIds.begin(), vertexIds.end(), 0);
+    std::shuffle(vertexIds.begin(), vertexIds.end(), generator);
+    std::vector<int64_t> triIds(numTris);
+    std::iota(triIds.begin(), triIds.end(), 0);
+    std::shuffle(triIds.begin(), triIds.end(), generator);
+
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(numVerts);
+    for(int64_t j = 0; j < k_GridSize; j++)
+    {
+      for(int64_t i = 0; i < k_GridSize; i++)
+      {
+        float coords[3] = {static_cast<float>(i), static_cast<float>(j), 0.1f * static_cast<float>((i * j) % 3)};
+        vertices->setTuple(vertexIds[j * k_GridSize + i], coords);
+      }
+    }
+    TriangleGeom::Pointer tris = TriangleGeom::CreateGeometry(numTris, vertices, "Triangles");
+    for(int64_t j = 0; j < k_GridSize - 1; j++)
+    {
+      for(int64_t i = 0; i < k_GridSize - 1; i++)
+      {
+        int64_t v0 = vertexIds[j * k_GridSize + i];
+        int64_t v1 = vertexIds[j * k_GridSize + i + 1];
+        int64_t v2 = vertexIds[(j + 1) * k_GridSize + i + 1];
+        int64_t v3 = vertexIds[(j + 1) * k_GridSize + i];
+        int64_t tri0[3] = {v0, v1, v2};
+        int64_t tri1[3] = {v0, v2, v3};
+        int64_t cell = j * (k_GridSize - 1) + i;
+        tris->setVertsAtTri(triIds[2 * cell], tri0);
+        tris->setVertsAtTri(triIds[2 * cell + 1], tri1);
+      }
+    }
+    return tris;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AttributeMatrix::Pointer CreateIdMatrix(size_t numTuples, AttributeMatrix::Type type)
+  {
+    QVector<size_t> tDims(1, numTuples);
+    AttributeMatrix::Pointer attrMat = AttributeMatrix::New(tDims, "Data", type);
+    Int64ArrayType::Pointer ids = Int64ArrayType::CreateArray(numTuples, "Ids");
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      ids->setValue(i, static_cast<int64_t>(i));
+    }
+    attrMat->addAttributeArray(ids->getName(), ids);
+    return attrMat;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Mean distance in memory between the vertices of the same element
+  // -----------------------------------------------------------------------------
+  double MeanVertexGap(Int64ArrayType::Pointer elements)
+  {
+    size_t numComps = static_cast<size_t>(elements->getNumberOfComponents());
+    double sum = 0.0;
+    for(size_t i = 0; i < elements->getNumberOfTuples(); i++)
+    {
+      int64_t* elem = elements->getTuplePointer(i);
+      for(size_t k = 1; k < numComps; k++)
+      {
+        sum += std::fabs(static_cast<double>(elem[k] - elem[0]));
+      }
+    }
+    return sum / static_cast<double>(elements->getNumberOfTuples() * (numComps - 1));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void ReorderTriangles(MeshReorderer::Method method)
+  {
+    TriangleGeom::Pointer tris = CreateShuffledGrid();
+    SharedVertexList::Pointer oldVertices = std::dynamic_pointer_cast<SharedVertexList>(tris->getVertices()->deepCopy());
+    SharedTriList::Pointer oldTris = std::dynamic_pointer_cast<SharedTriList>(tris->getTriangles()->deepCopy());
+    DREAM3D_REQUIRE_EQUAL(tris->findEdges(), 1)
+    DREAM3D_REQUIRE_EQUAL(tris->findElementCentroids(), 1)
+    SharedEdgeList::Pointer oldEdges = std::dynamic_pointer_cast<SharedEdgeList>(tris->getEdges()->deepCopy());
+    FloatArrayType::Pointer oldCentroids = std::dynamic_pointer_cast<FloatArrayType>(tris->getElementCentroids()->deepCopy());
+    tris->findElementsContainingVert();
+    double oldGap = MeanVertexGap(tris->getTriangles());
+
+    QVector<AttributeMatrix::Pointer> vertexData(1, CreateIdMatrix(oldVertices->getNumberOfTuples(), AttributeMatrix::Type::Vertex));
+    QVector<AttributeMatrix::Pointer> faceData(1, CreateIdMatrix(oldTris->getNumberOfTuples(), AttributeMatrix::Type::Face));
+    int err = tris->reorder(method, vertexData, faceData);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_NULL_POINTER(tris->getElementsContainingVert().get())
+
+    Int64ArrayType::Pointer vertexIds = vertexData[0]->getAttributeArrayAs<Int64ArrayType>("Ids");
+    Int64ArrayType::Pointer triIds = faceData[0]->getAttributeArrayAs<Int64ArrayType>("Ids");
+    SharedVertexList::Pointer vertices = tris->getVertices();
+    for(size_t i = 0; i < vertices->getNumberOfTuples(); i++)
+    {
+      for(int j = 0; j < 3; j++)
+      {
+        DREAM3D_REQUIRE_EQUAL(vertices->getComponent(i, j), oldVertices->getComponent(vertexIds->getValue(i), j))
+      }
+    }
+    FloatArrayType::Pointer centroids = tris->getElementCentroids();
+    for(int64_t t = 0; t < tris->getNumberOfTris(); t++)
+    {
+      int64_t verts[3] = {0, 0, 0};
+      tris->getVertsAtTri(t, verts);
+      for(int k = 0; k < 3; k++)
+      {
+        DREAM3D_REQUIRE_EQUAL(vertexIds->getValue(verts[k]), oldTris->getComponent(triIds->getValue(t), k))
+        DREAM3D_REQUIRE_EQUAL(centroids->getComponent(t, k), oldCentroids->getComponent(triIds->getValue(t), k))
+      }
+    }
+    SharedEdgeList::Pointer edges = tris->getEdges();
+    for(size_t e = 0; e < edges->getNumberOfTuples(); e++)
+    {
+      DREAM3D_REQUIRE_EQUAL(vertexIds->getValue(edges->getComponent(e, 0)), oldEdges->getComponent(e, 0))
+      DREAM3D_REQUIRE_EQUAL(vertexIds->getValue(edges->getComponent(e, 1)), oldEdges->getComponent(e, 1))
+    }
+
+    // The vertices of each triangle end up close together in memory
+    double newGap = MeanVertexGap(tris->getTriangles());
+    DREAM3D_REQUIRED(newGap * 4.0, <, oldGap)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReorderTriangles()
+  {
+    ReorderTriangles(MeshReorderer::Method::Morton);
+    ReorderTriangles(MeshReorderer::Method::Hilbert);
+    ReorderTriangles(MeshReorderer::Method::ReverseCuthillMcKee);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHilbertAdjacency()
+  {
+    // Consecutive points of an aligned 8 x 8 x 8 lattice are face neighbors along the Hilbert curve. The extra
+    // point makes the bounding cube exactly 2^21 lattice units wide.
+    const float spacing = 262144.0f;
+    std::vector<float> points;
+    for(int z = 0; z < 8; z++)
+    {
+      for(int y = 0; y < 8; y++)
+      {
+        for(int x = 0; x < 8; x++)
+        {
+          points.push_back(spacing * static_cast<float>(x));
+          points.push_back(spacing * static_cast<float>(y));
+          points.push_back(spacing * static_cast<float>(z));
+        }
+      }
+    }
+    points.push_back(8.0f * spacing);
+    points.push_back(0.0f);
+    points.push_back(0.0f);
+    size_t numPoints = points.size() / 3;
+
+    std::vector<size_t> order = MeshReorderer::SpaceFillingCurveOrder(points.data(), numPoints, MeshReorderer::Method::Hilbert);
+    DREAM3D_REQUIRE_EQUAL(order.size(), numPoints)
+    order.erase(std::remove(order.begin(), order.end(), numPoints - 1), order.end());
+    for(size_t i = 1; i < order.size(); i++)
+    {
+      float distance = 0.0f;
+      for(size_t j = 0; j < 3; j++)
+      {
+        distance += std::fabs(points[3 * order[i] + j] - points[3 * order[i - 1] + j]);
+      }
+      DREAM3D_REQUIRE_EQUAL(distance, spacing)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReorderTetrahedra()
+  {
+    // A strip of tetrahedra, each sharing a face with the next one, stored backwards
+    const int64_t numTets = 50;
+    SharedVertexList::Pointer vertices = TetrahedralGeom::CreateSharedVertexList(numTets + 3);
+    for(int64_t i = 0; i < numTets + 3; i++)
+    {
+      float coords[3] = {static_cast<float>(i), static_cast<float>(i % 2), static_cast<float>((i / 2) % 2)};
+      vertices->setTuple(i, coords);
+    }
+    TetrahedralGeom::Pointer tets = TetrahedralGeom::CreateGeometry(numTets, vertices, "Tets");
+    // Neighbors found for a shuffled strip go stale once the strip is rewritten, and must not drive the ordering
+    for(int64_t i = 0; i < numTets; i++)
+    {
+      int64_t s = (7 * i) % numTets;
+      int64_t verts[4] = {s, s + 1, s + 2, s + 3};
+      tets->setVertsAtTet(i, verts);
+    }
+    DREAM3D_REQUIRE_EQUAL(tets->findElementNeighbors(), 0)
+    for(int64_t i = 0; i < numTets; i++)
+    {
+      int64_t verts[4] = {i, i + 1, i + 2, i + 3};
+      tets->setVertsAtTet(numTets - 1 - i, verts);
+    }
+    DREAM3D_REQUIRE_EQUAL(tets->findFaces(), 1)
+    SharedTriList::Pointer oldFaces = std::dynamic_pointer_cast<SharedTriList>(tets->getTriangles()->deepCopy());
+
+    QVector<AttributeMatrix::Pointer> wrongSize(1, CreateIdMatrix(numTets + 1, AttributeMatrix::Type::Vertex));
+    int err = tets->reorder(MeshReorderer::Method::ReverseCuthillMcKee, wrongSize);
+    DREAM3D_REQUIRE_EQUAL(err, -2)
+
+    QVector<AttributeMatrix::Pointer> vertexData(1, CreateIdMatrix(numTets + 3, AttributeMatrix::Type::Vertex));
+    err = tets->reorder(MeshReorderer::Method::ReverseCuthillMcKee, vertexData);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+
+    // Each tetrahedron follows its neighbor, so its first new vertex is at most one past the last one seen
+    int64_t maxVertex = -1;
+    for(int64_t t = 0; t < numTets; t++)
+    {
+      int64_t verts[4] = {0, 0, 0, 0};
+      tets->getVertsAtTet(t, verts);
+      int64_t tetMax = *std::max_element(verts, verts + 4);
+      DREAM3D_REQUIRED(tetMax, <=, std::max<int64_t>(maxVertex + 1, 3))
+      maxVertex = std::max(maxVertex, tetMax);
+    }
+
+    Int64ArrayType::Pointer vertexIds = vertexData[0]->getAttributeArrayAs<Int64ArrayType>("Ids");
+    SharedTriList::Pointer faces = tets->getTriangles();
+    for(size_t f = 0; f < faces->getNumberOfTuples(); f++)
+    {
+      for(int k = 0; k < 3; k++)
+      {
+        DREAM3D_REQUIRE_EQUAL(vertexIds->getValue(faces->getComponent(f, k)), oldFaces->getComponent(f, k))
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### MeshReordererTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestReorderTriangles())
+    DREAM3D_REGISTER_TEST(TestHilbertAdjacency())
+    DREAM3D_REGISTER_TEST(TestReorderTetrahedra())
+  }
+
+private:
+  MeshReordererTest(const MeshReordererTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const MeshReordererTest&) = delete;    // Move assignment Not Implemented
+};
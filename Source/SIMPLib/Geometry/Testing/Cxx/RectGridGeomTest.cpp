@@ -0,0 +1,156 @@
+
+#include <stdlib.h>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/Geometry/RectGridGeom.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class RectGridGeomTest
+{
+public:
+  RectGridGeomTest() = default;
+
+  virtual ~RectGridGeomTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  RectGridGeom::Pointer CreateGrid(size_t dims[3])
+  {
+    RectGridGeom::Pointer geom = RectGridGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(dims);
+    FloatArrayType::Pointer bounds[3];
+    for(size_t axis = 0; axis < 3; axis++)
+    {
+      // Cell widths grow along each axis
+      bounds[axis] = FloatArrayType::CreateArray(dims[axis] + 1, "Bounds", true);
+      float value = static_cast<float>(axis) - 2.0f;
+      for(size_t i = 0; i <= dims[axis]; i++)
+      {
+        bounds[axis]->setValue(i, value);
+        value += 0.5f * static_cast<float>(i + 1);
+      }
+    }
+    geom->setXBounds(bounds[0]);
+    geom->setYBounds(bounds[1]);
+    geom->setZBounds(bounds[2]);
+    return geom;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBulkCoords()
+  {
+    size_t dims[3] = {6, 4, 3};
+    RectGridGeom::Pointer geom = CreateGrid(dims);
+    size_t numCells = geom->getNumberOfElements();
+
+    int err = geom->findElementCentroids();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    FloatArrayType::Pointer centroids = geom->getElementCentroids();
+    DREAM3D_REQUIRE_VALID_POINTER(centroids.get())
+    for(size_t i = 0; i < numCells; i++)
+    {
+      float expected[3] = {0.0f, 0.0f, 0.0f};
+      geom->getCoords(i, expected);
+      DREAM3D_REQUIRE_EQUAL(centroids->getComponent(i, 0), expected[0])
+      DREAM3D_REQUIRE_EQUAL(centroids->getComponent(i, 1), expected[1])
+      DREAM3D_REQUIRE_EQUAL(centroids->getComponent(i, 2), expected[2])
+    }
+
+    std::vector<int64_t> indices(numCells, -2);
+    size_t numInside = geom->computeCellIndices(centroids->getPointer(0), numCells, indices.data());
+    DREAM3D_REQUIRE_EQUAL(numInside, numCells)
+    for(size_t i = 0; i < numCells; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(indices[i], static_cast<int64_t>(i))
+    }
+
+    // A point on an interior bound belongs to the upper cell, the upper corner to the last cell
+    float* xBounds = geom->getXBounds()->getPointer(0);
+    float* yBounds = geom->getYBounds()->getPointer(0);
+    float* zBounds = geom->getZBounds()->getPointer(0);
+    float points[9] = {xBounds[2], yBounds[1], zBounds[0], xBounds[dims[0]], yBounds[dims[1]], zBounds[dims[2]], xBounds[0] - 0.1f, yBounds[0], zBounds[0]};
+    int64_t pointIndices[3] = {0, 0, 0};
+    numInside = geom->computeCellIndices(points, 3, pointIndices);
+    DREAM3D_REQUIRE_EQUAL(numInside, 2)
+    DREAM3D_REQUIRE_EQUAL(pointIndices[0], static_cast<int64_t>(dims[0] + 2))
+    DREAM3D_REQUIRE_EQUAL(pointIndices[1], static_cast<int64_t>(numCells - 1))
+    DREAM3D_REQUIRE_EQUAL(pointIndices[2], -1)
+
+    err = geom->findElementNeighbors();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    ElementDynamicList::Pointer neighbors = geom->getElementNeighbors();
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(0), 3)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfElements(dims[0] + 1), 5)
+
+    // New bounds drop the centroids computed for the old ones
+    FloatArrayType::Pointer newBounds = std::dynamic_pointer_cast<FloatArrayType>(geom->getXBounds()->deepCopy());
+    geom->setXBounds(newBounds);
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getElementCentroids().get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestGridModified()
+  {
+    size_t dims[3] = {6, 4, 3};
+    RectGridGeom::Pointer geom = CreateGrid(dims);
+
+    int err = geom->findElementCentroids();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    err = geom->findElementSizes();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    err = geom->findElementNeighbors();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+
+    // New dimensions drop everything computed for the old grid
+    size_t newDims[3] = {3, 4, 3};
+    geom->setDimensions(newDims);
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getElementCentroids().get())
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getElementSizes().get())
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getElementNeighbors().get())
+
+    FloatArrayType::Pointer xBounds = FloatArrayType::CreateArray(newDims[0] + 1, "Bounds", true);
+    for(size_t i = 0; i <= newDims[0]; i++)
+    {
+      xBounds->setValue(i, static_cast<float>(i));
+    }
+    geom->setXBounds(xBounds);
+    err = geom->findElementCentroids();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_EQUAL(geom->getElementCentroids()->getNumberOfTuples(), newDims[0] * newDims[1] * newDims[2])
+    err = geom->findElementNeighbors();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_EQUAL(geom->getElementNeighbors()->size(), newDims[0] * newDims[1] * newDims[2])
+
+    // So do new bounds
+    FloatArrayType::Pointer yBounds = std::dynamic_pointer_cast<FloatArrayType>(geom->getYBounds()->deepCopy());
+    geom->setYBounds(yBounds);
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getElementCentroids().get())
+    DREAM3D_REQUIRE_NULL_POINTER(geom->getElementNeighbors().get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### RectGridGeomTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestBulkCoords());
+    DREAM3D_REGISTER_TEST(TestGridModified());
+  }
+
+private:
+  RectGridGeomTest(const RectGridGeomTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const RectGridGeomTest&) = delete;   // Move assignment Not Implemented
+};
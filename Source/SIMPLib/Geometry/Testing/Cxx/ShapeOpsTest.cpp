@@ -0,0 +1,232 @@
+
+#include <stdlib.h>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <QtCore/QMap>
+
+#include "SIMPLib/Geometry/ShapeOps/CubeOctohedronOps.h"
+#include "SIMPLib/Geometry/ShapeOps/EllipsoidOps.h"
+#include "SIMPLib/Geometry/ShapeOps/ShapeKernels.hpp"
+#include "SIMPLib/Geometry/ShapeOps/ShapeOps.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+namespace
+{
+// The per voxel CubeOctohedronOps::inside() as it was before the kernels were split out
+float LegacyCubeOctohedronInside(float Gvalue, float axis1comp, float axis2comp, float axis3comp)
+{
+  float inside = 1 - fabs(axis1comp);
+  if((1 - fabs(axis2comp)) < inside)
+  {
+    inside = (1 - fabs(axis2comp));
+  }
+  if((1 - fabs(axis3comp)) < inside)
+  {
+    inside = (1 - fabs(axis3comp));
+  }
+  axis1comp = static_cast<float>(axis1comp + 1.0);
+  axis2comp = static_cast<float>(axis2comp + 1.0);
+  axis3comp = static_cast<float>(axis3comp + 1.0);
+
+  float planes[8];
+  planes[0] = ((-axis1comp) + (-axis2comp) + (axis3comp) - ((-0.5f * Gvalue) + (-0.5f * Gvalue) + 2.0f));
+  planes[0] = planes[0] / ((-1) + (-1) + (1) - ((-0.5f * Gvalue) + (-0.5f * Gvalue) + 2.0f));
+  planes[1] = ((axis1comp) + (-axis2comp) + (axis3comp) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue) + 2.0f));
+  planes[1] = planes[1] / ((1) + (-1) + (1) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue) + 2.0f));
+  planes[2] = ((axis1comp) + (axis2comp) + (axis3comp) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5f * Gvalue)) + 2.0f));
+  planes[2] = planes[2] / ((1) + (1) + (1) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5f * Gvalue)) + 2.0f));
+  planes[3] = static_cast<float>(((-axis1comp) + (axis2comp) + (axis3comp) - ((-0.5f * Gvalue) + (2.0f - (0.5 * Gvalue)) + 2.0f)));
+  planes[3] = planes[3] / ((-1) + (1) + (1) - ((-0.5f * Gvalue) + (2.0f - (0.5f * Gvalue)) + 2.0f));
+  planes[4] = ((-axis1comp) + (-axis2comp) + (-axis3comp) - ((-0.5f * Gvalue) + (-0.5f * Gvalue)));
+  planes[4] = planes[4] / ((-1) + (-1) + (-1) - ((-0.5f * Gvalue) + (-0.5f * Gvalue)));
+  planes[5] = ((axis1comp) + (-axis2comp) + (-axis3comp) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue)));
+  planes[5] = planes[5] / ((1) + (-1) + (-1) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue)));
+  planes[6] = ((axis1comp) + (axis2comp) + (-axis3comp) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5f * Gvalue))));
+  planes[6] = static_cast<float>(planes[6] / ((1) + (1) + (-1) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5 * Gvalue)))));
+  planes[7] = ((-axis1comp) + (axis2comp) + (-axis3comp) - ((-0.5f * Gvalue) + (2.0f - (0.5f * Gvalue))));
+  planes[7] = planes[7] / ((-1) + (1) + (-1) - ((-0.5f * Gvalue) + (2 - (0.5f * Gvalue))));
+  for(int i = 0; i < 8; i++)
+  {
+    if(planes[i] < inside)
+    {
+      inside = planes[i];
+    }
+  }
+  return inside;
+}
+}
+
+class ShapeOpsTest
+{
+public:
+  ShapeOpsTest() = default;
+  virtual ~ShapeOpsTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLegacyArguments()
+  {
+    QMap<ShapeOps::ArgName, float> args;
+    args[ShapeOps::Omega3] = 0.85f;
+    args[ShapeOps::B_OverA] = 0.8f;
+    args[ShapeOps::C_OverA] = 0.6f;
+    args[ShapeOps::VolCur] = 12.0f;
+    ShapeParameters params(0.85f, 0.8f, 0.6f, 12.0f);
+
+    std::vector<ShapeOps::Pointer> mapOps = ShapeOps::getShapeOpsVector();
+    std::vector<ShapeOps::Pointer> structOps = ShapeOps::getShapeOpsVector();
+    const size_t numShapes = 6;
+    DREAM3D_REQUIRE_EQUAL(mapOps.size(), numShapes)
+    for(size_t i = 0; i < mapOps.size(); i++)
+    {
+      float fromMap = mapOps[i]->radcur1(args);
+      float fromStruct = structOps[i]->radcur1(params);
+      DREAM3D_REQUIRE_EQUAL(fromMap, fromStruct)
+      DREAM3D_REQUIRED(fromMap, >, 0.0f)
+    }
+
+    float expected = powf(static_cast<float>(12.0f * 0.75f * SIMPLib::Constants::k_1OverPi * (1.0f / 0.8f) * (1.0f / 0.6f)), 0.333333333333f);
+    float radius = EllipsoidOps::New()->radcur1(args);
+    DREAM3D_REQUIRE_EQUAL(radius, expected)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCubeOctohedronMatchesLegacy()
+  {
+    const float omega3Values[5] = {0.787873524f, 0.823052718f, 0.962158855f, 0.89667764f, 0.810569469f};
+    for(int s = 0; s < 5; s++)
+    {
+      CubeOctohedronKernel kernel;
+      kernel.radcur1(ShapeParameters(omega3Values[s], 1.0f, 1.0f, 1.0f));
+      float gValue = kernel.getGvalue();
+      for(int i = 0; i < 21; i++)
+      {
+        for(int j = 0; j < 21; j++)
+        {
+          for(int k = 0; k < 21; k++)
+          {
+            float x = -1.3f + 0.13f * static_cast<float>(i);
+            float y = -1.3f + 0.13f * static_cast<float>(j);
+            float z = -1.3f + 0.13f * static_cast<float>(k);
+            float legacy = LegacyCubeOctohedronInside(gValue, x, y, z);
+            float value = kernel.inside(x, y, z);
+            DREAM3D_REQUIRE_EQUAL(value, legacy)
+          }
+        }
+      }
+    }
+
+    // A G value of zero is a cube, the center sits one unit from every face
+    CubeOctohedronOps::Pointer ops = CubeOctohedronOps::New();
+    float center = ops->inside(0.0f, 0.0f, 0.0f);
+    DREAM3D_REQUIRE_EQUAL(center, 1.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRowAndBox()
+  {
+    const float origin[3] = {-1.4f, -1.2f, -1.1f};
+    const float stepX[3] = {0.05f, 0.01f, -0.02f};
+    const float stepY[3] = {-0.01f, 0.06f, 0.015f};
+    const float stepZ[3] = {0.02f, -0.015f, 0.07f};
+    const size_t dims[3] = {45, 37, 29};
+    const size_t numVoxels = dims[0] * dims[1] * dims[2];
+
+    std::vector<ShapeOps::Pointer> shapeOps = ShapeOps::getShapeOpsVector();
+    for(size_t s = 0; s < shapeOps.size(); s++)
+    {
+      ShapeOps::Pointer ops = shapeOps[s];
+      ops->radcur1(ShapeParameters(0.9f, 0.7f, 0.5f, 20.0f));
+
+      std::vector<float> box(numVoxels, 0.0f);
+      ops->insideBox(origin, stepX, stepY, stepZ, dims, box.data());
+
+      size_t index = 0;
+      for(size_t z = 0; z < dims[2]; z++)
+      {
+        for(size_t y = 0; y < dims[1]; y++)
+        {
+          float rowStart[3] = {0.0f, 0.0f, 0.0f};
+          for(size_t c = 0; c < 3; c++)
+          {
+            rowStart[c] = origin[c] + static_cast<float>(y) * stepY[c] + static_cast<float>(z) * stepZ[c];
+          }
+          std::vector<float> row(dims[0], 0.0f);
+          ops->insideRow(rowStart, stepX, dims[0], row.data());
+          for(size_t x = 0; x < dims[0]; x++, index++)
+          {
+            const float t = static_cast<float>(x);
+            float expected = ops->inside(rowStart[0] + t * stepX[0], rowStart[1] + t * stepX[1], rowStart[2] + t * stepX[2]);
+            float rowDiff = fabsf(row[x] - expected);
+            float boxDiff = fabsf(box[index] - expected);
+            DREAM3D_REQUIRED(rowDiff, <=, 1.0E-5f)
+            DREAM3D_REQUIRED(boxDiff, <=, 1.0E-5f)
+          }
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestEllipsoidVolume()
+  {
+    const size_t dim = 80;
+    const float spacing = 2.4f / static_cast<float>(dim);
+    const float origin[3] = {-1.2f + 0.5f * spacing, -1.2f + 0.5f * spacing, -1.2f + 0.5f * spacing};
+    const float stepX[3] = {spacing, 0.0f, 0.0f};
+    const float stepY[3] = {0.0f, spacing, 0.0f};
+    const float stepZ[3] = {0.0f, 0.0f, spacing};
+    const size_t dims[3] = {dim, dim, dim};
+
+    std::vector<float> inside(dim * dim * dim, 0.0f);
+    EllipsoidKernel ellipsoid;
+    ellipsoid.insideBox(origin, stepX, stepY, stepZ, dims, inside.data());
+    CylinderCKernel cylinder;
+    std::vector<float> insideCylinder(dim * dim * dim, 0.0f);
+    cylinder.insideBox(origin, stepX, stepY, stepZ, dims, insideCylinder.data());
+
+    size_t ellipsoidCount = 0;
+    size_t cylinderCount = 0;
+    for(size_t i = 0; i < inside.size(); i++)
+    {
+      ellipsoidCount += (inside[i] >= 0.0f) ? 1 : 0;
+      cylinderCount += (insideCylinder[i] >= 0.0f) ? 1 : 0;
+    }
+    const double voxelVolume = static_cast<double>(spacing) * spacing * spacing;
+    double ellipsoidError = fabs(ellipsoidCount * voxelVolume - 4.0 / 3.0 * SIMPLib::Constants::k_Pi) / (4.0 / 3.0 * SIMPLib::Constants::k_Pi);
+    double cylinderError = fabs(cylinderCount * voxelVolume - 2.0 * SIMPLib::Constants::k_Pi) / (2.0 * SIMPLib::Constants::k_Pi);
+    DREAM3D_REQUIRED(ellipsoidError, <, 0.02)
+    DREAM3D_REQUIRED(cylinderError, <, 0.02)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ShapeOpsTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestLegacyArguments());
+    DREAM3D_REGISTER_TEST(TestCubeOctohedronMatchesLegacy());
+    DREAM3D_REGISTER_TEST(TestRowAndBox());
+    DREAM3D_REGISTER_TEST(TestEllipsoidVolume());
+  }
+
+private:
+  ShapeOpsTest(const ShapeOpsTest&) = delete;  // Copy Constructor Not Implemented
+  void operator=(const ShapeOpsTest&) = delete; // Move assignment Not Implemented
+};
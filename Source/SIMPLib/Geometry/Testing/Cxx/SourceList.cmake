@@ -1,6 +1,12 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
   ImageGeomTest
+  MeshGeometryMeasuresTest
+  MeshReordererTest
+  RectGridGeomTest
+  ShapeOpsTest
+  TriangleBVHTest
+  VertexWelderTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
@@ -0,0 +1,204 @@
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/Geometry/TriangleBVH.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class TriangleBVHTest
+{
+public:
+  TriangleBVHTest() = default;
+  virtual ~TriangleBVHTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Closed unit sphere tessellated along latitude and longitude lines
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer createSphere(int64_t numLat, int64_t numLong)
+  {
+    int64_t numVerts = (numLat + 1) * numLong;
+    int64_t numTris = 2 * numLong * (numLat - 1);
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(numVerts);
+    TriangleGeom::Pointer geom = TriangleGeom::CreateGeometry(numTris, vertices, "Sphere");
+
+    float* verts = vertices->getPointer(0);
+    for(int64_t i = 0; i <= numLat; i++)
+    {
+      double theta = SIMPLib::Constants::k_Pi * static_cast<double>(i) / static_cast<double>(numLat);
+      for(int64_t j = 0; j < numLong; j++)
+      {
+        double phi = SIMPLib::Constants::k_2Pi * static_cast<double>(j) / static_cast<double>(numLong);
+        float* v = verts + 3 * (i * numLong + j);
+        v[0] = static_cast<float>(sin(theta) * cos(phi));
+        v[1] = static_cast<float>(sin(theta) * sin(phi));
+        v[2] = static_cast<float>(cos(theta));
+      }
+    }
+
+    int64_t tri = 0;
+    for(int64_t i = 0; i < numLat; i++)
+    {
+      for(int64_t j = 0; j < numLong; j++)
+      {
+        int64_t v00 = i * numLong + j;
+        int64_t v01 = i * numLong + (j + 1) % numLong;
+        int64_t v10 = (i + 1) * numLong + j;
+        int64_t v11 = (i + 1) * numLong + (j + 1) % numLong;
+        if(i > 0)
+        {
+          int64_t* t = geom->getTriPointer(tri++);
+          t[0] = v00;
+          t[1] = v10;
+          t[2] = v01;
+        }
+        if(i < numLat - 1)
+        {
+          int64_t* t = geom->getTriPointer(tri++);
+          t[0] = v01;
+          t[1] = v10;
+          t[2] = v11;
+        }
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(tri, numTris)
+    return geom;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPointInPolyhedron()
+  {
+    TriangleGeom::Pointer sphere = createSphere(64, 128);
+    TriangleBVH::Pointer bvh = TriangleBVH::Create(sphere.get());
+    DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfFaces(), static_cast<size_t>(sphere->getNumberOfTris()))
+
+    float ll[3] = {0.0f, 0.0f, 0.0f};
+    float ur[3] = {0.0f, 0.0f, 0.0f};
+    bvh->getBounds(ll, ur);
+    DREAM3D_REQUIRED(ll[2], <=, -1.0f)
+    DREAM3D_REQUIRED(ur[2], >=, 1.0f)
+
+    // Points on a line through the sphere, skipping the ones close to the tessellated surface
+    std::vector<float> points;
+    std::vector<char> expected;
+    for(int32_t i = 0; i <= 100; i++)
+    {
+      float x = -1.5f + 0.03f * static_cast<float>(i);
+      float radius = std::sqrt(x * x + 0.05f);
+      if(std::fabs(radius - 1.0f) < 0.02f)
+      {
+        continue;
+      }
+      points.push_back(x);
+      points.push_back(0.1f);
+      points.push_back(0.2f);
+      expected.push_back(radius < 1.0f ? 'i' : 'o');
+    }
+
+    size_t numPoints = expected.size();
+    std::vector<char> codes(numPoints, '?');
+    bvh->pointsInPolyhedron(points.data(), numPoints, 4.0f, codes.data());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(codes[i], expected[i])
+      DREAM3D_REQUIRE_EQUAL(bvh->pointInPolyhedron(points.data() + 3 * i, 4.0f), expected[i])
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRayCastAndClosestPoint()
+  {
+    TriangleGeom::Pointer sphere = createSphere(64, 128);
+    TriangleBVH::Pointer bvh = TriangleBVH::Create(sphere.get());
+
+    float origins[6] = {0.0f, 0.0f, 0.0f, 3.0f, 0.05f, 0.05f};
+    float directions[6] = {0.3f, 0.4f, 0.5f, -2.0f, 0.0f, 0.0f};
+    int64_t faceIds[2] = {-1, -1};
+    float distances[2] = {0.0f, 0.0f};
+    bvh->rayCast(origins, directions, 2, 100.0f, faceIds, distances);
+    DREAM3D_REQUIRED(faceIds[0], >=, 0)
+    DREAM3D_REQUIRED(faceIds[1], >=, 0)
+    DREAM3D_REQUIRED(std::fabs(distances[0] - 1.0f), <, 0.01f)
+    DREAM3D_REQUIRED(std::fabs(distances[1] - 2.0f), <, 0.01f)
+
+    // A ray pointing away from the sphere misses
+    float away[3] = {1.0f, 0.0f, 0.0f};
+    int64_t faceId = 0;
+    float distance = 0.0f;
+    DREAM3D_REQUIRE_EQUAL(bvh->rayCast(origins + 3, away, 100.0f, faceId, distance), false)
+    DREAM3D_REQUIRE_EQUAL(faceId, -1)
+
+    float closest[3] = {0.0f, 0.0f, 0.0f};
+    float query[3] = {0.0f, 2.5f, 0.0f};
+    DREAM3D_REQUIRE_EQUAL(bvh->findClosestPoint(query, closest, faceId, distance), true)
+    DREAM3D_REQUIRED(std::fabs(distance - 1.5f), <, 0.01f)
+    DREAM3D_REQUIRED(std::fabs(closest[1] - 1.0f), <, 0.01f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFaceSubset()
+  {
+    TriangleGeom::Pointer sphere = createSphere(16, 32);
+
+    // Only the triangles in the upper hemisphere
+    std::vector<int32_t> faces;
+    for(int64_t i = 0; i < sphere->getNumberOfTris(); i++)
+    {
+      float a[3], b[3], c[3];
+      sphere->getVertCoordsAtTri(i, a, b, c);
+      if(a[2] > 0.0f && b[2] > 0.0f && c[2] > 0.0f)
+      {
+        faces.push_back(static_cast<int32_t>(i));
+      }
+    }
+    Int32Int32DynamicListArray::ElementList faceIds;
+    faceIds.ncells = static_cast<int32_t>(faces.size());
+    faceIds.cells = faces.data();
+
+    TriangleBVH::Pointer bvh = TriangleBVH::Create(sphere.get(), faceIds);
+    DREAM3D_REQUIRE_EQUAL(bvh->getNumberOfFaces(), faces.size())
+
+    float ll[3] = {0.0f, 0.0f, 0.0f};
+    float ur[3] = {0.0f, 0.0f, 0.0f};
+    bvh->getBounds(ll, ur);
+    DREAM3D_REQUIRED(ll[2], >, 0.0f)
+
+    // The closest face to a point below the sphere must still come from the subset
+    float query[3] = {0.0f, 0.0f, -2.0f};
+    float closest[3] = {0.0f, 0.0f, 0.0f};
+    int64_t faceId = -1;
+    float distance = 0.0f;
+    DREAM3D_REQUIRE_EQUAL(bvh->findClosestPoint(query, closest, faceId, distance), true)
+    DREAM3D_REQUIRE(std::find(faces.begin(), faces.end(), static_cast<int32_t>(faceId)) != faces.end())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### TriangleBVHTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestPointInPolyhedron());
+    DREAM3D_REGISTER_TEST(TestRayCastAndClosestPoint());
+    DREAM3D_REGISTER_TEST(TestFaceSubset());
+  }
+
+private:
+  TriangleBVHTest(const TriangleBVHTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const TriangleBVHTest&) = delete;  // Move assignment Not Implemented
+};
@@ -0,0 +1,258 @@
+
+#include <stdlib.h>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexWelder.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class VertexWelderTest
+{
+public:
+  VertexWelderTest() = default;
+  virtual ~VertexWelderTest() = default;
+
+  const int64_t k_GridSize = 20;
+  const int64_t k_NumUnreferenced = 5;
+
+  // -----------------------------------------------------------------------------
+  // A triangle soup over a k_GridSize x k_GridSize vertex grid: every triangle has its own three vertices,
+  // which are jittered by less than the tolerance, followed by a few vertices that no triangle uses
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer CreateTriangleSoup(float jitter)
+  {
+    int64_t numTris = 2 * (k_GridSize - 1) * (k_GridSize - 1);
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(3 * numTris + k_NumUnreferenced);
+    TriangleGeom::Pointer tris = TriangleGeom::CreateGeometry(numTris, vertices, "Triangles");
+    int64_t vertId = 0;
+    for(int64_t j = 0; j < k_GridSize - 1; j++)
+    {
+      for(int64_t i = 0; i < k_GridSize - 1; i++)
+      {
+        int64_t corners[2][3][2] = {{{i, j}, {i + 1, j}, {i + 1, j + 1}}, {{i, j}, {i + 1, j + 1}, {i, j + 1}}};
+        for(int64_t t = 0; t < 2; t++)
+        {
+          int64_t verts[3] = {vertId, vertId + 1, vertId + 2};
+          for(int64_t k = 0; k < 3; k++)
+          {
+            float sign = ((vertId + k) % 2 == 0) ? 1.0f : -1.0f;
+            float coords[3] = {static_cast<float>(corners[t][k][0]) + sign * jitter, static_cast<float>(corners[t][k][1]), 0.0f};
+            vertices->setTuple(vertId + k, coords);
+          }
+          tris->setVertsAtTri(2 * (j * (k_GridSize - 1) + i) + t, verts);
+          vertId += 3;
+        }
+      }
+    }
+    for(int64_t k = 0; k < k_NumUnreferenced; k++)
+    {
+      float coords[3] = {-10.0f * static_cast<float>(k + 1), 0.0f, 0.0f};
+      vertices->setTuple(vertId + k, coords);
+    }
+    return tris;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AttributeMatrix::Pointer CreateVertexData(int64_t numVertices)
+  {
+    QVector<size_t> tDims(1, static_cast<size_t>(numVertices));
+    AttributeMatrix::Pointer vertexData = AttributeMatrix::New(tDims, "VertexData", AttributeMatrix::Type::Vertex);
+    Int64ArrayType::Pointer ids = Int64ArrayType::CreateArray(static_cast<size_t>(numVertices), "Ids");
+    for(int64_t i = 0; i < numVertices; i++)
+    {
+      ids->setValue(i, i);
+    }
+    vertexData->addAttributeArray(ids->getName(), ids);
+    return vertexData;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestWeldTriangles()
+  {
+    TriangleGeom::Pointer tris = CreateTriangleSoup(0.01f);
+    SharedVertexList::Pointer oldVertices = std::dynamic_pointer_cast<SharedVertexList>(tris->getVertices()->deepCopy());
+    SharedTriList::Pointer oldTris = std::dynamic_pointer_cast<SharedTriList>(tris->getTriangles()->deepCopy());
+    AttributeMatrix::Pointer vertexData = CreateVertexData(tris->getNumberOfVertices());
+    tris->findElementsContainingVert();
+
+    QVector<AttributeMatrix::Pointer> attrMats(1, vertexData);
+    int err = tris->weldVertices(0.05f, true, false, attrMats);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_EQUAL(tris->getNumberOfVertices(), k_GridSize * k_GridSize)
+    DREAM3D_REQUIRE_EQUAL(vertexData->getNumberOfTuples(), k_GridSize * k_GridSize)
+    DREAM3D_REQUIRE_NULL_POINTER(tris->getElementsContainingVert().get())
+
+    // Every corner now points to the first vertex of its group, and its attribute values moved with it
+    Int64ArrayType::Pointer ids = vertexData->getAttributeArrayAs<Int64ArrayType>("Ids");
+    for(size_t i = 0; i < oldTris->getSize(); i++)
+    {
+      int64_t oldId = oldTris->getValue(i);
+      int64_t newId = tris->getTriangles()->getValue(i);
+      DREAM3D_REQUIRED(newId, <, k_GridSize * k_GridSize)
+      int64_t oldOfNew = ids->getValue(newId);
+      DREAM3D_REQUIRED(oldOfNew, <=, oldId)
+      DREAM3D_REQUIRED(std::fabs(oldVertices->getComponent(oldId, 0) - oldVertices->getComponent(oldOfNew, 0)), <=, 0.05f)
+      DREAM3D_REQUIRE_EQUAL(oldVertices->getComponent(oldOfNew, 1), oldVertices->getComponent(oldId, 1))
+      DREAM3D_REQUIRE_EQUAL(tris->getVertices()->getComponent(newId, 0), oldVertices->getComponent(oldOfNew, 0))
+    }
+
+    // Kept vertices stay in their original order
+    for(size_t i = 1; i < ids->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRED(ids->getValue(i - 1), <, ids->getValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestExactWeld()
+  {
+    // Without a tolerance only identical vertices are merged
+    TriangleGeom::Pointer tris = CreateTriangleSoup(0.0f);
+    VertexWelder::Pointer welder = VertexWelder::Create(tris->getVertices(), tris->getTriangles(), 0.0f, false);
+    DREAM3D_REQUIRE_VALID_POINTER(welder.get())
+    DREAM3D_REQUIRE_EQUAL(welder->getNumberOfUnreferencedVertices(), 0)
+    DREAM3D_REQUIRE_EQUAL(welder->getCompactionMap().getNewNumberOfTuples(), k_GridSize * k_GridSize + k_NumUnreferenced)
+    int err = tris->weldVertices(0.0f, false);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_EQUAL(tris->getNumberOfVertices(), k_GridSize * k_GridSize + k_NumUnreferenced)
+
+    // A welded mesh shares its edges
+    err = tris->findEdges();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_EQUAL(tris->getNumberOfEdges(), 2 * k_GridSize * (k_GridSize - 1) + (k_GridSize - 1) * (k_GridSize - 1))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestWeldQuads()
+  {
+    // Two quads with their own vertices that share an edge, plus an unused vertex in between
+    SharedVertexList::Pointer vertices = QuadGeom::CreateSharedVertexList(9);
+    float coords[9][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}, {5, 5, 5}, {1, 0, 0}, {2, 0, 0}, {2, 1, 0}, {1, 1, 0}};
+    for(int64_t i = 0; i < 9; i++)
+    {
+      vertices->setTuple(i, coords[i]);
+    }
+    QuadGeom::Pointer quads = QuadGeom::CreateGeometry(2, vertices, "Quads");
+    int64_t quad0[4] = {0, 1, 2, 3};
+    int64_t quad1[4] = {5, 6, 7, 8};
+    quads->setVertsAtQuad(0, quad0);
+    quads->setVertsAtQuad(1, quad1);
+
+    // A matrix of the wrong size leaves the geometry untouched
+    QVector<AttributeMatrix::Pointer> attrMats(1, CreateVertexData(8));
+    int err = quads->weldVertices(0.0f, true, false, attrMats);
+    DREAM3D_REQUIRE_EQUAL(err, -2)
+    DREAM3D_REQUIRE_EQUAL(quads->getNumberOfVertices(), 9)
+
+    attrMats[0] = CreateVertexData(9);
+    err = quads->weldVertices(0.0f, true, false, attrMats);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_EQUAL(quads->getNumberOfVertices(), 6)
+    int64_t verts[4] = {0, 0, 0, 0};
+    quads->getVertsAtQuad(1, verts);
+    DREAM3D_REQUIRE_EQUAL(verts[0], 1)
+    DREAM3D_REQUIRE_EQUAL(verts[1], 4)
+    DREAM3D_REQUIRE_EQUAL(verts[2], 5)
+    DREAM3D_REQUIRE_EQUAL(verts[3], 2)
+    Int64ArrayType::Pointer ids = attrMats[0]->getAttributeArrayAs<Int64ArrayType>("Ids");
+    DREAM3D_REQUIRE_EQUAL(ids->getValue(4), 6)
+
+    // Elements that reference missing vertices are rejected
+    int64_t badQuad[4] = {0, 1, 2, 6};
+    quads->setVertsAtQuad(1, badQuad);
+    err = quads->weldVertices(0.1f);
+    DREAM3D_REQUIRE_EQUAL(err, -1)
+    DREAM3D_REQUIRE_EQUAL(quads->getNumberOfVertices(), 6)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDegenerateElements()
+  {
+    // A proper triangle, a sliver that collapses onto an edge and a tiny triangle that collapses to a point
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(7);
+    float coords[7][3] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 0.01f, 0}, {5, 5, 5}, {5.01f, 5, 5}, {5, 5.01f, 5}};
+    for(int64_t i = 0; i < 7; i++)
+    {
+      vertices->setTuple(i, coords[i]);
+    }
+    TriangleGeom::Pointer tris = TriangleGeom::CreateGeometry(3, vertices, "Triangles");
+    int64_t tri0[3] = {0, 1, 2};
+    int64_t tri1[3] = {1, 3, 2};
+    int64_t tri2[3] = {4, 5, 6};
+    tris->setVertsAtTri(0, tri0);
+    tris->setVertsAtTri(1, tri1);
+    tris->setVertsAtTri(2, tri2);
+    TriangleGeom::Pointer keptTris = std::dynamic_pointer_cast<TriangleGeom>(tris->deepCopy());
+
+    // By default the collapsed triangles are kept
+    int err = keptTris->weldVertices(0.05f);
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_EQUAL(keptTris->getNumberOfTris(), 3)
+    DREAM3D_REQUIRE_EQUAL(keptTris->getNumberOfVertices(), 4)
+
+    VertexWelder::Pointer welder = VertexWelder::Create(tris->getVertices(), tris->getTriangles(), 0.05f, true, true);
+    DREAM3D_REQUIRE_VALID_POINTER(welder.get())
+    DREAM3D_REQUIRE_EQUAL(welder->getNumberOfDegenerateElements(), 2)
+    DREAM3D_REQUIRE_EQUAL(welder->getNumberOfUnreferencedVertices(), 1)
+
+    // Removing them also removes the vertices only they used, and compacts the element data
+    QVector<size_t> tDims(1, 3);
+    AttributeMatrix::Pointer faceData = AttributeMatrix::New(tDims, "FaceData", AttributeMatrix::Type::Face);
+    Int64ArrayType::Pointer faceIds = Int64ArrayType::CreateArray(3, "Ids");
+    for(int64_t i = 0; i < 3; i++)
+    {
+      faceIds->setValue(i, i);
+    }
+    faceData->addAttributeArray(faceIds->getName(), faceIds);
+    err = tris->findElementCentroids();
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+
+    err = tris->weldVertices(0.05f, true, true, QVector<AttributeMatrix::Pointer>(), QVector<AttributeMatrix::Pointer>(1, faceData));
+    DREAM3D_REQUIRE_EQUAL(err, 1)
+    DREAM3D_REQUIRE_EQUAL(tris->getNumberOfTris(), 1)
+    DREAM3D_REQUIRE_EQUAL(tris->getNumberOfVertices(), 3)
+    DREAM3D_REQUIRE_EQUAL(faceData->getNumberOfTuples(), 1)
+    DREAM3D_REQUIRE_EQUAL(faceData->getAttributeArrayAs<Int64ArrayType>("Ids")->getValue(0), 0)
+    DREAM3D_REQUIRE_NULL_POINTER(tris->getElementCentroids().get())
+    int64_t verts[3] = {0, 0, 0};
+    tris->getVertsAtTri(0, verts);
+    DREAM3D_REQUIRE_EQUAL(verts[0], 0)
+    DREAM3D_REQUIRE_EQUAL(verts[1], 1)
+    DREAM3D_REQUIRE_EQUAL(verts[2], 2)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### VertexWelderTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestWeldTriangles())
+    DREAM3D_REGISTER_TEST(TestExactWeld())
+    DREAM3D_REGISTER_TEST(TestWeldQuads())
+    DREAM3D_REGISTER_TEST(TestDegenerateElements())
+  }
+
+private:
+  VertexWelderTest(const VertexWelderTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VertexWelderTest&) = delete;   // Move assignment Not Implemented
+};
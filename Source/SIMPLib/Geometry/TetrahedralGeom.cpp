@@ -55,18 +55,24 @@
 
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/MeshReorderer.h"
+#include "SIMPLib/Utilities/ParallelProgress.h"
 
 /**
- * @brief The FindTriangleDerivativesImpl class implements a threaded algorithm that computes the
- * derivative of an arbitrary dimensional field on the underlying triangles
+ * @brief The FindTetDerivativesImpl class implements a threaded algorithm that computes the
+ * derivative of an arbitrary dimensional field on the underlying tetrahedra. The field is read in its
+ * native type; if a list of elements containing each vertex is supplied the field is element centered
+ * and is averaged onto the vertices as it is read.
  */
-class FindTetDerivativesImpl
+template <typename T, typename K> class FindTetDerivativesImpl
 {
 public:
-  FindTetDerivativesImpl(TetrahedralGeom* tets, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs)
+  FindTetDerivativesImpl(TetrahedralGeom* tets, typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivs, ElementDynamicList::Pointer elemsContainingVert, ParallelProgress* progress)
   : m_Tets(tets)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_ElemsContainingVert(elemsContainingVert)
+  , m_Progress(progress)
   {
   }
   virtual ~FindTetDerivativesImpl()
@@ -76,11 +82,12 @@ public:
   void compute(int64_t start, int64_t end) const
   {
     int32_t cDims = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    T* fieldPtr = m_Field->getPointer(0);
+    K* derivsPtr = m_Derivatives->getPointer(0);
+    std::vector<double> vertValues(4 * cDims, 0.0);
     double values[4] = {0.0, 0.0, 0.0, 0.0};
     double derivs[3] = {0.0, 0.0, 0.0};
-    int64_t verts[4]{0, 0, 0, 0};
+    int64_t verts[4] = {0, 0, 0, 0};
 
     int64_t counter = 0;
     int64_t totalElements = m_Tets->getNumberOfTets();
@@ -89,25 +96,31 @@ public:
     for(int64_t i = start; i < end; i++)
     {
       m_Tets->getVertsAtTet(i, verts);
+      DerivativeHelpers::GatherVertexValues<T>(fieldPtr, cDims, verts, 4, m_ElemsContainingVert.get(), vertValues.data());
       for(int32_t j = 0; j < cDims; j++)
       {
         for(size_t k = 0; k < 4; k++)
         {
-          values[k] = fieldPtr[cDims * verts[k] + j];
+          values[k] = vertValues[k * cDims + j];
         }
         DerivativeHelpers::TetDeriv()(m_Tets, i, values, derivs);
-        derivsPtr[i * 3 * cDims + j * 3] = derivs[0];
-        derivsPtr[i * 3 * cDims + j * 3 + 1] = derivs[1];
-        derivsPtr[i * 3 * cDims + j * 3 + 2] = derivs[2];
+        derivsPtr[i * 3 * cDims + j * 3] = static_cast<K>(derivs[0]);
+        derivsPtr[i * 3 * cDims + j * 3 + 1] = static_cast<K>(derivs[1]);
+        derivsPtr[i * 3 * cDims + j * 3 + 2] = static_cast<K>(derivs[2]);
       }
 
       if(counter > progIncrement)
       {
-        m_Tets->sendThreadSafeProgressMessage(counter, totalElements);
+        m_Progress->increment(counter);
         counter = 0;
+        if(m_Progress->wasCanceled())
+        {
+          return;
+        }
       }
       counter++;
     }
+    m_Progress->increment(counter);
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -118,8 +131,10 @@ public:
 #endif
 private:
   TetrahedralGeom* m_Tets;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  typename DataArray<T>::Pointer m_Field;
+  typename DataArray<K>::Pointer m_Derivatives;
+  ElementDynamicList::Pointer m_ElemsContainingVert;
+  ParallelProgress* m_Progress;
 };
 
 // -----------------------------------------------------------------------------
@@ -382,14 +397,7 @@ void TetrahedralGeom::deleteElementNeighbors()
 // -----------------------------------------------------------------------------
 int TetrahedralGeom::findElementCentroids()
 {
-  QVector<size_t> cDims(1, 3);
-  m_TetCentroids = FloatArrayType::CreateArray(getNumberOfTets(), cDims, SIMPL::StringConstants::TetCentroids);
-  GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_TetList, m_VertexList, m_TetCentroids);
-  if(m_TetCentroids.get() == nullptr)
-  {
-    return -1;
-  }
-  return 1;
+  return updateElementCentroidsAndSizes(true, false);
 }
 
 // -----------------------------------------------------------------------------
@@ -422,12 +430,38 @@ void TetrahedralGeom::deleteElementCentroids()
 // -----------------------------------------------------------------------------
 int TetrahedralGeom::findElementSizes()
 {
-  QVector<size_t> cDims(1, 1);
-  m_TetSizes = FloatArrayType::CreateArray(getNumberOfTets(), cDims, SIMPL::StringConstants::TetVolumes);
-  GeometryHelpers::Topology::FindTetVolumes<int64_t>(m_TetList, m_VertexList, m_TetSizes);
-  if(m_TetSizes.get() == nullptr)
+  return updateElementCentroidsAndSizes(false, true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TetrahedralGeom::findElementMeasures(bool centroids, bool sizes)
+{
+  FloatArrayType::Pointer elemCentroids = FloatArrayType::NullPointer();
+  FloatArrayType::Pointer elemSizes = FloatArrayType::NullPointer();
+  if(centroids)
   {
-    return -1;
+    QVector<size_t> cDims(1, 3);
+    elemCentroids = FloatArrayType::CreateArray(getNumberOfTets(), cDims, SIMPL::StringConstants::TetCentroids);
+  }
+  if(sizes)
+  {
+    QVector<size_t> cDims(1, 1);
+    elemSizes = FloatArrayType::CreateArray(getNumberOfTets(), cDims, SIMPL::StringConstants::TetVolumes);
+  }
+  int err = GeometryHelpers::Topology::FindElementCentroidsAndSizes<int64_t>(m_TetList, m_VertexList, elemCentroids, elemSizes, IGeometry::Type::Tetrahedral);
+  if(err < 0)
+  {
+    return err;
+  }
+  if(centroids)
+  {
+    m_TetCentroids = elemCentroids;
+  }
+  if(sizes)
+  {
+    m_TetSizes = elemSizes;
   }
   return 1;
 }
@@ -534,6 +568,97 @@ void TetrahedralGeom::deleteUnsharedFaces()
   m_UnsharedTriList = SharedTriList::NullPointer();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TetrahedralGeom::reorder(MeshReorderer::Method method, const QVector<AttributeMatrix::Pointer>& vertexAttributeMatrices, const QVector<AttributeMatrix::Pointer>& elementAttributeMatrices)
+{
+  size_t numElems = static_cast<size_t>(getNumberOfTets());
+  size_t numVerts = static_cast<size_t>(getNumberOfVertices());
+  for(const AttributeMatrix::Pointer& attrMat : vertexAttributeMatrices)
+  {
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != numVerts)
+    {
+      return -2;
+    }
+  }
+  for(const AttributeMatrix::Pointer& attrMat : elementAttributeMatrices)
+  {
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != numElems)
+    {
+      return -2;
+    }
+  }
+
+  std::vector<size_t> elementOrder;
+  if(method == MeshReorderer::Method::ReverseCuthillMcKee)
+  {
+    // The cached connectivity may predate edits made through the element list, so it is rebuilt here
+    int err = findElementsContainingVert();
+    if(err < 0)
+    {
+      return err;
+    }
+    err = findElementNeighbors();
+    if(err < 0)
+    {
+      return err;
+    }
+    elementOrder = MeshReorderer::ReverseCuthillMcKeeOrder(m_TetNeighbors, numElems);
+  }
+  else
+  {
+    int err = updateElementCentroidsAndSizes(true, false);
+    if(err < 0)
+    {
+      return err;
+    }
+    elementOrder = MeshReorderer::SpaceFillingCurveOrder(m_TetCentroids->getPointer(0), numElems, method);
+  }
+  MeshReorderer::Pointer reorderer = MeshReorderer::Create(m_TetList, numVerts, elementOrder);
+  if(nullptr == reorderer.get())
+  {
+    return -1;
+  }
+
+  for(const AttributeMatrix::Pointer& attrMat : vertexAttributeMatrices)
+  {
+    int err = attrMat->permuteTuples(reorderer->getVertexOrder());
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+  for(const AttributeMatrix::Pointer& attrMat : elementAttributeMatrices)
+  {
+    int err = attrMat->permuteTuples(elementOrder);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+  m_TetList->permuteTuples(elementOrder);
+  reorderer->renumberVertices(m_TetList);
+  reorderer->renumberVertices(m_EdgeList);
+  reorderer->renumberVertices(m_UnsharedEdgeList);
+  reorderer->renumberVertices(m_TriList);
+  reorderer->renumberVertices(m_UnsharedTriList);
+  m_VertexList->permuteTuples(reorderer->getVertexOrder());
+
+  // The centroids and sizes move with their elements, so they stay current
+  if(m_TetCentroids.get() != nullptr)
+  {
+    m_TetCentroids->permuteTuples(elementOrder);
+  }
+  if(m_TetSizes.get() != nullptr)
+  {
+    m_TetSizes->permuteTuples(elementOrder);
+  }
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  return 1;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -574,6 +699,14 @@ void TetrahedralGeom::getShapeFunctions(double pCoords[3], double* shape)
 //
 // -----------------------------------------------------------------------------
 void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives<double, double>(field, derivatives, observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void TetrahedralGeom::findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   int64_t numTets = getNumberOfTets();
@@ -583,6 +716,8 @@ void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArra
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
 
+  ParallelProgress progress(this, numTets, m_MessagePrefix, m_MessageLabel, m_MessageTitle, observable);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
   bool doParallel = true;
@@ -591,16 +726,61 @@ void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArra
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numTets), FindTetDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numTets), FindTetDerivativesImpl<T, K>(this, field, derivatives, ElementDynamicList::NullPointer(), &progress), tbb::auto_partitioner());
   }
   else
 #endif
   {
-    FindTetDerivativesImpl serial(this, field, derivatives);
+    FindTetDerivativesImpl<T, K> serial(this, field, derivatives, ElementDynamicList::NullPointer(), &progress);
     serial.compute(0, numTets);
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void TetrahedralGeom::findDerivativesFromElementValues(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
+{
+  m_ProgressCounter = 0;
+  int64_t numTets = getNumberOfTets();
+
+  if(getElementsContainingVert().get() == nullptr)
+  {
+    if(findElementsContainingVert() < 0)
+    {
+      return;
+    }
+  }
+  ElementDynamicList::Pointer elemsContainingVert = getElementsContainingVert();
+
+  if(observable)
+  {
+    connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
+  }
+
+  ParallelProgress progress(this, numTets, m_MessagePrefix, m_MessageLabel, m_MessageTitle, observable);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numTets), FindTetDerivativesImpl<T, K>(this, field, derivatives, elemsContainingVert, &progress), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    FindTetDerivativesImpl<T, K> serial(this, field, derivatives, elemsContainingVert, &progress);
+    serial.compute(0, numTets);
+  }
+}
+
+SIMPL_INSTANTIATE_DERIVATIVES(TetrahedralGeom, findDerivatives)
+SIMPL_INSTANTIATE_DERIVATIVES(TetrahedralGeom, findDerivativesFromElementValues)
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -851,10 +1031,10 @@ int TetrahedralGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 // -----------------------------------------------------------------------------
 IGeometry::Pointer TetrahedralGeom::deepCopy(bool forceNoAllocate)
 {
-  SharedTetList::Pointer tets = std::dynamic_pointer_cast<SharedTetList>((getTetrahedra().get() == nullptr) ? nullptr : getTetrahedra()->deepCopy(forceNoAllocate));
-  SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
-  SharedTriList::Pointer tris = std::dynamic_pointer_cast<SharedTriList>((getTriangles().get() == nullptr) ? nullptr : getTriangles()->deepCopy(forceNoAllocate));
-  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((getEdges().get() == nullptr) ? nullptr : getEdges()->deepCopy(forceNoAllocate));
+  SharedTetList::Pointer tets = std::dynamic_pointer_cast<SharedTetList>((m_TetList.get() == nullptr) ? nullptr : m_TetList->deepCopy(forceNoAllocate));
+  SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((m_VertexList.get() == nullptr) ? nullptr : m_VertexList->deepCopy(forceNoAllocate));
+  SharedTriList::Pointer tris = std::dynamic_pointer_cast<SharedTriList>((m_TriList.get() == nullptr) ? nullptr : m_TriList->deepCopy(forceNoAllocate));
+  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((m_EdgeList.get() == nullptr) ? nullptr : m_EdgeList->deepCopy(forceNoAllocate));
   SharedEdgeList::Pointer unsharedEdges = std::dynamic_pointer_cast<SharedEdgeList>((getUnsharedEdges().get() == nullptr) ? nullptr : getUnsharedEdges()->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementsContainingVert =
       std::dynamic_pointer_cast<ElementDynamicList>((getElementsContainingVert().get() == nullptr) ? nullptr : getElementsContainingVert()->deepCopy(forceNoAllocate));
@@ -38,6 +38,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Geometry/IGeometry3D.h"
+#include "SIMPLib/Geometry/MeshReorderer.h"
 
 /**
  * @brief The TetrahedralGeom class represents a collection of tetrahedra
@@ -151,6 +152,13 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     int64_t* getTriPointer(int64_t i);
 
+    /**
+     * @brief getTriPointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    const int64_t* getTriPointer(int64_t i) const;
+
     /**
      * @brief getNumberOfTris
      * @return
@@ -216,6 +224,13 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     int64_t* getTetPointer(int64_t i);
 
+    /**
+     * @brief getTetPointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    const int64_t* getTetPointer(int64_t i) const;
+
     /**
      * @brief getNumberOfTets
      * @return
@@ -325,6 +340,22 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     virtual void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr);
 
+    /**
+     * @brief findDerivatives Computes the derivatives of a vertex field in its native type
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
+    /**
+     * @brief findDerivativesFromElementValues Computes the derivatives of an element centered field
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivativesFromElementValues(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -411,6 +442,13 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     virtual float* getVertexPointer(int64_t i);
 
+    /**
+     * @brief getVertexPointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    virtual const float* getVertexPointer(int64_t i) const;
+
     /**
      * @brief getNumberOfVertices
      * @return
@@ -458,6 +496,13 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     virtual int64_t* getEdgePointer(int64_t i);
 
+    /**
+     * @brief getEdgePointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    virtual const int64_t* getEdgePointer(int64_t i) const;
+
     /**
      * @brief getNumberOfEdges
      * @return
@@ -518,6 +563,27 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     virtual void deleteUnsharedFaces();
 
+// -----------------------------------------------------------------------------
+// Reordering
+// -----------------------------------------------------------------------------
+
+    /**
+     * @brief reorder Renumbers the tetrahedra and the vertices so that neighbors are close in memory. The tetrahedra
+     * are sorted along a space filling curve through their centroids, or with reverse Cuthill-McKee on the tetrahedron
+     * neighbor graph, and the vertices follow the order in which the reordered tetrahedra first use them. The vertex
+     * list, the tetrahedron list, the element centroids and sizes and the arrays of the given attribute matrices are
+     * permuted in place and the edge and face lists are renumbered. The vertex and element connectivity is rebuilt for
+     * reverse Cuthill-McKee and deleted afterwards. Other geometries that share the vertex list are not renumbered.
+     * @param method
+     * @param vertexAttributeMatrices Attribute matrices with one tuple per vertex
+     * @param elementAttributeMatrices Attribute matrices with one tuple per tetrahedron
+     * @return 1 on success, -1 if the order could not be computed, -2 if an attribute matrix does not have one
+     * tuple per vertex or tetrahedron, or the error of AttributeMatrix::permuteTuples if an attribute array could not be
+     * permuted
+     */
+    int reorder(MeshReorderer::Method method, const QVector<AttributeMatrix::Pointer>& vertexAttributeMatrices = QVector<AttributeMatrix::Pointer>(),
+                const QVector<AttributeMatrix::Pointer>& elementAttributeMatrices = QVector<AttributeMatrix::Pointer>());
+
   protected:
 
     TetrahedralGeom();
@@ -546,6 +612,14 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
      */
     virtual void setElementSizes(FloatArrayType::Pointer elementSizes);
 
+    /**
+     * @brief findElementMeasures Computes the requested element centroids and sizes in one parallel sweep
+     * @param centroids
+     * @param sizes
+     * @return
+     */
+    virtual int findElementMeasures(bool centroids, bool sizes);
+
     /**
      * @brief setEdges
      * @param edges
@@ -576,7 +650,7 @@ class SIMPLib_EXPORT TetrahedralGeom : public IGeometry3D
     FloatArrayType::Pointer m_TetCentroids;
     FloatArrayType::Pointer m_TetSizes;
 
-    friend class FindTetDerivativesImpl;
+    template <typename T, typename K> friend class FindTetDerivativesImpl;
 
     TetrahedralGeom(const TetrahedralGeom&) = delete; // Copy Constructor Not Implemented
     void operator=(const TetrahedralGeom&) = delete;  // Move assignment Not Implemented
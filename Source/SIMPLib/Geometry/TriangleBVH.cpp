@@ -0,0 +1,1012 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/Geometry/TriangleBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Math/GeometryMath.h"
+
+namespace
+{
+const int32_t k_MaxLeafSize = 4;
+const int32_t k_NumBins = 12;
+const int32_t k_ParallelBuildThreshold = 4096;
+// Past this depth splits are forced to the median, which bounds the depth to k_MaxSahDepth + 31
+const int32_t k_MaxSahDepth = 64;
+const int32_t k_StackSize = 128;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ResetBounds(float* ll, float* ur)
+{
+  for(int i = 0; i < 3; i++)
+  {
+    ll[i] = std::numeric_limits<float>::max();
+    ur[i] = -std::numeric_limits<float>::max();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GrowBounds(float* ll, float* ur, const float* otherLL, const float* otherUR)
+{
+  for(int i = 0; i < 3; i++)
+  {
+    ll[i] = std::min(ll[i], otherLL[i]);
+    ur[i] = std::max(ur[i], otherUR[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float HalfSurfaceArea(const float* ll, const float* ur)
+{
+  float dx = ur[0] - ll[0];
+  float dy = ur[1] - ll[1];
+  float dz = ur[2] - ll[2];
+  if(dx < 0.0f || dy < 0.0f || dz < 0.0f)
+  {
+    return 0.0f;
+  }
+  return dx * dy + dy * dz + dz * dx;
+}
+
+// -----------------------------------------------------------------------------
+// Clips the segment q + t * d, t in [0, 1], against the box
+// -----------------------------------------------------------------------------
+bool SegmentIntersectsBox(const float* q, const float* d, const float* ll, const float* ur)
+{
+  float t0 = 0.0f;
+  float t1 = 1.0f;
+  for(int i = 0; i < 3; i++)
+  {
+    if(d[i] == 0.0f)
+    {
+      if(q[i] < ll[i] || q[i] > ur[i])
+      {
+        return false;
+      }
+      continue;
+    }
+    float inv = 1.0f / d[i];
+    float tNear = (ll[i] - q[i]) * inv;
+    float tFar = (ur[i] - q[i]) * inv;
+    if(tNear > tFar)
+    {
+      std::swap(tNear, tFar);
+    }
+    t0 = std::max(t0, tNear);
+    t1 = std::min(t1, tFar);
+    if(t0 > t1)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Returns the distance along the ray at which it enters the box, or a negative value on a miss
+// -----------------------------------------------------------------------------
+float RayEntersBox(const float* origin, const float* invDir, float maxT, const float* ll, const float* ur)
+{
+  float t0 = 0.0f;
+  float t1 = maxT;
+  for(int i = 0; i < 3; i++)
+  {
+    float tNear = (ll[i] - origin[i]) * invDir[i];
+    float tFar = (ur[i] - origin[i]) * invDir[i];
+    if(tNear > tFar)
+    {
+      std::swap(tNear, tFar);
+    }
+    // NaN from 0 * inf leaves the interval unchanged, which keeps the test conservative
+    t0 = (tNear > t0) ? tNear : t0;
+    t1 = (tFar < t1) ? tFar : t1;
+    if(t0 > t1)
+    {
+      return -1.0f;
+    }
+  }
+  return t0;
+}
+
+// -----------------------------------------------------------------------------
+// Moller-Trumbore ray/triangle intersection; returns the ray parameter or a negative value on a miss
+// -----------------------------------------------------------------------------
+float RayTriangle(const float* origin, const float* dir, const float* a, const float* b, const float* c)
+{
+  const float eps = 1.0e-12f;
+  float e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+  float e2[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+  float p[3] = {dir[1] * e2[2] - dir[2] * e2[1], dir[2] * e2[0] - dir[0] * e2[2], dir[0] * e2[1] - dir[1] * e2[0]};
+  float det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+  if(std::fabs(det) < eps)
+  {
+    return -1.0f;
+  }
+  float invDet = 1.0f / det;
+  float s[3] = {origin[0] - a[0], origin[1] - a[1], origin[2] - a[2]};
+  float u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * invDet;
+  if(u < 0.0f || u > 1.0f)
+  {
+    return -1.0f;
+  }
+  float qv[3] = {s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0]};
+  float v = (dir[0] * qv[0] + dir[1] * qv[1] + dir[2] * qv[2]) * invDet;
+  if(v < 0.0f || u + v > 1.0f)
+  {
+    return -1.0f;
+  }
+  return (e2[0] * qv[0] + e2[1] * qv[1] + e2[2] * qv[2]) * invDet;
+}
+
+// -----------------------------------------------------------------------------
+// Closest point on a triangle, following Ericson, Real-Time Collision Detection, 5.1.5
+// -----------------------------------------------------------------------------
+void ClosestPointOnTriangle(const float* p, const float* a, const float* b, const float* c, float* out)
+{
+  float ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+  float ac[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+  float ap[3] = {p[0] - a[0], p[1] - a[1], p[2] - a[2]};
+  float d1 = ab[0] * ap[0] + ab[1] * ap[1] + ab[2] * ap[2];
+  float d2 = ac[0] * ap[0] + ac[1] * ap[1] + ac[2] * ap[2];
+  if(d1 <= 0.0f && d2 <= 0.0f)
+  {
+    std::copy(a, a + 3, out);
+    return;
+  }
+
+  float bp[3] = {p[0] - b[0], p[1] - b[1], p[2] - b[2]};
+  float d3 = ab[0] * bp[0] + ab[1] * bp[1] + ab[2] * bp[2];
+  float d4 = ac[0] * bp[0] + ac[1] * bp[1] + ac[2] * bp[2];
+  if(d3 >= 0.0f && d4 <= d3)
+  {
+    std::copy(b, b + 3, out);
+    return;
+  }
+
+  float vc = d1 * d4 - d3 * d2;
+  if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+  {
+    float v = d1 / (d1 - d3);
+    for(int i = 0; i < 3; i++)
+    {
+      out[i] = a[i] + v * ab[i];
+    }
+    return;
+  }
+
+  float cp[3] = {p[0] - c[0], p[1] - c[1], p[2] - c[2]};
+  float d5 = ab[0] * cp[0] + ab[1] * cp[1] + ab[2] * cp[2];
+  float d6 = ac[0] * cp[0] + ac[1] * cp[1] + ac[2] * cp[2];
+  if(d6 >= 0.0f && d5 <= d6)
+  {
+    std::copy(c, c + 3, out);
+    return;
+  }
+
+  float vb = d5 * d2 - d1 * d6;
+  if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+  {
+    float w = d2 / (d2 - d6);
+    for(int i = 0; i < 3; i++)
+    {
+      out[i] = a[i] + w * ac[i];
+    }
+    return;
+  }
+
+  float va = d3 * d6 - d5 * d4;
+  if(va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+  {
+    float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    for(int i = 0; i < 3; i++)
+    {
+      out[i] = b[i] + w * (c[i] - b[i]);
+    }
+    return;
+  }
+
+  float denom = 1.0f / (va + vb + vc);
+  float v = vb * denom;
+  float w = vc * denom;
+  for(int i = 0; i < 3; i++)
+  {
+    out[i] = a[i] + ab[i] * v + ac[i] * w;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float SquaredDistanceToBox(const float* p, const float* ll, const float* ur)
+{
+  float dist = 0.0f;
+  for(int i = 0; i < 3; i++)
+  {
+    float d = 0.0f;
+    if(p[i] < ll[i])
+    {
+      d = ll[i] - p[i];
+    }
+    else if(p[i] > ur[i])
+    {
+      d = p[i] - ur[i];
+    }
+    dist += d * d;
+  }
+  return dist;
+}
+}
+
+/**
+ * @brief The GatherTrianglesImpl class copies the triangle coordinates out of the geometry and computes
+ * the bounds and centroid of each triangle
+ */
+class GatherTrianglesImpl
+{
+public:
+  GatherTrianglesImpl(TriangleGeom* triangles, const int32_t* faceIds, float* coords, float* bounds, float* centroids)
+  : m_Triangles(triangles)
+  , m_FaceIds(faceIds)
+  , m_Coords(coords)
+  , m_Bounds(bounds)
+  , m_Centroids(centroids)
+  {
+  }
+  virtual ~GatherTrianglesImpl() = default;
+
+  void gather(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      int64_t faceId = (nullptr != m_FaceIds) ? m_FaceIds[i] : static_cast<int64_t>(i);
+      float* a = m_Coords + 9 * i;
+      m_Triangles->getVertCoordsAtTri(faceId, a, a + 3, a + 6);
+      float* ll = m_Bounds + 6 * i;
+      float* ur = ll + 3;
+      for(int j = 0; j < 3; j++)
+      {
+        ll[j] = std::min(std::min(a[j], a[j + 3]), a[j + 6]);
+        ur[j] = std::max(std::max(a[j], a[j + 3]), a[j + 6]);
+        m_Centroids[3 * i + j] = (a[j] + a[j + 3] + a[j + 6]) / 3.0f;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    gather(r.begin(), r.end());
+  }
+#endif
+
+private:
+  TriangleGeom* m_Triangles;
+  const int32_t* m_FaceIds;
+  float* m_Coords;
+  float* m_Bounds;
+  float* m_Centroids;
+};
+
+/**
+ * @brief The TriangleBVHBuilder class recursively splits a range of triangles using binned surface area
+ * heuristic splits. The node slots are allocated up front: a subtree over n triangles never needs more
+ * than 2n - 1 nodes, so the second child of a node over [start, end) split at mid is placed 2 * (mid - start)
+ * slots after it. That lets both subtrees be built concurrently without any shared allocation.
+ */
+class TriangleBVHBuilder
+{
+public:
+  TriangleBVHBuilder(std::vector<TriangleBVH::Node>& nodes, std::vector<int32_t>& order, const float* bounds, const float* centroids, float padding)
+  : m_Nodes(nodes)
+  , m_Order(order)
+  , m_Bounds(bounds)
+  , m_Centroids(centroids)
+  , m_Padding(padding)
+  {
+  }
+  virtual ~TriangleBVHBuilder() = default;
+
+  void buildNode(int32_t nodeIndex, int32_t start, int32_t end, int32_t depth) const
+  {
+    TriangleBVH::Node& node = m_Nodes[nodeIndex];
+    float centroidLL[3];
+    float centroidUR[3];
+    ResetBounds(node.lowerLeft, node.upperRight);
+    ResetBounds(centroidLL, centroidUR);
+    for(int32_t i = start; i < end; i++)
+    {
+      const float* faceBounds = m_Bounds + 6 * m_Order[i];
+      const float* centroid = m_Centroids + 3 * m_Order[i];
+      GrowBounds(node.lowerLeft, node.upperRight, faceBounds, faceBounds + 3);
+      GrowBounds(centroidLL, centroidUR, centroid, centroid);
+    }
+    for(int i = 0; i < 3; i++)
+    {
+      node.lowerLeft[i] -= m_Padding;
+      node.upperRight[i] += m_Padding;
+    }
+
+    int32_t count = end - start;
+    if(count <= k_MaxLeafSize)
+    {
+      node.start = start;
+      node.count = count;
+      node.second = -1;
+      return;
+    }
+
+    int32_t mid = findSplit(start, end, centroidLL, centroidUR, depth < k_MaxSahDepth);
+
+    int32_t first = nodeIndex + 1;
+    int32_t second = nodeIndex + 2 * (mid - start);
+    node.start = start;
+    node.count = 0;
+    node.second = second;
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(count > k_ParallelBuildThreshold)
+    {
+      tbb::parallel_invoke([=] { buildNode(first, start, mid, depth + 1); }, [=] { buildNode(second, mid, end, depth + 1); });
+      return;
+    }
+#endif
+    buildNode(first, start, mid, depth + 1);
+    buildNode(second, mid, end, depth + 1);
+  }
+
+private:
+  int32_t findSplit(int32_t start, int32_t end, const float* centroidLL, const float* centroidUR, bool useSah) const
+  {
+    int axis = 0;
+    float extent[3] = {centroidUR[0] - centroidLL[0], centroidUR[1] - centroidLL[1], centroidUR[2] - centroidLL[2]};
+    if(extent[1] > extent[axis])
+    {
+      axis = 1;
+    }
+    if(extent[2] > extent[axis])
+    {
+      axis = 2;
+    }
+
+    int32_t half = start + (end - start) / 2;
+    if(extent[axis] <= 0.0f)
+    {
+      // Every centroid coincides; any split is as good as another
+      return half;
+    }
+
+    const float* centroids = m_Centroids;
+    if(!useSah)
+    {
+      std::nth_element(m_Order.begin() + start, m_Order.begin() + half, m_Order.begin() + end,
+                       [=](int32_t lhs, int32_t rhs) { return centroids[3 * lhs + axis] < centroids[3 * rhs + axis]; });
+      return half;
+    }
+
+    int32_t binCounts[k_NumBins];
+    float binLL[k_NumBins][3];
+    float binUR[k_NumBins][3];
+    for(int32_t b = 0; b < k_NumBins; b++)
+    {
+      binCounts[b] = 0;
+      ResetBounds(binLL[b], binUR[b]);
+    }
+
+    const float scale = static_cast<float>(k_NumBins) / extent[axis];
+    const float axisMin = centroidLL[axis];
+    auto binOf = [=](int32_t face) {
+      int32_t b = static_cast<int32_t>((centroids[3 * face + axis] - axisMin) * scale);
+      return (b >= k_NumBins) ? (k_NumBins - 1) : b;
+    };
+
+    for(int32_t i = start; i < end; i++)
+    {
+      int32_t face = m_Order[i];
+      int32_t b = binOf(face);
+      binCounts[b]++;
+      GrowBounds(binLL[b], binUR[b], m_Bounds + 6 * face, m_Bounds + 6 * face + 3);
+    }
+
+    // Sweep from the right to collect the cost of every right hand side, then from the left to pick the split
+    float rightCost[k_NumBins];
+    float ll[3];
+    float ur[3];
+    ResetBounds(ll, ur);
+    int32_t rightCount = 0;
+    for(int32_t b = k_NumBins - 1; b > 0; b--)
+    {
+      GrowBounds(ll, ur, binLL[b], binUR[b]);
+      rightCount += binCounts[b];
+      rightCost[b] = static_cast<float>(rightCount) * HalfSurfaceArea(ll, ur);
+    }
+
+    ResetBounds(ll, ur);
+    int32_t leftCount = 0;
+    int32_t bestBin = -1;
+    float bestCost = std::numeric_limits<float>::max();
+    for(int32_t b = 0; b < k_NumBins - 1; b++)
+    {
+      GrowBounds(ll, ur, binLL[b], binUR[b]);
+      leftCount += binCounts[b];
+      if(leftCount == 0 || leftCount == (end - start))
+      {
+        continue;
+      }
+      float cost = static_cast<float>(leftCount) * HalfSurfaceArea(ll, ur) + rightCost[b + 1];
+      if(cost < bestCost)
+      {
+        bestCost = cost;
+        bestBin = b;
+      }
+    }
+
+    if(bestBin < 0)
+    {
+      std::nth_element(m_Order.begin() + start, m_Order.begin() + half, m_Order.begin() + end,
+                       [=](int32_t lhs, int32_t rhs) { return centroids[3 * lhs + axis] < centroids[3 * rhs + axis]; });
+      return half;
+    }
+
+    auto midIter = std::partition(m_Order.begin() + start, m_Order.begin() + end, [=](int32_t face) { return binOf(face) <= bestBin; });
+    return static_cast<int32_t>(midIter - m_Order.begin());
+  }
+
+  std::vector<TriangleBVH::Node>& m_Nodes;
+  std::vector<int32_t>& m_Order;
+  const float* m_Bounds;
+  const float* m_Centroids;
+  float m_Padding;
+};
+
+/**
+ * @brief The PointInPolyhedronImpl class classifies a batch of points against the surface
+ */
+class PointInPolyhedronImpl
+{
+public:
+  PointInPolyhedronImpl(const TriangleBVH* bvh, const float* points, float radius, char* codes)
+  : m_BVH(bvh)
+  , m_Points(points)
+  , m_Radius(radius)
+  , m_Codes(codes)
+  {
+  }
+  virtual ~PointInPolyhedronImpl() = default;
+
+  void classify(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_Codes[i] = m_BVH->pointInPolyhedron(m_Points + 3 * i, m_Radius);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    classify(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const TriangleBVH* m_BVH;
+  const float* m_Points;
+  float m_Radius;
+  char* m_Codes;
+};
+
+/**
+ * @brief The RayCastImpl class finds the closest hit for a batch of rays
+ */
+class RayCastImpl
+{
+public:
+  RayCastImpl(const TriangleBVH* bvh, const float* origins, const float* directions, float maxDistance, int64_t* faceIds, float* distances)
+  : m_BVH(bvh)
+  , m_Origins(origins)
+  , m_Directions(directions)
+  , m_MaxDistance(maxDistance)
+  , m_FaceIds(faceIds)
+  , m_Distances(distances)
+  {
+  }
+  virtual ~RayCastImpl() = default;
+
+  void cast(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_BVH->rayCast(m_Origins + 3 * i, m_Directions + 3 * i, m_MaxDistance, m_FaceIds[i], m_Distances[i]);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    cast(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const TriangleBVH* m_BVH;
+  const float* m_Origins;
+  const float* m_Directions;
+  float m_MaxDistance;
+  int64_t* m_FaceIds;
+  float* m_Distances;
+};
+
+/**
+ * @brief The ClosestPointImpl class finds the closest surface point for a batch of points
+ */
+class ClosestPointImpl
+{
+public:
+  ClosestPointImpl(const TriangleBVH* bvh, const float* points, float* closest, int64_t* faceIds, float* distances)
+  : m_BVH(bvh)
+  , m_Points(points)
+  , m_Closest(closest)
+  , m_FaceIds(faceIds)
+  , m_Distances(distances)
+  {
+  }
+  virtual ~ClosestPointImpl() = default;
+
+  void find(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      m_BVH->findClosestPoint(m_Points + 3 * i, m_Closest + 3 * i, m_FaceIds[i], m_Distances[i]);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    find(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const TriangleBVH* m_BVH;
+  const float* m_Points;
+  float* m_Closest;
+  int64_t* m_FaceIds;
+  float* m_Distances;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::TriangleBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::~TriangleBVH() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::Create(TriangleGeom* triangles)
+{
+  Pointer bvh(new TriangleBVH());
+  if(nullptr != triangles)
+  {
+    bvh->build(triangles, nullptr, static_cast<size_t>(triangles->getNumberOfTris()));
+  }
+  return bvh;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleBVH::Pointer TriangleBVH::Create(TriangleGeom* triangles, const Int32Int32DynamicListArray::ElementList& faceIds)
+{
+  Pointer bvh(new TriangleBVH());
+  if(nullptr != triangles && faceIds.ncells > 0)
+  {
+    bvh->build(triangles, faceIds.cells, static_cast<size_t>(faceIds.ncells));
+  }
+  return bvh;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::build(TriangleGeom* triangles, const int32_t* faceIds, size_t numFaces)
+{
+  m_Nodes.clear();
+  m_Coords.clear();
+  m_FaceIds.clear();
+  if(numFaces == 0)
+  {
+    return;
+  }
+
+  std::vector<float> coords(9 * numFaces);
+  std::vector<float> bounds(6 * numFaces);
+  std::vector<float> centroids(3 * numFaces);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numFaces), GatherTrianglesImpl(triangles, faceIds, coords.data(), bounds.data(), centroids.data()), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    GatherTrianglesImpl serial(triangles, faceIds, coords.data(), bounds.data(), centroids.data());
+    serial.gather(0, numFaces);
+  }
+
+  // Pad every box slightly so that round off never lets a segment slip between a box and the triangle it holds
+  float ll[3];
+  float ur[3];
+  ResetBounds(ll, ur);
+  for(size_t i = 0; i < numFaces; i++)
+  {
+    GrowBounds(ll, ur, &bounds[6 * i], &bounds[6 * i + 3]);
+  }
+  float size = std::max(std::max(ur[0] - ll[0], ur[1] - ll[1]), ur[2] - ll[2]);
+  float padding = size * 1.0e-5f + std::numeric_limits<float>::min();
+
+  std::vector<int32_t> order(numFaces);
+  for(size_t i = 0; i < numFaces; i++)
+  {
+    order[i] = static_cast<int32_t>(i);
+  }
+
+  m_Nodes.resize(2 * numFaces - 1);
+  TriangleBVHBuilder builder(m_Nodes, order, bounds.data(), centroids.data(), padding);
+  builder.buildNode(0, 0, static_cast<int32_t>(numFaces), 0);
+
+  // Store the triangles in leaf order so a leaf reads one contiguous block
+  m_Coords.resize(9 * numFaces);
+  m_FaceIds.resize(numFaces);
+  for(size_t i = 0; i < numFaces; i++)
+  {
+    int32_t face = order[i];
+    std::copy(coords.begin() + 9 * face, coords.begin() + 9 * face + 9, m_Coords.begin() + 9 * i);
+    m_FaceIds[i] = (nullptr != faceIds) ? faceIds[face] : static_cast<int64_t>(face);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TriangleBVH::getNumberOfFaces() const
+{
+  return m_FaceIds.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::getBounds(float lowerLeft[3], float upperRight[3]) const
+{
+  if(m_Nodes.empty())
+  {
+    std::fill(lowerLeft, lowerLeft + 3, 0.0f);
+    std::fill(upperRight, upperRight + 3, 0.0f);
+    return;
+  }
+  std::copy(m_Nodes[0].lowerLeft, m_Nodes[0].lowerLeft + 3, lowerLeft);
+  std::copy(m_Nodes[0].upperRight, m_Nodes[0].upperRight + 3, upperRight);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+char TriangleBVH::pointInPolyhedron(const float* q, float radius) const
+{
+  if(m_Nodes.empty() || GeometryMath::PointInBox(q, m_Nodes[0].lowerLeft, m_Nodes[0].upperRight) == false)
+  {
+    return 'o';
+  }
+
+  float ray[3] = {0.0f, 0.0f, 0.0f};
+  float r[3] = {0.0f, 0.0f, 0.0f};
+  float d[3] = {0.0f, 0.0f, 0.0f};
+  float p[3] = {0.0f, 0.0f, 0.0f};
+  int32_t stack[k_StackSize];
+  int32_t crossings = 0;
+  size_t numFaces = m_FaceIds.size();
+
+  // Same retry policy as GeometryMath::PointInPolyhedron: a degenerate hit discards the ray
+  for(size_t k = 0; k < numFaces; k++)
+  {
+    GeometryMath::GenerateRandomRay(radius, ray);
+    for(int i = 0; i < 3; i++)
+    {
+      r[i] = q[i] + ray[i];
+      d[i] = ray[i];
+    }
+
+    crossings = 0;
+    bool degenerate = false;
+    int32_t stackSize = 0;
+    stack[stackSize++] = 0;
+    while(stackSize > 0 && !degenerate)
+    {
+      int32_t nodeIndex = stack[--stackSize];
+      const Node& node = m_Nodes[nodeIndex];
+      if(!SegmentIntersectsBox(q, d, node.lowerLeft, node.upperRight))
+      {
+        continue;
+      }
+      if(node.count == 0)
+      {
+        stack[stackSize++] = node.second;
+        stack[stackSize++] = nodeIndex + 1;
+        continue;
+      }
+      for(int32_t f = node.start; f < node.start + node.count; f++)
+      {
+        const float* a = &m_Coords[9 * f];
+        char code = GeometryMath::RayIntersectsTriangle(a, a + 3, a + 6, q, r, p);
+        if(code == 'p' || code == 'v' || code == 'e' || code == '?')
+        {
+          degenerate = true;
+          break;
+        }
+        else if(code == 'f')
+        {
+          crossings++;
+        }
+        else if(code == 'V' || code == 'E' || code == 'F')
+        {
+          return code;
+        }
+      }
+    }
+
+    if(!degenerate)
+    {
+      break;
+    }
+  }
+
+  return ((crossings % 2) == 1) ? 'i' : 'o';
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::pointsInPolyhedron(const float* points, size_t numPoints, float radius, char* codes) const
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), PointInPolyhedronImpl(this, points, radius, codes), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    PointInPolyhedronImpl serial(this, points, radius, codes);
+    serial.classify(0, numPoints);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TriangleBVH::rayCast(const float* origin, const float* direction, float maxDistance, int64_t& faceId, float& distance) const
+{
+  faceId = -1;
+  distance = maxDistance;
+  float length = std::sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+  if(m_Nodes.empty() || length == 0.0f)
+  {
+    return false;
+  }
+
+  float dir[3] = {direction[0] / length, direction[1] / length, direction[2] / length};
+  float invDir[3] = {1.0f / dir[0], 1.0f / dir[1], 1.0f / dir[2]};
+  float best = maxDistance;
+  int32_t stack[k_StackSize];
+  int32_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    int32_t nodeIndex = stack[--stackSize];
+    const Node& node = m_Nodes[nodeIndex];
+    float tEnter = RayEntersBox(origin, invDir, best, node.lowerLeft, node.upperRight);
+    if(tEnter < 0.0f)
+    {
+      continue;
+    }
+    if(node.count == 0)
+    {
+      // Visit the nearer child first so it can tighten the search distance for the other one
+      int32_t first = nodeIndex + 1;
+      int32_t second = node.second;
+      float tFirst = RayEntersBox(origin, invDir, best, m_Nodes[first].lowerLeft, m_Nodes[first].upperRight);
+      float tSecond = RayEntersBox(origin, invDir, best, m_Nodes[second].lowerLeft, m_Nodes[second].upperRight);
+      if(tFirst >= 0.0f && tSecond >= 0.0f && tSecond < tFirst)
+      {
+        std::swap(first, second);
+      }
+      stack[stackSize++] = second;
+      stack[stackSize++] = first;
+      continue;
+    }
+    for(int32_t f = node.start; f < node.start + node.count; f++)
+    {
+      const float* a = &m_Coords[9 * f];
+      float t = RayTriangle(origin, dir, a, a + 3, a + 6);
+      if(t > 0.0f && t <= best)
+      {
+        best = t;
+        faceId = m_FaceIds[f];
+      }
+    }
+  }
+
+  distance = best;
+  return faceId >= 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::rayCast(const float* origins, const float* directions, size_t numRays, float maxDistance, int64_t* faceIds, float* distances) const
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numRays), RayCastImpl(this, origins, directions, maxDistance, faceIds, distances), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    RayCastImpl serial(this, origins, directions, maxDistance, faceIds, distances);
+    serial.cast(0, numRays);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool TriangleBVH::findClosestPoint(const float* q, float closest[3], int64_t& faceId, float& distance) const
+{
+  faceId = -1;
+  distance = std::numeric_limits<float>::max();
+  if(m_Nodes.empty())
+  {
+    return false;
+  }
+
+  float bestSq = std::numeric_limits<float>::max();
+  float candidate[3] = {0.0f, 0.0f, 0.0f};
+  int32_t stack[k_StackSize];
+  int32_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while(stackSize > 0)
+  {
+    int32_t nodeIndex = stack[--stackSize];
+    const Node& node = m_Nodes[nodeIndex];
+    if(SquaredDistanceToBox(q, node.lowerLeft, node.upperRight) > bestSq)
+    {
+      continue;
+    }
+    if(node.count == 0)
+    {
+      int32_t first = nodeIndex + 1;
+      int32_t second = node.second;
+      if(SquaredDistanceToBox(q, m_Nodes[second].lowerLeft, m_Nodes[second].upperRight) < SquaredDistanceToBox(q, m_Nodes[first].lowerLeft, m_Nodes[first].upperRight))
+      {
+        std::swap(first, second);
+      }
+      stack[stackSize++] = second;
+      stack[stackSize++] = first;
+      continue;
+    }
+    for(int32_t f = node.start; f < node.start + node.count; f++)
+    {
+      const float* a = &m_Coords[9 * f];
+      ClosestPointOnTriangle(q, a, a + 3, a + 6, candidate);
+      float dx = candidate[0] - q[0];
+      float dy = candidate[1] - q[1];
+      float dz = candidate[2] - q[2];
+      float distSq = dx * dx + dy * dy + dz * dz;
+      if(distSq < bestSq)
+      {
+        bestSq = distSq;
+        faceId = m_FaceIds[f];
+        std::copy(candidate, candidate + 3, closest);
+      }
+    }
+  }
+
+  distance = std::sqrt(bestSq);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void TriangleBVH::findClosestPoints(const float* points, size_t numPoints, float* closest, int64_t* faceIds, float* distances) const
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), ClosestPointImpl(this, points, closest, faceIds, distances), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    ClosestPointImpl serial(this, points, closest, faceIds, distances);
+    serial.find(0, numPoints);
+  }
+}
@@ -0,0 +1,189 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _trianglebvh_h_
+#define _trianglebvh_h_
+
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DynamicListArray.hpp"
+
+class TriangleGeom;
+
+/**
+ * @brief The TriangleBVH class is a bounding volume hierarchy over the triangles of a TriangleGeom, or over
+ * a subset of them such as the faces of a single feature. The hierarchy is built top down with binned
+ * surface area heuristic splits; large subtrees are built in parallel. The triangle coordinates are copied
+ * into the hierarchy in traversal order, so the TriangleGeom does not need to outlive the index.
+ *
+ * All queries are const and may be called concurrently. The batched variants distribute the queries
+ * over threads when SIMPL_USE_PARALLEL_ALGORITHMS is enabled.
+ */
+class SIMPLib_EXPORT TriangleBVH
+{
+  public:
+    SIMPL_SHARED_POINTERS(TriangleBVH)
+    SIMPL_TYPE_MACRO(TriangleBVH)
+
+    /**
+     * @brief Create Builds a hierarchy over all the triangles of the geometry
+     * @param triangles
+     * @return
+     */
+    static Pointer Create(TriangleGeom* triangles);
+
+    /**
+     * @brief Create Builds a hierarchy over the listed triangles of the geometry
+     * @param triangles
+     * @param faceIds
+     * @return
+     */
+    static Pointer Create(TriangleGeom* triangles, const Int32Int32DynamicListArray::ElementList& faceIds);
+
+    virtual ~TriangleBVH();
+
+    /**
+     * @brief getNumberOfFaces Returns the number of triangles stored in the hierarchy
+     * @return
+     */
+    size_t getNumberOfFaces() const;
+
+    /**
+     * @brief getBounds Returns the bounding box of all the triangles in the hierarchy
+     * @param lowerLeft
+     * @param upperRight
+     */
+    void getBounds(float lowerLeft[3], float upperRight[3]) const;
+
+    /**
+     * @brief pointInPolyhedron Classifies a point against the closed surface formed by the triangles. The
+     * codes match GeometryMath::PointInPolyhedron: 'i' inside, 'o' outside, 'V', 'E' or 'F' when the point
+     * lies on a vertex, edge or face.
+     * @param q Query point
+     * @param radius Length of the random rays cast from the point; should exceed the size of the surface
+     * @return
+     */
+    char pointInPolyhedron(const float* q, float radius) const;
+
+    /**
+     * @brief pointsInPolyhedron Batched version of pointInPolyhedron
+     * @param points Packed xyz coordinates of the query points
+     * @param numPoints
+     * @param radius
+     * @param codes Receives one code per point
+     */
+    void pointsInPolyhedron(const float* points, size_t numPoints, float radius, char* codes) const;
+
+    /**
+     * @brief rayCast Finds the closest triangle hit by a ray
+     * @param origin
+     * @param direction Does not need to be normalized
+     * @param maxDistance Hits further than this distance along the ray are ignored
+     * @param faceId Receives the id of the triangle in the TriangleGeom, or -1
+     * @param distance Receives the distance from the origin to the hit
+     * @return True if a triangle was hit
+     */
+    bool rayCast(const float* origin, const float* direction, float maxDistance, int64_t& faceId, float& distance) const;
+
+    /**
+     * @brief rayCast Batched version of rayCast
+     * @param origins Packed xyz coordinates of the ray origins
+     * @param directions Packed xyz ray directions
+     * @param numRays
+     * @param maxDistance
+     * @param faceIds Receives the hit triangle per ray, or -1
+     * @param distances Receives the hit distance per ray
+     */
+    void rayCast(const float* origins, const float* directions, size_t numRays, float maxDistance, int64_t* faceIds, float* distances) const;
+
+    /**
+     * @brief findClosestPoint Finds the point on the triangles that is closest to a query point
+     * @param q
+     * @param closest Receives the closest point
+     * @param faceId Receives the id of the triangle containing the closest point, or -1 if the hierarchy is empty
+     * @param distance Receives the distance between q and the closest point
+     * @return False if the hierarchy is empty
+     */
+    bool findClosestPoint(const float* q, float closest[3], int64_t& faceId, float& distance) const;
+
+    /**
+     * @brief findClosestPoints Batched version of findClosestPoint
+     * @param points Packed xyz coordinates of the query points
+     * @param numPoints
+     * @param closest Receives the packed xyz closest points
+     * @param faceIds
+     * @param distances
+     */
+    void findClosestPoints(const float* points, size_t numPoints, float* closest, int64_t* faceIds, float* distances) const;
+
+    /**
+     * @brief The Node struct is one box of the hierarchy. Interior nodes store their first child directly
+     * after themselves and the index of the second child in 'second'; leaves store a range of triangles.
+     */
+    struct Node
+    {
+      float lowerLeft[3];
+      float upperRight[3];
+      int32_t start;
+      int32_t count;
+      int32_t second;
+    };
+
+  protected:
+    TriangleBVH();
+
+    /**
+     * @brief build Gathers the triangles and builds the hierarchy
+     * @param triangles
+     * @param faceIds
+     * @param numFaces
+     */
+    void build(TriangleGeom* triangles, const int32_t* faceIds, size_t numFaces);
+
+  private:
+    std::vector<Node> m_Nodes;
+    std::vector<float> m_Coords;
+    std::vector<int64_t> m_FaceIds;
+
+  public:
+    TriangleBVH(const TriangleBVH&) = delete;            // Copy Constructor Not Implemented
+    TriangleBVH(TriangleBVH&&) = delete;                 // Move Constructor Not Implemented
+    TriangleBVH& operator=(const TriangleBVH&) = delete; // Copy Assignment Not Implemented
+    TriangleBVH& operator=(TriangleBVH&&) = delete;      // Move Assignment Not Implemented
+};
+
+#endif /* _trianglebvh_h_ */
@@ -55,18 +55,25 @@
 
 #include "SIMPLib/Geometry/DerivativeHelpers.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/MeshReorderer.h"
+#include "SIMPLib/Geometry/VertexWelder.h"
+#include "SIMPLib/Utilities/ParallelProgress.h"
 
 /**
  * @brief The FindTriangleDerivativesImpl class implements a threaded algorithm that computes the
- * derivative of an arbitrary dimensional field on the underlying triangles
+ * derivative of an arbitrary dimensional field on the underlying triangles. The field is read in its
+ * native type; if a list of elements containing each vertex is supplied the field is element centered
+ * and is averaged onto the vertices as it is read.
  */
-class FindTriangleDerivativesImpl
+template <typename T, typename K> class FindTriangleDerivativesImpl
 {
 public:
-  FindTriangleDerivativesImpl(TriangleGeom* tris, DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivs)
+  FindTriangleDerivativesImpl(TriangleGeom* tris, typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivs, ElementDynamicList::Pointer elemsContainingVert, ParallelProgress* progress)
   : m_Tris(tris)
   , m_Field(field)
   , m_Derivatives(derivs)
+  , m_ElemsContainingVert(elemsContainingVert)
+  , m_Progress(progress)
   {
   }
   virtual ~FindTriangleDerivativesImpl()
@@ -76,11 +83,12 @@ public:
   void compute(int64_t start, int64_t end) const
   {
     int32_t cDims = m_Field->getNumberOfComponents();
-    double* fieldPtr = m_Field->getPointer(0);
-    double* derivsPtr = m_Derivatives->getPointer(0);
+    T* fieldPtr = m_Field->getPointer(0);
+    K* derivsPtr = m_Derivatives->getPointer(0);
+    std::vector<double> vertValues(3 * cDims, 0.0);
     double values[3] = {0.0, 0.0, 0.0};
     double derivs[3] = {0.0, 0.0, 0.0};
-    int64_t verts[3]{0, 0, 0};
+    int64_t verts[3] = {0, 0, 0};
 
     int64_t counter = 0;
     int64_t totalElements = m_Tris->getNumberOfTris();
@@ -89,25 +97,31 @@ public:
     for(int64_t i = start; i < end; i++)
     {
       m_Tris->getVertsAtTri(i, verts);
+      DerivativeHelpers::GatherVertexValues<T>(fieldPtr, cDims, verts, 3, m_ElemsContainingVert.get(), vertValues.data());
       for(int32_t j = 0; j < cDims; j++)
       {
         for(size_t k = 0; k < 3; k++)
         {
-          values[k] = fieldPtr[cDims * verts[k] + j];
+          values[k] = vertValues[k * cDims + j];
         }
         DerivativeHelpers::TriangleDeriv()(m_Tris, i, values, derivs);
-        derivsPtr[i * 3 * cDims + j * 3] = derivs[0];
-        derivsPtr[i * 3 * cDims + j * 3 + 1] = derivs[1];
-        derivsPtr[i * 3 * cDims + j * 3 + 2] = derivs[2];
+        derivsPtr[i * 3 * cDims + j * 3] = static_cast<K>(derivs[0]);
+        derivsPtr[i * 3 * cDims + j * 3 + 1] = static_cast<K>(derivs[1]);
+        derivsPtr[i * 3 * cDims + j * 3 + 2] = static_cast<K>(derivs[2]);
       }
 
       if(counter > progIncrement)
       {
-        m_Tris->sendThreadSafeProgressMessage(counter, totalElements);
+        m_Progress->increment(counter);
         counter = 0;
+        if(m_Progress->wasCanceled())
+        {
+          return;
+        }
       }
       counter++;
     }
+    m_Progress->increment(counter);
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -118,8 +132,10 @@ public:
 #endif
 private:
   TriangleGeom* m_Tris;
-  DoubleArrayType::Pointer m_Field;
-  DoubleArrayType::Pointer m_Derivatives;
+  typename DataArray<T>::Pointer m_Field;
+  typename DataArray<K>::Pointer m_Derivatives;
+  ElementDynamicList::Pointer m_ElemsContainingVert;
+  ParallelProgress* m_Progress;
 };
 
 // -----------------------------------------------------------------------------
@@ -352,14 +368,7 @@ void TriangleGeom::deleteElementNeighbors()
 // -----------------------------------------------------------------------------
 int TriangleGeom::findElementCentroids()
 {
-  QVector<size_t> cDims(1, 3);
-  m_TriangleCentroids = FloatArrayType::CreateArray(getNumberOfTris(), cDims, SIMPL::StringConstants::TriangleCentroids);
-  GeometryHelpers::Topology::FindElementCentroids<int64_t>(m_TriList, m_VertexList, m_TriangleCentroids);
-  if(m_TriangleCentroids.get() == nullptr)
-  {
-    return -1;
-  }
-  return 1;
+  return updateElementCentroidsAndSizes(true, false);
 }
 
 // -----------------------------------------------------------------------------
@@ -391,12 +400,38 @@ void TriangleGeom::deleteElementCentroids()
 // -----------------------------------------------------------------------------
 int TriangleGeom::findElementSizes()
 {
-  QVector<size_t> cDims(1, 1);
-  m_TriangleSizes = FloatArrayType::CreateArray(getNumberOfTris(), cDims, SIMPL::StringConstants::TriangleAreas);
-  GeometryHelpers::Topology::Find2DElementAreas<int64_t>(m_TriList, m_VertexList, m_TriangleSizes);
-  if(m_TriangleSizes.get() == nullptr)
+  return updateElementCentroidsAndSizes(false, true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::findElementMeasures(bool centroids, bool sizes)
+{
+  FloatArrayType::Pointer elemCentroids = FloatArrayType::NullPointer();
+  FloatArrayType::Pointer elemSizes = FloatArrayType::NullPointer();
+  if(centroids)
   {
-    return -1;
+    QVector<size_t> cDims(1, 3);
+    elemCentroids = FloatArrayType::CreateArray(getNumberOfTris(), cDims, SIMPL::StringConstants::TriangleCentroids);
+  }
+  if(sizes)
+  {
+    QVector<size_t> cDims(1, 1);
+    elemSizes = FloatArrayType::CreateArray(getNumberOfTris(), cDims, SIMPL::StringConstants::TriangleAreas);
+  }
+  int err = GeometryHelpers::Topology::FindElementCentroidsAndSizes<int64_t>(m_TriList, m_VertexList, elemCentroids, elemSizes, IGeometry::Type::Triangle);
+  if(err < 0)
+  {
+    return err;
+  }
+  if(centroids)
+  {
+    m_TriangleCentroids = elemCentroids;
+  }
+  if(sizes)
+  {
+    m_TriangleSizes = elemSizes;
   }
   return 1;
 }
@@ -464,6 +499,151 @@ void TriangleGeom::deleteUnsharedEdges()
   m_UnsharedEdgeList = SharedEdgeList::NullPointer();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::weldVertices(float tolerance, bool removeUnreferenced, bool removeDegenerate, const QVector<AttributeMatrix::Pointer>& vertexAttributeMatrices,
+                          const QVector<AttributeMatrix::Pointer>& elementAttributeMatrices)
+{
+  VertexWelder::Pointer welder = VertexWelder::Create(m_VertexList, m_TriList, tolerance, removeUnreferenced, removeDegenerate);
+  if(nullptr == welder.get())
+  {
+    return -1;
+  }
+  const TupleCompactionMap& compactionMap = welder->getCompactionMap();
+  const TupleCompactionMap& elementCompactionMap = welder->getElementCompactionMap();
+  for(const AttributeMatrix::Pointer& attrMat : vertexAttributeMatrices)
+  {
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != compactionMap.getOldNumberOfTuples())
+    {
+      return -2;
+    }
+  }
+  for(const AttributeMatrix::Pointer& attrMat : elementAttributeMatrices)
+  {
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != elementCompactionMap.getOldNumberOfTuples())
+    {
+      return -2;
+    }
+  }
+  if(compactionMap.getNewNumberOfTuples() == compactionMap.getOldNumberOfTuples() &&
+     elementCompactionMap.getNewNumberOfTuples() == elementCompactionMap.getOldNumberOfTuples())
+  {
+    return 1;
+  }
+
+  for(const AttributeMatrix::Pointer& attrMat : vertexAttributeMatrices)
+  {
+    attrMat->compactTuples(compactionMap);
+  }
+  for(const AttributeMatrix::Pointer& attrMat : elementAttributeMatrices)
+  {
+    attrMat->compactTuples(elementCompactionMap);
+  }
+  welder->remapElements(m_TriList);
+  m_TriList->compactTuples(elementCompactionMap);
+  m_VertexList->compactTuples(compactionMap);
+
+  // Everything derived from the old vertex ids is stale
+  deleteElementCentroids();
+  deleteElementSizes();
+  deleteEdges();
+  deleteUnsharedEdges();
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  elementGeometryModified();
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int TriangleGeom::reorder(MeshReorderer::Method method, const QVector<AttributeMatrix::Pointer>& vertexAttributeMatrices, const QVector<AttributeMatrix::Pointer>& elementAttributeMatrices)
+{
+  size_t numElems = static_cast<size_t>(getNumberOfTris());
+  size_t numVerts = static_cast<size_t>(getNumberOfVertices());
+  for(const AttributeMatrix::Pointer& attrMat : vertexAttributeMatrices)
+  {
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != numVerts)
+    {
+      return -2;
+    }
+  }
+  for(const AttributeMatrix::Pointer& attrMat : elementAttributeMatrices)
+  {
+    if(nullptr == attrMat.get() || attrMat->getNumberOfTuples() != numElems)
+    {
+      return -2;
+    }
+  }
+
+  std::vector<size_t> elementOrder;
+  if(method == MeshReorderer::Method::ReverseCuthillMcKee)
+  {
+    // The cached connectivity may predate edits made through the element list, so it is rebuilt here
+    int err = findElementsContainingVert();
+    if(err < 0)
+    {
+      return err;
+    }
+    err = findElementNeighbors();
+    if(err < 0)
+    {
+      return err;
+    }
+    elementOrder = MeshReorderer::ReverseCuthillMcKeeOrder(m_TriangleNeighbors, numElems);
+  }
+  else
+  {
+    int err = updateElementCentroidsAndSizes(true, false);
+    if(err < 0)
+    {
+      return err;
+    }
+    elementOrder = MeshReorderer::SpaceFillingCurveOrder(m_TriangleCentroids->getPointer(0), numElems, method);
+  }
+  MeshReorderer::Pointer reorderer = MeshReorderer::Create(m_TriList, numVerts, elementOrder);
+  if(nullptr == reorderer.get())
+  {
+    return -1;
+  }
+
+  for(const AttributeMatrix::Pointer& attrMat : vertexAttributeMatrices)
+  {
+    int err = attrMat->permuteTuples(reorderer->getVertexOrder());
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+  for(const AttributeMatrix::Pointer& attrMat : elementAttributeMatrices)
+  {
+    int err = attrMat->permuteTuples(elementOrder);
+    if(err < 0)
+    {
+      return err;
+    }
+  }
+  m_TriList->permuteTuples(elementOrder);
+  reorderer->renumberVertices(m_TriList);
+  reorderer->renumberVertices(m_EdgeList);
+  reorderer->renumberVertices(m_UnsharedEdgeList);
+  m_VertexList->permuteTuples(reorderer->getVertexOrder());
+
+  // The centroids and sizes move with their elements, so they stay current
+  if(m_TriangleCentroids.get() != nullptr)
+  {
+    m_TriangleCentroids->permuteTuples(elementOrder);
+  }
+  if(m_TriangleSizes.get() != nullptr)
+  {
+    m_TriangleSizes->permuteTuples(elementOrder);
+  }
+  deleteElementsContainingVert();
+  deleteElementNeighbors();
+  return 1;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -496,6 +676,14 @@ void TriangleGeom::getShapeFunctions(double pCoords[3], double* shape)
 //
 // -----------------------------------------------------------------------------
 void TriangleGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives<double, double>(field, derivatives, observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void TriangleGeom::findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
 {
   m_ProgressCounter = 0;
   int64_t numTris = getNumberOfTris();
@@ -505,6 +693,50 @@ void TriangleGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
 
+  ParallelProgress progress(this, numTris, m_MessagePrefix, m_MessageLabel, m_MessageTitle, observable);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numTris), FindTriangleDerivativesImpl<T, K>(this, field, derivatives, ElementDynamicList::NullPointer(), &progress), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    FindTriangleDerivativesImpl<T, K> serial(this, field, derivatives, ElementDynamicList::NullPointer(), &progress);
+    serial.compute(0, numTris);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void TriangleGeom::findDerivativesFromElementValues(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
+{
+  m_ProgressCounter = 0;
+  int64_t numTris = getNumberOfTris();
+
+  if(getElementsContainingVert().get() == nullptr)
+  {
+    if(findElementsContainingVert() < 0)
+    {
+      return;
+    }
+  }
+  ElementDynamicList::Pointer elemsContainingVert = getElementsContainingVert();
+
+  if(observable)
+  {
+    connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
+  }
+
+  ParallelProgress progress(this, numTris, m_MessagePrefix, m_MessageLabel, m_MessageTitle, observable);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
   bool doParallel = true;
@@ -513,16 +745,19 @@ void TriangleGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numTris), FindTriangleDerivativesImpl(this, field, derivatives), tbb::auto_partitioner());
+    tbb::parallel_for(tbb::blocked_range<int64_t>(0, numTris), FindTriangleDerivativesImpl<T, K>(this, field, derivatives, elemsContainingVert, &progress), tbb::auto_partitioner());
   }
   else
 #endif
   {
-    FindTriangleDerivativesImpl serial(this, field, derivatives);
+    FindTriangleDerivativesImpl<T, K> serial(this, field, derivatives, elemsContainingVert, &progress);
     serial.compute(0, numTris);
   }
 }
 
+SIMPL_INSTANTIATE_DERIVATIVES(TriangleGeom, findDerivatives)
+SIMPL_INSTANTIATE_DERIVATIVES(TriangleGeom, findDerivativesFromElementValues)
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -745,9 +980,9 @@ int TriangleGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 // -----------------------------------------------------------------------------
 IGeometry::Pointer TriangleGeom::deepCopy(bool forceNoAllocate)
 {
-  SharedTriList::Pointer tris = std::dynamic_pointer_cast<SharedTriList>((getTriangles().get() == nullptr) ? nullptr : getTriangles()->deepCopy(forceNoAllocate));
-  SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
-  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((getEdges().get() == nullptr) ? nullptr : getEdges()->deepCopy(forceNoAllocate));
+  SharedTriList::Pointer tris = std::dynamic_pointer_cast<SharedTriList>((m_TriList.get() == nullptr) ? nullptr : m_TriList->deepCopy(forceNoAllocate));
+  SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((m_VertexList.get() == nullptr) ? nullptr : m_VertexList->deepCopy(forceNoAllocate));
+  SharedEdgeList::Pointer edges = std::dynamic_pointer_cast<SharedEdgeList>((m_EdgeList.get() == nullptr) ? nullptr : m_EdgeList->deepCopy(forceNoAllocate));
   SharedEdgeList::Pointer unsharedEdges = std::dynamic_pointer_cast<SharedEdgeList>((getUnsharedEdges().get() == nullptr) ? nullptr : getUnsharedEdges()->deepCopy(forceNoAllocate));
   ElementDynamicList::Pointer elementsContainingVert =
       std::dynamic_pointer_cast<ElementDynamicList>((getElementsContainingVert().get() == nullptr) ? nullptr : getElementsContainingVert()->deepCopy(forceNoAllocate));
@@ -38,6 +38,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Geometry/IGeometry2D.h"
+#include "SIMPLib/Geometry/MeshReorderer.h"
 
 /**
  * @brief The TriangleGeom class represents a collection of triangles
@@ -151,6 +152,13 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     int64_t* getTriPointer(int64_t i);
 
+    /**
+     * @brief getTriPointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    const int64_t* getTriPointer(int64_t i) const;
+
     /**
      * @brief getNumberOfTris
      * @return
@@ -260,6 +268,22 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     virtual void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr);
 
+    /**
+     * @brief findDerivatives Computes the derivatives of a vertex field in its native type
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
+    /**
+     * @brief findDerivativesFromElementValues Computes the derivatives of an element centered field
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivativesFromElementValues(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -346,6 +370,13 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     virtual float* getVertexPointer(int64_t i);
 
+    /**
+     * @brief getVertexPointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    virtual const float* getVertexPointer(int64_t i) const;
+
     /**
      * @brief getNumberOfVertices
      * @return
@@ -393,6 +424,13 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     virtual int64_t* getEdgePointer(int64_t i);
 
+    /**
+     * @brief getEdgePointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    virtual const int64_t* getEdgePointer(int64_t i) const;
+
     /**
      * @brief getNumberOfEdges
      * @return
@@ -426,6 +464,51 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     virtual void deleteUnsharedEdges();
 
+// -----------------------------------------------------------------------------
+// Mesh cleanup
+// -----------------------------------------------------------------------------
+
+    /**
+     * @brief weldVertices Merges the vertices that are closer than the tolerance and removes the vertices that no
+     * triangle uses. Each group of merged vertices keeps the coordinates and attribute values of its vertex with
+     * the smallest id. The triangle list is remapped, and the vertex list and the arrays of the given vertex
+     * attribute matrices are compacted in place. The vertex list is changed in place, so other geometries that
+     * share it are affected as well. Edges, unshared edges, the element centroids and sizes and the vertex and
+     * element connectivity are deleted.
+     * @param tolerance Vertices closer than this distance are merged; 0 merges vertices with identical coordinates
+     * @param removeUnreferenced Whether vertices that no triangle uses are removed
+     * @param removeDegenerate Whether triangles that use a vertex more than once after the merge are removed
+     * @param vertexAttributeMatrices Attribute matrices with one tuple per vertex
+     * @param elementAttributeMatrices Attribute matrices with one tuple per triangle, compacted like the triangle
+     * list when degenerate triangles are removed
+     * @return 1 on success, -1 if a triangle references a vertex that does not exist, -2 if an attribute matrix does
+     * not have one tuple per vertex or per triangle. Nothing is changed on failure.
+     */
+    int weldVertices(float tolerance, bool removeUnreferenced = true, bool removeDegenerate = false,
+                     const QVector<AttributeMatrix::Pointer>& vertexAttributeMatrices = QVector<AttributeMatrix::Pointer>(),
+                     const QVector<AttributeMatrix::Pointer>& elementAttributeMatrices = QVector<AttributeMatrix::Pointer>());
+
+// -----------------------------------------------------------------------------
+// Reordering
+// -----------------------------------------------------------------------------
+
+    /**
+     * @brief reorder Renumbers the triangles and the vertices so that neighbors are close in memory. The triangles are
+     * sorted along a space filling curve through their centroids, or with reverse Cuthill-McKee on the triangle
+     * neighbor graph, and the vertices follow the order in which the reordered triangles first use them. The vertex
+     * list, the triangle list, the element centroids and sizes and the arrays of the given attribute matrices are
+     * permuted in place and the edge lists are renumbered. The vertex and element connectivity is rebuilt for reverse
+     * Cuthill-McKee and deleted afterwards. Other geometries that share the vertex list are not renumbered.
+     * @param method
+     * @param vertexAttributeMatrices Attribute matrices with one tuple per vertex
+     * @param elementAttributeMatrices Attribute matrices with one tuple per triangle
+     * @return 1 on success, -1 if the order could not be computed, -2 if an attribute matrix does not have one
+     * tuple per vertex or triangle, or the error of AttributeMatrix::permuteTuples if an attribute array could not be
+     * permuted
+     */
+    int reorder(MeshReorderer::Method method, const QVector<AttributeMatrix::Pointer>& vertexAttributeMatrices = QVector<AttributeMatrix::Pointer>(),
+                const QVector<AttributeMatrix::Pointer>& elementAttributeMatrices = QVector<AttributeMatrix::Pointer>());
+
   protected:
 
     TriangleGeom();
@@ -454,6 +537,14 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
      */
     virtual void setElementSizes(FloatArrayType::Pointer elementSizes);
 
+    /**
+     * @brief findElementMeasures Computes the requested element centroids and sizes in one parallel sweep
+     * @param centroids
+     * @param sizes
+     * @return
+     */
+    virtual int findElementMeasures(bool centroids, bool sizes);
+
     /**
      * @brief setEdges
      * @param edges
@@ -476,7 +567,7 @@ class SIMPLib_EXPORT TriangleGeom : public IGeometry2D
     FloatArrayType::Pointer m_TriangleCentroids;
     FloatArrayType::Pointer m_TriangleSizes;
 
-    friend class FindTriangleDerivativesImpl;
+    template <typename T, typename K> friend class FindTriangleDerivativesImpl;
 
     TriangleGeom(const TriangleGeom&) = delete;   // Copy Constructor Not Implemented
     void operator=(const TriangleGeom&) = delete; // Move assignment Not Implemented
@@ -44,6 +44,8 @@
 
 #include "SIMPLib/Geometry/VertexGeom.h"
 
+#include "SIMPLib/Geometry/DerivativeHelpers.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -299,12 +301,22 @@ void VertexGeom::getShapeFunctions(double pCoords[3], double* shape)
 //
 // -----------------------------------------------------------------------------
 void VertexGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
+{
+  findDerivatives<double, double>(field, derivatives, observable);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T, typename K> void VertexGeom::findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable)
 {
   // The exterior derivative of a point source is zero,
   // so simply splat 0 over the derivatives array
   derivatives->initializeWithZeros();
 }
 
+SIMPL_INSTANTIATE_DERIVATIVES(VertexGeom, findDerivatives)
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -455,7 +467,7 @@ int VertexGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
 // -----------------------------------------------------------------------------
 IGeometry::Pointer VertexGeom::deepCopy(bool forceNoAllocate)
 {
-  SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((getVertices().get() == nullptr) ? nullptr : getVertices()->deepCopy(forceNoAllocate));
+  SharedVertexList::Pointer verts = std::dynamic_pointer_cast<SharedVertexList>((m_VertexList.get() == nullptr) ? nullptr : m_VertexList->deepCopy(forceNoAllocate));
   FloatArrayType::Pointer elementSizes = std::dynamic_pointer_cast<FloatArrayType>((getElementSizes().get() == nullptr) ? nullptr : getElementSizes()->deepCopy(forceNoAllocate));
 
   VertexGeom::Pointer vertexCopy = VertexGeom::CreateGeometry(verts, getName());
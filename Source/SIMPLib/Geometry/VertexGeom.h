@@ -121,6 +121,13 @@ class SIMPLib_EXPORT VertexGeom : public IGeometry
      */
     float* getVertexPointer(int64_t i);
 
+    /**
+     * @brief getVertexPointer Read-only overload that leaves the cached element centroids and sizes valid
+     * @param i
+     * @return
+     */
+    const float* getVertexPointer(int64_t i) const;
+
     /**
      * @brief getNumberOfVertices
      * @return
@@ -230,6 +237,14 @@ class SIMPLib_EXPORT VertexGeom : public IGeometry
      */
     virtual void findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable = nullptr);
 
+    /**
+     * @brief findDerivatives Computes the derivatives of a vertex field in its native type
+     * @param field
+     * @param derivatives
+     */
+    template <typename T, typename K>
+    void findDerivatives(typename DataArray<T>::Pointer field, typename DataArray<K>::Pointer derivatives, Observable* observable = nullptr);
+
     /**
      * @brief getInfoString
      * @return Returns a formatted string that contains general infomation about
@@ -0,0 +1,620 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLib/Geometry/VertexWelder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+namespace
+{
+// Cell coordinates are clamped so that the coordinates of the adjacent cells never overflow
+const int64_t k_MaxCell = (static_cast<int64_t>(1) << 62);
+const size_t k_MaxPairBlocks = 256;
+
+/**
+ * @brief The ComputeCellsImpl class finds the hash grid cell of every vertex. Without a tolerance the cell is the
+ * bit pattern of the coordinates, so only vertices with identical coordinates share a cell.
+ */
+class ComputeCellsImpl
+{
+public:
+  ComputeCellsImpl(const float* vertices, double inverseCellSize, bool exact, int64_t* cells)
+  : m_Vertices(vertices)
+  , m_InverseCellSize(inverseCellSize)
+  , m_Exact(exact)
+  , m_Cells(cells)
+  {
+  }
+  virtual ~ComputeCellsImpl()
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    for(size_t i = 3 * start; i < 3 * end; i++)
+    {
+      if(m_Exact)
+      {
+        // Adding zero turns -0.0 into 0.0 so both land in the same cell
+        float value = m_Vertices[i] + 0.0f;
+        int32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        m_Cells[i] = static_cast<int64_t>(bits);
+      }
+      else
+      {
+        double cell = std::floor(static_cast<double>(m_Vertices[i]) * m_InverseCellSize);
+        if(std::isnan(cell) || cell > static_cast<double>(k_MaxCell))
+        {
+          m_Cells[i] = k_MaxCell;
+        }
+        else if(cell < -static_cast<double>(k_MaxCell))
+        {
+          m_Cells[i] = -k_MaxCell;
+        }
+        else
+        {
+          m_Cells[i] = static_cast<int64_t>(cell);
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const float* m_Vertices;
+  double m_InverseCellSize;
+  bool m_Exact;
+  int64_t* m_Cells;
+};
+
+/**
+ * @brief The CellOrder struct sorts vertex ids by their cell and then by id
+ */
+struct CellOrder
+{
+  const int64_t* cells;
+
+  bool operator()(int64_t a, int64_t b) const
+  {
+    const int64_t* cellA = cells + 3 * a;
+    const int64_t* cellB = cells + 3 * b;
+    for(size_t j = 0; j < 3; j++)
+    {
+      if(cellA[j] != cellB[j])
+      {
+        return cellA[j] < cellB[j];
+      }
+    }
+    return a < b;
+  }
+};
+
+/**
+ * @brief The FindPairsImpl class finds the pairs of vertices closer than the tolerance. The occupied cells are
+ * split into fixed blocks and every block writes its pairs to its own list, so the result does not depend on the
+ * scheduling. Each cell is compared with itself and with the 13 adjacent cells that follow it, which visits every
+ * pair of adjacent cells once.
+ */
+class FindPairsImpl
+{
+public:
+  FindPairsImpl(const float* vertices, const int64_t* cells, const std::vector<int64_t>& order, const std::vector<size_t>& cellStarts, double tolerance, bool exact,
+                size_t cellsPerBlock, std::vector<std::vector<int64_t>>& blockPairs)
+  : m_Vertices(vertices)
+  , m_Cells(cells)
+  , m_Order(order)
+  , m_CellStarts(cellStarts)
+  , m_SquaredTolerance(tolerance * tolerance)
+  , m_Exact(exact)
+  , m_CellsPerBlock(cellsPerBlock)
+  , m_BlockPairs(blockPairs)
+  {
+  }
+  virtual ~FindPairsImpl()
+  {
+  }
+
+  const int64_t* cellOf(size_t cellIndex) const
+  {
+    return m_Cells + 3 * m_Order[m_CellStarts[cellIndex]];
+  }
+
+  int64_t findCell(const int64_t* key) const
+  {
+    size_t numCells = m_CellStarts.size() - 1;
+    size_t low = 0;
+    size_t high = numCells;
+    while(low < high)
+    {
+      size_t mid = low + (high - low) / 2;
+      const int64_t* cell = cellOf(mid);
+      if(std::lexicographical_compare(cell, cell + 3, key, key + 3))
+      {
+        low = mid + 1;
+      }
+      else
+      {
+        high = mid;
+      }
+    }
+    if(low < numCells && std::equal(key, key + 3, cellOf(low)))
+    {
+      return static_cast<int64_t>(low);
+    }
+    return -1;
+  }
+
+  bool isClose(int64_t a, int64_t b) const
+  {
+    const float* vertA = m_Vertices + 3 * a;
+    const float* vertB = m_Vertices + 3 * b;
+    if(m_Exact)
+    {
+      return (vertA[0] == vertB[0] && vertA[1] == vertB[1] && vertA[2] == vertB[2]);
+    }
+    double squaredDistance = 0.0;
+    for(size_t j = 0; j < 3; j++)
+    {
+      double delta = static_cast<double>(vertA[j]) - static_cast<double>(vertB[j]);
+      squaredDistance += delta * delta;
+    }
+    return (squaredDistance <= m_SquaredTolerance);
+  }
+
+  void addPair(std::vector<int64_t>& pairs, int64_t a, int64_t b) const
+  {
+    pairs.push_back(std::min(a, b));
+    pairs.push_back(std::max(a, b));
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    size_t numCells = m_CellStarts.size() - 1;
+    for(size_t block = start; block < end; block++)
+    {
+      std::vector<int64_t>& pairs = m_BlockPairs[block];
+      size_t lastCell = std::min(numCells, (block + 1) * m_CellsPerBlock);
+      for(size_t cell = block * m_CellsPerBlock; cell < lastCell; cell++)
+      {
+        size_t first = m_CellStarts[cell];
+        size_t last = m_CellStarts[cell + 1];
+        if(m_Exact)
+        {
+          // All the vertices of a cell have the same coordinates, so joining each to the first one is enough
+          for(size_t i = first + 1; i < last; i++)
+          {
+            if(isClose(m_Order[first], m_Order[i]))
+            {
+              addPair(pairs, m_Order[first], m_Order[i]);
+            }
+          }
+          continue;
+        }
+
+        for(size_t i = first; i < last; i++)
+        {
+          for(size_t k = i + 1; k < last; k++)
+          {
+            if(isClose(m_Order[i], m_Order[k]))
+            {
+              addPair(pairs, m_Order[i], m_Order[k]);
+            }
+          }
+        }
+
+        const int64_t* key = cellOf(cell);
+        for(int64_t d0 = 0; d0 <= 1; d0++)
+        {
+          for(int64_t d1 = (d0 == 0 ? 0 : -1); d1 <= 1; d1++)
+          {
+            for(int64_t d2 = (d0 == 0 && d1 == 0 ? 1 : -1); d2 <= 1; d2++)
+            {
+              int64_t neighborKey[3] = {key[0] + d0, key[1] + d1, key[2] + d2};
+              int64_t neighbor = findCell(neighborKey);
+              if(neighbor < 0)
+              {
+                continue;
+              }
+              size_t neighborFirst = m_CellStarts[static_cast<size_t>(neighbor)];
+              size_t neighborLast = m_CellStarts[static_cast<size_t>(neighbor) + 1];
+              for(size_t i = first; i < last; i++)
+              {
+                for(size_t k = neighborFirst; k < neighborLast; k++)
+                {
+                  if(isClose(m_Order[i], m_Order[k]))
+                  {
+                    addPair(pairs, m_Order[i], m_Order[k]);
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const float* m_Vertices;
+  const int64_t* m_Cells;
+  const std::vector<int64_t>& m_Order;
+  const std::vector<size_t>& m_CellStarts;
+  double m_SquaredTolerance;
+  bool m_Exact;
+  size_t m_CellsPerBlock;
+  std::vector<std::vector<int64_t>>& m_BlockPairs;
+};
+
+/**
+ * @brief The RemapElementsImpl class replaces the vertex ids of an element list with their new ids
+ */
+class RemapElementsImpl
+{
+public:
+  RemapElementsImpl(int64_t* elements, const std::vector<int64_t>& vertexMap)
+  : m_Elements(elements)
+  , m_VertexMap(vertexMap)
+  {
+  }
+  virtual ~RemapElementsImpl()
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    int64_t numVertices = static_cast<int64_t>(m_VertexMap.size());
+    for(size_t i = start; i < end; i++)
+    {
+      int64_t id = m_Elements[i];
+      if(id >= 0 && id < numVertices)
+      {
+        m_Elements[i] = m_VertexMap[static_cast<size_t>(id)];
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  int64_t* m_Elements;
+  const std::vector<int64_t>& m_VertexMap;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t FindRoot(std::vector<int64_t>& parents, int64_t id)
+{
+  while(parents[id] != id)
+  {
+    parents[id] = parents[parents[id]];
+    id = parents[id];
+  }
+  return id;
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexWelder::VertexWelder() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexWelder::~VertexWelder() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VertexWelder::Pointer VertexWelder::Create(FloatArrayType::Pointer vertices, Int64ArrayType::Pointer elements, float tolerance, bool removeUnreferenced, bool removeDegenerate)
+{
+  if(nullptr == vertices.get() || nullptr == elements.get() || vertices->getNumberOfComponents() != 3)
+  {
+    return NullPointer();
+  }
+
+  Pointer welder(new VertexWelder());
+  size_t numVertices = vertices->getNumberOfTuples();
+  std::vector<int64_t> representatives;
+  welder->findGroups(vertices->getPointer(0), numVertices, tolerance, representatives);
+
+  const int64_t* elems = elements->getPointer(0);
+  size_t numIds = elements->getSize();
+  for(size_t i = 0; i < numIds; i++)
+  {
+    if(elems[i] < 0 || static_cast<size_t>(elems[i]) >= numVertices)
+    {
+      return NullPointer();
+    }
+  }
+
+  // A group is referenced if any of its vertices is used by an element that is kept
+  std::vector<uint8_t> referenced(numVertices, removeUnreferenced ? 0 : 1);
+  size_t numElements = elements->getNumberOfTuples();
+  size_t numVertsPerElem = elements->getNumberOfComponents();
+  QVector<size_t> degenerateList;
+  for(size_t i = 0; i < numElements; i++)
+  {
+    const int64_t* elem = elems + numVertsPerElem * i;
+    bool degenerate = false;
+    for(size_t j = 0; j < numVertsPerElem && !degenerate; j++)
+    {
+      for(size_t k = j + 1; k < numVertsPerElem; k++)
+      {
+        if(representatives[elem[j]] == representatives[elem[k]])
+        {
+          degenerate = true;
+          break;
+        }
+      }
+    }
+    if(removeDegenerate && degenerate)
+    {
+      degenerateList.push_back(i);
+      continue;
+    }
+    for(size_t j = 0; j < numVertsPerElem; j++)
+    {
+      referenced[representatives[elem[j]]] = 1;
+    }
+  }
+  welder->m_NumberOfDegenerateElements = degenerateList.size();
+  welder->m_ElementCompactionMap.reset(new TupleCompactionMap(numElements, degenerateList));
+
+  // Representatives have the smallest id of their group, so their new id is known when the other vertices need it
+  QVector<size_t> removeList;
+  welder->m_VertexMap.resize(numVertices);
+  int64_t nextId = 0;
+  for(size_t i = 0; i < numVertices; i++)
+  {
+    int64_t representative = representatives[i];
+    if(representative != static_cast<int64_t>(i))
+    {
+      welder->m_VertexMap[i] = welder->m_VertexMap[representative];
+      welder->m_NumberOfMergedVertices++;
+      removeList.push_back(i);
+    }
+    else if(referenced[i] == 0)
+    {
+      welder->m_VertexMap[i] = -1;
+      welder->m_NumberOfUnreferencedVertices++;
+      removeList.push_back(i);
+    }
+    else
+    {
+      welder->m_VertexMap[i] = nextId++;
+    }
+  }
+  welder->m_CompactionMap.reset(new TupleCompactionMap(numVertices, removeList));
+  return welder;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexWelder::findGroups(const float* vertices, size_t numVertices, float tolerance, std::vector<int64_t>& representatives)
+{
+  representatives.resize(numVertices);
+  std::iota(representatives.begin(), representatives.end(), 0);
+  if(numVertices < 2)
+  {
+    return;
+  }
+
+  bool exact = !(tolerance > 0.0f);
+  double inverseCellSize = exact ? 0.0 : 1.0 / static_cast<double>(tolerance);
+  std::vector<int64_t> cells(3 * numVertices);
+  std::vector<int64_t> order(numVertices);
+  std::iota(order.begin(), order.end(), 0);
+  CellOrder cellOrder = {cells.data()};
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numVertices), ComputeCellsImpl(vertices, inverseCellSize, exact, cells.data()), tbb::auto_partitioner());
+    tbb::parallel_sort(order.begin(), order.end(), cellOrder);
+  }
+  else
+#endif
+  {
+    ComputeCellsImpl serial(vertices, inverseCellSize, exact, cells.data());
+    serial.compute(0, numVertices);
+    std::sort(order.begin(), order.end(), cellOrder);
+  }
+
+  std::vector<size_t> cellStarts;
+  cellStarts.push_back(0);
+  for(size_t i = 1; i < numVertices; i++)
+  {
+    const int64_t* previous = cells.data() + 3 * order[i - 1];
+    if(!std::equal(previous, previous + 3, cells.data() + 3 * order[i]))
+    {
+      cellStarts.push_back(i);
+    }
+  }
+  cellStarts.push_back(numVertices);
+
+  size_t numCells = cellStarts.size() - 1;
+  size_t numBlocks = std::min(numCells, k_MaxPairBlocks);
+  size_t cellsPerBlock = (numCells + numBlocks - 1) / numBlocks;
+  std::vector<std::vector<int64_t>> blockPairs(numBlocks);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks, 1), FindPairsImpl(vertices, cells.data(), order, cellStarts, tolerance, exact, cellsPerBlock, blockPairs),
+                      tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    FindPairsImpl serial(vertices, cells.data(), order, cellStarts, tolerance, exact, cellsPerBlock, blockPairs);
+    serial.compute(0, numBlocks);
+  }
+
+  // Union the close pairs; the larger root is always attached to the smaller one, so every root is the
+  // smallest id of its group
+  for(size_t block = 0; block < numBlocks; block++)
+  {
+    const std::vector<int64_t>& pairs = blockPairs[block];
+    for(size_t i = 0; i < pairs.size(); i += 2)
+    {
+      int64_t rootA = FindRoot(representatives, pairs[i]);
+      int64_t rootB = FindRoot(representatives, pairs[i + 1]);
+      if(rootA < rootB)
+      {
+        representatives[rootB] = rootA;
+      }
+      else if(rootB < rootA)
+      {
+        representatives[rootA] = rootB;
+      }
+    }
+  }
+  for(size_t i = 0; i < numVertices; i++)
+  {
+    representatives[i] = FindRoot(representatives, static_cast<int64_t>(i));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexWelder::getNumberOfMergedVertices() const
+{
+  return m_NumberOfMergedVertices;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexWelder::getNumberOfUnreferencedVertices() const
+{
+  return m_NumberOfUnreferencedVertices;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VertexWelder::getNumberOfDegenerateElements() const
+{
+  return m_NumberOfDegenerateElements;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int64_t>& VertexWelder::getVertexMap() const
+{
+  return m_VertexMap;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const TupleCompactionMap& VertexWelder::getCompactionMap() const
+{
+  return *m_CompactionMap;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const TupleCompactionMap& VertexWelder::getElementCompactionMap() const
+{
+  return *m_ElementCompactionMap;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexWelder::remapElements(Int64ArrayType::Pointer elements) const
+{
+  if(nullptr == elements.get() || elements->getSize() == 0)
+  {
+    return;
+  }
+  size_t numIds = elements->getSize();
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numIds), RemapElementsImpl(elements->getPointer(0), m_VertexMap), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    RemapElementsImpl serial(elements->getPointer(0), m_VertexMap);
+    serial.compute(0, numIds);
+  }
+}
@@ -0,0 +1,151 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _vertexwelder_h_
+#define _vertexwelder_h_
+
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/TupleCompactionMap.h"
+
+/**
+ * @brief The VertexWelder class finds the duplicate and the unreferenced vertices of a mesh and describes their
+ * removal. Vertices are hashed into a grid with cells as wide as the tolerance, so only vertices in the same or in
+ * adjacent cells are compared. Vertices closer than the tolerance are merged transitively and every group is
+ * replaced by its vertex with the smallest id, whose coordinates and attribute values are kept. The result is a
+ * TupleCompactionMap, which compacts the vertex list and every vertex attribute array in place, and the new id of
+ * every old vertex, which remaps the element lists. Elements that would use a vertex more than once after the merge
+ * can be removed with a second TupleCompactionMap.
+ *
+ * The cell hashing, the sort, the pair search and the element remapping run in parallel when
+ * SIMPL_USE_PARALLEL_ALGORITHMS is enabled.
+ */
+class SIMPLib_EXPORT VertexWelder
+{
+  public:
+    SIMPL_SHARED_POINTERS(VertexWelder)
+    SIMPL_TYPE_MACRO(VertexWelder)
+
+    /**
+     * @brief Create Finds the vertices to merge and to remove
+     * @param vertices Packed xyz coordinates
+     * @param elements Element connectivity; every tuple lists the vertex ids of one element
+     * @param tolerance Vertices closer than this distance are merged; 0 merges vertices with identical coordinates
+     * @param removeUnreferenced Whether vertices that no element uses are removed as well
+     * @param removeDegenerate Whether elements that use a vertex more than once after the merge are removed. Their
+     * vertices do not count as referenced.
+     * @return A null pointer if an element references a vertex that does not exist
+     */
+    static Pointer Create(FloatArrayType::Pointer vertices, Int64ArrayType::Pointer elements, float tolerance, bool removeUnreferenced = true, bool removeDegenerate = false);
+
+    virtual ~VertexWelder();
+
+    /**
+     * @brief getNumberOfMergedVertices Returns the number of vertices that were merged into another vertex
+     * @return
+     */
+    size_t getNumberOfMergedVertices() const;
+
+    /**
+     * @brief getNumberOfUnreferencedVertices Returns the number of vertices removed because no element uses them
+     * @return
+     */
+    size_t getNumberOfUnreferencedVertices() const;
+
+    /**
+     * @brief getNumberOfDegenerateElements Returns the number of elements removed because they use a vertex more
+     * than once
+     * @return
+     */
+    size_t getNumberOfDegenerateElements() const;
+
+    /**
+     * @brief getVertexMap Returns the new id of every old vertex, or -1 for removed vertices that were not merged
+     * into a kept one
+     * @return
+     */
+    const std::vector<int64_t>& getVertexMap() const;
+
+    /**
+     * @brief getCompactionMap Returns the removal of the merged and unreferenced vertices
+     * @return
+     */
+    const TupleCompactionMap& getCompactionMap() const;
+
+    /**
+     * @brief getElementCompactionMap Returns the removal of the degenerate elements
+     * @return
+     */
+    const TupleCompactionMap& getElementCompactionMap() const;
+
+    /**
+     * @brief remapElements Replaces every vertex id of an element list with its new id. Ids that are not vertices
+     * of the welded mesh are left as they are.
+     * @param elements
+     */
+    void remapElements(Int64ArrayType::Pointer elements) const;
+
+  protected:
+    VertexWelder();
+
+    /**
+     * @brief findGroups Computes the representative of every vertex
+     * @param vertices
+     * @param numVertices
+     * @param tolerance
+     * @param representatives Receives the smallest vertex id of the group of every vertex
+     */
+    void findGroups(const float* vertices, size_t numVertices, float tolerance, std::vector<int64_t>& representatives);
+
+  private:
+    std::vector<int64_t> m_VertexMap;
+    std::unique_ptr<TupleCompactionMap> m_CompactionMap;
+    std::unique_ptr<TupleCompactionMap> m_ElementCompactionMap;
+    size_t m_NumberOfMergedVertices = 0;
+    size_t m_NumberOfUnreferencedVertices = 0;
+    size_t m_NumberOfDegenerateElements = 0;
+
+  public:
+    VertexWelder(const VertexWelder&) = delete;            // Copy Constructor Not Implemented
+    VertexWelder(VertexWelder&&) = delete;                 // Move Constructor Not Implemented
+    VertexWelder& operator=(const VertexWelder&) = delete; // Copy Assignment Not Implemented
+    VertexWelder& operator=(VertexWelder&&) = delete;      // Move Assignment Not Implemented
+};
+
+#endif /* _vertexwelder_h_ */
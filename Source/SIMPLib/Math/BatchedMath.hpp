@@ -0,0 +1,627 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _BatchedMath_H_
+#define _BatchedMath_H_
+
+#include <cmath>
+
+#include <algorithm>
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+/**
+ * The classes in this file apply the QuaternionMath and MatrixMath operations to whole ranges of
+ * tuples of DataArray<float> or DataArray<double>. Tuples are processed in blocks: every block is
+ * transposed into a structure of arrays on the stack, the kernel runs over that with the widest
+ * SIMD registers the build targets (AVX, then SSE2, then plain scalars) and the results are
+ * transposed back. Blocks are spread over threads when parallel algorithms are enabled.
+ */
+namespace BatchedMathInternal
+{
+static const size_t k_BlockSize = 64;
+
+// -----------------------------------------------------------------------------
+// SIMD packs. Each pack holds k_Width lanes of one component and supports the handful of
+// arithmetic operations the kernels need.
+// -----------------------------------------------------------------------------
+template <typename T> struct ScalarPack
+{
+  static const size_t k_Width = 1;
+  T v;
+
+  static ScalarPack Load(const T* p)
+  {
+    ScalarPack r;
+    r.v = *p;
+    return r;
+  }
+  static ScalarPack Set(T value)
+  {
+    ScalarPack r;
+    r.v = value;
+    return r;
+  }
+  void store(T* p) const
+  {
+    *p = v;
+  }
+  friend ScalarPack operator+(ScalarPack a, ScalarPack b)
+  {
+    return Set(a.v + b.v);
+  }
+  friend ScalarPack operator-(ScalarPack a, ScalarPack b)
+  {
+    return Set(a.v - b.v);
+  }
+  friend ScalarPack operator*(ScalarPack a, ScalarPack b)
+  {
+    return Set(a.v * b.v);
+  }
+  friend ScalarPack operator/(ScalarPack a, ScalarPack b)
+  {
+    return Set(a.v / b.v);
+  }
+  friend ScalarPack Sqrt(ScalarPack a)
+  {
+    return Set(std::sqrt(a.v));
+  }
+};
+
+#define SIMPL_BATCHED_MATH_PACK(Name, Scalar, Register, Width, Prefix, Suffix) \
+  struct Name \
+  { \
+    static const size_t k_Width = Width; \
+    Register v; \
+    static Name Wrap(Register value) \
+    { \
+      Name r; \
+      r.v = value; \
+      return r; \
+    } \
+    static Name Load(const Scalar* p) \
+    { \
+      return Wrap(Prefix##load##Suffix(p)); \
+    } \
+    static Name Set(Scalar value) \
+    { \
+      return Wrap(Prefix##set1##Suffix(value)); \
+    } \
+    void store(Scalar* p) const \
+    { \
+      Prefix##store##Suffix(p, v); \
+    } \
+    friend Name operator+(Name a, Name b) \
+    { \
+      return Wrap(Prefix##add##Suffix(a.v, b.v)); \
+    } \
+    friend Name operator-(Name a, Name b) \
+    { \
+      return Wrap(Prefix##sub##Suffix(a.v, b.v)); \
+    } \
+    friend Name operator*(Name a, Name b) \
+    { \
+      return Wrap(Prefix##mul##Suffix(a.v, b.v)); \
+    } \
+    friend Name operator/(Name a, Name b) \
+    { \
+      return Wrap(Prefix##div##Suffix(a.v, b.v)); \
+    } \
+    friend Name Sqrt(Name a) \
+    { \
+      return Wrap(Prefix##sqrt##Suffix(a.v)); \
+    } \
+  };
+
+#if defined(__AVX__)
+#define SIMPL_BATCHED_MATH_SIMD "AVX"
+SIMPL_BATCHED_MATH_PACK(PackF, float, __m256, 8, _mm256_, _ps)
+SIMPL_BATCHED_MATH_PACK(PackD, double, __m256d, 4, _mm256_, _pd)
+#elif defined(__SSE2__) || defined(_M_X64)
+#define SIMPL_BATCHED_MATH_SIMD "SSE2"
+SIMPL_BATCHED_MATH_PACK(PackF, float, __m128, 4, _mm_, _ps)
+SIMPL_BATCHED_MATH_PACK(PackD, double, __m128d, 2, _mm_, _pd)
+#else
+#define SIMPL_BATCHED_MATH_SIMD "Scalar"
+typedef ScalarPack<float> PackF;
+typedef ScalarPack<double> PackD;
+#endif
+
+#undef SIMPL_BATCHED_MATH_PACK
+
+template <typename T> struct NativePack
+{
+  typedef ScalarPack<T> Type;
+};
+
+template <> struct NativePack<float>
+{
+  typedef PackF Type;
+};
+
+template <> struct NativePack<double>
+{
+  typedef PackD Type;
+};
+
+// -----------------------------------------------------------------------------
+// Kernels. Each one declares the component counts of its inputs and output and computes one
+// pack of lanes, using the same formulas as QuaternionMath and MatrixMath.
+// -----------------------------------------------------------------------------
+struct QuaternionMultiplyKernel
+{
+  static const size_t k_FirstComps = 4;
+  static const size_t k_SecondComps = 4;
+  static const size_t k_OutComps = 4;
+
+  template <typename Pack> static void Apply(const Pack* q1, const Pack* q2, Pack* out)
+  {
+    out[0] = q2[0] * q1[3] + q2[3] * q1[0] + q2[2] * q1[1] - q2[1] * q1[2];
+    out[1] = q2[1] * q1[3] + q2[3] * q1[1] + q2[0] * q1[2] - q2[2] * q1[0];
+    out[2] = q2[2] * q1[3] + q2[3] * q1[2] + q2[1] * q1[0] - q2[0] * q1[1];
+    out[3] = q2[3] * q1[3] - q2[0] * q1[0] - q2[1] * q1[1] - q2[2] * q1[2];
+  }
+};
+
+struct QuaternionConjugateKernel
+{
+  static const size_t k_FirstComps = 4;
+  static const size_t k_SecondComps = 0;
+  static const size_t k_OutComps = 4;
+
+  template <typename Pack> static void Apply(const Pack* q, const Pack*, Pack* out)
+  {
+    Pack zero = Pack::Set(0);
+    out[0] = zero - q[0];
+    out[1] = zero - q[1];
+    out[2] = zero - q[2];
+    out[3] = q[3];
+  }
+};
+
+struct QuaternionNormalizeKernel
+{
+  static const size_t k_FirstComps = 4;
+  static const size_t k_SecondComps = 0;
+  static const size_t k_OutComps = 4;
+
+  template <typename Pack> static void Apply(const Pack* q, const Pack*, Pack* out)
+  {
+    Pack length = Sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    out[0] = q[0] / length;
+    out[1] = q[1] / length;
+    out[2] = q[2] / length;
+    out[3] = q[3] / length;
+  }
+};
+
+struct QuaternionRotateVectorKernel
+{
+  static const size_t k_FirstComps = 4;
+  static const size_t k_SecondComps = 3;
+  static const size_t k_OutComps = 3;
+
+  template <typename Pack> static void Apply(const Pack* q, const Pack* v, Pack* out)
+  {
+    Pack two = Pack::Set(2);
+    Pack qx2 = q[0] * q[0];
+    Pack qy2 = q[1] * q[1];
+    Pack qz2 = q[2] * q[2];
+    Pack qw2 = q[3] * q[3];
+
+    Pack qxy = q[0] * q[1];
+    Pack qyz = q[1] * q[2];
+    Pack qzx = q[2] * q[0];
+
+    Pack qxw = q[0] * q[3];
+    Pack qyw = q[1] * q[3];
+    Pack qzw = q[2] * q[3];
+
+    out[0] = v[0] * (qx2 - qy2 - qz2 + qw2) + two * (v[1] * (qxy + qzw) + v[2] * (qzx - qyw));
+    out[1] = v[1] * (qy2 - qx2 - qz2 + qw2) + two * (v[2] * (qyz + qxw) + v[0] * (qxy - qzw));
+    out[2] = v[2] * (qz2 - qx2 - qy2 + qw2) + two * (v[0] * (qzx + qyw) + v[1] * (qyz - qxw));
+  }
+};
+
+struct Matrix3x3MultiplyKernel
+{
+  static const size_t k_FirstComps = 9;
+  static const size_t k_SecondComps = 9;
+  static const size_t k_OutComps = 9;
+
+  template <typename Pack> static void Apply(const Pack* a, const Pack* b, Pack* out)
+  {
+    for(size_t r = 0; r < 3; r++)
+    {
+      for(size_t c = 0; c < 3; c++)
+      {
+        out[r * 3 + c] = a[r * 3] * b[c] + a[r * 3 + 1] * b[3 + c] + a[r * 3 + 2] * b[6 + c];
+      }
+    }
+  }
+};
+
+struct Matrix3x3TransposeKernel
+{
+  static const size_t k_FirstComps = 9;
+  static const size_t k_SecondComps = 0;
+  static const size_t k_OutComps = 9;
+
+  template <typename Pack> static void Apply(const Pack* a, const Pack*, Pack* out)
+  {
+    for(size_t r = 0; r < 3; r++)
+    {
+      for(size_t c = 0; c < 3; c++)
+      {
+        out[r * 3 + c] = a[c * 3 + r];
+      }
+    }
+  }
+};
+
+struct Matrix3x3InvertKernel
+{
+  static const size_t k_FirstComps = 9;
+  static const size_t k_SecondComps = 0;
+  static const size_t k_OutComps = 9;
+
+  template <typename Pack> static void Apply(const Pack* m, const Pack*, Pack* out)
+  {
+    // Cofactors, stored transposed so that they form the adjoint
+    Pack c00 = m[4] * m[8] - m[5] * m[7];
+    Pack c01 = m[5] * m[6] - m[3] * m[8];
+    Pack c02 = m[3] * m[7] - m[4] * m[6];
+    Pack determinant = m[0] * c00 + m[1] * c01 + m[2] * c02;
+    Pack oneOverDeterminant = Pack::Set(1) / determinant;
+
+    out[0] = c00 * oneOverDeterminant;
+    out[3] = c01 * oneOverDeterminant;
+    out[6] = c02 * oneOverDeterminant;
+    out[1] = (m[2] * m[7] - m[1] * m[8]) * oneOverDeterminant;
+    out[4] = (m[0] * m[8] - m[2] * m[6]) * oneOverDeterminant;
+    out[7] = (m[1] * m[6] - m[0] * m[7]) * oneOverDeterminant;
+    out[2] = (m[1] * m[5] - m[2] * m[4]) * oneOverDeterminant;
+    out[5] = (m[2] * m[3] - m[0] * m[5]) * oneOverDeterminant;
+    out[8] = (m[0] * m[4] - m[1] * m[3]) * oneOverDeterminant;
+  }
+};
+}
+
+/**
+ * @brief The BatchedKernelImpl class runs a kernel over a range of tuples, one block at a time.
+ * Every block is read completely before it is written, so the output may be one of the inputs.
+ */
+template <typename T, typename Kernel> class BatchedKernelImpl
+{
+public:
+  BatchedKernelImpl(const T* first, const T* second, T* out)
+  : m_First(first)
+  , m_Second(second)
+  , m_Out(out)
+  {
+  }
+  virtual ~BatchedKernelImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    typedef typename BatchedMathInternal::NativePack<T>::Type Pack;
+    const size_t firstComps = Kernel::k_FirstComps;
+    const size_t secondComps = Kernel::k_SecondComps;
+    const size_t outComps = Kernel::k_OutComps;
+    const size_t blockSize = BatchedMathInternal::k_BlockSize;
+
+    alignas(32) T first[Kernel::k_FirstComps][BatchedMathInternal::k_BlockSize];
+    alignas(32) T second[Kernel::k_SecondComps > 0 ? Kernel::k_SecondComps : 1][BatchedMathInternal::k_BlockSize];
+    alignas(32) T out[Kernel::k_OutComps][BatchedMathInternal::k_BlockSize];
+    Pack firstPack[Kernel::k_FirstComps];
+    Pack secondPack[Kernel::k_SecondComps > 0 ? Kernel::k_SecondComps : 1];
+    Pack outPack[Kernel::k_OutComps];
+
+    for(size_t blockStart = start; blockStart < end; blockStart += blockSize)
+    {
+      size_t count = std::min(blockSize, end - blockStart);
+      // Unused lanes of the last pack are padded so they never see uninitialized values
+      size_t lanes = std::min(blockSize, (count + Pack::k_Width - 1) / Pack::k_Width * Pack::k_Width);
+
+      for(size_t t = 0; t < lanes; t++)
+      {
+        const T* tuple = m_First + (blockStart + std::min(t, count - 1)) * firstComps;
+        for(size_t c = 0; c < firstComps; c++)
+        {
+          first[c][t] = tuple[c];
+        }
+      }
+      for(size_t t = 0; t < lanes && secondComps > 0; t++)
+      {
+        const T* tuple = m_Second + (blockStart + std::min(t, count - 1)) * secondComps;
+        for(size_t c = 0; c < secondComps; c++)
+        {
+          second[c][t] = tuple[c];
+        }
+      }
+
+      for(size_t lane = 0; lane < lanes; lane += Pack::k_Width)
+      {
+        for(size_t c = 0; c < firstComps; c++)
+        {
+          firstPack[c] = Pack::Load(first[c] + lane);
+        }
+        for(size_t c = 0; c < secondComps; c++)
+        {
+          secondPack[c] = Pack::Load(second[c] + lane);
+        }
+        Kernel::Apply(firstPack, secondPack, outPack);
+        for(size_t c = 0; c < outComps; c++)
+        {
+          outPack[c].store(out[c] + lane);
+        }
+      }
+
+      for(size_t t = 0; t < count; t++)
+      {
+        T* tuple = m_Out + (blockStart + t) * outComps;
+        for(size_t c = 0; c < outComps; c++)
+        {
+          tuple[c] = out[c][t];
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_First;
+  const T* m_Second;
+  T* m_Out;
+};
+
+/**
+ * @brief The BatchedMath class validates the arrays handed to a batched operation and runs its kernel.
+ */
+template <typename T> class BatchedMath
+{
+public:
+  typedef typename DataArray<T>::Pointer ArrayPointer;
+
+  /**
+   * @brief Returns the instruction set the kernels were compiled for ("AVX", "SSE2" or "Scalar").
+   * @return
+   */
+  static const char* InstructionSet()
+  {
+    return SIMPL_BATCHED_MATH_SIMD;
+  }
+
+  /**
+   * @brief Runs a kernel over the tuples [start, end) of the arrays.
+   * @param first First input array
+   * @param second Second input array, or a null pointer for kernels with one input
+   * @param out Output array. It may be one of the inputs.
+   * @param start First tuple
+   * @param end One past the last tuple
+   * @return false if an array is missing, has the wrong number of components or is too short
+   */
+  template <typename Kernel> static bool Run(const ArrayPointer& first, const ArrayPointer& second, const ArrayPointer& out, size_t start, size_t end)
+  {
+    if(!IsValid(first, Kernel::k_FirstComps, end) || !IsValid(out, Kernel::k_OutComps, end) || start > end)
+    {
+      return false;
+    }
+    if(Kernel::k_SecondComps > 0 && !IsValid(second, Kernel::k_SecondComps, end))
+    {
+      return false;
+    }
+    if(start == end)
+    {
+      return true;
+    }
+
+    const T* secondPtr = (Kernel::k_SecondComps > 0) ? second->getPointer(0) : nullptr;
+    BatchedKernelImpl<T, Kernel> impl(first->getPointer(0), secondPtr, out->getPointer(0));
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(start, end, BatchedMathInternal::k_BlockSize), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(start, end);
+    }
+    return true;
+  }
+
+private:
+  static bool IsValid(const ArrayPointer& array, size_t numComps, size_t end)
+  {
+    return nullptr != array.get() && static_cast<size_t>(array->getNumberOfComponents()) == numComps && end <= array->getNumberOfTuples();
+  }
+};
+
+/**
+ * @brief The BatchedQuaternionMath class applies QuaternionMath operations to ranges of tuples of
+ * 4 component arrays laid out as (x, y, z, w), which is the layout of QuaternionMath::Quaternion.
+ * Every operation has an overload that processes all the tuples of the first array.
+ * @code
+ *  FloatArrayType::Pointer quats = ...;
+ *  BatchedQuaternionMath<float>::Normalize(quats, quats);
+ * @endcode
+ */
+template <typename T> class BatchedQuaternionMath
+{
+public:
+  typedef typename DataArray<T>::Pointer ArrayPointer;
+
+  /**
+   * @brief Multiply Computes out = q1 * q2 tuple by tuple, see QuaternionMath::Multiply
+   */
+  static bool Multiply(const ArrayPointer& q1, const ArrayPointer& q2, const ArrayPointer& out, size_t start, size_t end)
+  {
+    return BatchedMath<T>::template Run<BatchedMathInternal::QuaternionMultiplyKernel>(q1, q2, out, start, end);
+  }
+
+  static bool Multiply(const ArrayPointer& q1, const ArrayPointer& q2, const ArrayPointer& out)
+  {
+    return Multiply(q1, q2, out, 0, NumberOfTuples(q1));
+  }
+
+  /**
+   * @brief Conjugate Writes the conjugate of every quaternion, see QuaternionMath::Conjugate
+   */
+  static bool Conjugate(const ArrayPointer& in, const ArrayPointer& out, size_t start, size_t end)
+  {
+    return BatchedMath<T>::template Run<BatchedMathInternal::QuaternionConjugateKernel>(in, ArrayPointer(), out, start, end);
+  }
+
+  static bool Conjugate(const ArrayPointer& in, const ArrayPointer& out)
+  {
+    return Conjugate(in, out, 0, NumberOfTuples(in));
+  }
+
+  /**
+   * @brief Normalize Writes the unit quaternion of every quaternion, see QuaternionMath::UnitQuaternion
+   */
+  static bool Normalize(const ArrayPointer& in, const ArrayPointer& out, size_t start, size_t end)
+  {
+    return BatchedMath<T>::template Run<BatchedMathInternal::QuaternionNormalizeKernel>(in, ArrayPointer(), out, start, end);
+  }
+
+  static bool Normalize(const ArrayPointer& in, const ArrayPointer& out)
+  {
+    return Normalize(in, out, 0, NumberOfTuples(in));
+  }
+
+  /**
+   * @brief RotateVectors Rotates the 3 component vector of every tuple by the quaternion of the same
+   * tuple, see QuaternionMath::MultiplyQuatVec
+   */
+  static bool RotateVectors(const ArrayPointer& quats, const ArrayPointer& vectors, const ArrayPointer& out, size_t start, size_t end)
+  {
+    return BatchedMath<T>::template Run<BatchedMathInternal::QuaternionRotateVectorKernel>(quats, vectors, out, start, end);
+  }
+
+  static bool RotateVectors(const ArrayPointer& quats, const ArrayPointer& vectors, const ArrayPointer& out)
+  {
+    return RotateVectors(quats, vectors, out, 0, NumberOfTuples(quats));
+  }
+
+private:
+  static size_t NumberOfTuples(const ArrayPointer& array)
+  {
+    return nullptr != array.get() ? array->getNumberOfTuples() : 0;
+  }
+};
+
+/**
+ * @brief The BatchedMatrixMath class applies MatrixMath 3x3 operations to ranges of tuples of
+ * 9 component arrays holding row major matrices. Every operation has an overload that processes
+ * all the tuples of the first array.
+ */
+template <typename T> class BatchedMatrixMath
+{
+public:
+  typedef typename DataArray<T>::Pointer ArrayPointer;
+
+  /**
+   * @brief Multiply3x3 Computes out = a * b tuple by tuple, see MatrixMath::Multiply3x3with3x3
+   */
+  static bool Multiply3x3(const ArrayPointer& a, const ArrayPointer& b, const ArrayPointer& out, size_t start, size_t end)
+  {
+    return BatchedMath<T>::template Run<BatchedMathInternal::Matrix3x3MultiplyKernel>(a, b, out, start, end);
+  }
+
+  static bool Multiply3x3(const ArrayPointer& a, const ArrayPointer& b, const ArrayPointer& out)
+  {
+    return Multiply3x3(a, b, out, 0, NumberOfTuples(a));
+  }
+
+  /**
+   * @brief Transpose3x3 Writes the transpose of every matrix, see MatrixMath::Transpose3x3
+   */
+  static bool Transpose3x3(const ArrayPointer& in, const ArrayPointer& out, size_t start, size_t end)
+  {
+    return BatchedMath<T>::template Run<BatchedMathInternal::Matrix3x3TransposeKernel>(in, ArrayPointer(), out, start, end);
+  }
+
+  static bool Transpose3x3(const ArrayPointer& in, const ArrayPointer& out)
+  {
+    return Transpose3x3(in, out, 0, NumberOfTuples(in));
+  }
+
+  /**
+   * @brief Invert3x3 Writes the inverse of every matrix, see MatrixMath::Invert3x3. Singular matrices
+   * give infinite or NaN values, as they do there.
+   */
+  static bool Invert3x3(const ArrayPointer& in, const ArrayPointer& out, size_t start, size_t end)
+  {
+    return BatchedMath<T>::template Run<BatchedMathInternal::Matrix3x3InvertKernel>(in, ArrayPointer(), out, start, end);
+  }
+
+  static bool Invert3x3(const ArrayPointer& in, const ArrayPointer& out)
+  {
+    return Invert3x3(in, out, 0, NumberOfTuples(in));
+  }
+
+private:
+  static size_t NumberOfTuples(const ArrayPointer& array)
+  {
+    return nullptr != array.get() ? array->getNumberOfTuples() : 0;
+  }
+};
+
+#endif /* _BatchedMath_H_ */
@@ -0,0 +1,295 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _CounterBasedRandom_H_
+#define _CounterBasedRandom_H_
+
+#include <stdint.h>
+
+#include <chrono>
+#include <limits>
+#include <random>
+
+/**
+ * @brief The CounterBasedRandom class is a Philox4x32-10 counter based random number generator
+ * (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3", SC11). Unlike a Mersenne Twister
+ * the generator holds no evolving state: every output is a pure function of (seed, stream, index),
+ * which makes it safe to share one instance between threads and lets a parallel loop produce the
+ * exact same values as its serial counterpart, whatever the number of threads.
+ *
+ * There are two ways to use it:
+ * @code
+ *  // Indexed access: the value for element i depends only on the seed and i
+ *  CounterBasedRandom random(seed);
+ *  for(size_t i = 0; i < count; i++)
+ *  {
+ *    data[i] = random.uniformReal(i, 0.0, 1.0);
+ *  }
+ *
+ *  // Sequential access: the class also models a UniformRandomBitGenerator, so it can be handed to
+ *  // the <random> distributions. discard() jumps ahead in constant time.
+ *  CounterBasedRandom engine(seed);
+ *  std::normal_distribution<double> distribution(0.0, 1.0);
+ *  double value = distribution(engine);
+ * @endcode
+ *
+ * The n'th value returned by operator()() is always equal to generate(n), so both forms can be mixed.
+ * Different streams with the same seed are statistically independent sequences.
+ */
+class CounterBasedRandom
+{
+  public:
+    using result_type = uint64_t;
+
+    /**
+     * @brief CounterBasedRandom
+     * @param seed The key of the generator
+     * @param stream Selects one of 2^64 independent sequences for the seed
+     */
+    explicit CounterBasedRandom(uint64_t seed = 5489u, uint64_t stream = 0)
+    : m_Seed(seed)
+    , m_Stream(stream)
+    , m_Position(0)
+    {
+    }
+
+    /**
+     * @brief Creates a seed from the clock and the system entropy source, for callers that do not
+     * need to reproduce a run.
+     * @return
+     */
+    static uint64_t GenerateSeed()
+    {
+      std::random_device randomDevice;
+      uint64_t seed = static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+      seed ^= static_cast<uint64_t>(randomDevice()) << 32;
+      seed ^= static_cast<uint64_t>(randomDevice());
+      return seed;
+    }
+
+    /**
+     * @brief Runs the ten Philox rounds over the counter in place.
+     * @param counter 4 x 32 bit counter, replaced by the random output
+     * @param key 2 x 32 bit key
+     */
+    static void Philox4x32(uint32_t counter[4], const uint32_t key[2])
+    {
+      uint32_t k0 = key[0];
+      uint32_t k1 = key[1];
+      for(int round = 0; round < 10; round++)
+      {
+        uint64_t product0 = static_cast<uint64_t>(k_Multiplier0) * counter[0];
+        uint64_t product1 = static_cast<uint64_t>(k_Multiplier1) * counter[2];
+        uint32_t c0 = static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ k0;
+        uint32_t c1 = static_cast<uint32_t>(product1);
+        uint32_t c2 = static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ k1;
+        uint32_t c3 = static_cast<uint32_t>(product0);
+        counter[0] = c0;
+        counter[1] = c1;
+        counter[2] = c2;
+        counter[3] = c3;
+        k0 += k_Weyl0;
+        k1 += k_Weyl1;
+      }
+    }
+
+    /**
+     * @brief Returns the full 128 bit block for an index.
+     * @param index
+     * @param output 4 x 32 bits
+     */
+    void generateBlock(uint64_t index, uint32_t output[4]) const
+    {
+      const uint32_t key[2] = {static_cast<uint32_t>(m_Seed), static_cast<uint32_t>(m_Seed >> 32)};
+      output[0] = static_cast<uint32_t>(index);
+      output[1] = static_cast<uint32_t>(index >> 32);
+      output[2] = static_cast<uint32_t>(m_Stream);
+      output[3] = static_cast<uint32_t>(m_Stream >> 32);
+      Philox4x32(output, key);
+    }
+
+    /**
+     * @brief Returns 64 random bits for an index.
+     * @param index
+     * @return
+     */
+    result_type generate(uint64_t index) const
+    {
+      uint32_t block[4];
+      generateBlock(index, block);
+      return (static_cast<uint64_t>(block[1]) << 32) | block[0];
+    }
+
+    /**
+     * @brief Returns two independent sets of 64 random bits for an index, for callers that need
+     * a pair of values per element (e.g. directions on a sphere).
+     * @param index
+     * @param first
+     * @param second
+     */
+    void generate(uint64_t index, result_type& first, result_type& second) const
+    {
+      uint32_t block[4];
+      generateBlock(index, block);
+      first = (static_cast<uint64_t>(block[1]) << 32) | block[0];
+      second = (static_cast<uint64_t>(block[3]) << 32) | block[2];
+    }
+
+    /**
+     * @brief Converts 64 random bits to a double uniformly distributed in [0, 1) with 53 bits of precision.
+     * @param bits
+     * @return
+     */
+    static double ToUnitInterval(result_type bits)
+    {
+      return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    /**
+     * @brief Returns a double uniformly distributed in [0, 1) for an index.
+     * @param index
+     * @return
+     */
+    double uniformReal(uint64_t index) const
+    {
+      return ToUnitInterval(generate(index));
+    }
+
+    /**
+     * @brief Returns a value uniformly distributed in [min, max) for an index.
+     * @param index
+     * @param min
+     * @param max
+     * @return
+     */
+    template <typename T> T uniformReal(uint64_t index, T min, T max) const
+    {
+      return static_cast<T>(min + (max - min) * uniformReal(index));
+    }
+
+    /**
+     * @brief Returns an integer uniformly distributed in [min, max] (both inclusive) for an index.
+     * The range is reduced with a modulo, whose bias is below 2^-32 for ranges of up to 32 bits.
+     * @param index
+     * @param min
+     * @param max
+     * @return
+     */
+    template <typename T> T uniformInt(uint64_t index, T min, T max) const
+    {
+      uint64_t range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+      uint64_t bits = generate(index);
+      if(range != std::numeric_limits<uint64_t>::max())
+      {
+        bits %= (range + 1);
+      }
+      return static_cast<T>(static_cast<uint64_t>(min) + bits);
+    }
+
+    // -----------------------------------------------------------------------------
+    // UniformRandomBitGenerator interface
+    // -----------------------------------------------------------------------------
+    static constexpr result_type min()
+    {
+      return 0;
+    }
+
+    static constexpr result_type max()
+    {
+      return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()()
+    {
+      return generate(m_Position++);
+    }
+
+    /**
+     * @brief Skips ahead n values in constant time.
+     * @param n
+     */
+    void discard(uint64_t n)
+    {
+      m_Position += n;
+    }
+
+    /**
+     * @brief Moves the sequential position to an absolute index.
+     * @param index
+     */
+    void seek(uint64_t index)
+    {
+      m_Position = index;
+    }
+
+    /**
+     * @brief Resets the key and stream and rewinds the sequential position.
+     * @param seed
+     * @param stream
+     */
+    void seed(uint64_t seed, uint64_t stream = 0)
+    {
+      m_Seed = seed;
+      m_Stream = stream;
+      m_Position = 0;
+    }
+
+    uint64_t getSeed() const
+    {
+      return m_Seed;
+    }
+
+    uint64_t getStream() const
+    {
+      return m_Stream;
+    }
+
+    uint64_t getPosition() const
+    {
+      return m_Position;
+    }
+
+  private:
+    static const uint32_t k_Multiplier0 = 0xD2511F53;
+    static const uint32_t k_Multiplier1 = 0xCD9E8D57;
+    static const uint32_t k_Weyl0 = 0x9E3779B9;
+    static const uint32_t k_Weyl1 = 0xBB67AE85;
+
+    uint64_t m_Seed;
+    uint64_t m_Stream;
+    uint64_t m_Position;
+};
+
+#endif /* _CounterBasedRandom_H_ */
@@ -0,0 +1,822 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _DataArrayReductions_H_
+#define _DataArrayReductions_H_
+
+#include <cmath>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+/**
+ * The classes in this file compute statistics of the values of a DataArray in one parallel sweep that is split
+ * across all cores with tbb::parallel_reduce. Every reduction takes a ReductionRange that restricts it to a
+ * range of tuples, a single component and/or the tuples of a mask. NaN values never take part in a reduction.
+ * Sums are accumulated in double precision, optionally with Neumaier's compensated summation, and the
+ * variance is combined from blocks with Chan's parallel update so that it stays stable for large arrays. For
+ * the variance each cache sized block is read twice, first for its mean and then for the squared differences
+ * from that mean, while it is still in cache.
+ */
+
+/**
+ * @brief The ReductionRange struct selects the values a reduction runs over
+ */
+struct ReductionRange
+{
+  ReductionRange()
+  : startTuple(0)
+  , endTuple(std::numeric_limits<size_t>::max())
+  , component(-1)
+  , mask(nullptr)
+  , finiteOnly(false)
+  {
+  }
+
+  size_t startTuple;    // First tuple of the range
+  size_t endTuple;      // One past the last tuple of the range, clamped to the number of tuples
+  int component;        // The component to reduce, -1 reduces every component
+  const bool* mask;     // Optional mask with one entry per tuple of the array; tuples that are false are skipped
+  bool finiteOnly;      // Also skip infinite values
+};
+
+/**
+ * @brief The CompensatedSum class accumulates doubles with Neumaier's variant of the Kahan summation
+ */
+class CompensatedSum
+{
+public:
+  CompensatedSum()
+  : m_Sum(0.0)
+  , m_Compensation(0.0)
+  {
+  }
+
+  inline void add(double value)
+  {
+    double t = m_Sum + value;
+    if(std::fabs(m_Sum) >= std::fabs(value))
+    {
+      m_Compensation += (m_Sum - t) + value;
+    }
+    else
+    {
+      m_Compensation += (value - t) + m_Sum;
+    }
+    m_Sum = t;
+  }
+
+  inline void add(const CompensatedSum& other)
+  {
+    add(other.m_Sum);
+    add(other.m_Compensation);
+  }
+
+  inline double getValue() const
+  {
+    return m_Sum + m_Compensation;
+  }
+
+private:
+  double m_Sum;
+  double m_Compensation;
+};
+
+/**
+ * @brief The ReductionStatistics struct holds the result of DataArrayReductions::Statistics. The arg indices are
+ * indices into the values of the array, i.e. tuple * numberOfComponents + component. All values are 0 when count is 0.
+ */
+template <typename T> struct ReductionStatistics
+{
+  ReductionStatistics()
+  : count(0)
+  , min(0)
+  , max(0)
+  , argMin(0)
+  , argMax(0)
+  , sum(0.0)
+  , mean(0.0)
+  , m2(0.0)
+  {
+  }
+
+  /**
+   * @brief variance Returns the population variance
+   */
+  double variance() const
+  {
+    return (count > 0) ? m2 / static_cast<double>(count) : 0.0;
+  }
+
+  /**
+   * @brief sampleVariance Returns the unbiased sample variance
+   */
+  double sampleVariance() const
+  {
+    return (count > 1) ? m2 / static_cast<double>(count - 1) : 0.0;
+  }
+
+  size_t count;
+  T min;
+  T max;
+  size_t argMin;
+  size_t argMax;
+  double sum;
+  double mean;
+  double m2; // Sum of the squared differences from the mean
+};
+
+namespace DataArrayReductionsInternal
+{
+// Values handled per block; blocks are traversed twice while they are still in cache
+static const size_t k_BlockSize = 4096;
+
+template <typename T> inline typename std::enable_if<std::is_floating_point<T>::value, bool>::type IsAccepted(T value, bool finiteOnly)
+{
+  return finiteOnly ? std::isfinite(value) : !std::isnan(value);
+}
+
+template <typename T> inline typename std::enable_if<!std::is_floating_point<T>::value, bool>::type IsAccepted(T, bool)
+{
+  return true;
+}
+
+/**
+ * @brief The ValueSource class describes the values of an array that a reduction visits
+ */
+template <typename T> class ValueSource
+{
+public:
+  ValueSource(const T* data, size_t numTuples, int numComps, const ReductionRange& range)
+  : m_Data(data)
+  , m_NumComps(static_cast<size_t>(numComps))
+  , m_FirstComp(range.component < 0 ? 0 : static_cast<size_t>(range.component))
+  , m_EndComp(range.component < 0 ? static_cast<size_t>(numComps) : static_cast<size_t>(range.component) + 1)
+  , m_StartTuple(std::min(range.startTuple, numTuples))
+  , m_EndTuple(std::min(range.endTuple, numTuples))
+  , m_Mask(range.mask)
+  , m_FiniteOnly(range.finiteOnly)
+  {
+    if(m_EndTuple < m_StartTuple || m_FirstComp >= m_NumComps)
+    {
+      m_EndTuple = m_StartTuple;
+    }
+  }
+
+  size_t startTuple() const
+  {
+    return m_StartTuple;
+  }
+
+  size_t endTuple() const
+  {
+    return m_EndTuple;
+  }
+
+  size_t tuplesPerBlock() const
+  {
+    return std::max(static_cast<size_t>(1), k_BlockSize / (m_EndComp - m_FirstComp));
+  }
+
+  /**
+   * @brief visit Calls visitor(value, index) for every accepted value of the tuples [start, end)
+   */
+  template <typename Visitor> inline void visit(size_t start, size_t end, Visitor& visitor) const
+  {
+    for(size_t t = start; t < end; t++)
+    {
+      if(m_Mask != nullptr && !m_Mask[t])
+      {
+        continue;
+      }
+      const size_t offset = t * m_NumComps;
+      for(size_t c = m_FirstComp; c < m_EndComp; c++)
+      {
+        const T value = m_Data[offset + c];
+        if(IsAccepted(value, m_FiniteOnly))
+        {
+          visitor(value, offset + c);
+        }
+      }
+    }
+  }
+
+private:
+  const T* m_Data;
+  size_t m_NumComps;
+  size_t m_FirstComp;
+  size_t m_EndComp;
+  size_t m_StartTuple;
+  size_t m_EndTuple;
+  const bool* m_Mask;
+  bool m_FiniteOnly;
+};
+
+/**
+ * @brief Runs a reduction body over the tuples of a source, in parallel when TBB is available
+ */
+template <typename T, typename Body> void Reduce(const ValueSource<T>& source, Body& body)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(source.startTuple(), source.endTuple(), source.tuplesPerBlock()), body, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    body.reduce(source.startTuple(), source.endTuple());
+  }
+}
+
+template <typename T> class StatisticsImpl
+{
+public:
+  StatisticsImpl(const ValueSource<T>& source)
+  : m_Source(source)
+  {
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  StatisticsImpl(StatisticsImpl& other, tbb::split)
+  : m_Source(other.m_Source)
+  {
+  }
+#endif
+
+  /**
+   * @brief The BlockPass1 struct finds the count, extrema and sum of a block
+   */
+  struct BlockPass1
+  {
+    BlockPass1()
+    : stats()
+    , sum()
+    {
+    }
+    inline void operator()(T value, size_t index)
+    {
+      if(stats.count == 0 || value < stats.min)
+      {
+        stats.min = value;
+        stats.argMin = index;
+      }
+      if(stats.count == 0 || value > stats.max)
+      {
+        stats.max = value;
+        stats.argMax = index;
+      }
+      stats.count++;
+      sum.add(static_cast<double>(value));
+    }
+    ReductionStatistics<T> stats;
+    CompensatedSum sum;
+  };
+
+  /**
+   * @brief The BlockPass2 struct sums the squared differences from the block mean
+   */
+  struct BlockPass2
+  {
+    BlockPass2(double blockMean)
+    : mean(blockMean)
+    , m2(0.0)
+    {
+    }
+    inline void operator()(T value, size_t)
+    {
+      const double delta = static_cast<double>(value) - mean;
+      m2 += delta * delta;
+    }
+    double mean;
+    double m2;
+  };
+
+  void reduce(size_t start, size_t end)
+  {
+    const size_t blockTuples = m_Source.tuplesPerBlock();
+    for(size_t blockStart = start; blockStart < end; blockStart += blockTuples)
+    {
+      const size_t blockEnd = std::min(end, blockStart + blockTuples);
+      BlockPass1 pass1;
+      m_Source.visit(blockStart, blockEnd, pass1);
+      if(pass1.stats.count == 0)
+      {
+        continue;
+      }
+      pass1.stats.sum = pass1.sum.getValue();
+      pass1.stats.mean = pass1.stats.sum / static_cast<double>(pass1.stats.count);
+      BlockPass2 pass2(pass1.stats.mean);
+      m_Source.visit(blockStart, blockEnd, pass2);
+      pass1.stats.m2 = pass2.m2;
+      merge(pass1.stats, pass1.sum);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    reduce(r.begin(), r.end());
+  }
+#endif
+
+  void join(const StatisticsImpl& rhs)
+  {
+    merge(rhs.m_Stats, rhs.m_Sum);
+  }
+
+  ReductionStatistics<T> getStatistics() const
+  {
+    return m_Stats;
+  }
+
+private:
+  /**
+   * @brief merge Folds the statistics of values that come after the ones already reduced into this body
+   */
+  void merge(const ReductionStatistics<T>& other, const CompensatedSum& otherSum)
+  {
+    if(other.count == 0)
+    {
+      return;
+    }
+    if(m_Stats.count == 0)
+    {
+      m_Stats = other;
+      m_Sum = otherSum;
+      return;
+    }
+    // Ties keep the lower index, which belongs to this body
+    if(other.min < m_Stats.min)
+    {
+      m_Stats.min = other.min;
+      m_Stats.argMin = other.argMin;
+    }
+    if(other.max > m_Stats.max)
+    {
+      m_Stats.max = other.max;
+      m_Stats.argMax = other.argMax;
+    }
+    const double n1 = static_cast<double>(m_Stats.count);
+    const double n2 = static_cast<double>(other.count);
+    const double delta = other.mean - m_Stats.mean;
+    m_Stats.count += other.count;
+    const double n = static_cast<double>(m_Stats.count);
+    m_Stats.mean += delta * n2 / n;
+    m_Stats.m2 += other.m2 + delta * delta * n1 * n2 / n;
+    m_Sum.add(otherSum);
+    m_Stats.sum = m_Sum.getValue();
+  }
+
+  ValueSource<T> m_Source;
+  ReductionStatistics<T> m_Stats;
+  CompensatedSum m_Sum;
+};
+
+template <typename T> class SumImpl
+{
+public:
+  SumImpl(const ValueSource<T>& source, bool compensated)
+  : m_Source(source)
+  , m_Compensated(compensated)
+  , m_Sum(0.0)
+  , m_Count(0)
+  {
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  SumImpl(SumImpl& other, tbb::split)
+  : m_Source(other.m_Source)
+  , m_Compensated(other.m_Compensated)
+  , m_Sum(0.0)
+  , m_Count(0)
+  {
+  }
+#endif
+
+  struct PlainVisitor
+  {
+    PlainVisitor()
+    : sum(0.0)
+    , count(0)
+    {
+    }
+    inline void operator()(T value, size_t)
+    {
+      sum += static_cast<double>(value);
+      count++;
+    }
+    double sum;
+    size_t count;
+  };
+
+  struct CompensatedVisitor
+  {
+    CompensatedVisitor()
+    : sum()
+    , count(0)
+    {
+    }
+    inline void operator()(T value, size_t)
+    {
+      sum.add(static_cast<double>(value));
+      count++;
+    }
+    CompensatedSum sum;
+    size_t count;
+  };
+
+  void reduce(size_t start, size_t end)
+  {
+    if(m_Compensated)
+    {
+      CompensatedVisitor visitor;
+      m_Source.visit(start, end, visitor);
+      m_CompensatedSum.add(visitor.sum);
+      m_Count += visitor.count;
+    }
+    else
+    {
+      PlainVisitor visitor;
+      m_Source.visit(start, end, visitor);
+      m_Sum += visitor.sum;
+      m_Count += visitor.count;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    reduce(r.begin(), r.end());
+  }
+#endif
+
+  void join(const SumImpl& rhs)
+  {
+    m_CompensatedSum.add(rhs.m_CompensatedSum);
+    m_Sum += rhs.m_Sum;
+    m_Count += rhs.m_Count;
+  }
+
+  double getSum() const
+  {
+    return m_Compensated ? m_CompensatedSum.getValue() : m_Sum;
+  }
+
+  size_t getCount() const
+  {
+    return m_Count;
+  }
+
+private:
+  ValueSource<T> m_Source;
+  bool m_Compensated;
+  CompensatedSum m_CompensatedSum;
+  double m_Sum;
+  size_t m_Count;
+};
+
+template <typename T> class ComponentMinMaxImpl
+{
+public:
+  ComponentMinMaxImpl(int numComps, const ValueSource<T>& source)
+  : m_NumComps(static_cast<size_t>(numComps))
+  , m_Source(source)
+  , m_Found(m_NumComps, 0)
+  , m_Min(m_NumComps, static_cast<T>(0))
+  , m_Max(m_NumComps, static_cast<T>(0))
+  {
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ComponentMinMaxImpl(ComponentMinMaxImpl& other, tbb::split)
+  : m_NumComps(other.m_NumComps)
+  , m_Source(other.m_Source)
+  , m_Found(m_NumComps, 0)
+  , m_Min(m_NumComps, static_cast<T>(0))
+  , m_Max(m_NumComps, static_cast<T>(0))
+  {
+  }
+#endif
+
+  inline void operator()(T value, size_t index)
+  {
+    const size_t c = index % m_NumComps;
+    if(m_Found[c] == 0)
+    {
+      m_Min[c] = value;
+      m_Max[c] = value;
+      m_Found[c] = 1;
+    }
+    else if(value < m_Min[c])
+    {
+      m_Min[c] = value;
+    }
+    else if(value > m_Max[c])
+    {
+      m_Max[c] = value;
+    }
+  }
+
+  void reduce(size_t start, size_t end)
+  {
+    m_Source.visit(start, end, *this);
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    reduce(r.begin(), r.end());
+  }
+#endif
+
+  void join(const ComponentMinMaxImpl& rhs)
+  {
+    for(size_t c = 0; c < m_NumComps; c++)
+    {
+      if(rhs.m_Found[c] == 0)
+      {
+        continue;
+      }
+      if(m_Found[c] == 0)
+      {
+        m_Min[c] = rhs.m_Min[c];
+        m_Max[c] = rhs.m_Max[c];
+        m_Found[c] = 1;
+        continue;
+      }
+      if(rhs.m_Min[c] < m_Min[c])
+      {
+        m_Min[c] = rhs.m_Min[c];
+      }
+      if(rhs.m_Max[c] > m_Max[c])
+      {
+        m_Max[c] = rhs.m_Max[c];
+      }
+    }
+  }
+
+  const std::vector<T>& getMin() const
+  {
+    return m_Min;
+  }
+
+  const std::vector<T>& getMax() const
+  {
+    return m_Max;
+  }
+
+private:
+  size_t m_NumComps;
+  ValueSource<T> m_Source;
+  std::vector<uint8_t> m_Found;
+  std::vector<T> m_Min;
+  std::vector<T> m_Max;
+};
+
+template <typename T> class HistogramImpl
+{
+public:
+  HistogramImpl(const ValueSource<T>& source, size_t numBins, double minValue, double maxValue)
+  : m_Source(source)
+  , m_Min(minValue)
+  , m_Max(maxValue)
+  , m_Scale((maxValue > minValue) ? static_cast<double>(numBins) / (maxValue - minValue) : 0.0)
+  , m_Counts(numBins, 0)
+  {
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  HistogramImpl(HistogramImpl& other, tbb::split)
+  : m_Source(other.m_Source)
+  , m_Min(other.m_Min)
+  , m_Max(other.m_Max)
+  , m_Scale(other.m_Scale)
+  , m_Counts(other.m_Counts.size(), 0)
+  {
+  }
+#endif
+
+  inline void operator()(T value, size_t)
+  {
+    const double v = static_cast<double>(value);
+    if(v < m_Min || v > m_Max)
+    {
+      return;
+    }
+    size_t bin = static_cast<size_t>((v - m_Min) * m_Scale);
+    // The maximum value belongs to the last bin
+    bin = (bin < m_Counts.size()) ? bin : m_Counts.size() - 1;
+    m_Counts[bin]++;
+  }
+
+  void reduce(size_t start, size_t end)
+  {
+    m_Source.visit(start, end, *this);
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    reduce(r.begin(), r.end());
+  }
+#endif
+
+  void join(const HistogramImpl& rhs)
+  {
+    for(size_t i = 0; i < m_Counts.size(); i++)
+    {
+      m_Counts[i] += rhs.m_Counts[i];
+    }
+  }
+
+  const std::vector<size_t>& getCounts() const
+  {
+    return m_Counts;
+  }
+
+private:
+  ValueSource<T> m_Source;
+  double m_Min;
+  double m_Max;
+  double m_Scale;
+  std::vector<size_t> m_Counts;
+};
+}
+
+/**
+ * @brief The DataArrayReductions class is the entry point of the reductions. Every function comes in a raw
+ * pointer flavor and a DataArray flavor.
+ */
+template <typename T> class DataArrayReductions
+{
+public:
+  /**
+   * @brief Statistics Computes count, min, max, their indices, the compensated sum, mean and variance. Every
+   * block of values is read twice, once for its extrema and sum and once for its squared differences from the mean
+   */
+  static ReductionStatistics<T> Statistics(const T* data, size_t numTuples, int numComps, const ReductionRange& range = ReductionRange())
+  {
+    DataArrayReductionsInternal::ValueSource<T> source(data, numTuples, numComps, range);
+    DataArrayReductionsInternal::StatisticsImpl<T> body(source);
+    DataArrayReductionsInternal::Reduce(source, body);
+    return body.getStatistics();
+  }
+
+  static ReductionStatistics<T> Statistics(DataArray<T>& array, const ReductionRange& range = ReductionRange())
+  {
+    return Statistics(array.getPointer(0), array.getNumberOfTuples(), array.getNumberOfComponents(), range);
+  }
+
+  /**
+   * @brief Sum Sums the values in double precision, with compensated summation when compensated is true
+   */
+  static double Sum(const T* data, size_t numTuples, int numComps, const ReductionRange& range = ReductionRange(), bool compensated = true)
+  {
+    DataArrayReductionsInternal::ValueSource<T> source(data, numTuples, numComps, range);
+    DataArrayReductionsInternal::SumImpl<T> body(source, compensated);
+    DataArrayReductionsInternal::Reduce(source, body);
+    return body.getSum();
+  }
+
+  static double Sum(DataArray<T>& array, const ReductionRange& range = ReductionRange(), bool compensated = true)
+  {
+    return Sum(array.getPointer(0), array.getNumberOfTuples(), array.getNumberOfComponents(), range, compensated);
+  }
+
+  /**
+   * @brief Count Returns the number of values the range selects
+   */
+  static size_t Count(DataArray<T>& array, const ReductionRange& range = ReductionRange())
+  {
+    DataArrayReductionsInternal::ValueSource<T> source(array.getPointer(0), array.getNumberOfTuples(), array.getNumberOfComponents(), range);
+    DataArrayReductionsInternal::SumImpl<T> body(source, false);
+    DataArrayReductionsInternal::Reduce(source, body);
+    return body.getCount();
+  }
+
+  static T Min(DataArray<T>& array, const ReductionRange& range = ReductionRange())
+  {
+    return Statistics(array, range).min;
+  }
+
+  static T Max(DataArray<T>& array, const ReductionRange& range = ReductionRange())
+  {
+    return Statistics(array, range).max;
+  }
+
+  static size_t ArgMin(DataArray<T>& array, const ReductionRange& range = ReductionRange())
+  {
+    return Statistics(array, range).argMin;
+  }
+
+  static size_t ArgMax(DataArray<T>& array, const ReductionRange& range = ReductionRange())
+  {
+    return Statistics(array, range).argMax;
+  }
+
+  static double Mean(DataArray<T>& array, const ReductionRange& range = ReductionRange())
+  {
+    return Statistics(array, range).mean;
+  }
+
+  static double Variance(DataArray<T>& array, const ReductionRange& range = ReductionRange())
+  {
+    return Statistics(array, range).variance();
+  }
+
+  /**
+   * @brief ComponentMinMax Finds the minimum and maximum of every component separately in a single pass. The
+   * component of the range is ignored. Components without any selected value report 0 for both.
+   */
+  static void ComponentMinMax(const T* data, size_t numTuples, int numComps, std::vector<T>& mins, std::vector<T>& maxs, const ReductionRange& range = ReductionRange())
+  {
+    ReductionRange allComponents = range;
+    allComponents.component = -1;
+    DataArrayReductionsInternal::ValueSource<T> source(data, numTuples, numComps, allComponents);
+    DataArrayReductionsInternal::ComponentMinMaxImpl<T> body(numComps, source);
+    DataArrayReductionsInternal::Reduce(source, body);
+    mins = body.getMin();
+    maxs = body.getMax();
+  }
+
+  static void ComponentMinMax(DataArray<T>& array, std::vector<T>& mins, std::vector<T>& maxs, const ReductionRange& range = ReductionRange())
+  {
+    ComponentMinMax(array.getPointer(0), array.getNumberOfTuples(), array.getNumberOfComponents(), mins, maxs, range);
+  }
+
+  /**
+   * @brief Histogram Counts the values in numBins equal bins spanning [minValue, maxValue]. Values outside of
+   * that interval are not counted and the maximum falls into the last bin.
+   */
+  static std::vector<size_t> Histogram(const T* data, size_t numTuples, int numComps, size_t numBins, double minValue, double maxValue, const ReductionRange& range = ReductionRange())
+  {
+    if(numBins == 0)
+    {
+      return std::vector<size_t>();
+    }
+    DataArrayReductionsInternal::ValueSource<T> source(data, numTuples, numComps, range);
+    DataArrayReductionsInternal::HistogramImpl<T> body(source, numBins, minValue, maxValue);
+    DataArrayReductionsInternal::Reduce(source, body);
+    return body.getCounts();
+  }
+
+  static std::vector<size_t> Histogram(DataArray<T>& array, size_t numBins, double minValue, double maxValue, const ReductionRange& range = ReductionRange())
+  {
+    return Histogram(array.getPointer(0), array.getNumberOfTuples(), array.getNumberOfComponents(), numBins, minValue, maxValue, range);
+  }
+
+protected:
+  DataArrayReductions() = default;
+
+private:
+  DataArrayReductions(const DataArrayReductions&) = delete; // Copy Constructor Not Implemented
+  void operator=(const DataArrayReductions&) = delete;      // Move assignment Not Implemented
+};
+
+#endif /* _DataArrayReductions_H_ */
@@ -0,0 +1,587 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _FeatureGatherScatter_H_
+#define _FeatureGatherScatter_H_
+
+#include <cmath>
+#include <cstdint>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+/**
+ * The classes in this file move tuples between an element level array and a feature level array through a
+ * featureIds array. A gather copies feature[featureIds[i]] into element i, a scatter reduces all the elements
+ * with the same feature id into that feature. Both are split across all cores; a scatter gives every task its
+ * own partial feature buffers that are joined in element order, so the result does not depend on the number of
+ * threads. The component loops are specialized at compile time for 1, 3 and 4 components. Elements whose
+ * feature id is outside [0, numFeatures) are set to zero by a gather and skipped by a scatter.
+ */
+
+/**
+ * @brief The FeatureReduction enum selects how a scatter combines the elements of a feature
+ */
+enum class FeatureReduction : unsigned int
+{
+  First = 0, // The value of the element with the lowest index
+  Last = 1,  // The value of the element with the highest index
+  Mean = 2,  // The mean of the values, rounded to the nearest value for integer types
+  Min = 3,   // The smallest value, per component
+  Max = 4    // The largest value, per component
+};
+
+/**
+ * @brief The FeatureScatterResult struct reports whether the elements of every feature had the same values. A
+ * scatter always checks this, whatever its reduction. firstInconsistentFeature is the feature of the lowest element
+ * index that differs from the first element of its feature, or -1 when every feature is consistent.
+ */
+struct FeatureScatterResult
+{
+  FeatureScatterResult()
+  : inconsistentFeatures(0)
+  , firstInconsistentFeature(-1)
+  {
+  }
+
+  size_t inconsistentFeatures;
+  int32_t firstInconsistentFeature;
+};
+
+namespace FeatureGatherScatterInternal
+{
+// Minimum number of elements per task; a scatter task also pays for its own feature buffers
+static const size_t k_MinElementsPerTask = 16384;
+static const size_t k_NotFound = std::numeric_limits<size_t>::max();
+
+template <typename T> inline typename std::enable_if<std::is_floating_point<T>::value, T>::type FromMean(double value)
+{
+  return static_cast<T>(value);
+}
+
+template <typename T> inline typename std::enable_if<std::is_same<T, bool>::value, T>::type FromMean(double value)
+{
+  return value >= 0.5;
+}
+
+template <typename T> inline typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, T>::type FromMean(double value)
+{
+  return static_cast<T>(std::floor(value + 0.5));
+}
+
+/**
+ * @brief The GatherImpl class copies feature tuples to the elements. NumComps is 0 when the number of components
+ * is only known at run time.
+ */
+template <typename T, int NumComps> class GatherImpl
+{
+public:
+  GatherImpl(const T* featureData, const int32_t* featureIds, int numComps, size_t numFeatures, T* elementData)
+  : m_FeatureData(featureData)
+  , m_FeatureIds(featureIds)
+  , m_NumComps(NumComps > 0 ? NumComps : numComps)
+  , m_NumFeatures(numFeatures)
+  , m_ElementData(elementData)
+  {
+  }
+
+  void gather(size_t start, size_t end) const
+  {
+    const size_t numComps = static_cast<size_t>(NumComps > 0 ? NumComps : m_NumComps);
+    for(size_t i = start; i < end; i++)
+    {
+      const int32_t featureId = m_FeatureIds[i];
+      T* dst = m_ElementData + numComps * i;
+      if(featureId < 0 || static_cast<size_t>(featureId) >= m_NumFeatures)
+      {
+        for(size_t c = 0; c < numComps; c++)
+        {
+          dst[c] = static_cast<T>(0);
+        }
+        continue;
+      }
+      const T* src = m_FeatureData + numComps * static_cast<size_t>(featureId);
+      for(size_t c = 0; c < numComps; c++)
+      {
+        dst[c] = src[c];
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    gather(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const T* m_FeatureData;
+  const int32_t* m_FeatureIds;
+  int m_NumComps;
+  size_t m_NumFeatures;
+  T* m_ElementData;
+};
+
+/**
+ * @brief The ScatterImpl class reduces the element tuples of every feature into partial feature buffers. Bodies are
+ * joined with the body of the following elements, which keeps First, Last and the consistency check in element order.
+ */
+template <typename T, int NumComps> class ScatterImpl
+{
+public:
+  ScatterImpl(const T* elementData, const int32_t* featureIds, int numComps, size_t numFeatures, FeatureReduction mode)
+  : m_ElementData(elementData)
+  , m_FeatureIds(featureIds)
+  , m_NumComps(NumComps > 0 ? NumComps : numComps)
+  , m_NumFeatures(numFeatures)
+  , m_Mode(mode)
+  , m_FirstInconsistentElement(k_NotFound)
+  , m_FirstInconsistentFeature(-1)
+  {
+    allocate();
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ScatterImpl(ScatterImpl& other, tbb::split)
+  : m_ElementData(other.m_ElementData)
+  , m_FeatureIds(other.m_FeatureIds)
+  , m_NumComps(other.m_NumComps)
+  , m_NumFeatures(other.m_NumFeatures)
+  , m_Mode(other.m_Mode)
+  , m_FirstInconsistentElement(k_NotFound)
+  , m_FirstInconsistentFeature(-1)
+  {
+    allocate();
+  }
+#endif
+
+  void scatter(size_t start, size_t end)
+  {
+    const size_t numComps = static_cast<size_t>(NumComps > 0 ? NumComps : m_NumComps);
+    for(size_t i = start; i < end; i++)
+    {
+      const int32_t featureId = m_FeatureIds[i];
+      if(featureId < 0 || static_cast<size_t>(featureId) >= m_NumFeatures)
+      {
+        continue;
+      }
+      const size_t feature = static_cast<size_t>(featureId);
+      const T* src = m_ElementData + numComps * i;
+      T* first = m_First.data() + numComps * feature;
+      if(m_FirstIndex[feature] == k_NotFound)
+      {
+        m_FirstIndex[feature] = i;
+        for(size_t c = 0; c < numComps; c++)
+        {
+          first[c] = src[c];
+        }
+        if(m_Mode == FeatureReduction::Mean)
+        {
+          double* sum = m_Sums.data() + numComps * feature;
+          for(size_t c = 0; c < numComps; c++)
+          {
+            sum[c] = static_cast<double>(src[c]);
+          }
+          m_Counts[feature] = 1;
+        }
+        else if(m_Mode != FeatureReduction::First)
+        {
+          T* value = m_Values.data() + numComps * feature;
+          for(size_t c = 0; c < numComps; c++)
+          {
+            value[c] = src[c];
+          }
+        }
+        continue;
+      }
+
+      bool consistent = true;
+      for(size_t c = 0; c < numComps; c++)
+      {
+        consistent = consistent && (src[c] == first[c]);
+      }
+      if(!consistent)
+      {
+        markInconsistent(feature, i);
+      }
+      accumulate(feature, src, numComps);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    scatter(r.begin(), r.end());
+  }
+#endif
+
+  /**
+   * @brief join Merges the body of the elements that directly follow the elements of this body
+   */
+  void join(const ScatterImpl& rhs)
+  {
+    const size_t numComps = static_cast<size_t>(NumComps > 0 ? NumComps : m_NumComps);
+    if(rhs.m_FirstInconsistentElement < m_FirstInconsistentElement)
+    {
+      m_FirstInconsistentElement = rhs.m_FirstInconsistentElement;
+      m_FirstInconsistentFeature = rhs.m_FirstInconsistentFeature;
+    }
+    for(size_t feature = 0; feature < m_NumFeatures; feature++)
+    {
+      const size_t rhsFirstIndex = rhs.m_FirstIndex[feature];
+      if(rhsFirstIndex == k_NotFound)
+      {
+        continue;
+      }
+      m_Inconsistent[feature] |= rhs.m_Inconsistent[feature];
+      const size_t offset = numComps * feature;
+      if(m_FirstIndex[feature] == k_NotFound)
+      {
+        m_FirstIndex[feature] = rhsFirstIndex;
+        std::copy(rhs.m_First.begin() + offset, rhs.m_First.begin() + offset + numComps, m_First.begin() + offset);
+        if(m_Mode == FeatureReduction::Mean)
+        {
+          std::copy(rhs.m_Sums.begin() + offset, rhs.m_Sums.begin() + offset + numComps, m_Sums.begin() + offset);
+          m_Counts[feature] = rhs.m_Counts[feature];
+        }
+        else if(m_Mode != FeatureReduction::First)
+        {
+          std::copy(rhs.m_Values.begin() + offset, rhs.m_Values.begin() + offset + numComps, m_Values.begin() + offset);
+        }
+        continue;
+      }
+
+      // The first element of the feature in rhs is the earliest one that can differ from the first element here
+      bool consistent = true;
+      for(size_t c = 0; c < numComps; c++)
+      {
+        consistent = consistent && (rhs.m_First[offset + c] == m_First[offset + c]);
+      }
+      if(!consistent)
+      {
+        markInconsistent(feature, rhsFirstIndex);
+      }
+      if(m_Mode == FeatureReduction::Mean)
+      {
+        for(size_t c = 0; c < numComps; c++)
+        {
+          m_Sums[offset + c] += rhs.m_Sums[offset + c];
+        }
+        m_Counts[feature] += rhs.m_Counts[feature];
+      }
+      else if(m_Mode != FeatureReduction::First)
+      {
+        accumulate(feature, rhs.m_Values.data() + offset, numComps);
+      }
+    }
+  }
+
+  /**
+   * @brief finish Writes the reduced tuple of every feature that has at least one element. Features without any
+   * element are left untouched.
+   */
+  FeatureScatterResult finish(T* featureData) const
+  {
+    const size_t numComps = static_cast<size_t>(NumComps > 0 ? NumComps : m_NumComps);
+    FeatureScatterResult result;
+    for(size_t feature = 0; feature < m_NumFeatures; feature++)
+    {
+      if(m_FirstIndex[feature] == k_NotFound)
+      {
+        continue;
+      }
+      const size_t offset = numComps * feature;
+      T* dst = featureData + offset;
+      if(m_Mode == FeatureReduction::First)
+      {
+        std::copy(m_First.begin() + offset, m_First.begin() + offset + numComps, dst);
+      }
+      else if(m_Mode == FeatureReduction::Mean)
+      {
+        const double count = static_cast<double>(m_Counts[feature]);
+        for(size_t c = 0; c < numComps; c++)
+        {
+          dst[c] = FromMean<T>(m_Sums[offset + c] / count);
+        }
+      }
+      else
+      {
+        std::copy(m_Values.begin() + offset, m_Values.begin() + offset + numComps, dst);
+      }
+      if(m_Inconsistent[feature] != 0)
+      {
+        result.inconsistentFeatures++;
+      }
+    }
+    if(m_FirstInconsistentElement != k_NotFound)
+    {
+      result.firstInconsistentFeature = m_FirstInconsistentFeature;
+    }
+    return result;
+  }
+
+private:
+  const T* m_ElementData;
+  const int32_t* m_FeatureIds;
+  int m_NumComps;
+  size_t m_NumFeatures;
+  FeatureReduction m_Mode;
+
+  std::vector<size_t> m_FirstIndex; // Lowest element index of every feature, k_NotFound when the feature has no element yet
+  std::vector<T> m_First;           // Tuple of that element
+  std::vector<T> m_Values;          // Last, Min or Max tuple
+  std::vector<double> m_Sums;       // Mean only
+  std::vector<size_t> m_Counts;     // Mean only
+  std::vector<uint8_t> m_Inconsistent;
+  size_t m_FirstInconsistentElement;
+  int32_t m_FirstInconsistentFeature;
+
+  void allocate()
+  {
+    const size_t numValues = m_NumFeatures * static_cast<size_t>(m_NumComps);
+    m_FirstIndex.assign(m_NumFeatures, k_NotFound);
+    m_First.resize(numValues);
+    m_Inconsistent.assign(m_NumFeatures, 0);
+    if(m_Mode == FeatureReduction::Mean)
+    {
+      m_Sums.resize(numValues);
+      m_Counts.resize(m_NumFeatures);
+    }
+    else if(m_Mode != FeatureReduction::First)
+    {
+      m_Values.resize(numValues);
+    }
+  }
+
+  inline void markInconsistent(size_t feature, size_t element)
+  {
+    m_Inconsistent[feature] = 1;
+    if(element < m_FirstInconsistentElement)
+    {
+      m_FirstInconsistentElement = element;
+      m_FirstInconsistentFeature = static_cast<int32_t>(feature);
+    }
+  }
+
+  inline void accumulate(size_t feature, const T* src, size_t numComps)
+  {
+    switch(m_Mode)
+    {
+    case FeatureReduction::Last:
+    {
+      T* value = m_Values.data() + numComps * feature;
+      for(size_t c = 0; c < numComps; c++)
+      {
+        value[c] = src[c];
+      }
+      break;
+    }
+    case FeatureReduction::Min:
+    {
+      T* value = m_Values.data() + numComps * feature;
+      for(size_t c = 0; c < numComps; c++)
+      {
+        if(src[c] < value[c])
+        {
+          value[c] = src[c];
+        }
+      }
+      break;
+    }
+    case FeatureReduction::Max:
+    {
+      T* value = m_Values.data() + numComps * feature;
+      for(size_t c = 0; c < numComps; c++)
+      {
+        if(src[c] > value[c])
+        {
+          value[c] = src[c];
+        }
+      }
+      break;
+    }
+    case FeatureReduction::Mean:
+    {
+      double* sum = m_Sums.data() + numComps * feature;
+      for(size_t c = 0; c < numComps; c++)
+      {
+        sum[c] += static_cast<double>(src[c]);
+      }
+      m_Counts[feature]++;
+      break;
+    }
+    case FeatureReduction::First:
+      break;
+    }
+  }
+};
+
+template <typename T, int NumComps> void RunGather(const T* featureData, const int32_t* featureIds, size_t numElements, int numComps, size_t numFeatures, T* elementData)
+{
+  GatherImpl<T, NumComps> body(featureData, featureIds, numComps, numFeatures, elementData);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numElements, k_MinElementsPerTask), body, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    body.gather(0, numElements);
+  }
+}
+
+template <typename T, int NumComps>
+FeatureScatterResult RunScatter(const T* elementData, const int32_t* featureIds, size_t numElements, int numComps, size_t numFeatures, FeatureReduction mode, T* featureData)
+{
+  ScatterImpl<T, NumComps> body(elementData, featureIds, numComps, numFeatures, mode);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  // Every task owns a buffer of all the features, so a task gets at least a few elements per feature
+  bool doParallel = numElements >= 4 * numFeatures;
+  if(doParallel == true)
+  {
+    size_t grainSize = std::max(k_MinElementsPerTask, 4 * numFeatures);
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, numElements, grainSize), body, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    body.scatter(0, numElements);
+  }
+  return body.finish(featureData);
+}
+}
+
+/**
+ * @brief The FeatureGatherScatter class copies data between element and feature arrays through a featureIds array
+ */
+template <typename T> class FeatureGatherScatter
+{
+public:
+  virtual ~FeatureGatherScatter() = default;
+
+  /**
+   * @brief Gather Sets every element tuple to the tuple of its feature: elementData[i] = featureData[featureIds[i]].
+   * Elements with a feature id outside [0, numFeatures) are set to zero. The element and feature data may be the
+   * same array only when numComps is 1, which allows renumbering an id array in place.
+   * @param featureData Feature tuples, numFeatures * numComps values
+   * @param featureIds One feature id per element
+   * @param numElements Number of elements
+   * @param numComps Number of components of both arrays
+   * @param numFeatures Number of feature tuples
+   * @param elementData Element tuples, numElements * numComps values
+   */
+  static void Gather(const T* featureData, const int32_t* featureIds, size_t numElements, int numComps, size_t numFeatures, T* elementData)
+  {
+    switch(numComps)
+    {
+    case 1:
+      FeatureGatherScatterInternal::RunGather<T, 1>(featureData, featureIds, numElements, numComps, numFeatures, elementData);
+      break;
+    case 3:
+      FeatureGatherScatterInternal::RunGather<T, 3>(featureData, featureIds, numElements, numComps, numFeatures, elementData);
+      break;
+    case 4:
+      FeatureGatherScatterInternal::RunGather<T, 4>(featureData, featureIds, numElements, numComps, numFeatures, elementData);
+      break;
+    default:
+      FeatureGatherScatterInternal::RunGather<T, 0>(featureData, featureIds, numElements, numComps, numFeatures, elementData);
+      break;
+    }
+  }
+
+  static void Gather(DataArray<T>& featureArray, const int32_t* featureIds, DataArray<T>& elementArray)
+  {
+    Gather(featureArray.getPointer(0), featureIds, elementArray.getNumberOfTuples(), featureArray.getNumberOfComponents(), featureArray.getNumberOfTuples(), elementArray.getPointer(0));
+  }
+
+  /**
+   * @brief Scatter Reduces the element tuples of every feature into the feature tuple. Features that no element
+   * refers to are left untouched.
+   * @param elementData Element tuples, numElements * numComps values
+   * @param featureIds One feature id per element
+   * @param numElements Number of elements
+   * @param numComps Number of components of both arrays
+   * @param numFeatures Number of feature tuples
+   * @param mode How the tuples of a feature are combined
+   * @param featureData Feature tuples, numFeatures * numComps values
+   * @return Whether all the elements of each feature had the same tuple
+   */
+  static FeatureScatterResult Scatter(const T* elementData, const int32_t* featureIds, size_t numElements, int numComps, size_t numFeatures, FeatureReduction mode, T* featureData)
+  {
+    switch(numComps)
+    {
+    case 1:
+      return FeatureGatherScatterInternal::RunScatter<T, 1>(elementData, featureIds, numElements, numComps, numFeatures, mode, featureData);
+    case 3:
+      return FeatureGatherScatterInternal::RunScatter<T, 3>(elementData, featureIds, numElements, numComps, numFeatures, mode, featureData);
+    case 4:
+      return FeatureGatherScatterInternal::RunScatter<T, 4>(elementData, featureIds, numElements, numComps, numFeatures, mode, featureData);
+    default:
+      return FeatureGatherScatterInternal::RunScatter<T, 0>(elementData, featureIds, numElements, numComps, numFeatures, mode, featureData);
+    }
+  }
+
+  static FeatureScatterResult Scatter(DataArray<T>& elementArray, const int32_t* featureIds, FeatureReduction mode, DataArray<T>& featureArray)
+  {
+    return Scatter(elementArray.getPointer(0), featureIds, elementArray.getNumberOfTuples(), elementArray.getNumberOfComponents(), featureArray.getNumberOfTuples(), mode,
+                   featureArray.getPointer(0));
+  }
+
+protected:
+  FeatureGatherScatter() = default;
+
+private:
+  FeatureGatherScatter(const FeatureGatherScatter&) = delete; // Copy Constructor Not Implemented
+  void operator=(const FeatureGatherScatter&) = delete;       // Move assignment Not Implemented
+};
+
+#endif /* _FeatureGatherScatter_H_ */
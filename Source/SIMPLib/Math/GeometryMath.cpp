@@ -35,15 +35,29 @@
 
 #include "GeometryMath.h"
 
-#include <chrono>
-#include <random>
+#include <functional>
+#include <thread>
 
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/Geometry/VertexGeom.h"
+#include "SIMPLib/Math/CounterBasedRandom.hpp"
 #include "SIMPLib/Math/MatrixMath.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 //#include "SIMPLib/Math/SIMPLibRandom.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// Every thread gets its own stream of the counter based generator, keyed once per process run
+// -----------------------------------------------------------------------------
+CounterBasedRandom& ThreadLocalGenerator()
+{
+  static const uint64_t seed = CounterBasedRandom::GenerateSeed();
+  static thread_local CounterBasedRandom generator(seed, static_cast<uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+  return generator;
+}
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -280,17 +294,25 @@ float GeometryMath::LengthOfRayInBox(const float* p, const float* q, const float
 //
 // -----------------------------------------------------------------------------
 void GeometryMath::GenerateRandomRay(float length, float ray[3])
+{
+  CounterBasedRandom& generator = ThreadLocalGenerator();
+  GenerateRandomRay(length, ray, generator, generator.getPosition());
+  generator.discard(1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GeometryMath::GenerateRandomRay(float length, float ray[3], const CounterBasedRandom& random, uint64_t index)
 {
   float w, t;
 
-  std::random_device randomDevice;           // Will be used to obtain a seed for the random number engine
-  std::mt19937_64 generator(randomDevice()); // Standard mersenne_twister_engine seeded with rd()
-  std::mt19937_64::result_type seed = static_cast<std::mt19937_64::result_type>(std::chrono::steady_clock::now().time_since_epoch().count());
-  generator.seed(seed);
-  std::uniform_real_distribution<> distribution(0.0, 1.0);
+  uint64_t first = 0;
+  uint64_t second = 0;
+  random.generate(index, first, second);
 
-  ray[2] = (2.0f * distribution(generator)) - 1.0f;
-  t = (SIMPLib::Constants::k_2Pi * distribution(generator));
+  ray[2] = static_cast<float>(2.0 * CounterBasedRandom::ToUnitInterval(first)) - 1.0f;
+  t = static_cast<float>(SIMPLib::Constants::k_2Pi * CounterBasedRandom::ToUnitInterval(second));
   w = sqrtf(1.0f - (ray[2] * ray[2]));
   ray[0] = w * cosf(t);
   ray[1] = w * sinf(t);
@@ -311,7 +333,8 @@ void GeometryMath::FindBoundingBoxOfVertices(VertexGeom* verts, float* ll, float
   ur[1] = 0.0;
   ur[2] = 0.0;
 
-  float* v = verts->getVertexPointer(0);
+  const VertexGeom* constVerts = verts;
+  const float* v = constVerts->getVertexPointer(0);
   int64_t numVerts = verts->getNumberOfVertices();
   for(int i = 0; i < numVerts; i++)
   {
@@ -1002,7 +1025,7 @@ char GeometryMath::RayCrossesTriangle(const float* a, const float* b, const floa
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-char GeometryMath::PointInPolyhedron(TriangleGeom* faces, const Int32Int32DynamicListArray::ElementList& faceIds, VertexGeom* faceBBs, const float* q, const float* ll,
+char GeometryMath::PointInPolyhedron(TriangleGeom* faces, const Int32Int32DynamicListArray::ElementList& faceIds, const VertexGeom* faceBBs, const float* q, const float* ll,
                                      const float* ur, float radius)
 {
   float ray[3]; /* Ray */
@@ -1042,8 +1065,8 @@ LOOP:
     {
       /* Begin check each face */
       int32_t idx = 2 * faceId[f];
-      float* v0 = faceBBs->getVertexPointer(idx);
-      float* v1 = faceBBs->getVertexPointer(idx + 1);
+      const float* v0 = faceBBs->getVertexPointer(idx);
+      const float* v1 = faceBBs->getVertexPointer(idx + 1);
       if(RayIntersectsBox(q, r, v0, v1) == false)
       {
         code = '0';
@@ -1093,7 +1116,7 @@ LOOP:
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-char GeometryMath::PointInPolyhedron(TriangleGeom* faces, const Int32Int32DynamicListArray::ElementList& faceIds, VertexGeom* faceBBs, const float* q, const float* ll,
+char GeometryMath::PointInPolyhedron(TriangleGeom* faces, const Int32Int32DynamicListArray::ElementList& faceIds, const VertexGeom* faceBBs, const float* q, const float* ll,
                                      const float* ur, float radius, float& distToBoundary)
 {
   float ray[3] = {0.0f, 0.0f, 0.0f}; /* Ray */
@@ -1137,8 +1160,8 @@ LOOP:
     {
       /* Begin check each face */
       int32_t idx = 2 * faceId[f];
-      float* v0 = faceBBs->getVertexPointer(idx);
-      float* v1 = faceBBs->getVertexPointer(idx + 1);
+      const float* v0 = faceBBs->getVertexPointer(idx);
+      const float* v1 = faceBBs->getVertexPointer(idx + 1);
       faces->getVertCoordsAtTri(faceId[f], a, b, c);
       FindDistanceToTriangleCentroid(a, b, c, q, distance);
       if(distance < closestTriangleDistance)
@@ -44,6 +44,7 @@
 
 class VertexGeom;
 class TriangleGeom;
+class CounterBasedRandom;
 
 /*
  * @class GeometryMath GeometryMath.h DREAM3DLib/Common/GeometryMath.h
@@ -188,7 +189,7 @@ class SIMPLib_EXPORT GeometryMath
      */
     static char PointInPolyhedron(TriangleGeom* faces,
                                   const Int32Int32DynamicListArray::ElementList& faceIds,
-                                  VertexGeom* faceBBs,
+                                  const VertexGeom* faceBBs,
                                   const float* q,
                                   const float* ll,
                                   const float* ur,
@@ -205,7 +206,7 @@ class SIMPLib_EXPORT GeometryMath
     */
     static char PointInPolyhedron(TriangleGeom* faces,
                                   const Int32Int32DynamicListArray::ElementList& faceIds,
-                                  VertexGeom* faceBBs,
+                                  const VertexGeom* faceBBs,
                                   const float* q,
                                   const float* ll,
                                   const float* ur,
@@ -254,13 +255,25 @@ class SIMPLib_EXPORT GeometryMath
     static float LengthOfRayInBox(const float* p, const float* q, const float* lowerLeft, const float* upperRight);
 
     /**
-     * @brief Creates a randomly oriented ray of given length
+     * @brief Creates a randomly oriented ray of given length. Each thread draws from its own stream
+     * of a counter based generator, so this is cheap to call repeatedly and from parallel code.
      * @param length float
      * @param ray 1x3 Vector
      * @return
      */
     static void GenerateRandomRay(float length, float ray[3]);
 
+    /**
+     * @brief Creates the randomly oriented ray of given length that belongs to an index of the
+     * generator. The same (generator, index) pair always gives the same ray, which lets parallel
+     * callers reproduce their results.
+     * @param length float
+     * @param ray 1x3 Vector
+     * @param random Generator
+     * @param index Index of the ray
+     */
+    static void GenerateRandomRay(float length, float ray[3], const CounterBasedRandom& random, uint64_t index);
+
     /**
      * @brief Determines the bounding box defined by the lower left and upper right corners of a set of vertices
      * @param verts pointer to vertex array
@@ -37,12 +37,304 @@
 
 #include "math.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
-#include "SIMPLib/Math/SIMPLibRandom.h"
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/Math/CounterBasedRandom.hpp"
 #include "SIMPLib/StatsData/StatsData.h"
 
+namespace
+{
+const size_t k_PointsPerBlock = 2048;
+const size_t k_MaxCellsPerPoint = 2;
+
+/**
+ * @brief The RdfCellList class sorts points into a uniform grid of cells at least as large as the
+ * largest distance of interest, so that every pair closer than that distance lies in the same or in
+ * adjacent cells. The coordinates are stored in cell order so that a cell scan reads contiguous memory.
+ */
+class RdfCellList
+{
+public:
+  RdfCellList(const std::vector<float>& points, const float boxLength[3], float maxDistance, bool periodic)
+  : m_Periodic(periodic)
+  {
+    size_t numPoints = points.size() / 3;
+    for(int d = 0; d < 3; d++)
+    {
+      m_BoxLength[d] = boxLength[d];
+      m_HalfBoxLength[d] = 0.5f * boxLength[d];
+      m_NumCells[d] = std::max<int64_t>(1, static_cast<int64_t>(boxLength[d] / maxDistance));
+    }
+    // Keep the grid from growing much beyond the number of points when the distance is tiny
+    while(static_cast<size_t>(m_NumCells[0] * m_NumCells[1] * m_NumCells[2]) > k_MaxCellsPerPoint * numPoints + 1)
+    {
+      int d = static_cast<int>(std::max_element(m_NumCells, m_NumCells + 3) - m_NumCells);
+      m_NumCells[d] = std::max<int64_t>(1, m_NumCells[d] / 2);
+    }
+    for(int d = 0; d < 3; d++)
+    {
+      m_CellLength[d] = boxLength[d] / m_NumCells[d];
+    }
+
+    // Counting sort of the points by cell
+    size_t numCells = static_cast<size_t>(m_NumCells[0] * m_NumCells[1] * m_NumCells[2]);
+    std::vector<size_t> cellOfPoint(numPoints);
+    m_CellStart.assign(numCells + 1, 0);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      const float* p = points.data() + 3 * i;
+      cellOfPoint[i] = cellIndex(cellCoordinate(p, 0), cellCoordinate(p, 1), cellCoordinate(p, 2));
+      m_CellStart[cellOfPoint[i] + 1]++;
+    }
+    for(size_t c = 0; c < numCells; c++)
+    {
+      m_CellStart[c + 1] += m_CellStart[c];
+    }
+    std::vector<size_t> fill(m_CellStart.begin(), m_CellStart.end() - 1);
+    m_SortedPoints.resize(points.size());
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      size_t k = fill[cellOfPoint[i]]++;
+      m_SortedPoints[3 * k] = points[3 * i];
+      m_SortedPoints[3 * k + 1] = points[3 * i + 1];
+      m_SortedPoints[3 * k + 2] = points[3 * i + 2];
+    }
+  }
+
+  size_t getNumberOfPoints() const
+  {
+    return m_SortedPoints.size() / 3;
+  }
+
+  /**
+   * @brief Returns the k'th point in cell order.
+   */
+  const float* getPoint(size_t k) const
+  {
+    return m_SortedPoints.data() + 3 * k;
+  }
+
+  int64_t cellCoordinate(const float* point, int d) const
+  {
+    int64_t c = static_cast<int64_t>(point[d] / m_CellLength[d]);
+    return std::min(std::max<int64_t>(c, 0), m_NumCells[d] - 1);
+  }
+
+  size_t cellIndex(int64_t x, int64_t y, int64_t z) const
+  {
+    return static_cast<size_t>((z * m_NumCells[1] + y) * m_NumCells[0] + x);
+  }
+
+  /**
+   * @brief Lists the distinct cells adjacent to c along one axis, wrapping around when periodic.
+   * @return The number of cells written to neighbors
+   */
+  int neighborCells(int64_t c, int d, int64_t neighbors[3]) const
+  {
+    int count = 0;
+    for(int64_t offset = -1; offset <= 1; offset++)
+    {
+      int64_t n = c + offset;
+      if(m_Periodic)
+      {
+        n = (n + m_NumCells[d]) % m_NumCells[d];
+      }
+      else if(n < 0 || n >= m_NumCells[d])
+      {
+        continue;
+      }
+      if(std::find(neighbors, neighbors + count, n) == neighbors + count)
+      {
+        neighbors[count++] = n;
+      }
+    }
+    return count;
+  }
+
+  size_t cellBegin(size_t cell) const
+  {
+    return m_CellStart[cell];
+  }
+
+  size_t cellEnd(size_t cell) const
+  {
+    return m_CellStart[cell + 1];
+  }
+
+  /**
+   * @brief Squared distance between two points, using the nearest periodic image when periodic.
+   */
+  float squaredDistance(const float* a, const float* b) const
+  {
+    float sum = 0.0f;
+    for(int d = 0; d < 3; d++)
+    {
+      float delta = a[d] - b[d];
+      if(m_Periodic)
+      {
+        if(delta > m_HalfBoxLength[d])
+        {
+          delta -= m_BoxLength[d];
+        }
+        else if(delta < -m_HalfBoxLength[d])
+        {
+          delta += m_BoxLength[d];
+        }
+      }
+      sum += delta * delta;
+    }
+    return sum;
+  }
+
+private:
+  bool m_Periodic;
+  float m_BoxLength[3];
+  float m_HalfBoxLength[3];
+  float m_CellLength[3];
+  int64_t m_NumCells[3];
+  std::vector<size_t> m_CellStart;
+  std::vector<float> m_SortedPoints;
+};
+}
+
+/**
+ * @brief The GenerateRdfPointsImpl class places random points on voxel centers of the sampling box.
+ */
+class GenerateRdfPointsImpl
+{
+public:
+  GenerateRdfPointsImpl(float* points, const CounterBasedRandom& random, size_t xpoints, size_t ypoints, size_t totalpoints, const float* boxres)
+  : m_Points(points)
+  , m_Random(random)
+  , m_XPoints(xpoints)
+  , m_YPoints(ypoints)
+  , m_TotalPoints(totalpoints)
+  , m_BoxRes(boxres)
+  {
+  }
+  virtual ~GenerateRdfPointsImpl() = default;
+
+  void generate(size_t start, size_t end) const
+  {
+    for(size_t i = start; i < end; i++)
+    {
+      size_t featureOwnerIdx = static_cast<size_t>(m_Random.uniformReal(i) * m_TotalPoints);
+      size_t column = featureOwnerIdx % m_XPoints;
+      size_t row = (featureOwnerIdx / m_XPoints) % m_YPoints;
+      size_t plane = featureOwnerIdx / (m_XPoints * m_YPoints);
+
+      m_Points[3 * i] = static_cast<float>(column * m_BoxRes[0]);
+      m_Points[3 * i + 1] = static_cast<float>(row * m_BoxRes[1]);
+      m_Points[3 * i + 2] = static_cast<float>(plane * m_BoxRes[2]);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    generate(r.begin(), r.end());
+  }
+#endif
+
+private:
+  float* m_Points;
+  const CounterBasedRandom& m_Random;
+  size_t m_XPoints;
+  size_t m_YPoints;
+  size_t m_TotalPoints;
+  const float* m_BoxRes;
+};
+
+/**
+ * @brief The CountRdfPairsImpl class histograms the distances between each point of a block and the
+ * points further along in cell order in the neighboring cells. Every block owns its histogram, so no two
+ * tasks ever write to the same bins.
+ */
+class CountRdfPairsImpl
+{
+public:
+  CountRdfPairsImpl(const RdfCellList& cellList, float minDistance, float maxDistance, float stepsize, size_t numBins, std::vector<std::vector<uint64_t>>& blockCounts)
+  : m_CellList(cellList)
+  , m_MinDistance(minDistance)
+  , m_MaxDistance(maxDistance)
+  , m_StepSize(stepsize)
+  , m_NumBins(numBins)
+  , m_BlockCounts(blockCounts)
+  {
+  }
+  virtual ~CountRdfPairsImpl() = default;
+
+  void count(size_t startBlock, size_t endBlock) const
+  {
+    size_t numPoints = m_CellList.getNumberOfPoints();
+    float maxDistanceSquared = m_MaxDistance * m_MaxDistance;
+    int64_t xCells[3], yCells[3], zCells[3];
+
+    for(size_t b = startBlock; b < endBlock; b++)
+    {
+      std::vector<uint64_t>& counts = m_BlockCounts[b];
+      counts.assign(m_NumBins, 0);
+      size_t end = std::min(numPoints, (b + 1) * k_PointsPerBlock);
+      for(size_t i = b * k_PointsPerBlock; i < end; i++)
+      {
+        const float* p = m_CellList.getPoint(i);
+        int numX = m_CellList.neighborCells(m_CellList.cellCoordinate(p, 0), 0, xCells);
+        int numY = m_CellList.neighborCells(m_CellList.cellCoordinate(p, 1), 1, yCells);
+        int numZ = m_CellList.neighborCells(m_CellList.cellCoordinate(p, 2), 2, zCells);
+        for(int z = 0; z < numZ; z++)
+        {
+          for(int y = 0; y < numY; y++)
+          {
+            for(int x = 0; x < numX; x++)
+            {
+              size_t cell = m_CellList.cellIndex(xCells[x], yCells[y], zCells[z]);
+              for(size_t j = std::max(m_CellList.cellBegin(cell), i + 1); j < m_CellList.cellEnd(cell); j++)
+              {
+                float distanceSquared = m_CellList.squaredDistance(p, m_CellList.getPoint(j));
+                if(distanceSquared > maxDistanceSquared)
+                {
+                  continue;
+                }
+                float distance = sqrtf(distanceSquared);
+                size_t bin = 0;
+                if(distance >= m_MinDistance)
+                {
+                  bin = std::min(static_cast<size_t>((distance - m_MinDistance) / m_StepSize) + 1, m_NumBins - 1);
+                }
+                counts[bin]++;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    count(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const RdfCellList& m_CellList;
+  float m_MinDistance;
+  float m_MaxDistance;
+  float m_StepSize;
+  size_t m_NumBins;
+  std::vector<std::vector<uint64_t>>& m_BlockCounts;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -189,102 +481,112 @@ RadialDistributionFunction::~RadialDistributionFunction() = default;
 // -----------------------------------------------------------------------------
 std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres)
 {
-  std::vector<float> freq(numBins, 0);
-  std::vector<float> randomCentroids;
-  std::vector<std::vector<float>> distancelist;
-  size_t largeNumber = 1000;
-  size_t numDistances = largeNumber * (largeNumber - 1);
+  return GenerateRandomDistribution(minDistance, maxDistance, numBins, boxdims, boxres, CounterBasedRandom::GenerateSeed());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres, uint64_t seed)
+{
+  int err = 0;
+  return GenerateRandomDistribution(minDistance, maxDistance, numBins, boxdims, boxres, k_DefaultNumberOfPoints, false, seed, err);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, const std::vector<float>& boxdims, const std::vector<float>& boxres,
+                                                                          size_t numPoints, bool periodic, uint64_t seed, int& err)
+{
+  err = 0;
+  std::vector<float> freq(numBins > 0 ? numBins : 0, 0.0f);
 
   // boxdims are the dimensions of the box in microns
   // boxres is the resoultion of the box in microns
   size_t xpoints = static_cast<size_t>(boxdims[0] / boxres[0]);
   size_t ypoints = static_cast<size_t>(boxdims[1] / boxres[1]);
   size_t zpoints = static_cast<size_t>(boxdims[2] / boxres[2]);
-
   size_t totalpoints = xpoints * ypoints * zpoints;
+  if(numBins <= 0 || totalpoints == 0 || numPoints < 2 || maxDistance <= minDistance)
+  {
+    return freq;
+  }
 
-  float x, y, z;
-  float xn, yn, zn;
-  float xc, yc, zc;
-  float r;
-
-  size_t featureOwnerIdx = 0;
-  size_t column, row, plane;
+  // The extent of the sampled lattice is the period of the box. The nearest image is only the one within
+  // maxDistance if no other image can be that close, i.e. if maxDistance is at most half of every box length
+  float boxLength[3] = {xpoints * boxres[0], ypoints * boxres[1], zpoints * boxres[2]};
+  if(periodic && (maxDistance > 0.5f * boxLength[0] || maxDistance > 0.5f * boxLength[1] || maxDistance > 0.5f * boxLength[2]))
+  {
+    err = k_PeriodicDistanceError;
+    return freq;
+  }
 
   float stepsize = (maxDistance - minDistance) / numBins;
   float maxBoxDistance = sqrtf((boxdims[0] * boxdims[0]) + (boxdims[1] * boxdims[1]) + (boxdims[2] * boxdims[2]));
   size_t current_num_bins = static_cast<size_t>(ceil((maxBoxDistance - minDistance) / stepsize));
+  current_num_bins = std::max(current_num_bins, static_cast<size_t>(numBins));
+  freq.resize(current_num_bins + 1);
 
-  freq.resize(static_cast<size_t>(current_num_bins + 1));
-
-  SIMPL_RANDOMNG_NEW();
-
-  randomCentroids.resize(largeNumber * 3);
-
-  // Generating all of the random points and storing their coordinates in randomCentroids
-  for(size_t i = 0; i < largeNumber; i++)
+  // Random voxel centers, each one derived from its own index of the generator
+  std::vector<float> points(numPoints * 3);
   {
-    featureOwnerIdx = static_cast<size_t>(rg.genrand_res53() * totalpoints);
-
-    column = featureOwnerIdx % xpoints;
-    row = (featureOwnerIdx / xpoints) % ypoints;
-    plane = featureOwnerIdx / (xpoints * ypoints);
-
-    xc = static_cast<float>(column * boxres[0]);
-    yc = static_cast<float>(row * boxres[1]);
-    zc = static_cast<float>(plane * boxres[2]);
-
-    randomCentroids[3 * i] = xc;
-    randomCentroids[3 * i + 1] = yc;
-    randomCentroids[3 * i + 2] = zc;
+    CounterBasedRandom random(seed);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), GenerateRdfPointsImpl(points.data(), random, xpoints, ypoints, totalpoints, boxres.data()), tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      GenerateRdfPointsImpl serial(points.data(), random, xpoints, ypoints, totalpoints, boxres.data());
+      serial.generate(0, numPoints);
+    }
   }
 
-  distancelist.resize(largeNumber);
+  RdfCellList cellList(points, boxLength, maxDistance, periodic);
 
-  // Calculating all of the distances and storing them in the distance list
-  for(size_t i = 1; i < largeNumber; i++)
+  size_t numBlocks = (numPoints + k_PointsPerBlock - 1) / k_PointsPerBlock;
+  std::vector<std::vector<uint64_t>> blockCounts(numBlocks);
   {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+#endif
 
-    x = randomCentroids[3 * i];
-    y = randomCentroids[3 * i + 1];
-    z = randomCentroids[3 * i + 2];
-
-    for(size_t j = i + 1; j < largeNumber; j++)
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
     {
-
-      xn = randomCentroids[3 * j];
-      yn = randomCentroids[3 * j + 1];
-      zn = randomCentroids[3 * j + 2];
-
-      r = sqrtf((x - xn) * (x - xn) + (y - yn) * (y - yn) + (z - zn) * (z - zn));
-
-      distancelist[i].push_back(r);
-      distancelist[j].push_back(r);
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks), CountRdfPairsImpl(cellList, minDistance, maxDistance, stepsize, freq.size(), blockCounts), tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      CountRdfPairsImpl serial(cellList, minDistance, maxDistance, stepsize, freq.size(), blockCounts);
+      serial.count(0, numBlocks);
     }
   }
 
-  // bin up the distance list
-  for(size_t i = 0; i < largeNumber; i++)
+  std::vector<uint64_t> counts(freq.size(), 0);
+  for(size_t b = 0; b < numBlocks; b++)
   {
-    for(size_t j = 0; j < distancelist[i].size(); j++)
+    for(size_t i = 0; i < counts.size(); i++)
     {
-      float distance = distancelist[i][j];
-      size_t bin = static_cast<size_t>((distance - minDistance) / stepsize);
-
-      if(distance < minDistance)
-      {
-        freq[0]++;
-      }
-      else
-      {
-        freq[bin + 1]++;
-      }
+      counts[i] += blockCounts[b][i];
     }
   }
 
-  for(size_t i = 0; i < current_num_bins + 1; i++)
+  // Each pair was counted once
+  double numDistances = 0.5 * static_cast<double>(numPoints) * static_cast<double>(numPoints - 1);
+  for(size_t i = 0; i < freq.size(); i++)
   {
-    freq[i] = freq[i] / (numDistances);
+    freq[i] = static_cast<float>(counts[i] / numDistances);
   }
 
   return freq;
@@ -113,6 +113,40 @@ class SIMPLib_EXPORT RadialDistributionFunction
      */
     static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres);
 
+    /**
+     * @brief GenerateRandomDistribution Same as above, but the random points are derived from the seed
+     * so the distribution can be reproduced exactly
+     * @param minDistance The minimum distance between objects
+     * @param maxDistance The maximum distance between objects
+     * @param numBins The number of bins to generate
+     * @param seed The seed of the random points
+     * @return An array of values that are the frequency values for the histogram
+     */
+    static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres, uint64_t seed);
+
+    /**
+     * @brief GenerateRandomDistribution Histograms the distances between pairs of random points of the box.
+     * The points are binned into a grid of cells so that only pairs closer than maxDistance are visited,
+     * and blocks of points are histogrammed in parallel, which makes millions of points affordable.
+     * Entry 0 holds the pairs closer than minDistance; pairs further apart than maxDistance are not
+     * counted, so the bins past maxDistance stay at zero.
+     * @param minDistance The minimum distance between objects
+     * @param maxDistance The maximum distance between objects
+     * @param numBins The number of bins to generate
+     * @param numPoints The number of random points
+     * @param periodic Whether distances are measured to the nearest periodic image of the box. This
+     * requires maxDistance to be at most half of the box length along every axis.
+     * @param seed The seed of the random points
+     * @param err Set to 0, or to k_PeriodicDistanceError if periodic and maxDistance is larger than half of a
+     * box length, in which case nothing is counted
+     * @return An array of values that are the frequency values for the histogram
+     */
+    static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, const std::vector<float>& boxdims, const std::vector<float>& boxres, size_t numPoints,
+                                                         bool periodic, uint64_t seed, int& err);
+
+    static const size_t k_DefaultNumberOfPoints = 1000;
+    static const int k_PeriodicDistanceError = -1;
+
   protected:
     RadialDistributionFunction();
 
@@ -3,6 +3,10 @@ set(SUBDIR_NAME Math)
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ArrayHelpers.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BatchedMath.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CounterBasedRandom.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/DataArrayReductions.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/FeatureGatherScatter.hpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/GeometryMath.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/MatrixMath.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/QuaternionMath.hpp
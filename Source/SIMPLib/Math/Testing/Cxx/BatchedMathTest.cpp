@@ -0,0 +1,195 @@
+#include <stdlib.h>
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Math/BatchedMath.hpp"
+#include "SIMPLib/Math/CounterBasedRandom.hpp"
+#include "SIMPLib/Math/MatrixMath.h"
+#include "SIMPLib/Math/QuaternionMath.hpp"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class BatchedMathTest
+{
+
+public:
+  BatchedMathTest()
+  {
+  }
+
+  virtual ~BatchedMathTest()
+  {
+  }
+
+  // An odd tuple count exercises the padded lanes of the last block
+  static const size_t k_NumTuples = 10007;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> typename DataArray<T>::Pointer CreateRandomArray(int numComps, uint64_t seed)
+  {
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(k_NumTuples, QVector<size_t>(1, numComps), "Random", true);
+    CounterBasedRandom random(seed);
+    for(size_t i = 0; i < array->getSize(); i++)
+    {
+      array->setValue(i, random.uniformReal<T>(i, -1, 1));
+    }
+    return array;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void RequireClose(const T* expected, const T* actual, int count)
+  {
+    for(int i = 0; i < count; i++)
+    {
+      double tolerance = 1.0e-5 * std::max(1.0, std::fabs(static_cast<double>(expected[i])));
+      double difference = std::fabs(static_cast<double>(expected[i]) - static_cast<double>(actual[i]));
+      DREAM3D_REQUIRED(difference, <=, tolerance)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> typename QuaternionMath<T>::Quaternion GetQuaternion(typename DataArray<T>::Pointer array, size_t tuple)
+  {
+    T* q = array->getTuplePointer(tuple);
+    return QuaternionMath<T>::New(q[0], q[1], q[2], q[3]);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestQuaternions()
+  {
+    typedef typename QuaternionMath<T>::Quaternion Quaternion;
+    typename DataArray<T>::Pointer q1 = CreateRandomArray<T>(4, 1);
+    typename DataArray<T>::Pointer q2 = CreateRandomArray<T>(4, 2);
+    typename DataArray<T>::Pointer vectors = CreateRandomArray<T>(3, 3);
+    typename DataArray<T>::Pointer out = DataArray<T>::CreateArray(k_NumTuples, QVector<size_t>(1, 4), "Out", true);
+    typename DataArray<T>::Pointer rotated = DataArray<T>::CreateArray(k_NumTuples, QVector<size_t>(1, 3), "Rotated", true);
+
+    bool ok = BatchedQuaternionMath<T>::Multiply(q1, q2, out);
+    DREAM3D_REQUIRE(ok)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      Quaternion expected;
+      QuaternionMath<T>::Multiply(GetQuaternion<T>(q1, i), GetQuaternion<T>(q2, i), expected);
+      RequireClose<T>(&expected.x, out->getTuplePointer(i), 4);
+    }
+
+    // A sub range leaves the other tuples alone
+    out->initializeWithZeros();
+    ok = BatchedQuaternionMath<T>::Conjugate(q1, out, 10, 5000);
+    DREAM3D_REQUIRE(ok)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      Quaternion expected = QuaternionMath<T>::New(0, 0, 0, 0);
+      if(i >= 10 && i < 5000)
+      {
+        QuaternionMath<T>::Conjugate(GetQuaternion<T>(q1, i), expected);
+      }
+      RequireClose<T>(&expected.x, out->getTuplePointer(i), 4);
+    }
+
+    ok = BatchedQuaternionMath<T>::RotateVectors(q1, vectors, rotated);
+    DREAM3D_REQUIRE(ok)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      T expected[3] = {0, 0, 0};
+      QuaternionMath<T>::MultiplyQuatVec(GetQuaternion<T>(q1, i), vectors->getTuplePointer(i), expected);
+      RequireClose<T>(expected, rotated->getTuplePointer(i), 3);
+    }
+
+    // In place
+    typename DataArray<T>::Pointer original = std::dynamic_pointer_cast<DataArray<T>>(q1->deepCopy());
+    ok = BatchedQuaternionMath<T>::Normalize(q1, q1);
+    DREAM3D_REQUIRE(ok)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      Quaternion expected = GetQuaternion<T>(original, i);
+      QuaternionMath<T>::UnitQuaternion(expected);
+      RequireClose<T>(&expected.x, q1->getTuplePointer(i), 4);
+    }
+
+    // Mismatched component counts and ranges are rejected
+    ok = BatchedQuaternionMath<T>::Multiply(q1, vectors, out);
+    DREAM3D_REQUIRE_EQUAL(ok, false)
+    ok = BatchedQuaternionMath<T>::Conjugate(q1, out, 0, k_NumTuples + 1);
+    DREAM3D_REQUIRE_EQUAL(ok, false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestMatrices()
+  {
+    FloatArrayType::Pointer a = CreateRandomArray<float>(9, 4);
+    FloatArrayType::Pointer b = CreateRandomArray<float>(9, 5);
+    // Diagonally dominant matrices are well conditioned, so their inverses can be compared closely
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      float* g = a->getTuplePointer(i);
+      g[0] += 3.0f;
+      g[4] += 3.0f;
+      g[8] += 3.0f;
+    }
+    FloatArrayType::Pointer out = FloatArrayType::CreateArray(k_NumTuples, QVector<size_t>(1, 9), "Out", true);
+    float g1[3][3];
+    float g2[3][3];
+    float expected[3][3];
+
+    bool ok = BatchedMatrixMath<float>::Multiply3x3(a, b, out);
+    DREAM3D_REQUIRE(ok)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      std::memcpy(g1, a->getTuplePointer(i), sizeof(g1));
+      std::memcpy(g2, b->getTuplePointer(i), sizeof(g2));
+      MatrixMath::Multiply3x3with3x3(g1, g2, expected);
+      RequireClose<float>(&expected[0][0], out->getTuplePointer(i), 9);
+    }
+
+    ok = BatchedMatrixMath<float>::Transpose3x3(a, out);
+    DREAM3D_REQUIRE(ok)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      std::memcpy(g1, a->getTuplePointer(i), sizeof(g1));
+      MatrixMath::Transpose3x3(g1, expected);
+      RequireClose<float>(&expected[0][0], out->getTuplePointer(i), 9);
+    }
+
+    ok = BatchedMatrixMath<float>::Invert3x3(a, out);
+    DREAM3D_REQUIRE(ok)
+    for(size_t i = 0; i < k_NumTuples; i++)
+    {
+      std::memcpy(g1, a->getTuplePointer(i), sizeof(g1));
+      MatrixMath::Invert3x3(g1, expected);
+      RequireClose<float>(&expected[0][0], out->getTuplePointer(i), 9);
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### BatchedMathTest Starting ####" << std::endl;
+    std::cout << "Batched kernels compiled for " << BatchedMath<float>::InstructionSet() << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestQuaternions<float>())
+    DREAM3D_REGISTER_TEST(TestQuaternions<double>())
+    DREAM3D_REGISTER_TEST(TestMatrices())
+  }
+
+private:
+  BatchedMathTest(const BatchedMathTest&); // Copy Constructor Not Implemented
+  void operator=(const BatchedMathTest&);  // Move assignment Not Implemented
+};
@@ -0,0 +1,176 @@
+#include <stdlib.h>
+
+#include <iostream>
+#include <limits>
+#include <random>
+
+#include "SIMPLib/Math/CounterBasedRandom.hpp"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class CounterBasedRandomTest
+{
+
+public:
+  CounterBasedRandomTest()
+  {
+  }
+
+  virtual ~CounterBasedRandomTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  // Known answers published with the Random123 reference implementation
+  // -----------------------------------------------------------------------------
+  void KnownAnswerTest()
+  {
+    uint32_t counter[4] = {0, 0, 0, 0};
+    uint32_t key[2] = {0, 0};
+    CounterBasedRandom::Philox4x32(counter, key);
+    DREAM3D_REQUIRE_EQUAL(counter[0], 0x6627e8d5u)
+    DREAM3D_REQUIRE_EQUAL(counter[1], 0xe169c58du)
+    DREAM3D_REQUIRE_EQUAL(counter[2], 0xbc57ac4cu)
+    DREAM3D_REQUIRE_EQUAL(counter[3], 0x9b00dbd8u)
+
+    uint32_t counter2[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+    uint32_t key2[2] = {0xa4093822, 0x299f31d0};
+    CounterBasedRandom::Philox4x32(counter2, key2);
+    DREAM3D_REQUIRE_EQUAL(counter2[0], 0xd16cfe09u)
+    DREAM3D_REQUIRE_EQUAL(counter2[1], 0x94fdccebu)
+    DREAM3D_REQUIRE_EQUAL(counter2[2], 0x5001e420u)
+    DREAM3D_REQUIRE_EQUAL(counter2[3], 0x24126ea1u)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void SequentialMatchesIndexedTest()
+  {
+    CounterBasedRandom indexed(1234);
+    CounterBasedRandom engine(1234);
+    for(uint64_t i = 0; i < 1000; i++)
+    {
+      uint64_t value = engine();
+      uint64_t expected = indexed.generate(i);
+      DREAM3D_REQUIRE_EQUAL(value, expected)
+    }
+
+    // Skipping ahead must land on the same value as drawing every intermediate value
+    CounterBasedRandom skipped(1234);
+    skipped.discard(999);
+    skipped.discard(1000);
+    CounterBasedRandom drawn(1234);
+    for(int i = 0; i < 1999; i++)
+    {
+      drawn();
+    }
+    uint64_t skippedValue = skipped();
+    uint64_t drawnValue = drawn();
+    DREAM3D_REQUIRE_EQUAL(skippedValue, drawnValue)
+
+    skipped.seek(17);
+    uint64_t seekedValue = skipped();
+    uint64_t expected = indexed.generate(17);
+    DREAM3D_REQUIRE_EQUAL(seekedValue, expected)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void SeedAndStreamTest()
+  {
+    CounterBasedRandom first(42, 0);
+    CounterBasedRandom second(42, 0);
+    CounterBasedRandom otherSeed(43, 0);
+    CounterBasedRandom otherStream(42, 1);
+
+    int sameSeedDifferences = 0;
+    int otherSeedMatches = 0;
+    int otherStreamMatches = 0;
+    for(uint64_t i = 0; i < 1000; i++)
+    {
+      sameSeedDifferences += (first.generate(i) != second.generate(i)) ? 1 : 0;
+      otherSeedMatches += (first.generate(i) == otherSeed.generate(i)) ? 1 : 0;
+      otherStreamMatches += (first.generate(i) == otherStream.generate(i)) ? 1 : 0;
+    }
+    DREAM3D_REQUIRE_EQUAL(sameSeedDifferences, 0)
+    DREAM3D_REQUIRE_EQUAL(otherSeedMatches, 0)
+    DREAM3D_REQUIRE_EQUAL(otherStreamMatches, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestIntRange(T min, T max)
+  {
+    CounterBasedRandom random(7);
+    bool hitMin = false;
+    bool hitMax = false;
+    for(uint64_t i = 0; i < 10000; i++)
+    {
+      T value = random.uniformInt<T>(i, min, max);
+      DREAM3D_REQUIRED(value, >=, min)
+      DREAM3D_REQUIRED(value, <=, max)
+      hitMin = hitMin || (value == min);
+      hitMax = hitMax || (value == max);
+    }
+    DREAM3D_REQUIRE(hitMin)
+    DREAM3D_REQUIRE(hitMax)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void UniformRangeTest()
+  {
+    TestIntRange<int8_t>(-5, 3);
+    TestIntRange<uint8_t>(0, 255);
+    TestIntRange<int32_t>(-100, 100);
+    TestIntRange<uint64_t>(10, 20);
+    TestIntRange<int64_t>(-7, -2);
+
+    CounterBasedRandom random(7);
+    double sum = 0.0;
+    const int count = 100000;
+    for(int i = 0; i < count; i++)
+    {
+      double value = random.uniformReal<double>(i, -2.0, 6.0);
+      DREAM3D_REQUIRED(value, >=, -2.0)
+      DREAM3D_REQUIRED(value, <, 6.0)
+      sum += value;
+    }
+    double mean = sum / count;
+    DREAM3D_REQUIRED(mean, >, 1.95)
+    DREAM3D_REQUIRED(mean, <, 2.05)
+
+    // The generator also drives the standard distributions
+    CounterBasedRandom engine(7);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    for(int i = 0; i < 1000; i++)
+    {
+      float value = distribution(engine);
+      DREAM3D_REQUIRED(value, >=, 0.0f)
+      DREAM3D_REQUIRED(value, <, 1.0f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### CounterBasedRandomTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(KnownAnswerTest())
+    DREAM3D_REGISTER_TEST(SequentialMatchesIndexedTest())
+    DREAM3D_REGISTER_TEST(SeedAndStreamTest())
+    DREAM3D_REGISTER_TEST(UniformRangeTest())
+  }
+
+private:
+  CounterBasedRandomTest(const CounterBasedRandomTest&); // Copy Constructor Not Implemented
+  void operator=(const CounterBasedRandomTest&);         // Move assignment Not Implemented
+};
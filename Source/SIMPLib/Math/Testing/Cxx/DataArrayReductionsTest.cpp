@@ -0,0 +1,189 @@
+#include <stdlib.h>
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Math/DataArrayReductions.hpp"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class DataArrayReductionsTest
+{
+
+public:
+  DataArrayReductionsTest()
+  {
+  }
+
+  virtual ~DataArrayReductionsTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void StatisticsTest()
+  {
+    const size_t numTuples = 100000;
+    QVector<size_t> cDims(1, 2);
+    DataArray<float>::Pointer array = DataArray<float>::CreateArray(numTuples, cDims, "Values", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      array->setComponent(i, 0, static_cast<float>(i % 1000) * 0.5f);
+      array->setComponent(i, 1, -static_cast<float>(i));
+    }
+    array->setComponent(777, 0, std::numeric_limits<float>::quiet_NaN());
+
+    // Brute force reference for component 0 in double precision
+    double sum = 0.0;
+    size_t count = 0;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      float value = array->getComponent(i, 0);
+      if(!std::isnan(value))
+      {
+        sum += value;
+        count++;
+      }
+    }
+    double mean = sum / static_cast<double>(count);
+    double m2 = 0.0;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      float value = array->getComponent(i, 0);
+      if(!std::isnan(value))
+      {
+        m2 += (value - mean) * (value - mean);
+      }
+    }
+
+    ReductionRange range;
+    range.component = 0;
+    ReductionStatistics<float> stats = DataArrayReductions<float>::Statistics(*array, range);
+    DREAM3D_REQUIRE_EQUAL(stats.count, count)
+    DREAM3D_REQUIRE_EQUAL(stats.min, 0.0f)
+    DREAM3D_REQUIRE_EQUAL(stats.max, 499.5f)
+    DREAM3D_REQUIRE_EQUAL(stats.argMin, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.argMax, 2 * 999)
+    double sumError = std::fabs(stats.sum - sum);
+    double meanError = std::fabs(stats.mean - mean);
+    double varianceError = std::fabs(stats.variance() - m2 / static_cast<double>(count)) / (m2 / static_cast<double>(count));
+    DREAM3D_REQUIRED(sumError, <, 1.0E-6)
+    DREAM3D_REQUIRED(meanError, <, 1.0E-9)
+    DREAM3D_REQUIRED(varianceError, <, 1.0E-9)
+
+    // Every component, the minimum comes from component 1 of the last tuple
+    ReductionStatistics<float> all = DataArrayReductions<float>::Statistics(*array);
+    DREAM3D_REQUIRE_EQUAL(all.count, 2 * numTuples - 1)
+    DREAM3D_REQUIRE_EQUAL(all.argMin, 2 * numTuples - 1)
+    size_t argMax = DataArrayReductions<float>::ArgMax(*array);
+    DREAM3D_REQUIRE_EQUAL(argMax, 2 * 999)
+
+    // A tuple range
+    range.startTuple = 10;
+    range.endTuple = 20;
+    float rangeMin = DataArrayReductions<float>::Min(*array, range);
+    float rangeMax = DataArrayReductions<float>::Max(*array, range);
+    size_t rangeCount = DataArrayReductions<float>::Count(*array, range);
+    DREAM3D_REQUIRE_EQUAL(rangeMin, 5.0f)
+    DREAM3D_REQUIRE_EQUAL(rangeMax, 9.5f)
+    DREAM3D_REQUIRE_EQUAL(rangeCount, 10)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void MaskAndHistogramTest()
+  {
+    const size_t numTuples = 50000;
+    DataArray<int32_t>::Pointer array = DataArray<int32_t>::CreateArray(numTuples, "Values", true);
+    std::unique_ptr<bool[]> maskStorage(new bool[numTuples]);
+    bool* mask = maskStorage.get();
+    size_t numMasked = 0;
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      array->setValue(i, static_cast<int32_t>(i % 100));
+      mask[i] = (i % 3 == 0);
+      numMasked += mask[i] ? 1 : 0;
+    }
+
+    ReductionRange range;
+    range.mask = mask;
+    size_t count = DataArrayReductions<int32_t>::Count(*array, range);
+    DREAM3D_REQUIRE_EQUAL(count, numMasked)
+
+    std::vector<size_t> histogram = DataArrayReductions<int32_t>::Histogram(*array, 10, 0.0, 99.0);
+    DREAM3D_REQUIRE_EQUAL(histogram.size(), 10)
+    size_t total = 0;
+    for(size_t i = 0; i < histogram.size(); i++)
+    {
+      total += histogram[i];
+    }
+    DREAM3D_REQUIRE_EQUAL(total, numTuples)
+    // 0..9 land in the first bin, 90..99 in the last one
+    DREAM3D_REQUIRE_EQUAL(histogram[0], numTuples / 10)
+    DREAM3D_REQUIRE_EQUAL(histogram[9], numTuples / 10)
+
+    std::vector<size_t> maskedHistogram = DataArrayReductions<int32_t>::Histogram(*array, 10, 0.0, 99.0, range);
+    size_t maskedTotal = 0;
+    for(size_t i = 0; i < maskedHistogram.size(); i++)
+    {
+      maskedTotal += maskedHistogram[i];
+    }
+    DREAM3D_REQUIRE_EQUAL(maskedTotal, numMasked)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CompensatedSumTest()
+  {
+    // One large value followed by many values that vanish next to it in a plain double sum
+    const size_t numTuples = 1000001;
+    DataArray<double>::Pointer array = DataArray<double>::CreateArray(numTuples, "Values", true);
+    array->setValue(0, 1.0E16);
+    for(size_t i = 1; i < numTuples; i++)
+    {
+      array->setValue(i, 1.0);
+    }
+    double compensated = DataArrayReductions<double>::Sum(*array);
+    DREAM3D_REQUIRE_EQUAL(compensated, 1.0E16 + 1.0E6)
+
+    ReductionRange range;
+    range.finiteOnly = true;
+    array->setValue(5, std::numeric_limits<double>::infinity());
+    array->setValue(6, 2.0);
+    double finite = DataArrayReductions<double>::Sum(*array, range);
+    DREAM3D_REQUIRE_EQUAL(finite, 1.0E16 + 1.0E6)
+
+    std::vector<double> mins;
+    std::vector<double> maxs;
+    DataArrayReductions<double>::ComponentMinMax(*array, mins, maxs, range);
+    DREAM3D_REQUIRE_EQUAL(mins.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(mins[0], 1.0)
+    DREAM3D_REQUIRE_EQUAL(maxs.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(maxs[0], 1.0E16)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DataArrayReductionsTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(StatisticsTest())
+    DREAM3D_REGISTER_TEST(MaskAndHistogramTest())
+    DREAM3D_REGISTER_TEST(CompensatedSumTest())
+  }
+
+private:
+  DataArrayReductionsTest(const DataArrayReductionsTest&); // Copy Constructor Not Implemented
+  void operator=(const DataArrayReductionsTest&);         // Move assignment Not Implemented
+};
@@ -0,0 +1,258 @@
+#include <stdlib.h>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/Math/FeatureGatherScatter.hpp"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class FeatureGatherScatterTest
+{
+
+public:
+  FeatureGatherScatterTest()
+  {
+  }
+
+  virtual ~FeatureGatherScatterTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestGather(int numComps)
+  {
+    const size_t numFeatures = 50;
+    const size_t numElements = 100000;
+    std::vector<T> featureData(numFeatures * numComps);
+    for(size_t i = 0; i < featureData.size(); i++)
+    {
+      featureData[i] = static_cast<T>(i);
+    }
+    std::vector<int32_t> featureIds(numElements);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      featureIds[i] = static_cast<int32_t>((i * 7) % numFeatures);
+    }
+    featureIds[10] = -1;
+    featureIds[20] = static_cast<int32_t>(numFeatures);
+
+    std::vector<T> elementData(numElements * numComps, static_cast<T>(-5));
+    FeatureGatherScatter<T>::Gather(featureData.data(), featureIds.data(), numElements, numComps, numFeatures, elementData.data());
+
+    for(size_t i = 0; i < numElements; i++)
+    {
+      for(int c = 0; c < numComps; c++)
+      {
+        T value = elementData[i * numComps + c];
+        T expected = static_cast<T>(0);
+        if(featureIds[i] >= 0 && featureIds[i] < static_cast<int32_t>(numFeatures))
+        {
+          expected = featureData[featureIds[i] * numComps + c];
+        }
+        DREAM3D_REQUIRE_EQUAL(value, expected)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void GatherTest()
+  {
+    TestGather<float>(1);
+    TestGather<float>(3);
+    TestGather<int32_t>(4);
+    TestGather<double>(2);
+
+    // Renumber an id array in place
+    std::vector<int32_t> newIds = {0, 2, 0, 1};
+    std::vector<int32_t> ids = {0, 1, 2, 3, 3, 1, 7, -1};
+    FeatureGatherScatter<int32_t>::Gather(newIds.data(), ids.data(), ids.size(), 1, newIds.size(), ids.data());
+    std::vector<int32_t> expected = {0, 2, 0, 1, 1, 2, 0, 0};
+    DREAM3D_REQUIRED(ids == expected, ==, true)
+
+    // Elements with an out of range feature id never keep stale values
+    std::vector<float> features = {1.0f, 2.0f, 3.0f, 4.0f};
+    std::vector<int32_t> badIds = {1, -3, 2, 99};
+    std::vector<float> gathered(badIds.size() * 2, 42.0f);
+    FeatureGatherScatter<float>::Gather(features.data(), badIds.data(), badIds.size(), 2, features.size() / 2, gathered.data());
+    std::vector<float> expectedGathered = {3.0f, 4.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    DREAM3D_REQUIRED(gathered == expectedGathered, ==, true)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void ScatterTest()
+  {
+    const size_t numFeatures = 100;
+    const size_t numElements = 200000;
+    std::vector<int32_t> featureIds(numElements);
+    std::vector<int32_t> elementData(numElements);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      int32_t featureId = static_cast<int32_t>((i * 13) % numFeatures);
+      featureIds[i] = featureId;
+      // Even features have varying values, odd features are constant
+      elementData[i] = (featureId % 2 == 0) ? featureId * 10 + static_cast<int32_t>((i / numFeatures) % 5) : featureId;
+    }
+    // Feature 99 has no elements and must stay untouched
+    for(size_t i = 0; i < numElements; i++)
+    {
+      if(featureIds[i] == 99)
+      {
+        featureIds[i] = 1000;
+      }
+    }
+
+    // Brute force references
+    std::vector<int32_t> first(numFeatures, -7);
+    std::vector<int32_t> last(numFeatures, -7);
+    std::vector<int32_t> mins(numFeatures, -7);
+    std::vector<int32_t> maxs(numFeatures, -7);
+    std::vector<double> sums(numFeatures, 0.0);
+    std::vector<size_t> counts(numFeatures, 0);
+    std::vector<bool> inconsistent(numFeatures, false);
+    int32_t firstInconsistentFeature = -1;
+    for(size_t i = 0; i < numElements; i++)
+    {
+      int32_t featureId = featureIds[i];
+      if(featureId >= static_cast<int32_t>(numFeatures))
+      {
+        continue;
+      }
+      int32_t value = elementData[i];
+      if(counts[featureId] == 0)
+      {
+        first[featureId] = value;
+        mins[featureId] = value;
+        maxs[featureId] = value;
+      }
+      else if(value != first[featureId])
+      {
+        inconsistent[featureId] = true;
+        if(firstInconsistentFeature < 0)
+        {
+          firstInconsistentFeature = featureId;
+        }
+      }
+      last[featureId] = value;
+      mins[featureId] = std::min(mins[featureId], value);
+      maxs[featureId] = std::max(maxs[featureId], value);
+      sums[featureId] += value;
+      counts[featureId]++;
+    }
+    size_t inconsistentCount = 0;
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      if(inconsistent[f])
+      {
+        inconsistentCount++;
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(inconsistentCount, 50)
+
+    const FeatureReduction modes[] = {FeatureReduction::First, FeatureReduction::Last, FeatureReduction::Min, FeatureReduction::Max, FeatureReduction::Mean};
+    for(FeatureReduction mode : modes)
+    {
+      std::vector<int32_t> featureData(numFeatures, -7);
+      FeatureScatterResult result =
+          FeatureGatherScatter<int32_t>::Scatter(elementData.data(), featureIds.data(), numElements, 1, numFeatures, mode, featureData.data());
+      DREAM3D_REQUIRE_EQUAL(result.inconsistentFeatures, inconsistentCount)
+      DREAM3D_REQUIRE_EQUAL(result.firstInconsistentFeature, firstInconsistentFeature)
+      for(size_t f = 0; f < numFeatures; f++)
+      {
+        int32_t expected = -7;
+        if(counts[f] > 0)
+        {
+          switch(mode)
+          {
+          case FeatureReduction::First:
+            expected = first[f];
+            break;
+          case FeatureReduction::Last:
+            expected = last[f];
+            break;
+          case FeatureReduction::Min:
+            expected = mins[f];
+            break;
+          case FeatureReduction::Max:
+            expected = maxs[f];
+            break;
+          case FeatureReduction::Mean:
+            expected = static_cast<int32_t>(std::floor(sums[f] / static_cast<double>(counts[f]) + 0.5));
+            break;
+          }
+        }
+        DREAM3D_REQUIRE_EQUAL(featureData[f], expected)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void ScatterArrayTest()
+  {
+    const size_t numElements = 50000;
+    const size_t numFeatures = 10;
+    QVector<size_t> cDims(1, 4);
+    DataArray<float>::Pointer elements = DataArray<float>::CreateArray(numElements, cDims, "Elements", true);
+    DataArray<float>::Pointer features = DataArray<float>::CreateArray(numFeatures, cDims, "Features", true);
+    std::vector<int32_t> featureIds(numElements);
+    for(size_t i = 0; i < numElements; i++)
+    {
+      featureIds[i] = static_cast<int32_t>(i % numFeatures);
+      for(int c = 0; c < 4; c++)
+      {
+        elements->setComponent(i, c, static_cast<float>(featureIds[i] * 4 + c));
+      }
+    }
+
+    FeatureScatterResult result = FeatureGatherScatter<float>::Scatter(*elements, featureIds.data(), FeatureReduction::Mean, *features);
+    DREAM3D_REQUIRE_EQUAL(result.inconsistentFeatures, 0)
+    DREAM3D_REQUIRE_EQUAL(result.firstInconsistentFeature, -1)
+    for(size_t f = 0; f < numFeatures; f++)
+    {
+      for(int c = 0; c < 4; c++)
+      {
+        float value = features->getComponent(f, c);
+        float expected = static_cast<float>(f * 4 + c);
+        DREAM3D_REQUIRE_EQUAL(value, expected)
+      }
+    }
+
+    // Gathering the features back restores the elements
+    DataArray<float>::Pointer gathered = DataArray<float>::CreateArray(numElements, cDims, "Gathered", true);
+    FeatureGatherScatter<float>::Gather(*features, featureIds.data(), *gathered);
+    for(size_t i = 0; i < numElements * 4; i++)
+    {
+      float value = gathered->getValue(i);
+      float expected = elements->getValue(i);
+      DREAM3D_REQUIRE_EQUAL(value, expected)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### FeatureGatherScatterTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(GatherTest())
+    DREAM3D_REGISTER_TEST(ScatterTest())
+    DREAM3D_REGISTER_TEST(ScatterArrayTest())
+  }
+
+private:
+  FeatureGatherScatterTest(const FeatureGatherScatterTest&); // Copy Constructor Not Implemented
+  void operator=(const FeatureGatherScatterTest&);           // Move assignment Not Implemented
+};
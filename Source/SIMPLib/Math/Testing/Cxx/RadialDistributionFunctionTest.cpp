@@ -0,0 +1,112 @@
+#include <stdlib.h>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "SIMPLib/Math/RadialDistributionFunction.h"
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class RadialDistributionFunctionTest
+{
+
+public:
+  RadialDistributionFunctionTest()
+  {
+  }
+
+  virtual ~RadialDistributionFunctionTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void SeedTest()
+  {
+    std::vector<float> boxDims(3, 50.0f);
+    std::vector<float> boxRes(3, 0.1f);
+    int err = 0;
+    std::vector<float> first = RadialDistributionFunction::GenerateRandomDistribution(2.0f, 10.0f, 20, boxDims, boxRes, 20000, false, 99, err);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    std::vector<float> second = RadialDistributionFunction::GenerateRandomDistribution(2.0f, 10.0f, 20, boxDims, boxRes, 20000, false, 99, err);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    size_t firstSize = first.size();
+    size_t secondSize = second.size();
+    DREAM3D_REQUIRE_EQUAL(firstSize, secondSize)
+    for(size_t i = 0; i < first.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(first[i], second[i])
+    }
+
+    // Pairs further apart than the maximum distance are not counted. Entry 0 holds the pairs below the
+    // minimum distance and entry 21 only a pair at exactly the maximum distance
+    for(size_t i = 22; i < first.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(first[i], 0.0f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  // With periodic boundaries every point sees a full sphere, so the fraction of pairs within a
+  // distance r of each other is the volume of that sphere over the volume of the box
+  // -----------------------------------------------------------------------------
+  void PeriodicTest()
+  {
+    const float boxLength = 100.0f;
+    const float maxDistance = 5.0f;
+    std::vector<float> boxDims(3, boxLength);
+    std::vector<float> boxRes(3, 0.1f);
+    int err = 0;
+    std::vector<float> periodic = RadialDistributionFunction::GenerateRandomDistribution(0.0f, maxDistance, 10, boxDims, boxRes, 200000, true, 7, err);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    std::vector<float> bounded = RadialDistributionFunction::GenerateRandomDistribution(0.0f, maxDistance, 10, boxDims, boxRes, 200000, false, 7, err);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    double periodicSum = 0.0;
+    double boundedSum = 0.0;
+    for(size_t i = 0; i < periodic.size(); i++)
+    {
+      periodicSum += periodic[i];
+      boundedSum += bounded[i];
+    }
+
+    double expected = 4.0 / 3.0 * SIMPLib::Constants::k_Pi * maxDistance * maxDistance * maxDistance / (boxLength * boxLength * boxLength);
+    double relativeError = std::fabs(periodicSum - expected) / expected;
+    DREAM3D_REQUIRED(relativeError, <, 0.02)
+
+    // Points near the faces lose part of their neighborhood without the periodic images
+    DREAM3D_REQUIRED(boundedSum, <, periodicSum)
+
+    // Beyond half of a box length a pair could be closer through another image than the nearest one
+    boxDims[1] = 2.0f * maxDistance - 1.0f;
+    periodic = RadialDistributionFunction::GenerateRandomDistribution(0.0f, maxDistance, 10, boxDims, boxRes, 1000, true, 7, err);
+    DREAM3D_REQUIRE_EQUAL(err, RadialDistributionFunction::k_PeriodicDistanceError)
+    for(size_t i = 0; i < periodic.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(periodic[i], 0.0f)
+    }
+    bounded = RadialDistributionFunction::GenerateRandomDistribution(0.0f, maxDistance, 10, boxDims, boxRes, 1000, false, 7, err);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### RadialDistributionFunctionTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(SeedTest())
+    DREAM3D_REGISTER_TEST(PeriodicTest())
+  }
+
+private:
+  RadialDistributionFunctionTest(const RadialDistributionFunctionTest&); // Copy Constructor Not Implemented
+  void operator=(const RadialDistributionFunctionTest&);                 // Move assignment Not Implemented
+};
@@ -1,7 +1,12 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  BatchedMathTest
+  CounterBasedRandomTest
+  DataArrayReductionsTest
+  FeatureGatherScatterTest
   MatrixMathTest
   QuaternionMathTest
+  RadialDistributionFunctionTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
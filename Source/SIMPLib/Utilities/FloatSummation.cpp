@@ -46,7 +46,7 @@ FloatSummation::~FloatSummation() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float FloatSummation::Kahanf(std::vector<float> values)
+float FloatSummation::Kahanf(const std::vector<float>& values)
 {
   float sum = 0.0;
   float compensation = 0.0;
@@ -66,7 +66,7 @@ float FloatSummation::Kahanf(std::vector<float> values)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-double FloatSummation::Kahan(std::vector<double> values)
+double FloatSummation::Kahan(const std::vector<double>& values)
 {
   double sum = 0.0;
   double compensation = 0.0;
@@ -0,0 +1,276 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "LineOffsetIndex.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTextStream>
+
+namespace
+{
+const int64_t k_BufferSize = 4 * 1024 * 1024;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LineOffsetIndex::LineOffsetIndex()
+: m_FileSize(0)
+, m_Stride(DefaultStride)
+, m_NumberOfLines(0)
+, m_Valid(false)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LineOffsetIndex::~LineOffsetIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool LineOffsetIndex::build(const QString& filePath, int32_t stride, const std::function<void(double)>& progress, const std::atomic<bool>* cancel)
+{
+  m_Valid = false;
+  m_FilePath = filePath;
+  m_Stride = stride;
+  if(m_Stride <= 0)
+  {
+    m_Stride = DefaultStride;
+  }
+  m_NumberOfLines = 0;
+  m_Offsets.clear();
+
+  QFileInfo fi(filePath);
+  QFile qFile(filePath);
+  if(filePath.isEmpty() || !qFile.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+  m_FileSize = qFile.size();
+  m_LastModified = fi.lastModified();
+
+  int64_t bufferSize = std::min(k_BufferSize, std::max(m_FileSize, static_cast<int64_t>(1)));
+  std::unique_ptr<char[]> buffer(new char[static_cast<size_t>(bufferSize)]);
+
+  if(m_FileSize > 0)
+  {
+    m_Offsets.push_back(0);
+  }
+
+  int64_t numNewLines = 0;
+  int64_t bufferOffset = 0;
+  char lastChar = '\n';
+  int64_t progressStep = m_FileSize / 20;
+  int64_t nextProgress = progressStep;
+  while(!qFile.atEnd())
+  {
+    if(nullptr != cancel && cancel->load())
+    {
+      return false;
+    }
+
+    int64_t bytesRead = qFile.read(buffer.get(), bufferSize);
+    if(bytesRead < 0)
+    {
+      return false;
+    }
+    if(bytesRead == 0)
+    {
+      break;
+    }
+
+    // memchr jumps between the newlines with vector instructions instead of testing every byte
+    const char* begin = buffer.get();
+    const char* end = begin + bytesRead;
+    const char* pos = begin;
+    while((pos = static_cast<const char*>(memchr(pos, '\n', static_cast<size_t>(end - pos)))) != nullptr)
+    {
+      numNewLines++;
+      if(numNewLines % m_Stride == 0)
+      {
+        m_Offsets.push_back(bufferOffset + (pos - begin) + 1);
+      }
+      pos++;
+    }
+    lastChar = end[-1];
+    bufferOffset += bytesRead;
+
+    if(progress && bufferOffset >= nextProgress)
+    {
+      progress(static_cast<double>(bufferOffset) / static_cast<double>(m_FileSize) * 100.0);
+      nextProgress = bufferOffset + progressStep;
+    }
+  }
+
+  // A newline that ends the file does not start another line
+  if(!m_Offsets.empty() && m_Offsets.back() >= bufferOffset)
+  {
+    m_Offsets.pop_back();
+  }
+  m_NumberOfLines = numNewLines + ((bufferOffset > 0 && lastChar != '\n') ? 1 : 0);
+  m_FileSize = bufferOffset;
+  m_Valid = true;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool LineOffsetIndex::isValid() const
+{
+  return m_Valid;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool LineOffsetIndex::matchesFile(const QString& filePath) const
+{
+  if(!m_Valid || filePath.isEmpty())
+  {
+    return false;
+  }
+  QFileInfo fi(filePath);
+  QFileInfo indexed(m_FilePath);
+  return fi.absoluteFilePath() == indexed.absoluteFilePath() && fi.size() == m_FileSize && fi.lastModified() == m_LastModified;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString LineOffsetIndex::getFilePath() const
+{
+  return m_FilePath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t LineOffsetIndex::getStride() const
+{
+  return m_Stride;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t LineOffsetIndex::getNumberOfLines() const
+{
+  return m_NumberOfLines;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t LineOffsetIndex::getNumberOfBlocks() const
+{
+  return m_Offsets.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t LineOffsetIndex::getBlockOffset(size_t block) const
+{
+  return m_Offsets[block];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t LineOffsetIndex::getBlockFirstLine(size_t block) const
+{
+  return static_cast<int64_t>(block) * m_Stride + 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool LineOffsetIndex::seekToLine(QTextStream& in, int64_t line) const
+{
+  if(!m_Valid || line < 1 || line > m_NumberOfLines)
+  {
+    return false;
+  }
+
+  size_t block = static_cast<size_t>((line - 1) / m_Stride);
+  if(!in.seek(m_Offsets[block]))
+  {
+    return false;
+  }
+  for(int64_t i = getBlockFirstLine(block); i < line; i++)
+  {
+    in.readLine();
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList LineOffsetIndex::readLines(int64_t beginLine, int64_t numOfLines) const
+{
+  QStringList result;
+  QFile inputFile(m_FilePath);
+  if(!m_Valid || !inputFile.open(QIODevice::ReadOnly))
+  {
+    return result;
+  }
+
+  // Like QTextStream based readers, a line before the first one starts reading at the first line
+  QTextStream in(&inputFile);
+  if(seekToLine(in, std::max(beginLine, static_cast<int64_t>(1))))
+  {
+    for(int64_t i = 0; i < numOfLines; i++)
+    {
+      result.push_back(in.readLine());
+    }
+  }
+  else
+  {
+    for(int64_t i = 0; i < numOfLines; i++)
+    {
+      result.push_back(QString());
+    }
+  }
+  return result;
+}
@@ -0,0 +1,155 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _lineoffsetindex_h_
+#define _lineoffsetindex_h_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+class QTextStream;
+
+/**
+ * @brief The LineOffsetIndex class is a sparse index of the lines of a text file. It stores the byte offset
+ * of every Nth line (the stride) so a reader can seek close to any line and only read the few lines in
+ * between, instead of reading the file from its beginning. The index is built with a single pass over the
+ * file that finds the newlines with memchr, which the C library implements with vector instructions.
+ *
+ * Lines are numbered from 1 and counted the same way as QTextStream::readLine reads them: every '\n' ends
+ * a line and a last line without a trailing '\n' is counted as well.
+ *
+ * The size and modification time of the file are recorded so an index that no longer matches the file on
+ * disk can be detected with matchesFile().
+ */
+class SIMPLib_EXPORT LineOffsetIndex
+{
+  public:
+    SIMPL_SHARED_POINTERS(LineOffsetIndex)
+    SIMPL_STATIC_NEW_MACRO(LineOffsetIndex)
+    SIMPL_TYPE_MACRO(LineOffsetIndex)
+
+    virtual ~LineOffsetIndex();
+
+    /**
+     * @brief Number of lines between two indexed offsets used when none is given
+     */
+    static const int32_t DefaultStride = 1024;
+
+    /**
+     * @brief build Scans the file and indexes the offset of every 'stride' line
+     * @param filePath Path to the file
+     * @param stride Number of lines between two indexed offsets
+     * @param progress Called with the percentage of the file that was scanned, may be empty
+     * @param cancel Checked between two reads, may be nullptr
+     * @return false if the file could not be read or the scan was canceled
+     */
+    bool build(const QString& filePath, int32_t stride = DefaultStride, const std::function<void(double)>& progress = std::function<void(double)>(),
+               const std::atomic<bool>* cancel = nullptr);
+
+    /**
+     * @brief isValid Returns true once build() succeeded
+     */
+    bool isValid() const;
+
+    /**
+     * @brief matchesFile Returns true if the index was built from this file and the file did not change since
+     * @param filePath
+     */
+    bool matchesFile(const QString& filePath) const;
+
+    QString getFilePath() const;
+    int32_t getStride() const;
+    int64_t getNumberOfLines() const;
+
+    /**
+     * @brief getNumberOfBlocks Returns the number of indexed offsets. Block i starts at line i * stride + 1
+     */
+    size_t getNumberOfBlocks() const;
+
+    /**
+     * @brief getBlockOffset Returns the byte offset of the first line of a block
+     * @param block
+     */
+    int64_t getBlockOffset(size_t block) const;
+
+    /**
+     * @brief getBlockFirstLine Returns the 1 based number of the first line of a block
+     * @param block
+     */
+    int64_t getBlockFirstLine(size_t block) const;
+
+    /**
+     * @brief seekToLine Positions the stream at the beginning of a line by seeking to the closest indexed
+     * line before it and reading the lines in between
+     * @param in Stream reading the indexed file
+     * @param line 1 based line number
+     * @return false if the line is past the end of the file
+     */
+    bool seekToLine(QTextStream& in, int64_t line) const;
+
+    /**
+     * @brief readLines Reads 'numOfLines' lines starting at line 'beginLine'. Lines past the end of the file
+     * are returned as empty strings, like QTextStream::readLine does.
+     * @param beginLine 1 based line number
+     * @param numOfLines
+     */
+    QStringList readLines(int64_t beginLine, int64_t numOfLines) const;
+
+  protected:
+    LineOffsetIndex();
+
+  private:
+    QString m_FilePath;
+    int64_t m_FileSize;
+    QDateTime m_LastModified;
+    int32_t m_Stride;
+    int64_t m_NumberOfLines;
+    std::vector<int64_t> m_Offsets;
+    bool m_Valid;
+
+    LineOffsetIndex(const LineOffsetIndex&); // Copy Constructor Not Implemented
+    void operator=(const LineOffsetIndex&);  // Move assignment Not Implemented
+};
+
+#endif /* _lineoffsetindex_h_ */
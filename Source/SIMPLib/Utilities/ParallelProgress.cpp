@@ -0,0 +1,210 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ParallelProgress.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "SIMPLib/Common/Observable.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+namespace
+{
+static std::atomic<int32_t> s_ReportInterval(250);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelProgress::ParallelProgress(Observable* observable, int64_t total, const QString& prefix, const QString& humanLabel, const QString& title, Observable* cancelSource)
+: m_Observable(observable)
+, m_CancelSource(dynamic_cast<AbstractFilter*>(cancelSource))
+, m_Total(total)
+, m_Prefix(prefix)
+, m_HumanLabel(humanLabel)
+, m_Title(title)
+, m_Interval(GetReportInterval())
+, m_LastPercent(-1)
+, m_Completed(0)
+, m_Canceled(false)
+, m_Stopping(false)
+{
+  m_Reporter = std::thread(&ParallelProgress::run, this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParallelProgress::~ParallelProgress()
+{
+  stop();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelProgress::cancel()
+{
+  m_Canceled.store(true, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t ParallelProgress::getCompleted() const
+{
+  return m_Completed.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int64_t ParallelProgress::getTotal() const
+{
+  return m_Total;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ParallelProgress::getLastPercent() const
+{
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  return m_LastPercent;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelProgress::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if(m_Stopping)
+    {
+      return;
+    }
+    m_Stopping = true;
+  }
+  m_Wake.notify_all();
+  if(m_Reporter.joinable())
+  {
+    m_Reporter.join();
+  }
+
+  int32_t percent = 0;
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  if(updatePercent(percent))
+  {
+    lock.unlock();
+    report(percent);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelProgress::SetReportInterval(int32_t milliseconds)
+{
+  s_ReportInterval.store(std::max(milliseconds, 1));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int32_t ParallelProgress::GetReportInterval()
+{
+  return s_ReportInterval.load();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelProgress::run()
+{
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  while(!m_Stopping)
+  {
+    m_Wake.wait_for(lock, std::chrono::milliseconds(m_Interval));
+    if(m_Stopping)
+    {
+      break;
+    }
+    if(nullptr != m_CancelSource && m_CancelSource->getCancel())
+    {
+      m_Canceled.store(true, std::memory_order_relaxed);
+    }
+    int32_t percent = 0;
+    if(updatePercent(percent))
+    {
+      // Emit without holding the lock so that receivers may query this object
+      lock.unlock();
+      report(percent);
+      lock.lock();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Called with m_Mutex held
+// -----------------------------------------------------------------------------
+bool ParallelProgress::updatePercent(int32_t& percent)
+{
+  int64_t completed = m_Completed.load(std::memory_order_relaxed);
+  percent = 100;
+  if(m_Total > 0)
+  {
+    percent = static_cast<int32_t>(std::min<int64_t>(completed, m_Total) * 100 / m_Total);
+  }
+  if(percent == m_LastPercent)
+  {
+    return false;
+  }
+  m_LastPercent = percent;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParallelProgress::report(int32_t percent)
+{
+  if(nullptr != m_Observable)
+  {
+    QString ss = m_Title + QObject::tr(" || %1% Complete").arg(percent);
+    m_Observable->notifyStatusMessage(m_Prefix, m_HumanLabel, ss);
+  }
+}
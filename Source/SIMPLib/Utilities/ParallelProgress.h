@@ -0,0 +1,144 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _parallelprogress_h_
+#define _parallelprogress_h_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/SIMPLib.h"
+
+class Observable;
+class AbstractFilter;
+
+/**
+ * @brief The ParallelProgress class collects the progress of a parallel algorithm and reports it. Worker
+ * threads only add their completed work to an atomic counter and read an atomic cancel flag, so they never
+ * take a lock or emit a Qt signal. A single reporter thread wakes up at a fixed interval, emits a status
+ * message through the Observable when the percentage has changed and, if the Observable is a filter,
+ * copies the filter's cancel flag into the flag the workers read.
+ *
+ * The reporter starts in the constructor and stops in stop() or the destructor, which also emit the final
+ * percentage.
+ */
+class SIMPLib_EXPORT ParallelProgress
+{
+  public:
+    /**
+     * @brief ParallelProgress
+     * @param observable Object that emits the status messages, may be nullptr
+     * @param total Number of work items the algorithm will complete
+     * @param prefix Message prefix
+     * @param humanLabel Message label
+     * @param title Text placed in front of the percentage
+     * @param cancelSource If this is an AbstractFilter, its cancel flag is sampled by the reporter. May be nullptr
+     */
+    ParallelProgress(Observable* observable, int64_t total, const QString& prefix, const QString& humanLabel, const QString& title, Observable* cancelSource = nullptr);
+    virtual ~ParallelProgress();
+
+    /**
+     * @brief increment Adds completed work items. Safe to call from any thread
+     */
+    inline void increment(int64_t count)
+    {
+      m_Completed.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief wasCanceled Returns true once the algorithm has been canceled. Safe to call from any thread
+     */
+    inline bool wasCanceled() const
+    {
+      return m_Canceled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief cancel Asks the workers to stop
+     */
+    void cancel();
+
+    int64_t getCompleted() const;
+    int64_t getTotal() const;
+
+    /**
+     * @brief getLastPercent Returns the last percentage that was reported, or -1 if none was
+     */
+    int32_t getLastPercent() const;
+
+    /**
+     * @brief stop Stops the reporter thread and reports the final percentage. Called by the destructor
+     */
+    void stop();
+
+    /**
+     * @brief SetReportInterval Sets how often, in milliseconds, the reporter of ParallelProgress objects
+     * created afterwards wakes up. The default is 250 ms
+     */
+    static void SetReportInterval(int32_t milliseconds);
+    static int32_t GetReportInterval();
+
+  private:
+    Observable* m_Observable;
+    AbstractFilter* m_CancelSource;
+    int64_t m_Total;
+    QString m_Prefix;
+    QString m_HumanLabel;
+    QString m_Title;
+    int32_t m_Interval;
+    int32_t m_LastPercent;
+
+    std::atomic<int64_t> m_Completed;
+    std::atomic<bool> m_Canceled;
+
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Wake;
+    bool m_Stopping;
+    std::thread m_Reporter;
+
+    void run();
+    bool updatePercent(int32_t& percent);
+    void report(int32_t percent);
+
+    ParallelProgress(const ParallelProgress&); // Copy Constructor Not Implemented
+    void operator=(const ParallelProgress&);   // Move assignment Not Implemented
+};
+
+#endif /* _parallelprogress_h_ */
@@ -0,0 +1,192 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include <QtCore/QFile>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/LineOffsetIndex.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class LineOffsetIndexTest
+{
+public:
+  LineOffsetIndexTest()
+  {
+  }
+  virtual ~LineOffsetIndexTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::LineOffsetIndexTest::TestFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteFile(const QByteArray& contents)
+  {
+    QFile file(UnitTest::LineOffsetIndexTest::TestFile);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::WriteOnly | QIODevice::Truncate), true)
+    file.write(contents);
+    file.close();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QStringList ReadSequentially(int64_t beginLine, int64_t numOfLines)
+  {
+    QStringList result;
+    QFile file(UnitTest::LineOffsetIndexTest::TestFile);
+    file.open(QIODevice::ReadOnly);
+    QTextStream in(&file);
+    for(int64_t i = 1; i < beginLine; i++)
+    {
+      in.readLine();
+    }
+    for(int64_t i = 0; i < numOfLines; i++)
+    {
+      result.push_back(in.readLine());
+    }
+    return result;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSeek()
+  {
+    const int64_t numLines = 10000;
+    QByteArray contents;
+    for(int64_t i = 1; i <= numLines; i++)
+    {
+      contents.append(QString("%1,%2,value %3").arg(i).arg(i * 3).arg(i % 17).toLatin1());
+      if(i < numLines)
+      {
+        contents.append('\n');
+      }
+    }
+    WriteFile(contents);
+
+    LineOffsetIndex::Pointer index = LineOffsetIndex::New();
+    DREAM3D_REQUIRE_EQUAL(index->build(UnitTest::LineOffsetIndexTest::TestFile, 7), true)
+    DREAM3D_REQUIRE_EQUAL(index->isValid(), true)
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfLines(), numLines)
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfBlocks(), (numLines + 6) / 7)
+    DREAM3D_REQUIRE_EQUAL(index->getBlockFirstLine(3), 22)
+    DREAM3D_REQUIRE_EQUAL(index->matchesFile(UnitTest::LineOffsetIndexTest::TestFile), true)
+
+    const int64_t beginLines[] = {1, 2, 7, 8, 9, 1000, 5001, 9990};
+    for(int64_t beginLine : beginLines)
+    {
+      QStringList expected = ReadSequentially(beginLine, 20);
+      QStringList lines = index->readLines(beginLine, 20);
+      DREAM3D_REQUIRE_EQUAL(lines.size(), 20)
+      DREAM3D_REQUIRE(lines == expected)
+    }
+
+    // Lines past the end of the file are empty, as with QTextStream
+    QStringList lines = index->readLines(numLines + 5, 3);
+    DREAM3D_REQUIRE_EQUAL(lines.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(lines[0].isEmpty(), true)
+
+    // Rewriting the file makes the index out of date
+    contents.append("\nanother line");
+    WriteFile(contents);
+    DREAM3D_REQUIRE_EQUAL(index->matchesFile(UnitTest::LineOffsetIndexTest::TestFile), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLineEndings()
+  {
+    LineOffsetIndex::Pointer index = LineOffsetIndex::New();
+
+    // A trailing newline does not start another line
+    WriteFile(QByteArray("a\nb\n"));
+    DREAM3D_REQUIRE_EQUAL(index->build(UnitTest::LineOffsetIndexTest::TestFile, 1), true)
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfLines(), 2)
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfBlocks(), 2)
+    DREAM3D_REQUIRE_EQUAL(index->readLines(2, 1)[0], QString("b"))
+
+    WriteFile(QByteArray("first\r\nsecond\r\nthird"));
+    DREAM3D_REQUIRE_EQUAL(index->build(UnitTest::LineOffsetIndexTest::TestFile, 2), true)
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfLines(), 3)
+    DREAM3D_REQUIRE_EQUAL(index->readLines(2, 1)[0], QString("second"))
+    DREAM3D_REQUIRE_EQUAL(index->readLines(3, 1)[0], QString("third"))
+
+    WriteFile(QByteArray());
+    DREAM3D_REQUIRE_EQUAL(index->build(UnitTest::LineOffsetIndexTest::TestFile), true)
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfLines(), 0)
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfBlocks(), 0)
+
+    RemoveTestFiles();
+    DREAM3D_REQUIRE_EQUAL(index->build(UnitTest::LineOffsetIndexTest::TestFile + ".missing"), false)
+    DREAM3D_REQUIRE_EQUAL(index->isValid(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### LineOffsetIndexTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestSeek())
+    DREAM3D_REGISTER_TEST(TestLineEndings())
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+private:
+  LineOffsetIndexTest(const LineOffsetIndexTest&); // Copy Constructor Not Implemented
+  void operator=(const LineOffsetIndexTest&);      // Move assignment Not Implemented
+};
@@ -0,0 +1,128 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "SIMPLib/Common/Observable.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Utilities/ParallelProgress.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ParallelProgressTest
+{
+public:
+  ParallelProgressTest()
+  {
+  }
+  virtual ~ParallelProgressTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentIncrements()
+  {
+    const int32_t numThreads = 8;
+    const int64_t itemsPerThread = 100000;
+    const int64_t total = numThreads * itemsPerThread;
+
+    Observable observable;
+    ParallelProgress::SetReportInterval(1);
+    ParallelProgress progress(&observable, total, "", "ParallelProgressTest", "Counting");
+
+    std::vector<std::thread> threads;
+    for(int32_t t = 0; t < numThreads; t++)
+    {
+      threads.push_back(std::thread([&progress, itemsPerThread]() {
+        for(int64_t i = 0; i < itemsPerThread; i++)
+        {
+          progress.increment(1);
+        }
+      }));
+    }
+    for(size_t t = 0; t < threads.size(); t++)
+    {
+      threads[t].join();
+    }
+    progress.stop();
+    ParallelProgress::SetReportInterval(250);
+
+    DREAM3D_REQUIRE_EQUAL(progress.getCompleted(), total)
+    DREAM3D_REQUIRE_EQUAL(progress.getTotal(), total)
+    DREAM3D_REQUIRE_EQUAL(progress.getLastPercent(), 100)
+    DREAM3D_REQUIRE_EQUAL(progress.wasCanceled(), false)
+
+    // Stopping twice is harmless
+    progress.stop();
+    DREAM3D_REQUIRE_EQUAL(progress.getLastPercent(), 100)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCancel()
+  {
+    ParallelProgress progress(nullptr, 1000, "", "ParallelProgressTest", "Canceling");
+    progress.increment(250);
+    DREAM3D_REQUIRE_EQUAL(progress.wasCanceled(), false)
+    progress.cancel();
+    DREAM3D_REQUIRE_EQUAL(progress.wasCanceled(), true)
+    progress.stop();
+    DREAM3D_REQUIRE_EQUAL(progress.getLastPercent(), 25)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ParallelProgressTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestConcurrentIncrements())
+    DREAM3D_REGISTER_TEST(TestCancel())
+  }
+
+private:
+  ParallelProgressTest(const ParallelProgressTest&); // Copy Constructor Not Implemented
+  void operator=(const ParallelProgressTest&);       // Move assignment Not Implemented
+};
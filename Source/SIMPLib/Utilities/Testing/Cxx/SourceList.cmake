@@ -1,6 +1,8 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
   FloatSummationTest
+  LineOffsetIndexTest
+  ParallelProgressTest
   StringOperationsTest
 )
 
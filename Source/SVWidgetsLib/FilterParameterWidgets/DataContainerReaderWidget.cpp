@@ -41,6 +41,7 @@
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QMetaProperty>
+#include <QtCore/QMutexLocker>
 
 #include <QtCore/QItemSelectionModel>
 #include <QtGui/QStandardItemModel>
@@ -56,6 +57,7 @@
 #include "SVWidgetsLib/Core/SVWidgetsLibConstants.h"
 #include "SVWidgetsLib/QtSupport/QtSFileCompleter.h"
 #include "SVWidgetsLib/QtSupport/QtSFileUtils.h"
+#include "SVWidgetsLib/Widgets/util/BackgroundPreflight.h"
 
 #include "FilterParameterWidgetsDialogs.h"
 
@@ -802,6 +804,7 @@ void DataContainerReaderWidget::on_m_LineEdit_fileDropped(const QString& text)
         }
         else
         {
+          QMutexLocker locker(&BackgroundPreflight::HDF5Mutex());
           proxy = m_Filter->readDataContainerArrayStructure(text);
           m_Filter->setLastRead(QDateTime::currentDateTime());
         }
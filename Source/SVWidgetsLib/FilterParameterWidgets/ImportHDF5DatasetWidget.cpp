@@ -36,6 +36,7 @@
 #include <QtCore/QDir>
 #include <QtCore/QFileInfo>
 #include <QtCore/QMimeData>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QSettings>
 #include <QtCore/QString>
 #include <QtCore/QTimer>
@@ -62,6 +63,7 @@
 
 #include "SVWidgetsLib/Widgets/ImportHDF5TreeModel.h"
 #include "SVWidgetsLib/Widgets/ImportHDF5TreeModelItem.h"
+#include "SVWidgetsLib/Widgets/util/BackgroundPreflight.h"
 
 #include "SVWidgetsLib/FilterParameterWidgets/FilterParameterWidgetsDialogs.h"
 
@@ -110,6 +112,7 @@ ImportHDF5DatasetWidget::~ImportHDF5DatasetWidget()
 {
   if(m_FileId > 0)
   {
+    QMutexLocker locker(&BackgroundPreflight::HDF5Mutex());
     H5Fclose(m_FileId);
   }
 }
@@ -350,6 +353,8 @@ bool ImportHDF5DatasetWidget::initWithFile(QString hdf5File)
   m_OpenDialogLastDirectory = fileInfo.path();
   m_CurrentOpenFile = hdf5File;
 
+  // The tree model reads the file as well, and a background preflight may be reading HDF5 at the same time
+  QMutexLocker locker(&BackgroundPreflight::HDF5Mutex());
   m_FileId = H5Utilities::openFile(hdf5File.toStdString(), true);
   if(m_FileId < 0)
   {
@@ -409,6 +414,7 @@ void ImportHDF5DatasetWidget::hdfTreeView_currentChanged(const QModelIndex& curr
 // -----------------------------------------------------------------------------
 herr_t ImportHDF5DatasetWidget::updateGeneralTable(const QString& path)
 {
+  QMutexLocker locker(&BackgroundPreflight::HDF5Mutex());
   std::string datasetPath = path.toStdString();
   std::string objName = H5Utilities::extractObjectName(datasetPath);
   QString objType;
@@ -563,6 +569,7 @@ void ImportHDF5DatasetWidget::addRow(QTableWidget* table, int row, const QString
 // -----------------------------------------------------------------------------
 herr_t ImportHDF5DatasetWidget::updateAttributeTable(const QString& path)
 {
+  QMutexLocker locker(&BackgroundPreflight::HDF5Mutex());
   QString objName = QH5Utilities::extractObjectName(path);
 
   herr_t err = 0;
@@ -380,6 +380,7 @@ void ReadASCIIDataWidget::lineCountDidFinish()
   int numOfLines = m_LineCounter->getNumberOfLines();
 
   m_ImportWizard = new ImportASCIIDataWizard(m_FilePath, numOfLines, m_Filter->getDataContainerArray(), this);
+  m_ImportWizard->setLineOffsetIndex(m_LineCounter->getLineOffsetIndex());
   int result = m_ImportWizard->exec();
 
   if(result == QDialog::Accepted)
@@ -457,6 +458,7 @@ void ReadASCIIDataWidget::filterNeedsInputParameters(AbstractFilter* filter)
     data.automaticAM = m_ImportWizard->getAutomaticAM();
     data.selectedPath = m_ImportWizard->getSelectedPath();
     data.attrMatType = m_ImportWizard->getAttributeMatrixType();
+    data.lineOffsetIndex = m_ImportWizard->getLineOffsetIndex();
   }
 
   // Now set the value into the filter.
@@ -60,6 +60,7 @@ set(SIMPLView_PARAMETER_WIDGETS_NO_CODEGEN
   PhaseTypeSelectionWidget
   ReadASCIIDataWidget
   ShapeTypeSelectionWidget
+  UInt64Widget
   UnknownWidget
 )
 
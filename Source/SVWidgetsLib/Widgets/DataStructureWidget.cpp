@@ -46,8 +46,31 @@
 #include "SVWidgetsLib/QtSupport/QtSSettings.h"
 #include "SVWidgetsLib/Widgets/PipelineFilterObject.h"
 
+namespace
+{
+const QString k_KeyDelimiter("|");
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString childKey(const QString& parentKey, const QString& name)
+{
+  return parentKey.isEmpty() ? name : parentKey + k_KeyDelimiter + name;
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString dimsToString(const QVector<size_t>& dims)
+{
+  QStringList values;
+  for(size_t dim : dims)
+  {
+    values.push_back(QString::number(dim));
+  }
+  return values.join(",");
+}
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -101,17 +124,16 @@ void DataStructureWidget::updateDataContainerArray(DataContainerArray::Pointer d
 // -----------------------------------------------------------------------------
 void DataStructureWidget::refreshData()
 {
-  // Get the DataContainerArray object
-  if(m_Dca.get() == nullptr)
+  QStandardItemModel* model = qobject_cast<QStandardItemModel*>(m_Ui->dataBrowserTreeView->model());
+
+  // Sanity check model
+  if(!model)
   {
-    QStandardItemModel* model = qobject_cast<QStandardItemModel*>(m_Ui->dataBrowserTreeView->model());
-    QStandardItem* rootItem = model->invisibleRootItem();
-    removeNonexistingEntries(rootItem, QStringList(), 0);
+    Q_ASSERT_X(model, "Model was not a QStandardItemModel in QColumnView", "");
     return;
   }
 
-  QStandardItemModel* model = qobject_cast<QStandardItemModel*>(m_Ui->dataBrowserTreeView->model());
-  QVector<QString> path;
+  QStringList path;
   {
     QModelIndex currIndex = m_Ui->dataBrowserTreeView->currentIndex();
     QStandardItem* item = model->itemFromIndex(currIndex);
@@ -121,108 +143,132 @@ void DataStructureWidget::refreshData()
       path.push_front(item->text());
       item = item->parent();
     }
-
   }
 
-  model = qobject_cast<QStandardItemModel*>(m_Ui->dataBrowserTreeView->model());
-
-  //  QItemSelectionModel* selectionModel = m_Ui->dataBrowserTreeView->selectionModel();
-  //  if(selectionModel)
-  //  {
-  //    connect(selectionModel, SIGNAL(currentChanged(const QModelIndex&, const QModelIndex&)),
-  //      this, SLOT(dataBrowserTreeView_indexChanged(const QModelIndex&, const QModelIndex&)));
-  //  }
+  // Only the difference between the previous and the current structure is applied to the model. Items are
+  // found through m_Items instead of scanning their siblings, and the info strings are only regenerated
+  // for the items whose signature changed.
+  DataContainerArrayProxy proxy(m_Dca.get());
+  QList<DataContainer::Pointer> containers;
+  if(m_Dca.get() != nullptr)
+  {
+    containers = m_Dca->getDataContainers();
+  }
 
-  // Sanity check model
-  if(!model)
+  QList<QString> dcNames;
+  QHash<QString, QString> dcSignatures;
+  for(const DataContainer::Pointer& dc : containers)
   {
-    Q_ASSERT_X(model, "Model was not a QStandardItemModel in QColumnView", "");
-    return;
+    dcNames.push_back(dc->getName());
+    dcSignatures.insert(dc->getName(), QString::number(proxy.dataContainers.value(dc->getName()).dcType) + ":" + QStringList(dc->getAttributeMatrixNames()).join(k_KeyDelimiter));
   }
 
-  // Loop over the data containers
-  QList<DataContainer::Pointer> containers = m_Dca->getDataContainers();
   QStandardItem* rootItem = model->invisibleRootItem();
-  QListIterator<DataContainer::Pointer> containerIter(containers);
+  QSet<QString> createdDcs;
+  QHash<QString, QString> renamedDcs = syncChildren(rootItem, QString(), m_Proxy.dataContainers.keys(), dcNames, dcSignatures, createdDcs);
 
-  while(containerIter.hasNext())
+  for(const DataContainer::Pointer& dc : containers)
   {
-    DataContainer::Pointer dc = containerIter.next();
-
-    QStandardItem* dcItem = findChildByName(rootItem, dc->getName(), 0);
-    if(!dcItem)
+    QString dcKey = dc->getName();
+    QStandardItem* dcItem = m_Items.value(dcKey);
+    if(createdDcs.contains(dcKey))
     {
-      dcItem = new QStandardItem(dc->getName());
-      rootItem->appendRow(dcItem);
-      //      dcItem->setBackground(QBrush(QColor(154, 136, 255)));
       m_Ui->dataBrowserTreeView->expand(dcItem->index());
     }
-    dcItem->setData(dc->getInfoString(SIMPL::HtmlFormat), Qt::UserRole + 1);
-    dcItem->setToolTip(dc->getInfoString(SIMPL::HtmlFormat));
-
-    if(path.size() > 0 && dc->getName().compare(path[0]) == 0)
+    // The geometry is not part of the signature, so the Data Container info string is always regenerated
+    m_Signatures.insert(dcKey, dcSignatures.value(dcKey));
+    QString dcInfo = dc->getInfoString(SIMPL::HtmlFormat);
+    if(dcItem->toolTip() != dcInfo)
     {
-      m_Ui->dataBrowserTreeView->setCurrentIndex(model->indexFromItem(dcItem));
+      dcItem->setData(dcInfo, Qt::UserRole + 1);
+      dcItem->setToolTip(dcInfo);
     }
 
-    // We found the proper Data Container, now populate the AttributeMatrix List
+    DataContainerProxy oldDcProxy = m_Proxy.dataContainers.value(renamedDcs.value(dcKey, dcKey));
+
     DataContainer::AttributeMatrixMap_t attrMats = dc->getAttributeMatrices();
+    QList<QString> amNames;
+    QHash<QString, QString> amSignatures;
     QMapIterator<QString, AttributeMatrix::Pointer> attrMatsIter(attrMats);
     while(attrMatsIter.hasNext())
+    {
+      attrMatsIter.next();
+      AttributeMatrix::Pointer am = attrMatsIter.value();
+      amNames.push_back(attrMatsIter.key());
+      amSignatures.insert(attrMatsIter.key(), QString::number(static_cast<int>(am->getType())) + ":" + dimsToString(am->getTupleDimensions()) + ":" +
+                                                  QStringList(am->getAttributeArrayNames()).join(k_KeyDelimiter));
+    }
+
+    QSet<QString> createdAms;
+    QHash<QString, QString> renamedAms = syncChildren(dcItem, dcKey, oldDcProxy.attributeMatricies.keys(), amNames, amSignatures, createdAms);
+
+    attrMatsIter.toFront();
+    while(attrMatsIter.hasNext())
     {
       attrMatsIter.next();
       QString amName = attrMatsIter.key();
       AttributeMatrix::Pointer am = attrMatsIter.value();
+      QString amKey = childKey(dcKey, amName);
 
-      QStandardItem* amItem = findChildByName(dcItem, am->getName(), 0);
-      if(!amItem)
+      QStandardItem* amItem = m_Items.value(amKey);
+      if(createdAms.contains(amName))
       {
-        amItem = new QStandardItem(am->getName());
-        //          amItem->setBackground(QColor(128, 224, 138));
-        dcItem->appendRow(amItem);
         m_Ui->dataBrowserTreeView->expand(amItem->index());
       }
-      amItem->setData(am->getInfoString(SIMPL::HtmlFormat), Qt::UserRole + 1);
-      amItem->setToolTip(am->getInfoString(SIMPL::HtmlFormat));
-
-      if(path.size() > 1 && am->getName().compare(path[1]) == 0)
+      if(signatureChanged(amKey, amSignatures.value(amName), renamedAms.contains(amName)))
       {
-        m_Ui->dataBrowserTreeView->setCurrentIndex(model->indexFromItem(amItem));
+        QString amInfo = am->getInfoString(SIMPL::HtmlFormat);
+        amItem->setData(amInfo, Qt::UserRole + 1);
+        amItem->setToolTip(amInfo);
       }
 
-      // We found the selected AttributeMatrix, so loop over this attribute matrix arrays and populate the list widget
+      AttributeMatrixProxy oldAmProxy = oldDcProxy.attributeMatricies.value(renamedAms.value(amName, amName));
+
       QList<QString> attrArrayNames = am->getAttributeArrayNames();
-      QListIterator<QString> dataArraysIter(attrArrayNames);
-      while(dataArraysIter.hasNext())
+      QHash<QString, QString> aaSignatures;
+      for(const QString& attrArrayName : attrArrayNames)
       {
-        QString attrArrayName = dataArraysIter.next();
         IDataArray::Pointer attrArray = am->getAttributeArray(attrArrayName);
+        aaSignatures.insert(attrArrayName, attrArray->getTypeAsString() + ":" + QString::number(attrArray->getNumberOfTuples()) + ":" +
+                                               dimsToString(attrArray->getComponentDimensions()));
+      }
 
-        QStandardItem* aaItem = findChildByName(amItem, attrArray->getName(), 0);
-        if(!aaItem)
-        {
-          aaItem = new QStandardItem(attrArrayName);
-          // aaItem->setBackground(QColor(255, 210, 173));
-          amItem->appendRow(aaItem);
-        }
-        //        else
-        //        {
-        //          aaItem->setBackground(QColor(255, 255, 255));
-        //        }
-        aaItem->setData(attrArray->getInfoString(SIMPL::HtmlFormat), Qt::UserRole + 1);
-        aaItem->setToolTip(attrArray->getInfoString(SIMPL::HtmlFormat));
-
-        if(path.size() > 2 && attrArrayName.compare(path[2]) == 0)
+      QSet<QString> createdAas;
+      QHash<QString, QString> renamedAas = syncChildren(amItem, amKey, oldAmProxy.dataArrays.keys(), attrArrayNames, aaSignatures, createdAas);
+
+      for(const QString& attrArrayName : attrArrayNames)
+      {
+        QString aaKey = childKey(amKey, attrArrayName);
+        if(signatureChanged(aaKey, aaSignatures.value(attrArrayName), renamedAas.contains(attrArrayName)))
         {
-          QModelIndex idx = model->indexFromItem(aaItem);
-          m_Ui->dataBrowserTreeView->setCurrentIndex(idx);
+          QStandardItem* aaItem = m_Items.value(aaKey);
+          QString aaInfo = am->getAttributeArray(attrArrayName)->getInfoString(SIMPL::HtmlFormat);
+          aaItem->setData(aaInfo, Qt::UserRole + 1);
+          aaItem->setToolTip(aaInfo);
         }
       }
-      removeNonexistingEntries(amItem, attrArrayNames, 0);
     }
-    removeNonexistingEntries(dcItem, dc->getAttributeMatrixNames(), 0);
   }
-  removeNonexistingEntries(rootItem, m_Dca->getDataContainerNames(), 0);
+
+  m_Proxy = proxy;
+
+  // Restore the deepest part of the saved selection that still exists
+  QStandardItem* selectedItem = nullptr;
+  QString selectedKey;
+  for(const QString& name : path)
+  {
+    selectedKey = childKey(selectedKey, name);
+    QStandardItem* item = m_Items.value(selectedKey);
+    if(nullptr == item)
+    {
+      break;
+    }
+    selectedItem = item;
+  }
+  if(nullptr != selectedItem && m_Ui->dataBrowserTreeView->currentIndex() != selectedItem->index())
+  {
+    m_Ui->dataBrowserTreeView->setCurrentIndex(selectedItem->index());
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -267,34 +313,124 @@ void DataStructureWidget::handleFilterParameterChanged(PipelineFilterObject* obj
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QStandardItem* DataStructureWidget::findChildByName(QStandardItem* rootItem, const QString &name, int column)
+QHash<QString, QString> DataStructureWidget::syncChildren(QStandardItem* parentItem, const QString& parentKey, const QList<QString>& oldNames, const QList<QString>& newNames,
+                                                          const QHash<QString, QString>& signatures, QSet<QString>& created)
 {
-  QStandardItem* item = nullptr;
-  int rowCount = rootItem->rowCount();
-  for (int row = 0; row < rowCount; ++row)
+  QSet<QString> oldSet;
+  for(const QString& name : oldNames)
   {
-    QStandardItem* anItem = rootItem->child(row, column);
-    if(anItem->text().compare(name) == 0)
+    oldSet.insert(name);
+  }
+  QSet<QString> newSet;
+  for(const QString& name : newNames)
+  {
+    newSet.insert(name);
+  }
+
+  QList<QString> removed;
+  for(const QString& name : oldNames)
+  {
+    if(!newSet.contains(name))
     {
-      item = anItem;
-      break;
+      removed.push_back(name);
     }
   }
-  return item;
+  QList<QString> added;
+  for(const QString& name : newNames)
+  {
+    if(!oldSet.contains(name))
+    {
+      added.push_back(name);
+    }
+  }
+
+  // A single name replaced by another one with the same content is a rename: the item keeps its
+  // children, expansion and selection instead of being rebuilt
+  QHash<QString, QString> renamed;
+  if(removed.size() == 1 && added.size() == 1)
+  {
+    QString oldKey = childKey(parentKey, removed[0]);
+    QStandardItem* item = m_Items.value(oldKey);
+    if(nullptr != item && m_Signatures.value(oldKey) == signatures.value(added[0]))
+    {
+      item->setText(added[0]);
+      rekeyItems(item, oldKey, childKey(parentKey, added[0]));
+      renamed.insert(added[0], removed[0]);
+      removed.clear();
+      added.clear();
+    }
+  }
+
+  for(const QString& name : removed)
+  {
+    QString key = childKey(parentKey, name);
+    QStandardItem* item = m_Items.value(key);
+    if(nullptr != item)
+    {
+      removeItemKeys(item, key);
+      parentItem->removeRow(item->row());
+    }
+  }
+
+  for(const QString& name : added)
+  {
+    QStandardItem* item = new QStandardItem(name);
+    parentItem->appendRow(item);
+    m_Items.insert(childKey(parentKey, name), item);
+    created.insert(name);
+  }
+
+  return renamed;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void DataStructureWidget::removeNonexistingEntries(QStandardItem* rootItem, QList<QString> existing, int column)
+void DataStructureWidget::rekeyItems(QStandardItem* item, const QString& oldKey, const QString& newKey)
 {
-  int rowCount = rootItem->rowCount();
-  for (int row = rowCount-1; row >= 0; row--)
+  m_Items.remove(oldKey);
+  m_Items.insert(newKey, item);
+  m_Signatures.insert(newKey, m_Signatures.take(oldKey));
+
+  int rowCount = item->rowCount();
+  for(int row = 0; row < rowCount; row++)
   {
-    QStandardItem* anItem = rootItem->child(row, column);
-    if(!existing.contains(anItem->text()))
-    {
-      rootItem->removeRow(row);
-    }
+    QStandardItem* child = item->child(row, 0);
+    rekeyItems(child, childKey(oldKey, child->text()), childKey(newKey, child->text()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataStructureWidget::removeItemKeys(QStandardItem* item, const QString& key)
+{
+  m_Items.remove(key);
+  m_Signatures.remove(key);
+
+  int rowCount = item->rowCount();
+  for(int row = 0; row < rowCount; row++)
+  {
+    QStandardItem* child = item->child(row, 0);
+    removeItemKeys(child, childKey(key, child->text()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool DataStructureWidget::signatureChanged(const QString& key, const QString& signature, bool force)
+{
+  QHash<QString, QString>::iterator iter = m_Signatures.find(key);
+  if(iter == m_Signatures.end())
+  {
+    m_Signatures.insert(key, signature);
+    return true;
+  }
+  if(iter.value() == signature && !force)
+  {
+    return false;
   }
+  iter.value() = signature;
+  return true;
 }
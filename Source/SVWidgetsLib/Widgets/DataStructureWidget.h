@@ -36,6 +36,8 @@
 #ifndef _dataBrowserWidget_h_
 #define _dataBrowserWidget_h_
 
+#include <QtCore/QHash>
+#include <QtCore/QSet>
 #include <QtCore/QUuid>
 #include <QtWidgets/QMainWindow>
 #include <QtWidgets/QWidget>
@@ -43,6 +45,7 @@
 #include "SIMPLib/Common/IObserver.h"
 #include "SIMPLib/Common/PipelineMessage.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
 
@@ -105,26 +108,52 @@ protected:
   void setupGui();
 
   /**
-   * @brief findChildByName
-   * @param rootItem
-   * @param name
-   * @param column
-   * @return
+   * @brief Applies the difference between the previous and the current children of an item. Items whose
+   * names are gone are removed, a single removed name replaced by a single added name with the same
+   * signature is renamed in place and the remaining names are appended.
+   * @param parentItem Item whose children are updated
+   * @param parentKey Path key of the parent item, empty for the root
+   * @param oldNames Children names from the previous DataContainerArrayProxy
+   * @param newNames Children names in the current DataContainerArray, in display order
+   * @param signatures Signature of each current child, used to detect renames
+   * @param created Receives the names of the items that were created
+   * @return Map from the new name to the previous name of a renamed child
    */
-  QStandardItem* findChildByName(QStandardItem* rootItem, const QString& name, int column);
+  QHash<QString, QString> syncChildren(QStandardItem* parentItem, const QString& parentKey, const QList<QString>& oldNames, const QList<QString>& newNames,
+                                       const QHash<QString, QString>& signatures, QSet<QString>& created);
 
   /**
-   * @brief Syncs up the QTreeView with the heirarchy from the DataContainerArray
-   * @param rootItem RootItem to start the sync
-   * @param existing List of existing objects
-   * @param column Column to update
+   * @brief Moves the hashed entries of an item and all of its descendants to a new path key
+   * @param item
+   * @param oldKey
+   * @param newKey
    */
-  void removeNonexistingEntries(QStandardItem* rootItem, QList<QString> existing, int column);
+  void rekeyItems(QStandardItem* item, const QString& oldKey, const QString& newKey);
+
+  /**
+   * @brief Drops the hashed entries of an item and all of its descendants
+   * @param item
+   * @param key
+   */
+  void removeItemKeys(QStandardItem* item, const QString& key);
+
+  /**
+   * @brief Records the signature of an item and returns whether its info string has to be regenerated
+   * @param key Path key of the item
+   * @param signature Summary of the values shown in the info string
+   * @param force Regenerate even if the signature did not change, e.g. after a rename
+   * @return
+   */
+  bool signatureChanged(const QString& key, const QString& signature, bool force);
 
 private:
   DataContainerArray::Pointer  m_Dca = nullptr;
   QSharedPointer<Ui::DataStructureWidget>       m_Ui;
 
+  DataContainerArrayProxy                       m_Proxy;
+  QHash<QString, QStandardItem*>                m_Items;
+  QHash<QString, QString>                       m_Signatures;
+
   DataStructureWidget(const DataStructureWidget&) = delete; // Copy Constructor Not Implemented
   void operator=(const DataStructureWidget&);               // Move assignment Not Implemented
 };
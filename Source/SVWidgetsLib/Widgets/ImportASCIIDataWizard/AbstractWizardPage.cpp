@@ -69,3 +69,16 @@ int AbstractWizardPage::nextId() const
   // This should never be called
   return -1;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LineOffsetIndex::Pointer AbstractWizardPage::getLineOffsetIndex() const
+{
+  ImportASCIIDataWizard* importWizard = dynamic_cast<ImportASCIIDataWizard*>(wizard());
+  if(nullptr == importWizard)
+  {
+    return LineOffsetIndex::NullPointer();
+  }
+  return importWizard->getLineOffsetIndex();
+}
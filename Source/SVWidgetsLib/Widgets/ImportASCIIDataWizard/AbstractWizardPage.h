@@ -39,6 +39,8 @@
 
 #include <QtWidgets/QWizardPage>
 
+#include "SIMPLib/Utilities/LineOffsetIndex.h"
+
 class AbstractWizardPage : public QWizardPage
 {
   Q_OBJECT
@@ -59,6 +61,11 @@ class AbstractWizardPage : public QWizardPage
   protected:
     AbstractWizardPage(const QString &inputFilePath, QWidget* parent = nullptr);
 
+    /**
+    * @brief Returns the sparse line index of the input file held by the wizard, or a null pointer
+    */
+    LineOffsetIndex::Pointer getLineOffsetIndex() const;
+
     QString                                         m_InputFilePath;
 
   private:
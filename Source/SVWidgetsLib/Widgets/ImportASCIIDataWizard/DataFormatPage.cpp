@@ -699,7 +699,7 @@ void DataFormatPage::on_startRowSpin_valueChanged(int value)
   bool spaceAsDelimiter = field("spaceAsDelimiter").toBool();
   bool consecutiveDelimiters = field("consecutiveDelimiters").toBool();
 
-  QStringList lines = ImportASCIIDataWizard::ReadLines(m_InputFilePath, value, ImportASCIIDataWizard::TotalPreviewLines);
+  QStringList lines = ImportASCIIDataWizard::ReadLines(m_InputFilePath, value, ImportASCIIDataWizard::TotalPreviewLines, getLineOffsetIndex());
   ImportASCIIDataWizard::LoadOriginalLines(lines, m_ASCIIDataModel.data());
 
   QList<char> delimiters = ImportASCIIDataWizard::ConvertToDelimiters(tabAsDelimiter, semicolonAsDelimiter, commaAsDelimiter, spaceAsDelimiter);
@@ -876,7 +876,7 @@ void DataFormatPage::on_headersIndexLineEdit_textChanged(const QString& text)
     return;
   }
 
-  QString line = ImportASCIIDataWizard::ReadLine(m_InputFilePath, lineNum);
+  QString line = ImportASCIIDataWizard::ReadLine(m_InputFilePath, lineNum, getLineOffsetIndex());
 
   QStringList list;
   list.push_back(line);
@@ -1083,7 +1083,7 @@ void DataFormatPage::refreshModel()
   bool spaceAsDelimiter = field("spaceAsDelimiter").toBool();
   bool consecutiveDelimiters = field("consecutiveDelimiters").toBool();
 
-  QStringList lines = ImportASCIIDataWizard::ReadLines(m_InputFilePath, startRowSpin->value(), ImportASCIIDataWizard::TotalPreviewLines);
+  QStringList lines = ImportASCIIDataWizard::ReadLines(m_InputFilePath, startRowSpin->value(), ImportASCIIDataWizard::TotalPreviewLines, getLineOffsetIndex());
 
   ImportASCIIDataWizard::LoadOriginalLines(lines, m_ASCIIDataModel.data());
 
@@ -125,7 +125,7 @@ void DelimitedPage::refreshModel()
   bool spaceAsDelimiter = spaceCheckBox->isChecked();
   bool consecutiveDelimiters = consecutiveDCheckBox->isChecked();
 
-  QStringList lines = ImportASCIIDataWizard::ReadLines(m_InputFilePath, 1, ImportASCIIDataWizard::TotalPreviewLines);
+  QStringList lines = ImportASCIIDataWizard::ReadLines(m_InputFilePath, 1, ImportASCIIDataWizard::TotalPreviewLines, getLineOffsetIndex());
 
   ImportASCIIDataWizard::LoadOriginalLines(lines, m_ASCIIDataModel.data());
 
@@ -118,6 +118,7 @@ ImportASCIIDataWizard::ImportASCIIDataWizard(ASCIIWizardData* wizardData, DataCo
   // setButton(QWizard::HelpButton, m_RefreshBtn);
   m_InputFilePath = wizardData->inputFilePath;
   m_NumLines = wizardData->numberOfLines;
+  m_LineOffsetIndex = wizardData->lineOffsetIndex;
 
   DelimitedPage* dPage = new DelimitedPage(m_ASCIIDataModel, m_InputFilePath, m_NumLines, this);
   setPage(Delimited, dPage);
@@ -251,9 +252,9 @@ QList<char> ImportASCIIDataWizard::ConvertToDelimiters(bool tabAsDelimiter, bool
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QString ImportASCIIDataWizard::ReadLine(const QString& inputFilePath, int line)
+QString ImportASCIIDataWizard::ReadLine(const QString& inputFilePath, int line, LineOffsetIndex::Pointer lineIndex)
 {
-  QStringList lines = ReadLines(inputFilePath, line, 1);
+  QStringList lines = ReadLines(inputFilePath, line, 1, lineIndex);
 
   if(lines.size() != 1)
   {
@@ -266,13 +267,20 @@ QString ImportASCIIDataWizard::ReadLine(const QString& inputFilePath, int line)
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-QStringList ImportASCIIDataWizard::ReadLines(const QString& inputFilePath, int beginLine, int numOfLines)
+QStringList ImportASCIIDataWizard::ReadLines(const QString& inputFilePath, int beginLine, int numOfLines, LineOffsetIndex::Pointer lineIndex)
 {
   QStringList result;
   if(inputFilePath.isEmpty())
   {
     return result;
   }
+
+  // Seek close to the first line through the index instead of reading every line before it
+  if(nullptr != lineIndex.get() && lineIndex->matchesFile(inputFilePath))
+  {
+    return lineIndex->readLines(beginLine, numOfLines);
+  }
+
   QFile inputFile(inputFilePath);
   if(inputFile.open(QIODevice::ReadOnly))
   {
@@ -440,6 +448,22 @@ int ImportASCIIDataWizard::getBeginningLineNum()
   return field("startRow").toInt();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImportASCIIDataWizard::setLineOffsetIndex(LineOffsetIndex::Pointer lineIndex)
+{
+  m_LineOffsetIndex = lineIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LineOffsetIndex::Pointer ImportASCIIDataWizard::getLineOffsetIndex()
+{
+  return m_LineOffsetIndex;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
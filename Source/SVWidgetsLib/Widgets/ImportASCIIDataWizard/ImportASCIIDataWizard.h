@@ -40,6 +40,7 @@
 #include <QtWidgets/QWizard>
 
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Utilities/LineOffsetIndex.h"
 
 struct ImportASCIIDataBundle
 {
@@ -94,15 +95,17 @@ class ImportASCIIDataWizard : public QWizard
     * @param inputFilePath The path to the file
     * @param beginLine The line to begin reading at in the file
     * @param numOfLines The number of lines to read from the file
+    * @param lineIndex Sparse line index of the file used to seek to 'beginLine'. The file is read from its beginning if this is null or out of date
     */
-    static QStringList ReadLines(const QString &inputFilePath, int beginLine, int numOfLines);
+    static QStringList ReadLines(const QString &inputFilePath, int beginLine, int numOfLines, LineOffsetIndex::Pointer lineIndex = LineOffsetIndex::NullPointer());
 
     /**
     * @brief Static convenience function that will read a certain line from the file 'inputFilePath'.
     * @param inputFilePath The path to the file
     * @param line The line to read from the file
+    * @param lineIndex Sparse line index of the file, may be null
     */
-    static QString ReadLine(const QString &inputFilePath, int line);
+    static QString ReadLine(const QString &inputFilePath, int line, LineOffsetIndex::Pointer lineIndex = LineOffsetIndex::NullPointer());
 
     /**
     * @brief Static function that loads lines into the table objects.  The full lines are stored in the ASCIIDataItem object that backs up each table item, and are not actually displayed in the table yet.
@@ -144,6 +147,13 @@ class ImportASCIIDataWizard : public QWizard
 
     void setInputFilePath(const QString &inputFilePath);
 
+    /**
+     * @brief Sets the sparse line index of the input file that the pages use to read their previews
+     * @param lineIndex
+     */
+    void setLineOffsetIndex(LineOffsetIndex::Pointer lineIndex);
+    LineOffsetIndex::Pointer getLineOffsetIndex();
+
     void setEditSettings(bool value);
 
   protected slots:
@@ -155,6 +165,7 @@ class ImportASCIIDataWizard : public QWizard
     int                                                 m_NumLines = -1;
     bool                                                m_EditSettings = false;
     DataContainerArray::Pointer                         m_Dca = DataContainerArray::NullPointer();
+    LineOffsetIndex::Pointer                            m_LineOffsetIndex = LineOffsetIndex::NullPointer();
 
     QPushButton*                                        m_RefreshBtn = nullptr;
     QSharedPointer<ASCIIDataModel> m_ASCIIDataModel;
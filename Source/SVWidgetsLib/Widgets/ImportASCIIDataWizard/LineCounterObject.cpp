@@ -35,9 +35,6 @@
 
 #include "LineCounterObject.h"
 
-#include <QtCore/QFile>
-#include <QtCore/QTextStream>
-
 #include "SIMPLib/SIMPLibTypes.h"
 
 // -----------------------------------------------------------------------------
@@ -70,83 +67,27 @@ LineCounterObject::~LineCounterObject() = default;
 // -----------------------------------------------------------------------------
 void LineCounterObject::run()
 {
-  // Validate that the file is an ASCII file
-  int64_t bufferSize = 262144;
-  char* buffer;
-  int64_t result;
-
-  // Obtain the file size
+  // Nothing to count without a file
   if(m_FilePath.isEmpty())
   {
     m_NumOfLines = -1;
     emit finished();
     return;
   }
-  QFile qFile(m_FilePath);
-  int64_t fileSize = qFile.size();
 
-  // Open the file
-  if(qFile.open(QIODevice::ReadOnly) == false)
+  // Counting the lines also indexes the offset of every Nth line, so the wizard previews and the filter
+  // can seek close to any line instead of reading the file from its beginning
+  LineOffsetIndex::Pointer lineIndex = LineOffsetIndex::New();
+  bool ok = lineIndex->build(m_FilePath, LineOffsetIndex::DefaultStride, [this](double progress) { emit progressUpdateGenerated(progress); });
+  if(!ok)
   {
     QString errorStr = "Error: Unable to open file \"" + m_FilePath + "\"";
     fputs(errorStr.toStdString().c_str(), stderr);
     return;
   }
 
-  int64_t actualSize;
-  if(fileSize <= bufferSize)
-  {
-    actualSize = fileSize;
-  }
-  else
-  {
-    actualSize = bufferSize;
-  }
-
-  // Allocate the buffer
-  buffer = (char*)malloc(sizeof(char) * actualSize);
-  if(buffer == nullptr)
-  {
-    QString errorStr = "Error: Unable to allocate memory to read in data from \"" + m_FilePath + "\"";
-    fputs(errorStr.toStdString().c_str(), stderr);
-    return;
-  }
-  m_NumOfLines = 0;
-  int64_t currentByte = 0;
-  while(qFile.atEnd() == false)
-  {
-    // Copy the file contents into the buffer
-    result = qFile.read(buffer, actualSize);
-
-    // Check the buffer for new lines and carriage returns
-    int64_t fiveThresh = fileSize / 20.0;
-    int64_t currentThresh = fiveThresh;
-    for(int i = 0; i < result; i++)
-    {
-      currentByte++;
-      if(currentByte > currentThresh)
-      {
-        double progress = static_cast<double>(currentByte) / static_cast<double>(fileSize) * 100;
-        emit progressUpdateGenerated(progress);
-        currentThresh = currentThresh + fiveThresh;
-      }
-
-      char currentChar = buffer[i];
-
-      if(currentChar == '\n')
-      {
-        m_NumOfLines++;
-      }
-      else if(qFile.atEnd() && currentByte == fileSize)
-      {
-        m_NumOfLines++;
-      }
-    }
-  }
-
-  // Close the file and free the memory from the buffer
-  qFile.close();
-  free(buffer);
+  m_NumOfLines = static_cast<int>(lineIndex->getNumberOfLines());
+  m_LineOffsetIndex = lineIndex;
 
   emit finished();
 }
@@ -158,3 +99,11 @@ int LineCounterObject::getNumberOfLines()
 {
   return m_NumOfLines;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LineOffsetIndex::Pointer LineCounterObject::getLineOffsetIndex()
+{
+  return m_LineOffsetIndex;
+}
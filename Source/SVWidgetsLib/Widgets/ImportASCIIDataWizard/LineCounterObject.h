@@ -41,6 +41,8 @@
 
 #include <QtCore/QObject>
 
+#include "SIMPLib/Utilities/LineOffsetIndex.h"
+
 class LineCounterObject : public QObject
 {
   Q_OBJECT
@@ -69,6 +71,13 @@ public:
    */
   int getNumberOfLines();
 
+  /**
+   * @brief getLineOffsetIndex Returns the sparse line index built while counting, or a null pointer if
+   * the lines were not counted by this object
+   * @return
+   */
+  LineOffsetIndex::Pointer getLineOffsetIndex();
+
 protected slots:
 
   /**
@@ -92,6 +101,7 @@ signals:
 private:
   QString m_FilePath;
   int m_NumOfLines;
+  LineOffsetIndex::Pointer m_LineOffsetIndex;
 
   LineCounterObject(const LineCounterObject&) = delete; // Copy Constructor Not Implemented
   void operator=(const LineCounterObject&);             // Move assignment Not Implemented
@@ -86,7 +86,7 @@ void TupleSelectionPage::refreshModel()
   bool consecutiveDelimiters = field("consecutiveDelimiters").toBool();
   int beginIndex = field("startRow").toInt();
 
-  QStringList lines = ImportASCIIDataWizard::ReadLines(m_InputFilePath, beginIndex, ImportASCIIDataWizard::TotalPreviewLines);
+  QStringList lines = ImportASCIIDataWizard::ReadLines(m_InputFilePath, beginIndex, ImportASCIIDataWizard::TotalPreviewLines, getLineOffsetIndex());
 
   ImportASCIIDataWizard::LoadOriginalLines(lines);
 
@@ -32,10 +32,13 @@
 
 #include "ImportHDF5TreeModelItem.h"
 
+#include <QtCore/QMutexLocker>
 #include <QtCore/QStringList>
 
 #include "H5Support/H5Utilities.h"
 
+#include "SVWidgetsLib/Widgets/util/BackgroundPreflight.h"
+
 ImportHDF5TreeModelItem::ImportHDF5TreeModelItem(hid_t fileId, const QString& data, ImportHDF5TreeModelItem* parent)
 : m_ItemData(QVariant(data))
 , m_ParentItem(parent)
@@ -226,6 +229,7 @@ void ImportHDF5TreeModelItem::initializeChildCount()
   }
 
   QString path = generateHDFPath();
+  QMutexLocker locker(&BackgroundPreflight::HDF5Mutex());
 
   hid_t obj_id = H5Utilities::openHDF5Object(m_FileId, path.toStdString());
   if(obj_id > 0)
@@ -281,6 +285,7 @@ void ImportHDF5TreeModelItem::initializeChildItems()
   }
 
   QString path = generateHDFPath();
+  QMutexLocker locker(&BackgroundPreflight::HDF5Mutex());
 
   // std::cout << "ImportHDF5TreeModelItem::initializeChildItems() - Generated Path as: " << path.toStdString() << std::endl;
   // Check to see if the path is a group or data set
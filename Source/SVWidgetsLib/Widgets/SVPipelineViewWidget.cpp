@@ -42,10 +42,13 @@
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QMimeData>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QTemporaryFile>
 #include <QtCore/QUrl>
 #include <QtCore/QSharedPointer>
 
+#include <QtConcurrent/QtConcurrentRun>
+
 #include <QtGui/QClipboard>
 #include <QtGui/QDrag>
 #include <QtGui/QDragEnterEvent>
@@ -85,8 +88,11 @@
 #include "SVWidgetsLib/Widgets/DataStructureWidget.h"
 #include "SVWidgetsLib/Widgets/ProgressDialog.h"
 
-
-
+namespace
+{
+// Time in milliseconds the parameters have to stay unchanged before a background preflight starts
+const int k_PreflightDelay = 300;
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -110,6 +116,10 @@ SVPipelineViewWidget::SVPipelineViewWidget(QWidget* parent)
 // -----------------------------------------------------------------------------
 SVPipelineViewWidget::~SVPipelineViewWidget()
 {
+  m_PreflightTimer.stop();
+  cancelBackgroundPreflight();
+  waitForBackgroundPreflight();
+
   // These disconnections are needed so that the slots are not called when the undo stack is deconstructed.  Calling the slots during deconstruction causes a crash.
   disconnect(m_UndoStack.data(), SIGNAL(undoTextChanged(const QString &)), this, SLOT(updateCurrentUndoText(const QString &)));
   disconnect(m_UndoStack.data(), SIGNAL(redoTextChanged(const QString &)), this, SLOT(updateCurrentRedoText(const QString &)));
@@ -137,6 +147,11 @@ void SVPipelineViewWidget::setupGui()
   newEmptyPipelineViewLayout();
   connect(&m_autoScrollTimer, SIGNAL(timeout()), this, SLOT(doAutoScroll()));
 
+  m_PreflightTimer.setSingleShot(true);
+  m_PreflightTimer.setInterval(k_PreflightDelay);
+  connect(&m_PreflightTimer, SIGNAL(timeout()), this, SLOT(startBackgroundPreflight()));
+  connect(&m_PreflightWatcher, SIGNAL(finished()), this, SLOT(backgroundPreflightFinished()));
+
   // Delete action if it exists
   if(m_ActionEnableFilter)
   {
@@ -801,9 +816,9 @@ void SVPipelineViewWidget::addFilterObject(PipelineFilterObject* filterObject, Q
           this, SLOT(startDrag(QMouseEvent*, SVPipelineFilterWidget*)));
 
   disconnect(filterWidget, SIGNAL(parametersChanged(QUuid)),
-             this, SLOT(preflightPipeline(QUuid)));
+             this, SLOT(schedulePreflight(QUuid)));
   connect(filterWidget, SIGNAL(parametersChanged(QUuid)),
-          this, SLOT(preflightPipeline(QUuid)));
+          this, SLOT(schedulePreflight(QUuid)));
 
   disconnect(filterWidget, SIGNAL(parametersChanged(QUuid)),
              this, SLOT(handleFilterParameterChanged(QUuid)));
@@ -977,6 +992,11 @@ void SVPipelineViewWidget::preflightPipeline(QUuid id)
     return;
   }
 
+  m_PreflightTimer.stop();
+  cancelBackgroundPreflight();
+  waitForBackgroundPreflight();
+  m_PreflightRestartPending = false;
+
   emit pipelineIssuesCleared();
   // Create a Pipeline Object and fill it with the filters from this View
   FilterPipeline::Pointer pipeline = getFilterPipeline();
@@ -986,7 +1006,157 @@ void SVPipelineViewWidget::preflightPipeline(QUuid id)
   {
     filters.at(i)->setErrorCondition(0);
     filters.at(i)->setCancel(false);
+  }
+  resetPreflightStates();
+
+  // Preflight the pipeline
+  int err = pipeline->preflightPipeline();
+  if(err < 0)
+  {
+    // FIXME: Implement error handling.
+  }
+
+  // Now that the preflight has been executed set the outline on the filter widgets if there were errors or warnings
+  showPreflightStates();
+  emit preflightPipelineComplete();
+  emit preflightFinished(err);
+
+  if(m_DataStructureWidget)
+  {
+    m_DataStructureWidget->refreshData();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineViewWidget::schedulePreflight(QUuid id)
+{
+  Q_UNUSED(id)
+  if(m_BlockPreflight)
+  {
+    return;
+  }
+
+  // Whatever is running now misses this edit. Drop it and wait for the edits to settle before starting over. The
+  // next preflight only starts once the worker is idle, see startBackgroundPreflight()
+  cancelBackgroundPreflight();
+  m_PreflightTimer.start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineViewWidget::startBackgroundPreflight()
+{
+  if(m_BlockPreflight)
+  {
+    return;
+  }
+
+  // A canceled preflight stops after its current filter. Start the new one once it has
+  if(m_PreflightWatcher.isRunning())
+  {
+    m_PreflightRestartPending = true;
+    return;
+  }
+  m_PreflightRestartPending = false;
+
+  // Copying pulls the current values out of the widgets, which must not schedule another preflight
+  blockPreflightSignals(true);
+  BackgroundPreflight::Pointer preflight = BackgroundPreflight::New(getViewFilters(), m_PreflightGeneration);
+  blockPreflightSignals(false);
+  m_BackgroundPreflight = preflight;
+  m_PreflightWatcher.setFuture(QtConcurrent::run([preflight] { return preflight->run(); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineViewWidget::backgroundPreflightFinished()
+{
+  if(m_PreflightRestartPending)
+  {
+    startBackgroundPreflight();
+    return;
+  }
+
+  BackgroundPreflight::Pointer preflight = m_BackgroundPreflight;
+  m_BackgroundPreflight.reset();
+  if(nullptr == preflight || preflight->wasCanceled() || preflight->getGeneration() != m_PreflightGeneration)
+  {
+    return;
+  }
+  if(m_BlockPreflight || preflight->matches(getViewFilters()) == false)
+  {
+    return;
+  }
+  int err = m_PreflightWatcher.result();
 
+  // Hand everything to the filters and widgets in one go. The widgets refresh their choices while the results
+  // are published, which must not schedule yet another preflight
+  emit pipelineIssuesCleared();
+  resetPreflightStates();
+  blockPreflightSignals(true);
+  preflight->publish(m_PipelineMessageObservers);
+  blockPreflightSignals(false);
+  showPreflightStates();
+  emit preflightPipelineComplete();
+  emit preflightFinished(err);
+
+  if(m_DataStructureWidget)
+  {
+    m_DataStructureWidget->refreshData();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineViewWidget::cancelBackgroundPreflight()
+{
+  m_PreflightGeneration++;
+  if(nullptr != m_BackgroundPreflight)
+  {
+    m_BackgroundPreflight->cancel();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineViewWidget::waitForBackgroundPreflight()
+{
+  // The result is still published or dropped by backgroundPreflightFinished() once the finished signal arrives
+  m_PreflightWatcher.waitForFinished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterPipeline::FilterContainerType SVPipelineViewWidget::getViewFilters()
+{
+  FilterPipeline::FilterContainerType filters;
+  qint32 count = filterCount();
+  for(qint32 i = 0; i < count; ++i)
+  {
+    PipelineFilterObject* fw = filterObjectAt(i);
+    if(fw)
+    {
+      filters.push_back(fw->getFilter());
+    }
+  }
+  return filters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineViewWidget::resetPreflightStates()
+{
+  qint32 count = filterCount();
+  for(qint32 i = 0; i < count; ++i)
+  {
     PipelineFilterObject* fw = filterObjectAt(i);
     if(fw)
     {
@@ -999,25 +1169,14 @@ void SVPipelineViewWidget::preflightPipeline(QUuid id)
       fw->changeStyle();
     }
   }
+}
 
-//  QSharedPointer<ProgressDialog> progressDialog(new ProgressDialog());
-//  progressDialog->setWindowTitle("Pipeline Preflighting");
-//  QString msg = QString("Please wait for %1 filters to preflight...").arg(pipeline->getFilterContainer().count());
-//  progressDialog->setLabelText(msg);
-//  progressDialog->show();
-//  progressDialog->raise();
-//  progressDialog->activateWindow();
-
-  // Preflight the pipeline
-  int err = pipeline->preflightPipeline();
-  if(err < 0)
-  {
-    // FIXME: Implement error handling.
-  }
-
-  int count = pipeline->getFilterContainer().size();
-  // Now that the preflight has been executed loop through the filters and check their error condition and set the
-  // outline on the filter widget if there were errors or warnings
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SVPipelineViewWidget::showPreflightStates()
+{
+  qint32 count = filterCount();
   for(qint32 i = 0; i < count; ++i)
   {
     PipelineFilterObject* fw = filterObjectAt(i);
@@ -1034,13 +1193,6 @@ void SVPipelineViewWidget::preflightPipeline(QUuid id)
       }
     }
   }
-  emit preflightPipelineComplete();
-  emit preflightFinished(err);
-
-  if(m_DataStructureWidget)
-  {
-    m_DataStructureWidget->refreshData();
-  }
 }
 
 // -----------------------------------------------------------------------------
@@ -1172,7 +1324,7 @@ void SVPipelineViewWidget::removeFilterObject(PipelineFilterObject* filterObject
         // When the filter widget is dragged
         disconnect(filterWidget, SIGNAL(dragStarted(QMouseEvent*, SVPipelineFilterWidget*)), this, SLOT(startDrag(QMouseEvent*, SVPipelineFilterWidget*)));
 
-        disconnect(filterWidget, SIGNAL(parametersChanged(QUuid)), this, SLOT(preflightPipeline(QUuid)));
+        disconnect(filterWidget, SIGNAL(parametersChanged(QUuid)), this, SLOT(schedulePreflight(QUuid)));
 
         disconnect(filterWidget, SIGNAL(parametersChanged(QUuid)), this, SLOT(handleFilterParameterChanged(QUuid)));
 
@@ -1507,6 +1659,7 @@ FilterPipeline::Pointer SVPipelineViewWidget::readPipelineFromFile(const QString
   FilterPipeline::Pointer pipeline;
   if(ext == "dream3d")
   {
+    QMutexLocker locker(&BackgroundPreflight::HDF5Mutex());
     H5FilterParametersReader::Pointer dream3dReader = H5FilterParametersReader::New();
     pipeline = dream3dReader->readPipelineFromFile(filePath);
   }
@@ -1534,6 +1687,7 @@ QString SVPipelineViewWidget::getJsonFromFile(const QString& filePath)
   QString jsonString = "";
   if(ext == "dream3d")
   {
+    QMutexLocker locker(&BackgroundPreflight::HDF5Mutex());
     H5FilterParametersReader::Pointer dream3dReader = H5FilterParametersReader::New();
     jsonString = dream3dReader->getJsonFromFile(filePath);
   }
@@ -1570,7 +1724,8 @@ int SVPipelineViewWidget::writePipeline(QString filePath)
 
   int err = 0;
   if(ext == "dream3d")
-  {    
+  {
+    QMutexLocker locker(&BackgroundPreflight::HDF5Mutex());
     QList<IObserver*> observers;
     for (int i = 0; i < m_PipelineMessageObservers.size(); i++)
     {
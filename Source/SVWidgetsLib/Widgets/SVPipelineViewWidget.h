@@ -40,6 +40,7 @@
 #include <vector>
 #include <stack>
 
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QTimer>
 #include <QtWidgets/QLabel>
@@ -59,6 +60,7 @@
 #include "SVWidgetsLib/Widgets/PipelineView.h"
 #include "SVWidgetsLib/Widgets/SVPipelineFilterWidget.h"
 #include "SVWidgetsLib/Widgets/SVPipelineFilterOutlineWidget.h"
+#include "SVWidgetsLib/Widgets/util/BackgroundPreflight.h"
 
 #include "SVWidgetsLib/QtSupport/QtSFileDragMessageBox.h"
 
@@ -278,10 +280,19 @@ class SVWidgetsLib_EXPORT SVPipelineViewWidget : public QFrame, public PipelineV
     void setSelectedFilterObject(PipelineFilterObject* w, Qt::KeyboardModifiers modifiers) override;
 
     /**
-     * @brief preflightPipeline
+     * @brief preflightPipeline Preflights the pipeline right away on the GUI thread. Any scheduled or running
+     * background preflight is canceled since this one already sees the latest edits, and a running one is waited
+     * for so that the two never preflight at the same time
      */
     void preflightPipeline(QUuid id = QUuid()) override;
 
+    /**
+     * @brief schedulePreflight Starts a background preflight once the parameters have not changed for a short
+     * while. A background preflight that is still running is canceled and its results are dropped
+     * @param id
+     */
+    void schedulePreflight(QUuid id = QUuid());
+
     /**
     * @brief Open pipeline to a file
     */
@@ -384,6 +395,35 @@ class SVWidgetsLib_EXPORT SVPipelineViewWidget : public QFrame, public PipelineV
 
     void updateActionEnableFilter();
 
+    /**
+     * @brief getViewFilters Returns the filters of the filter widgets in pipeline order
+     * @return
+     */
+    FilterPipeline::FilterContainerType getViewFilters();
+
+    /**
+     * @brief cancelBackgroundPreflight Marks every background preflight started so far as stale and asks the
+     * running one to stop
+     */
+    void cancelBackgroundPreflight();
+
+    /**
+     * @brief waitForBackgroundPreflight Blocks until the worker thread is idle, so that a preflight on the GUI thread
+     * never runs at the same time as a background one. Other HDF5 access on the GUI thread takes
+     * BackgroundPreflight::HDF5Mutex() instead
+     */
+    void waitForBackgroundPreflight();
+
+    /**
+     * @brief resetPreflightStates Clears the preflight warnings and errors shown on the filter widgets
+     */
+    void resetPreflightStates();
+
+    /**
+     * @brief showPreflightStates Shows the warning and error conditions of the filters on their widgets
+     */
+    void showPreflightStates();
+
   protected slots:
     void startDrag(QMouseEvent* event, SVPipelineFilterWidget *fw);
 
@@ -429,6 +469,17 @@ class SVWidgetsLib_EXPORT SVPipelineViewWidget : public QFrame, public PipelineV
      */
     void actionRedo_triggered();
 
+    /**
+     * @brief startBackgroundPreflight Copies the pipeline and preflights the copy on a worker thread
+     */
+    void startBackgroundPreflight();
+
+    /**
+     * @brief backgroundPreflightFinished Publishes the results of the background preflight unless a newer edit
+     * has made them stale
+     */
+    void backgroundPreflightFinished();
+
   private:
     SVPipelineFilterWidget*                           m_ShiftStart = nullptr;
     QVBoxLayout*                                      m_FilterWidgetLayout = nullptr;
@@ -454,6 +505,11 @@ class SVWidgetsLib_EXPORT SVPipelineViewWidget : public QFrame, public PipelineV
     DataStructureWidget*                              m_DataStructureWidget = nullptr;
     bool                                              m_LoadingJson = false;
     QAction*                                          m_ActionEnableFilter = nullptr;
+    QTimer                                            m_PreflightTimer;
+    QFutureWatcher<int>                               m_PreflightWatcher;
+    BackgroundPreflight::Pointer                      m_BackgroundPreflight;
+    int                                               m_PreflightGeneration = 0;
+    bool                                              m_PreflightRestartPending = false;
 
     /**
      * @brief addFilterObject
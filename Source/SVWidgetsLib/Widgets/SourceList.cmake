@@ -104,12 +104,14 @@ set(SVWidgetsLib_Widgets_UIS
   )
 
 SET(SVWidgetsLib_Widgets_Util_HDRS
+  ${SVWidgetsLib_SOURCE_DIR}/Widgets/util/BackgroundPreflight.h
   ${SVWidgetsLib_SOURCE_DIR}/Widgets/util/MoveFilterCommand.h
   ${SVWidgetsLib_SOURCE_DIR}/Widgets/util/AddFilterCommand.h
   ${SVWidgetsLib_SOURCE_DIR}/Widgets/util/RemoveFilterCommand.h
 )
 
 SET(SVWidgetsLib_Widgets_Util_SRCS
+  ${SVWidgetsLib_SOURCE_DIR}/Widgets/util/BackgroundPreflight.cpp
   ${SVWidgetsLib_SOURCE_DIR}/Widgets/util/MoveFilterCommand.cpp
   ${SVWidgetsLib_SOURCE_DIR}/Widgets/util/AddFilterCommand.cpp
   ${SVWidgetsLib_SOURCE_DIR}/Widgets/util/RemoveFilterCommand.cpp
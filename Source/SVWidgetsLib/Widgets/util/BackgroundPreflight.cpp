@@ -0,0 +1,200 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "BackgroundPreflight.h"
+
+#include <QtCore/QMetaObject>
+#include <QtCore/QMutexLocker>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BackgroundPreflight::BackgroundPreflight(const FilterPipeline::FilterContainerType& filters, int generation)
+: m_Filters(filters)
+, m_Pipeline(FilterPipeline::New())
+, m_RenamedPaths(filters.size())
+, m_Generation(generation)
+, m_Canceled(false)
+{
+  m_Pipeline->setPreflightCancelFlag(&m_Canceled);
+  for(int i = 0; i < m_Filters.size(); i++)
+  {
+    AbstractFilter::Pointer filter = m_Filters[i];
+
+    // Have the widgets push their current values into the filter before it is copied
+    QMetaObject::invokeMethod(filter.get(), "updateFilterParameters", Qt::DirectConnection, Q_ARG(AbstractFilter*, filter.get()));
+
+    AbstractFilter::Pointer copy = filter->newFilterInstance(true);
+    copy->setEnabled(filter->getEnabled());
+    copy->setDataContainerArray(filter->getDataContainerArray()->deepCopy(false));
+
+    // The copy only emits from the worker thread and nothing but this object listens to it, so the
+    // recorded values are read on the GUI thread only after run() has returned
+    QObject::connect(copy.get(), &Observable::filterGeneratedMessage, [this](const PipelineMessage& msg) { m_Messages.push_back(msg); });
+    QObject::connect(copy.get(), &AbstractFilter::dataArrayPathUpdated, [this, i](QString propertyName, DataArrayPath::RenameType renamePath) {
+      Q_UNUSED(propertyName)
+      m_RenamedPaths[i].push_back(renamePath);
+    });
+    m_Pipeline->pushBack(copy);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BackgroundPreflight::~BackgroundPreflight() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BackgroundPreflight::Pointer BackgroundPreflight::New(const FilterPipeline::FilterContainerType& filters, int generation)
+{
+  return Pointer(new BackgroundPreflight(filters, generation));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BackgroundPreflight::getGeneration() const
+{
+  return m_Generation;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QMutex& BackgroundPreflight::HDF5Mutex()
+{
+  static QMutex mutex(QMutex::Recursive);
+  return mutex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BackgroundPreflight::run()
+{
+  if(m_Canceled)
+  {
+    return -1;
+  }
+  QMutexLocker locker(&HDF5Mutex());
+  // The GUI thread may have held the mutex for a while, and the edits it made meanwhile cancel this preflight
+  if(m_Canceled)
+  {
+    return -1;
+  }
+  return m_Pipeline->preflightPipeline();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BackgroundPreflight::cancel()
+{
+  m_Canceled = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BackgroundPreflight::wasCanceled() const
+{
+  return m_Canceled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BackgroundPreflight::matches(const FilterPipeline::FilterContainerType& filters) const
+{
+  if(filters.size() != m_Filters.size())
+  {
+    return false;
+  }
+  for(int i = 0; i < filters.size(); i++)
+  {
+    if(filters[i] != m_Filters[i] || filters[i]->getEnabled() != m_Pipeline->getFilterContainer()[i]->getEnabled())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BackgroundPreflight::publish(const QList<QObject*>& messageReceivers)
+{
+  FilterPipeline::FilterContainerType copies = m_Pipeline->getFilterContainer();
+
+  // Every filter sees the structure left by the filter in front of it, which is what the
+  // copy of that filter stored after its own preflight
+  DataContainerArray::Pointer inputDca = DataContainerArray::New();
+  for(int i = 0; i < m_Filters.size(); i++)
+  {
+    AbstractFilter::Pointer filter = m_Filters[i];
+    AbstractFilter::Pointer copy = copies[i];
+
+    filter->renameDataArrayPaths(m_RenamedPaths[i]);
+    if(filter->getEnabled())
+    {
+      filter->setDataContainerArray(inputDca);
+      QMetaObject::invokeMethod(filter.get(), "preflightAboutToExecute", Qt::DirectConnection);
+      filter->setDataContainerArray(copy->getDataContainerArray());
+      QMetaObject::invokeMethod(filter.get(), "preflightExecuted", Qt::DirectConnection);
+    }
+    else
+    {
+      filter->setDataContainerArray(copy->getDataContainerArray());
+    }
+    filter->setErrorCondition(copy->getErrorCondition());
+    filter->setWarningCondition(copy->getWarningCondition());
+    filter->setCancel(false);
+
+    inputDca = copy->getDataContainerArray();
+  }
+
+  for(int i = 0; i < m_Messages.size(); i++)
+  {
+    for(int j = 0; j < messageReceivers.size(); j++)
+    {
+      QMetaObject::invokeMethod(messageReceivers[j], "processPipelineMessage", Qt::DirectConnection, Q_ARG(PipelineMessage, m_Messages[i]));
+    }
+  }
+}
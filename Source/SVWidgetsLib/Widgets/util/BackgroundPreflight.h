@@ -0,0 +1,139 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _backgroundpreflight_h_
+#define _backgroundpreflight_h_
+
+#include <atomic>
+
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/PipelineMessage.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+#include "SVWidgetsLib/SVWidgetsLib.h"
+
+/**
+ * @brief The BackgroundPreflight class preflights a private copy of a pipeline on a worker thread. The copy is made
+ * on the GUI thread from the current filter parameters, so the worker never touches the filters that the widgets
+ * are bound to. The messages and renamed paths of the copy are recorded while it preflights and are handed to the
+ * original filters and their widgets in one step by publish(), which runs on the GUI thread.
+ */
+class SVWidgetsLib_EXPORT BackgroundPreflight
+{
+  public:
+    SIMPL_SHARED_POINTERS(BackgroundPreflight)
+
+    /**
+     * @brief New Copies the filters with their current parameters. Must be called on the GUI thread
+     * @param filters The filters of the pipeline view, in order
+     * @param generation Identifies the edit the preflight was started for
+     * @return
+     */
+    static Pointer New(const FilterPipeline::FilterContainerType& filters, int generation);
+
+    virtual ~BackgroundPreflight();
+
+    /**
+     * @brief getGeneration Returns the generation given to New()
+     * @return
+     */
+    int getGeneration() const;
+
+    /**
+     * @brief HDF5Mutex Serializes HDF5 access between background preflights and the GUI thread. HDF5 is not thread
+     * safe, so run() holds the mutex for the whole preflight and GUI code takes it around its own HDF5 calls. It is
+     * recursive, and nobody may wait for a background preflight while holding it
+     * @return
+     */
+    static QMutex& HDF5Mutex();
+
+    /**
+     * @brief run Preflights the copy while holding HDF5Mutex(). Called on the worker thread
+     * @return The error code of the preflight
+     */
+    int run();
+
+    /**
+     * @brief cancel Stops a running preflight after its current filter. Only sets the flag that the worker polls
+     * between filters, so the copies are never touched from the calling thread
+     */
+    void cancel();
+
+    /**
+     * @brief wasCanceled Returns true once cancel() has been called
+     * @return
+     */
+    bool wasCanceled() const;
+
+    /**
+     * @brief matches Returns true if the filters are still the ones the copy was made from
+     * @param filters
+     * @return
+     */
+    bool matches(const FilterPipeline::FilterContainerType& filters) const;
+
+    /**
+     * @brief publish Hands the results of a finished preflight to the original filters. Every filter gets the renamed
+     * paths, DataContainerArray, error and warning condition of its copy and its widgets run their before and after
+     * preflight slots, then the messages are sent to the receivers. Must be called on the GUI thread
+     * @param messageReceivers Objects with a processPipelineMessage(const PipelineMessage&) slot
+     */
+    void publish(const QList<QObject*>& messageReceivers);
+
+  protected:
+    BackgroundPreflight(const FilterPipeline::FilterContainerType& filters, int generation);
+
+  private:
+    FilterPipeline::FilterContainerType m_Filters;
+    FilterPipeline::Pointer m_Pipeline;
+    QVector<DataArrayPath::RenameContainer> m_RenamedPaths;
+    QVector<PipelineMessage> m_Messages;
+    int m_Generation;
+    std::atomic<bool> m_Canceled;
+
+  public:
+    BackgroundPreflight(const BackgroundPreflight&) = delete; // Copy Constructor Not Implemented
+    BackgroundPreflight(BackgroundPreflight&&) = delete;      // Move Constructor
+    BackgroundPreflight& operator=(const BackgroundPreflight&) = delete; // Copy Assignment Not Implemented
+    BackgroundPreflight& operator=(BackgroundPreflight&&) = delete;      // Move Assignment
+};
+
+#endif /* _backgroundpreflight_h_ */